@@ -0,0 +1,3862 @@
+# 1 "data/battle_ai_scripts.s"
+#include "constants/battle.h"
+#include "constants/battle_ai.h"
+#include "constants/abilities.h"
+#include "constants/items.h"
+#include "constants/moves.h"
+#include "constants/battle_move_effects.h"
+#include "constants/hold_effects.h"
+#include "constants/pokemon.h"
+# 1 "asm/macros/battle_ai_script.inc"
+	.macro if_random_less_than percent:req, ptr:req
+	.byte 0x00
+	.byte \percent
+	.4byte \ptr
+	.endm
+
+	        
+	.macro if_random_greater_than percent:req, ptr:req
+	.byte 0x01
+	.byte \percent
+	.4byte \ptr
+	.endm
+
+	        
+	.macro if_random_equal ptr:req
+	.byte 0x02
+	.4byte \ptr
+	.endm
+
+	        
+	.macro if_random_not_equal ptr:req
+	.byte 0x03
+	.4byte \ptr
+	.endm
+
+	.macro score score:req
+	.byte 0x04
+	.byte \score
+	.endm
+
+	.macro if_hp_less_than battler:req, percent:req, ptr:req
+	.byte 0x05
+	.byte \battler
+	.byte \percent
+	.4byte \ptr
+	.endm
+
+	.macro if_hp_more_than battler:req, percent:req, ptr:req
+	.byte 0x06
+	.byte \battler
+	.byte \percent
+	.4byte \ptr
+	.endm
+
+	.macro if_hp_equal battler:req, percent:req, ptr:req
+	.byte 0x07
+	.byte \battler
+	.byte \percent
+	.4byte \ptr
+	.endm
+
+	.macro if_hp_not_equal battler:req, percent:req, ptr:req
+	.byte 0x08
+	.byte \battler
+	.byte \percent
+	.4byte \ptr
+	.endm
+
+	.macro if_status battler:req, status:req, ptr:req
+	.byte 0x09
+	.byte \battler
+	.4byte \status
+	.4byte \ptr
+	.endm
+
+	.macro if_not_status battler:req, status:req, ptr:req
+	.byte 0x0a
+	.byte \battler
+	.4byte \status
+	.4byte \ptr
+	.endm
+
+	.macro if_status2 battler:req, status:req, ptr:req
+	.byte 0x0b
+	.byte \battler
+	.4byte \status
+	.4byte \ptr
+	.endm
+
+	.macro if_not_status2 battler:req, status:req, ptr:req
+	.byte 0x0c
+	.byte \battler
+	.4byte \status
+	.4byte \ptr
+	.endm
+
+	.macro if_status3 battler:req, status:req, ptr:req
+	.byte 0x0d
+	.byte \battler
+	.4byte \status
+	.4byte \ptr
+	.endm
+
+	.macro if_not_status3 battler:req, status:req, ptr:req
+	.byte 0x0e
+	.byte \battler
+	.4byte \status
+	.4byte \ptr
+	.endm
+
+	.macro if_side_affecting battler:req, status:req, ptr:req
+	.byte 0x0f
+	.byte \battler
+	.4byte \status
+	.4byte \ptr
+	.endm
+
+	.macro if_not_side_affecting battler:req, status:req, ptr:req
+	.byte 0x10
+	.byte \battler
+	.4byte \status
+	.4byte \ptr
+	.endm
+
+	.macro if_less_than value:req, ptr:req
+	.byte 0x11
+	.byte \value
+	.4byte \ptr
+	.endm
+
+	.macro if_more_than value:req, ptr:req
+	.byte 0x12
+	.byte \value
+	.4byte \ptr
+	.endm
+
+	.macro if_equal value:req, ptr:req
+	.byte 0x13
+	.byte \value
+	.4byte \ptr
+	.endm
+
+	.macro if_not_equal value:req, ptr:req
+	.byte 0x14
+	.byte \value
+	.4byte \ptr
+	.endm
+
+	.macro if_less_than_ptr value:req, ptr:req
+	.byte 0x15
+	.4byte \value
+	.4byte \ptr
+	.endm
+
+	.macro if_more_than_ptr value:req, ptr:req
+	.byte 0x16
+	.4byte \value
+	.4byte \ptr
+	.endm
+
+	.macro if_equal_ptr value:req, ptr:req
+	.byte 0x17
+	.4byte \value
+	.4byte \ptr
+	.endm
+
+	.macro if_not_equal_ptr value:req, ptr:req
+	.byte 0x18
+	.4byte \value
+	.4byte \ptr
+	.endm
+
+	.macro if_move move:req, ptr:req
+	.byte 0x19
+	.2byte \move
+	.4byte \ptr
+	.endm
+
+	.macro if_not_move move:req, ptr:req
+	.byte 0x1a
+	.2byte \move
+	.4byte \ptr
+	.endm
+
+	.macro if_in_bytes list:req, ptr:req
+	.byte 0x1b
+	.4byte \list
+	.4byte \ptr
+	.endm
+
+	.macro if_not_in_bytes list:req, ptr:req
+	.byte 0x1c
+	.4byte \list
+	.4byte \ptr
+	.endm
+
+	.macro if_in_hwords list:req, ptr:req
+	.byte 0x1d
+	.4byte \list
+	.4byte \ptr
+	.endm
+
+	.macro if_not_in_hwords list:req, ptr:req
+	.byte 0x1e
+	.4byte \list
+	.4byte \ptr
+	.endm
+
+	.macro if_user_has_attacking_move ptr:req
+	.byte 0x1f
+	.4byte \ptr
+	.endm
+
+	.macro if_user_has_no_attacking_moves ptr:req
+	.byte 0x20
+	.4byte \ptr
+	.endm
+
+	.macro get_turn_count
+	.byte 0x21
+	.endm
+
+	.macro get_type byte:req
+	.byte 0x22
+	.byte \byte
+	.endm
+
+	        
+	.macro get_considered_move_power
+	.byte 0x23
+	.endm
+
+	.macro get_how_powerful_move_is
+	.byte 0x24
+	.endm
+
+	.macro get_last_used_move battler:req
+	.byte 0x25
+	.byte \battler
+	.endm
+
+	.macro if_equal_ type:req, ptr:req
+	.byte 0x26
+	.byte \type
+	.4byte \ptr
+	.endm
+
+	        
+	.macro if_not_equal_ type:req, ptr:req
+	.byte 0x27
+	.byte \type
+	.4byte \ptr
+	.endm
+
+	.macro if_would_go_first battler:req, ptr:req
+	.byte 0x28
+	.byte \battler
+	.4byte \ptr
+	.endm
+
+	.macro if_would_not_go_first battler:req, ptr:req
+	.byte 0x29
+	.byte \battler
+	.4byte \ptr
+	.endm
+
+	         
+	.macro ai_2a
+	.byte 0x2a
+	.endm
+
+	         
+	.macro ai_2b
+	.byte 0x2b
+	.endm
+
+	.macro count_alive_pokemon battler:req
+	.byte 0x2c
+	.byte \battler
+	.endm
+
+	        
+	.macro get_considered_move
+	.byte 0x2d
+	.endm
+
+	.macro get_considered_move_effect
+	.byte 0x2e
+	.endm
+
+	.macro get_ability battler:req
+	.byte 0x2f
+	.byte \battler
+	.endm
+
+	        
+	.macro get_highest_type_effectiveness
+	.byte 0x30
+	.endm
+
+	.macro if_type_effectiveness effectiveness:req, ptr:req
+	.byte 0x31
+	.byte \effectiveness
+	.4byte \ptr
+	.endm
+
+	         
+	.macro ai_32
+	.byte 0x32
+	.endm
+
+	         
+	.macro ai_33
+	.byte 0x33
+	.endm
+
+	.macro if_status_in_party battler:req, status:req, ptr:req
+	.byte 0x34
+	.byte \battler
+	.4byte \status
+	.4byte \ptr
+	.endm
+
+	        
+	.macro if_status_not_in_party battler:req, status:req, ptr:req
+	.byte 0x35
+	.byte \battler
+	.4byte \status
+	.4byte \ptr
+	.endm
+
+	.macro get_weather
+	.byte 0x36
+	.endm
+
+	.macro if_effect byte:req, ptr:req
+	.byte 0x37
+	.byte \byte
+	.4byte \ptr
+	.endm
+
+	.macro if_not_effect byte:req, ptr:req
+	.byte 0x38
+	.byte \byte
+	.4byte \ptr
+	.endm
+
+	.macro if_stat_level_less_than battler:req, stat:req, level:req, ptr:req
+	.byte 0x39
+	.byte \battler
+	.byte \stat
+	.byte \level
+	.4byte \ptr
+	.endm
+
+	.macro if_stat_level_more_than battler:req, stat:req, level:req, ptr:req
+	.byte 0x3a
+	.byte \battler
+	.byte \stat
+	.byte \level
+	.4byte \ptr
+	.endm
+
+	.macro if_stat_level_equal battler:req, stat:req, level:req, ptr:req
+	.byte 0x3b
+	.byte \battler
+	.byte \stat
+	.byte \level
+	.4byte \ptr
+	.endm
+
+	.macro if_stat_level_not_equal battler:req, stat:req, level:req, ptr:req
+	.byte 0x3c
+	.byte \battler
+	.byte \stat
+	.byte \level
+	.4byte \ptr
+	.endm
+
+	.macro if_can_faint ptr:req
+	.byte 0x3d
+	.4byte \ptr
+	.endm
+
+	.macro if_cant_faint ptr:req
+	.byte 0x3e
+	.4byte \ptr
+	.endm
+
+	        
+	.macro if_has_move battler:req, move:req, ptr:req
+	.byte 0x3f
+	.byte \battler
+	.2byte \move
+	.4byte \ptr
+	.endm
+
+	        
+	.macro if_doesnt_have_move battler:req, move:req, ptr:req
+	.byte 0x40
+	.byte \battler
+	.2byte \move
+	.4byte \ptr
+	.endm
+
+	.macro if_has_move_with_effect battler:req, effect:req, ptr:req
+	.byte 0x41
+	.byte \battler
+	.byte \effect
+	.4byte \ptr
+	.endm
+
+	.macro if_doesnt_have_move_with_effect battler:req, effect:req, ptr:req
+	.byte 0x42
+	.byte \battler
+	.byte \effect
+	.4byte \ptr
+	.endm
+
+	.macro if_any_move_disabled_or_encored battler:req, byte:req, ptr:req
+	.byte 0x43
+	.byte \battler
+	.byte \byte
+	.4byte \ptr
+	.endm
+
+	.macro if_curr_move_disabled_or_encored battler:req, ptr:req
+	.byte 0x44
+	.byte \battler
+	.4byte \ptr
+	.endm
+
+	.macro flee
+	.byte 0x45
+	.endm
+
+	.macro if_random_safari_flee ptr:req
+	.byte 0x46
+	.4byte \ptr
+	.endm
+
+	.macro watch
+	.byte 0x47
+	.endm
+
+	.macro get_hold_effect battler:req
+	.byte 0x48
+	.byte \battler
+	.endm
+
+	.macro get_gender battler:req
+	.byte 0x49
+	.byte \battler
+	.endm
+
+	.macro is_first_turn_for battler:req
+	.byte 0x4a
+	.byte \battler
+	.endm
+
+	.macro get_stockpile_count battler:req
+	.byte 0x4b
+	.byte \battler
+	.endm
+
+	.macro is_double_battle
+	.byte 0x4c
+	.endm
+
+	.macro get_used_held_item battler:req
+	.byte 0x4d
+	.byte \battler
+	.endm
+
+	.macro get_move_type_from_result
+	.byte 0x4e
+	.endm
+
+	.macro get_move_power_from_result
+	.byte 0x4f
+	.endm
+
+	.macro get_move_effect_from_result
+	.byte 0x50
+	.endm
+
+	.macro get_protect_count battler:req
+	.byte 0x51
+	.byte \battler
+	.endm
+
+	         
+	.macro ai_52
+	.byte 0x52
+	.endm
+
+	         
+	.macro ai_53
+	.byte 0x53
+	.endm
+
+	         
+	.macro ai_54
+	.byte 0x54
+	.endm
+
+	         
+	.macro ai_55
+	.byte 0x55
+	.endm
+
+	         
+	.macro ai_56
+	.byte 0x56
+	.endm
+
+	         
+	.macro ai_57
+	.byte 0x57
+	.endm
+
+	        
+	.macro call ptr:req
+	.byte 0x58
+	.4byte \ptr
+	.endm
+
+	.macro goto ptr:req
+	.byte 0x59
+	.4byte \ptr
+	.endm
+
+	.macro end
+	.byte 0x5a
+	.endm
+
+	.macro if_level_cond cond:req, ptr:req
+	.byte 0x5b
+	.byte \cond
+	.4byte \ptr
+	.endm
+
+	.macro if_user_higher_level ptr:req
+	if_level_cond 0, \ptr
+	.endm
+
+	.macro if_target_higher_level ptr:req
+	if_level_cond 1, \ptr
+	.endm
+
+	.macro if_equal_levels ptr:req
+	if_level_cond 2, \ptr
+	.endm
+
+	        
+	.macro if_target_taunted ptr:req
+	.byte 0x5c
+	.4byte \ptr
+	.endm
+
+	.macro if_target_not_taunted ptr:req
+	.byte 0x5d
+	.4byte \ptr
+	.endm
+
+                      
+	.macro get_curr_move_type
+	get_type AI_TYPE_MOVE
+	.endm
+	
+	.macro get_user_type1
+	get_type AI_TYPE1_USER
+	.endm
+	
+	.macro get_user_type2
+	get_type AI_TYPE2_USER
+	.endm
+	
+	.macro get_target_type1
+	get_type AI_TYPE1_TARGET
+	.endm
+	
+	.macro get_target_type2
+	get_type AI_TYPE2_TARGET
+	.endm
+
+	.macro if_target_faster ptr:req
+	if_would_go_first 1, \ptr
+	.endm
+	
+	.macro if_user_faster ptr:req
+	if_would_go_first 0, \ptr
+	.endm
+
+	.macro if_double_battle ptr:req
+	is_double_battle
+	if_equal 1, \ptr
+	.endm
+	
+	.macro if_not_double_battle ptr:req
+	is_double_battle
+	if_equal 0, \ptr
+	.endm
+
+	.macro if_any_move_disabled battler:req, ptr:req
+	if_any_move_disabled_or_encored \battler, 0, \ptr
+	.endm
+	
+	.macro if_any_move_encored battler:req, ptr:req
+	if_any_move_disabled_or_encored \battler, 1, \ptr
+	.endm
+# 10 "data/battle_ai_scripts.s"
+
+	.section script_data, "aw", %progbits
+
+                                                                 
+                                                                                                      
+                                                                                                              
+
+	.align 2
+gBattleAI_ScriptsTable: ; .global gBattleAI_ScriptsTable
+	.4byte AI_CheckBadMove
+	.4byte AI_CheckViability
+	.4byte AI_TryToFaint
+	.4byte AI_SetupFirstTurn
+	.4byte AI_Risky
+	.4byte AI_PreferStrongestMove
+	.4byte AI_PreferBatonPass
+	.4byte AI_DoubleBattle
+	.4byte AI_HPAware
+	.4byte AI_Unknown
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Ret
+	.4byte AI_Roaming
+	.4byte AI_Safari
+	.4byte AI_FirstBattle
+
+AI_CheckBadMove: ; .global AI_CheckBadMove
+                                                                           
+                                                    
+	get_how_powerful_move_is
+	if_equal MOVE_POWER_DISCOURAGED, AI_CheckBadMove_CheckSoundproof
+
+AI_CBM_CheckIfNegatesType: ; .global AI_CBM_CheckIfNegatesType
+	if_type_effectiveness AI_EFFECTIVENESS_x0, Score_Minus10
+	get_ability AI_TARGET
+	if_equal ABILITY_VOLT_ABSORB, CheckIfVoltAbsorbCancelsElectric
+	if_equal ABILITY_WATER_ABSORB, CheckIfWaterAbsorbCancelsWater
+	if_equal ABILITY_FLASH_FIRE, CheckIfFlashFireCancelsFire
+	if_equal ABILITY_WONDER_GUARD, CheckIfWonderGuardCancelsMove
+	if_equal ABILITY_LEVITATE, CheckIfLevitateCancelsGroundMove
+	goto AI_CheckBadMove_CheckSoundproof
+
+CheckIfVoltAbsorbCancelsElectric: ; .global CheckIfVoltAbsorbCancelsElectric
+	get_curr_move_type
+	if_equal_ TYPE_ELECTRIC, Score_Minus12
+	goto AI_CheckBadMove_CheckSoundproof
+
+CheckIfWaterAbsorbCancelsWater: ; .global CheckIfWaterAbsorbCancelsWater
+	get_curr_move_type
+	if_equal_ TYPE_WATER, Score_Minus12
+	goto AI_CheckBadMove_CheckSoundproof
+
+CheckIfFlashFireCancelsFire: ; .global CheckIfFlashFireCancelsFire
+	get_curr_move_type
+	if_equal_ TYPE_FIRE, Score_Minus12
+	goto AI_CheckBadMove_CheckSoundproof
+
+CheckIfWonderGuardCancelsMove: ; .global CheckIfWonderGuardCancelsMove
+	if_type_effectiveness AI_EFFECTIVENESS_x2, AI_CheckBadMove_CheckSoundproof
+	goto Score_Minus10
+
+CheckIfLevitateCancelsGroundMove: ; .global CheckIfLevitateCancelsGroundMove
+	get_curr_move_type
+	if_equal_ TYPE_GROUND, Score_Minus10
+
+AI_CheckBadMove_CheckSoundproof: ; .global AI_CheckBadMove_CheckSoundproof
+	get_ability AI_TARGET
+	if_not_equal ABILITY_SOUNDPROOF, AI_CheckBadMove_CheckEffect
+	if_move MOVE_GROWL, Score_Minus10
+	if_move MOVE_ROAR, Score_Minus10
+	if_move MOVE_SING, Score_Minus10
+	if_move MOVE_SUPERSONIC, Score_Minus10
+	if_move MOVE_SCREECH, Score_Minus10
+	if_move MOVE_SNORE, Score_Minus10
+	if_move MOVE_UPROAR, Score_Minus10
+	if_move MOVE_METAL_SOUND, Score_Minus10
+	if_move MOVE_GRASS_WHISTLE, Score_Minus10
+
+AI_CheckBadMove_CheckEffect: ; .global AI_CheckBadMove_CheckEffect
+	if_effect EFFECT_SLEEP, AI_CBM_Sleep
+	if_effect EFFECT_EXPLOSION, AI_CBM_Explosion
+	if_effect EFFECT_DREAM_EATER, AI_CBM_DreamEater
+	if_effect EFFECT_ATTACK_UP, AI_CBM_AttackUp
+	if_effect EFFECT_DEFENSE_UP, AI_CBM_DefenseUp
+	if_effect EFFECT_SPEED_UP, AI_CBM_SpeedUp
+	if_effect EFFECT_SPECIAL_ATTACK_UP, AI_CBM_SpAtkUp
+	if_effect EFFECT_SPECIAL_DEFENSE_UP, AI_CBM_SpDefUp
+	if_effect EFFECT_ACCURACY_UP, AI_CBM_AccUp
+	if_effect EFFECT_EVASION_UP, AI_CBM_EvasionUp
+	if_effect EFFECT_ATTACK_DOWN, AI_CBM_AttackDown
+	if_effect EFFECT_DEFENSE_DOWN, AI_CBM_DefenseDown
+	if_effect EFFECT_SPEED_DOWN, AI_CBM_SpeedDown
+	if_effect EFFECT_SPECIAL_ATTACK_DOWN, AI_CBM_SpAtkDown
+	if_effect EFFECT_SPECIAL_DEFENSE_DOWN, AI_CBM_SpDefDown
+	if_effect EFFECT_ACCURACY_DOWN, AI_CBM_AccDown
+	if_effect EFFECT_EVASION_DOWN, AI_CBM_EvasionDown
+	if_effect EFFECT_HAZE, AI_CBM_Haze
+	if_effect EFFECT_BIDE, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_ROAR, AI_CBM_Roar
+	if_effect EFFECT_TOXIC, AI_CBM_Poison
+	if_effect EFFECT_LIGHT_SCREEN, AI_CBM_LightScreen
+	if_effect EFFECT_OHKO, AI_CBM_OneHitKO
+	if_effect EFFECT_RAZOR_WIND, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_SUPER_FANG, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_MIST, AI_CBM_Mist
+	if_effect EFFECT_FOCUS_ENERGY, AI_CBM_FocusEnergy
+	if_effect EFFECT_CONFUSE, AI_CBM_Confuse
+	if_effect EFFECT_ATTACK_UP_2, AI_CBM_AttackUp
+	if_effect EFFECT_DEFENSE_UP_2, AI_CBM_DefenseUp
+	if_effect EFFECT_SPEED_UP_2, AI_CBM_SpeedUp
+	if_effect EFFECT_SPECIAL_ATTACK_UP_2, AI_CBM_SpAtkUp
+	if_effect EFFECT_SPECIAL_DEFENSE_UP_2, AI_CBM_SpDefUp
+	if_effect EFFECT_ACCURACY_UP_2, AI_CBM_AccUp
+	if_effect EFFECT_EVASION_UP_2, AI_CBM_EvasionUp
+	if_effect EFFECT_ATTACK_DOWN_2, AI_CBM_AttackDown
+	if_effect EFFECT_DEFENSE_DOWN_2, AI_CBM_DefenseDown
+	if_effect EFFECT_SPEED_DOWN_2, AI_CBM_SpeedDown
+	if_effect EFFECT_SPECIAL_ATTACK_DOWN_2, AI_CBM_SpAtkDown
+	if_effect EFFECT_SPECIAL_DEFENSE_DOWN_2, AI_CBM_SpDefDown
+	if_effect EFFECT_ACCURACY_DOWN_2, AI_CBM_AccDown
+	if_effect EFFECT_EVASION_DOWN_2, AI_CBM_EvasionDown
+	if_effect EFFECT_REFLECT, AI_CBM_Reflect
+	if_effect EFFECT_POISON, AI_CBM_Poison
+	if_effect EFFECT_PARALYZE, AI_CBM_Paralyze
+	if_effect EFFECT_SUBSTITUTE, AI_CBM_Substitute
+	if_effect EFFECT_RECHARGE, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_LEECH_SEED, AI_CBM_LeechSeed
+	if_effect EFFECT_DISABLE, AI_CBM_Disable
+	if_effect EFFECT_LEVEL_DAMAGE, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_PSYWAVE, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_COUNTER, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_ENCORE, AI_CBM_Encore
+	if_effect EFFECT_SNORE, AI_CBM_DamageDuringSleep
+	if_effect EFFECT_SLEEP_TALK, AI_CBM_DamageDuringSleep
+	if_effect EFFECT_FLAIL, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_MEAN_LOOK, AI_CBM_CantEscape
+	if_effect EFFECT_NIGHTMARE, AI_CBM_Nightmare
+	if_effect EFFECT_MINIMIZE, AI_CBM_EvasionUp
+	if_effect EFFECT_CURSE, AI_CBM_Curse
+	if_effect EFFECT_SPIKES, AI_CBM_Spikes
+	if_effect EFFECT_FORESIGHT, AI_CBM_Foresight
+	if_effect EFFECT_PERISH_SONG, AI_CBM_PerishSong
+	if_effect EFFECT_SANDSTORM, AI_CBM_Sandstorm
+	if_effect EFFECT_SWAGGER, AI_CBM_Confuse
+	if_effect EFFECT_ATTRACT, AI_CBM_Attract
+	if_effect EFFECT_RETURN, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_PRESENT, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_FRUSTRATION, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_SAFEGUARD, AI_CBM_Safeguard
+	if_effect EFFECT_MAGNITUDE, AI_CBM_Magnitude
+	if_effect EFFECT_BATON_PASS, AI_CBM_BatonPass
+	if_effect EFFECT_SONICBOOM, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_RAIN_DANCE, AI_CBM_RainDance
+	if_effect EFFECT_SUNNY_DAY, AI_CBM_SunnyDay
+	if_effect EFFECT_BELLY_DRUM, AI_CBM_BellyDrum
+	if_effect EFFECT_PSYCH_UP, AI_CBM_Haze
+	if_effect EFFECT_MIRROR_COAT, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_SKULL_BASH, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_FUTURE_SIGHT, AI_CBM_FutureSight
+	if_effect EFFECT_TELEPORT, Score_Minus10
+	if_effect EFFECT_DEFENSE_CURL, AI_CBM_DefenseUp
+	if_effect EFFECT_FAKE_OUT, AI_CBM_FakeOut
+	if_effect EFFECT_STOCKPILE, AI_CBM_Stockpile
+	if_effect EFFECT_SPIT_UP, AI_CBM_SpitUpAndSwallow
+	if_effect EFFECT_SWALLOW, AI_CBM_SpitUpAndSwallow
+	if_effect EFFECT_HAIL, AI_CBM_Hail
+	if_effect EFFECT_TORMENT, AI_CBM_Torment
+	if_effect EFFECT_FLATTER, AI_CBM_Confuse
+	if_effect EFFECT_WILL_O_WISP, AI_CBM_WillOWisp
+	if_effect EFFECT_MEMENTO, AI_CBM_Memento
+	if_effect EFFECT_FOCUS_PUNCH, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_HELPING_HAND, AI_CBM_HelpingHand
+	if_effect EFFECT_TRICK, AI_CBM_TrickAndKnockOff
+	if_effect EFFECT_INGRAIN, AI_CBM_Ingrain
+	if_effect EFFECT_SUPERPOWER, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_RECYCLE, AI_CBM_Recycle
+	if_effect EFFECT_KNOCK_OFF, AI_CBM_TrickAndKnockOff
+	if_effect EFFECT_ENDEAVOR, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_IMPRISON, AI_CBM_Imprison
+	if_effect EFFECT_REFRESH, AI_CBM_Refresh
+	if_effect EFFECT_LOW_KICK, AI_CBM_HighRiskForDamage
+	if_effect EFFECT_MUD_SPORT, AI_CBM_MudSport
+	if_effect EFFECT_TICKLE, AI_CBM_Tickle
+	if_effect EFFECT_COSMIC_POWER, AI_CBM_CosmicPower
+	if_effect EFFECT_BULK_UP, AI_CBM_BulkUp
+	if_effect EFFECT_WATER_SPORT, AI_CBM_WaterSport
+	if_effect EFFECT_CALM_MIND, AI_CBM_CalmMind
+	if_effect EFFECT_DRAGON_DANCE, AI_CBM_DragonDance
+	end
+
+AI_CBM_Sleep: ; .global AI_CBM_Sleep
+	get_ability AI_TARGET
+	if_equal ABILITY_INSOMNIA, Score_Minus10
+	if_equal ABILITY_VITAL_SPIRIT, Score_Minus10
+	if_status AI_TARGET, STATUS1_ANY, Score_Minus10
+                                                                                             
+	end
+
+AI_CBM_Explosion: ; .global AI_CBM_Explosion
+	if_type_effectiveness AI_EFFECTIVENESS_x0, Score_Minus10
+	get_ability AI_TARGET
+	if_equal ABILITY_DAMP, Score_Minus10
+	count_alive_pokemon AI_USER
+	if_not_equal 0, AI_CBM_Explosion_End
+	count_alive_pokemon AI_TARGET
+	if_not_equal 0, Score_Minus10
+	goto Score_Minus1
+
+AI_CBM_Explosion_End: ; .global AI_CBM_Explosion_End
+	end
+
+AI_CBM_Nightmare: ; .global AI_CBM_Nightmare
+	if_status2 AI_TARGET, STATUS2_NIGHTMARE, Score_Minus10
+	if_not_status AI_TARGET, STATUS1_SLEEP, Score_Minus8
+	end
+
+AI_CBM_DreamEater: ; .global AI_CBM_DreamEater
+	if_not_status AI_TARGET, STATUS1_SLEEP, Score_Minus8
+	if_type_effectiveness AI_EFFECTIVENESS_x0, Score_Minus10
+	end
+
+AI_CBM_BellyDrum: ; .global AI_CBM_BellyDrum
+	if_hp_less_than AI_USER, 51, Score_Minus10
+
+AI_CBM_AttackUp: ; .global AI_CBM_AttackUp
+	if_stat_level_equal AI_USER, STAT_ATK, 12, Score_Minus10
+	end
+
+AI_CBM_DefenseUp: ; .global AI_CBM_DefenseUp
+	if_stat_level_equal AI_USER, STAT_DEF, 12, Score_Minus10
+	end
+
+AI_CBM_SpeedUp: ; .global AI_CBM_SpeedUp
+	if_stat_level_equal AI_USER, STAT_SPEED, 12, Score_Minus10
+	end
+
+AI_CBM_SpAtkUp: ; .global AI_CBM_SpAtkUp
+	if_stat_level_equal AI_USER, STAT_SPATK, 12, Score_Minus10
+	end
+
+AI_CBM_SpDefUp: ; .global AI_CBM_SpDefUp
+	if_stat_level_equal AI_USER, STAT_SPDEF, 12, Score_Minus10
+	end
+
+AI_CBM_AccUp: ; .global AI_CBM_AccUp
+	if_stat_level_equal AI_USER, STAT_ACC, 12, Score_Minus10
+	end
+
+AI_CBM_EvasionUp: ; .global AI_CBM_EvasionUp
+	if_stat_level_equal AI_USER, STAT_EVASION, 12, Score_Minus10
+	end
+
+AI_CBM_AttackDown: ; .global AI_CBM_AttackDown
+	if_stat_level_equal AI_TARGET, STAT_ATK, 0, Score_Minus10
+	get_ability AI_TARGET
+	if_equal ABILITY_HYPER_CUTTER, Score_Minus10
+	goto CheckIfAbilityBlocksStatChange
+
+AI_CBM_DefenseDown: ; .global AI_CBM_DefenseDown
+	if_stat_level_equal AI_TARGET, STAT_DEF, 0, Score_Minus10
+	goto CheckIfAbilityBlocksStatChange
+
+AI_CBM_SpeedDown: ; .global AI_CBM_SpeedDown
+	if_stat_level_equal AI_TARGET, STAT_SPEED, 0, Score_Minus10
+                                                 
+                                             
+	goto CheckIfAbilityBlocksStatChange
+
+AI_CBM_SpAtkDown: ; .global AI_CBM_SpAtkDown
+	if_stat_level_equal AI_TARGET, STAT_SPATK, 0, Score_Minus10
+	goto CheckIfAbilityBlocksStatChange
+
+AI_CBM_SpDefDown: ; .global AI_CBM_SpDefDown
+	if_stat_level_equal AI_TARGET, STAT_SPDEF, 0, Score_Minus10
+	goto CheckIfAbilityBlocksStatChange
+
+AI_CBM_AccDown: ; .global AI_CBM_AccDown
+	if_stat_level_equal AI_TARGET, STAT_ACC, 0, Score_Minus10
+	get_ability AI_TARGET
+	if_equal ABILITY_KEEN_EYE, Score_Minus10
+	goto CheckIfAbilityBlocksStatChange
+
+AI_CBM_EvasionDown: ; .global AI_CBM_EvasionDown
+	if_stat_level_equal AI_TARGET, STAT_EVASION, 0, Score_Minus10
+
+CheckIfAbilityBlocksStatChange: ; .global CheckIfAbilityBlocksStatChange
+	get_ability AI_TARGET
+	if_equal ABILITY_CLEAR_BODY, Score_Minus10
+	if_equal ABILITY_WHITE_SMOKE, Score_Minus10
+	end
+
+AI_CBM_Haze: ; .global AI_CBM_Haze
+	if_stat_level_less_than AI_USER, STAT_ATK, 6, AI_CBM_Haze_End
+	if_stat_level_less_than AI_USER, STAT_DEF, 6, AI_CBM_Haze_End
+	if_stat_level_less_than AI_USER, STAT_SPEED, 6, AI_CBM_Haze_End
+	if_stat_level_less_than AI_USER, STAT_SPATK, 6, AI_CBM_Haze_End
+	if_stat_level_less_than AI_USER, STAT_SPDEF, 6, AI_CBM_Haze_End
+	if_stat_level_less_than AI_USER, STAT_ACC, 6, AI_CBM_Haze_End
+	if_stat_level_less_than AI_USER, STAT_EVASION, 6, AI_CBM_Haze_End
+	if_stat_level_more_than AI_TARGET, STAT_ATK, 6, AI_CBM_Haze_End
+	if_stat_level_more_than AI_TARGET, STAT_DEF, 6, AI_CBM_Haze_End
+	if_stat_level_more_than AI_TARGET, STAT_SPEED, 6, AI_CBM_Haze_End
+	if_stat_level_more_than AI_TARGET, STAT_SPATK, 6, AI_CBM_Haze_End
+	if_stat_level_more_than AI_TARGET, STAT_SPDEF, 6, AI_CBM_Haze_End
+	if_stat_level_more_than AI_TARGET, STAT_ACC, 6, AI_CBM_Haze_End
+	if_stat_level_more_than AI_TARGET, STAT_EVASION, 6, AI_CBM_Haze_End
+	goto Score_Minus10
+
+AI_CBM_Haze_End: ; .global AI_CBM_Haze_End
+	end
+
+AI_CBM_Roar: ; .global AI_CBM_Roar
+	count_alive_pokemon AI_TARGET
+	if_equal 0, Score_Minus10
+	get_ability AI_TARGET
+	if_equal ABILITY_SUCTION_CUPS, Score_Minus10
+	end
+
+AI_CBM_Poison: ; .global AI_CBM_Poison
+	get_target_type1
+	if_equal TYPE_STEEL, Score_Minus10
+	if_equal TYPE_POISON, Score_Minus10
+	get_target_type2
+	if_equal TYPE_STEEL, Score_Minus10
+	if_equal TYPE_POISON, Score_Minus10
+	get_ability AI_TARGET
+	if_equal ABILITY_IMMUNITY, Score_Minus10
+	if_status AI_TARGET, STATUS1_ANY, Score_Minus10
+                                                                                             
+	end
+
+AI_CBM_LightScreen: ; .global AI_CBM_LightScreen
+	if_side_affecting AI_USER, SIDE_STATUS_LIGHTSCREEN, Score_Minus8
+	end
+
+AI_CBM_OneHitKO: ; .global AI_CBM_OneHitKO
+	if_type_effectiveness AI_EFFECTIVENESS_x0, Score_Minus10
+	get_ability AI_TARGET
+	if_equal ABILITY_STURDY, Score_Minus10
+	if_level_cond 1, Score_Minus10
+	end
+
+AI_CBM_Magnitude: ; .global AI_CBM_Magnitude
+	get_ability AI_TARGET
+	if_equal ABILITY_LEVITATE, Score_Minus10
+
+AI_CBM_HighRiskForDamage: ; .global AI_CBM_HighRiskForDamage
+	if_type_effectiveness AI_EFFECTIVENESS_x0, Score_Minus10
+	get_ability AI_TARGET
+	if_not_equal ABILITY_WONDER_GUARD, AI_CBM_HighRiskForDamage_End
+	if_type_effectiveness AI_EFFECTIVENESS_x2, AI_CBM_HighRiskForDamage_End
+	goto Score_Minus10
+
+AI_CBM_HighRiskForDamage_End: ; .global AI_CBM_HighRiskForDamage_End
+	end
+
+AI_CBM_Mist: ; .global AI_CBM_Mist
+	if_side_affecting AI_USER, SIDE_STATUS_MIST, Score_Minus8
+	end
+
+AI_CBM_FocusEnergy: ; .global AI_CBM_FocusEnergy
+	if_status2 AI_USER, STATUS2_FOCUS_ENERGY, Score_Minus10
+	end
+
+AI_CBM_Confuse: ; .global AI_CBM_Confuse
+	if_status2 AI_TARGET, STATUS2_CONFUSION, Score_Minus5
+	get_ability AI_TARGET
+	if_equal ABILITY_OWN_TEMPO, Score_Minus10
+                                                                                             
+	end
+
+AI_CBM_Reflect: ; .global AI_CBM_Reflect
+	if_side_affecting AI_USER, SIDE_STATUS_REFLECT, Score_Minus8
+	end
+
+AI_CBM_Paralyze: ; .global AI_CBM_Paralyze
+	if_type_effectiveness AI_EFFECTIVENESS_x0, Score_Minus10
+	get_ability AI_TARGET
+	if_equal ABILITY_LIMBER, Score_Minus10
+	if_status AI_TARGET, STATUS1_ANY, Score_Minus10
+                                                                                             
+	end
+
+AI_CBM_Substitute: ; .global AI_CBM_Substitute
+	if_status2 AI_USER, STATUS2_SUBSTITUTE, Score_Minus8
+	if_hp_less_than AI_USER, 26, Score_Minus10
+	end
+
+AI_CBM_LeechSeed: ; .global AI_CBM_LeechSeed
+	if_status3 AI_TARGET, STATUS3_LEECHSEED, Score_Minus10
+	get_target_type1
+	if_equal TYPE_GRASS, Score_Minus10
+	get_target_type2
+	if_equal TYPE_GRASS, Score_Minus10
+	end
+
+AI_CBM_Disable: ; .global AI_CBM_Disable
+	if_any_move_disabled AI_TARGET, Score_Minus8
+	end
+
+AI_CBM_Encore: ; .global AI_CBM_Encore
+	if_any_move_encored AI_TARGET, Score_Minus8
+	end
+
+AI_CBM_DamageDuringSleep: ; .global AI_CBM_DamageDuringSleep
+	if_not_status AI_USER, STATUS1_SLEEP, Score_Minus8
+	end
+
+AI_CBM_CantEscape: ; .global AI_CBM_CantEscape
+	if_status2 AI_TARGET, STATUS2_ESCAPE_PREVENTION, Score_Minus10
+	end
+
+AI_CBM_Curse: ; .global AI_CBM_Curse
+	if_stat_level_equal AI_USER, STAT_ATK, 12, Score_Minus10
+	if_stat_level_equal AI_USER, STAT_DEF, 12, Score_Minus8
+	end
+
+AI_CBM_Spikes: ; .global AI_CBM_Spikes
+	if_side_affecting AI_TARGET, SIDE_STATUS_SPIKES, Score_Minus10
+	end
+
+AI_CBM_Foresight: ; .global AI_CBM_Foresight
+	if_status2 AI_TARGET, STATUS2_FORESIGHT, Score_Minus10
+	end
+
+AI_CBM_PerishSong: ; .global AI_CBM_PerishSong
+	if_status3 AI_TARGET, STATUS3_PERISH_SONG, Score_Minus10
+	end
+
+AI_CBM_Sandstorm: ; .global AI_CBM_Sandstorm
+	get_weather
+	if_equal AI_WEATHER_SANDSTORM, Score_Minus8
+	end
+
+AI_CBM_Attract: ; .global AI_CBM_Attract
+	if_status2 AI_TARGET, STATUS2_INFATUATION, Score_Minus10
+	get_ability AI_TARGET
+	if_equal ABILITY_OBLIVIOUS, Score_Minus10
+	get_gender AI_USER
+	if_equal MON_MALE, AI_CBM_Attract_CheckIfTargetIsFemale
+	if_equal MON_FEMALE, AI_CBM_Attract_CheckIfTargetIsMale
+	goto Score_Minus10
+
+AI_CBM_Attract_CheckIfTargetIsFemale: ; .global AI_CBM_Attract_CheckIfTargetIsFemale
+	get_gender AI_TARGET
+	if_equal MON_FEMALE, AI_CBM_Attract_End
+	goto Score_Minus10
+
+AI_CBM_Attract_CheckIfTargetIsMale: ; .global AI_CBM_Attract_CheckIfTargetIsMale
+	get_gender AI_TARGET
+	if_equal MON_MALE, AI_CBM_Attract_End
+	goto Score_Minus10
+
+AI_CBM_Attract_End: ; .global AI_CBM_Attract_End
+	end
+
+AI_CBM_Safeguard: ; .global AI_CBM_Safeguard
+	if_side_affecting AI_USER, SIDE_STATUS_SAFEGUARD, Score_Minus8
+	end
+
+AI_CBM_Memento: ; .global AI_CBM_Memento
+	if_stat_level_equal AI_TARGET, STAT_ATK, 0, Score_Minus10
+	if_stat_level_equal AI_TARGET, STAT_SPATK, 0, Score_Minus8
+
+AI_CBM_BatonPass: ; .global AI_CBM_BatonPass
+	count_alive_pokemon AI_USER
+	if_equal 0, Score_Minus10
+	end
+
+AI_CBM_RainDance: ; .global AI_CBM_RainDance
+	get_weather
+	if_equal AI_WEATHER_RAIN, Score_Minus8
+	end
+
+AI_CBM_SunnyDay: ; .global AI_CBM_SunnyDay
+	get_weather
+	if_equal AI_WEATHER_SUN, Score_Minus8
+	end
+
+AI_CBM_FutureSight: ; .global AI_CBM_FutureSight
+	if_side_affecting AI_TARGET, SIDE_STATUS_FUTUREATTACK, Score_Minus10
+                                                                                              
+	end
+
+AI_CBM_FakeOut: ; .global AI_CBM_FakeOut
+	is_first_turn_for AI_USER
+	if_equal 0, Score_Minus10
+	end
+
+AI_CBM_Stockpile: ; .global AI_CBM_Stockpile
+	get_stockpile_count AI_USER
+	if_equal 3, Score_Minus10
+	end
+
+AI_CBM_SpitUpAndSwallow: ; .global AI_CBM_SpitUpAndSwallow
+	if_type_effectiveness AI_EFFECTIVENESS_x0, Score_Minus10
+	get_stockpile_count AI_USER
+	if_equal 0, Score_Minus10
+	end
+
+AI_CBM_Hail: ; .global AI_CBM_Hail
+	get_weather
+	if_equal AI_WEATHER_HAIL, Score_Minus8
+	end
+
+AI_CBM_Torment: ; .global AI_CBM_Torment
+	if_status2 AI_TARGET, STATUS2_TORMENT, Score_Minus10
+	end
+
+AI_CBM_WillOWisp: ; .global AI_CBM_WillOWisp
+	get_ability AI_TARGET
+	if_equal ABILITY_WATER_VEIL, Score_Minus10
+	if_status AI_TARGET, STATUS1_ANY, Score_Minus10
+	if_type_effectiveness AI_EFFECTIVENESS_x0, Score_Minus10
+	if_type_effectiveness AI_EFFECTIVENESS_x0_5, Score_Minus10
+	if_type_effectiveness AI_EFFECTIVENESS_x0_25, Score_Minus10
+                                                                                             
+	end
+
+AI_CBM_HelpingHand: ; .global AI_CBM_HelpingHand
+	if_not_double_battle Score_Minus10
+	end
+
+AI_CBM_TrickAndKnockOff: ; .global AI_CBM_TrickAndKnockOff
+	get_ability AI_TARGET
+	if_equal ABILITY_STICKY_HOLD, Score_Minus10
+	end
+
+AI_CBM_Ingrain: ; .global AI_CBM_Ingrain
+	if_status3 AI_USER, STATUS3_ROOTED, Score_Minus10
+	end
+
+AI_CBM_Recycle: ; .global AI_CBM_Recycle
+	get_used_held_item AI_USER
+	if_equal ITEM_NONE, Score_Minus10
+	end
+
+AI_CBM_Imprison: ; .global AI_CBM_Imprison
+	if_status3 AI_USER, STATUS3_IMPRISONED_OTHERS, Score_Minus10
+	end
+
+AI_CBM_Refresh: ; .global AI_CBM_Refresh
+	if_not_status AI_USER, STATUS1_POISON | STATUS1_BURN | STATUS1_PARALYSIS | STATUS1_TOXIC_POISON, Score_Minus10
+	end
+
+AI_CBM_MudSport: ; .global AI_CBM_MudSport
+	if_status3 AI_USER, STATUS3_MUDSPORT, Score_Minus10
+	end
+
+AI_CBM_Tickle: ; .global AI_CBM_Tickle
+	if_stat_level_equal AI_TARGET, STAT_ATK, 0, Score_Minus10
+	if_stat_level_equal AI_TARGET, STAT_DEF, 0, Score_Minus8
+	end
+
+AI_CBM_CosmicPower: ; .global AI_CBM_CosmicPower
+	if_stat_level_equal AI_USER, STAT_DEF, 12, Score_Minus10
+	if_stat_level_equal AI_USER, STAT_SPDEF, 12, Score_Minus8
+	end
+
+AI_CBM_BulkUp: ; .global AI_CBM_BulkUp
+	if_stat_level_equal AI_USER, STAT_ATK, 12, Score_Minus10
+	if_stat_level_equal AI_USER, STAT_DEF, 12, Score_Minus8
+	end
+
+AI_CBM_WaterSport: ; .global AI_CBM_WaterSport
+	if_status3 AI_USER, STATUS3_WATERSPORT, Score_Minus10
+	end
+
+AI_CBM_CalmMind: ; .global AI_CBM_CalmMind
+	if_stat_level_equal AI_USER, STAT_SPATK, 12, Score_Minus10
+	if_stat_level_equal AI_USER, STAT_SPDEF, 12, Score_Minus8
+	end
+
+AI_CBM_DragonDance: ; .global AI_CBM_DragonDance
+	if_stat_level_equal AI_USER, STAT_ATK, 12, Score_Minus10
+	if_stat_level_equal AI_USER, STAT_SPEED, 12, Score_Minus8
+	end
+
+Score_Minus1: ; .global Score_Minus1
+	score -1
+	end
+
+Score_Minus2: ; .global Score_Minus2
+	score -2
+	end
+
+Score_Minus3: ; .global Score_Minus3
+	score -3
+	end
+
+Score_Minus5: ; .global Score_Minus5
+	score -5
+	end
+
+Score_Minus8: ; .global Score_Minus8
+	score -8
+	end
+
+Score_Minus10: ; .global Score_Minus10
+	score -10
+	end
+
+Score_Minus12: ; .global Score_Minus12
+	score -12
+	end
+
+Score_Plus1: ; .global Score_Plus1
+	score +1
+	end
+
+Score_Plus2: ; .global Score_Plus2
+	score +2
+	end
+
+Score_Plus3: ; .global Score_Plus3
+	score +3
+	end
+
+Score_Plus5: ; .global Score_Plus5
+	score +5
+	end
+
+                        
+               
+           
+     
+
+AI_CheckViability: ; .global AI_CheckViability
+	if_effect EFFECT_SLEEP, AI_CV_Sleep
+	if_effect EFFECT_ABSORB, AI_CV_Absorb
+	if_effect EFFECT_EXPLOSION, AI_CV_SelfKO
+	if_effect EFFECT_DREAM_EATER, AI_CV_DreamEater
+	if_effect EFFECT_MIRROR_MOVE, AI_CV_MirrorMove
+	if_effect EFFECT_ATTACK_UP, AI_CV_AttackUp
+	if_effect EFFECT_DEFENSE_UP, AI_CV_DefenseUp
+	if_effect EFFECT_SPEED_UP, AI_CV_SpeedUp
+	if_effect EFFECT_SPECIAL_ATTACK_UP, AI_CV_SpAtkUp
+	if_effect EFFECT_SPECIAL_DEFENSE_UP, AI_CV_SpDefUp
+	if_effect EFFECT_ACCURACY_UP, AI_CV_AccuracyUp
+	if_effect EFFECT_EVASION_UP, AI_CV_EvasionUp
+	if_effect EFFECT_ALWAYS_HIT, AI_CV_AlwaysHit
+	if_effect EFFECT_ATTACK_DOWN, AI_CV_AttackDown
+	if_effect EFFECT_DEFENSE_DOWN, AI_CV_DefenseDown
+	if_effect EFFECT_SPEED_DOWN, AI_CV_SpeedDown
+	if_effect EFFECT_SPECIAL_ATTACK_DOWN, AI_CV_SpAtkDown
+	if_effect EFFECT_SPECIAL_DEFENSE_DOWN, AI_CV_SpDefDown
+	if_effect EFFECT_ACCURACY_DOWN, AI_CV_AccuracyDown
+	if_effect EFFECT_EVASION_DOWN, AI_CV_EvasionDown
+	if_effect EFFECT_HAZE, AI_CV_Haze
+	if_effect EFFECT_BIDE, AI_CV_Bide
+	if_effect EFFECT_ROAR, AI_CV_Roar
+	if_effect EFFECT_CONVERSION, AI_CV_Conversion
+	if_effect EFFECT_RESTORE_HP, AI_CV_Heal
+	if_effect EFFECT_TOXIC, AI_CV_Toxic
+	if_effect EFFECT_LIGHT_SCREEN, AI_CV_LightScreen
+	if_effect EFFECT_REST, AI_CV_Rest
+	if_effect EFFECT_OHKO, AI_CV_OneHitKO
+	if_effect EFFECT_RAZOR_WIND, AI_CV_ChargeUpMove
+	if_effect EFFECT_SUPER_FANG, AI_CV_SuperFang
+	if_effect EFFECT_TRAP, AI_CV_Trap
+	if_effect EFFECT_HIGH_CRITICAL, AI_CV_HighCrit
+	if_effect EFFECT_CONFUSE, AI_CV_Confuse
+	if_effect EFFECT_ATTACK_UP_2, AI_CV_AttackUp
+	if_effect EFFECT_DEFENSE_UP_2, AI_CV_DefenseUp
+	if_effect EFFECT_SPEED_UP_2, AI_CV_SpeedUp
+	if_effect EFFECT_SPECIAL_ATTACK_UP_2, AI_CV_SpAtkUp
+	if_effect EFFECT_SPECIAL_DEFENSE_UP_2, AI_CV_SpDefUp
+	if_effect EFFECT_ACCURACY_UP_2, AI_CV_AccuracyUp
+	if_effect EFFECT_EVASION_UP_2, AI_CV_EvasionUp
+	if_effect EFFECT_ATTACK_DOWN_2, AI_CV_AttackDown
+	if_effect EFFECT_DEFENSE_DOWN_2, AI_CV_DefenseDown
+	if_effect EFFECT_SPEED_DOWN_2, AI_CV_SpeedDown
+	if_effect EFFECT_SPECIAL_ATTACK_DOWN_2, AI_CV_SpAtkDown
+	if_effect EFFECT_SPECIAL_DEFENSE_DOWN_2, AI_CV_SpDefDown
+	if_effect EFFECT_ACCURACY_DOWN_2, AI_CV_AccuracyDown
+	if_effect EFFECT_EVASION_DOWN_2, AI_CV_EvasionDown
+	if_effect EFFECT_REFLECT, AI_CV_Reflect
+	if_effect EFFECT_POISON, AI_CV_Poison
+	if_effect EFFECT_PARALYZE, AI_CV_Paralyze
+	                                                                   
+	if_effect EFFECT_SPEED_DOWN_HIT, AI_CV_SpeedDownFromChance
+	if_effect EFFECT_SKY_ATTACK, AI_CV_ChargeUpMove
+	if_effect EFFECT_VITAL_THROW, AI_CV_VitalThrow
+	if_effect EFFECT_SUBSTITUTE, AI_CV_Substitute
+	if_effect EFFECT_RECHARGE, AI_CV_Recharge
+	if_effect EFFECT_LEECH_SEED, AI_CV_Toxic
+	if_effect EFFECT_DISABLE, AI_CV_Disable
+	if_effect EFFECT_COUNTER, AI_CV_Counter
+	if_effect EFFECT_ENCORE, AI_CV_Encore
+	if_effect EFFECT_PAIN_SPLIT, AI_CV_PainSplit
+	if_effect EFFECT_SNORE, AI_CV_Snore
+	if_effect EFFECT_LOCK_ON, AI_CV_LockOn
+	if_effect EFFECT_SLEEP_TALK, AI_CV_SleepTalk
+	if_effect EFFECT_DESTINY_BOND, AI_CV_DestinyBond
+	if_effect EFFECT_FLAIL, AI_CV_Flail
+	if_effect EFFECT_HEAL_BELL, AI_CV_HealBell
+	if_effect EFFECT_THIEF, AI_CV_Thief
+	if_effect EFFECT_MEAN_LOOK, AI_CV_Trap
+	if_effect EFFECT_MINIMIZE, AI_CV_EvasionUp
+	if_effect EFFECT_CURSE, AI_CV_Curse
+	if_effect EFFECT_PROTECT, AI_CV_Protect
+	if_effect EFFECT_FORESIGHT, AI_CV_Foresight
+	if_effect EFFECT_ENDURE, AI_CV_Endure
+	if_effect EFFECT_BATON_PASS, AI_CV_BatonPass
+	if_effect EFFECT_PURSUIT, AI_CV_Pursuit
+	if_effect EFFECT_MORNING_SUN, AI_CV_HealWeather
+	if_effect EFFECT_SYNTHESIS, AI_CV_HealWeather
+	if_effect EFFECT_MOONLIGHT, AI_CV_HealWeather
+	if_effect EFFECT_RAIN_DANCE, AI_CV_RainDance
+	if_effect EFFECT_SUNNY_DAY, AI_CV_SunnyDay
+	if_effect EFFECT_BELLY_DRUM, AI_CV_BellyDrum
+	if_effect EFFECT_PSYCH_UP, AI_CV_PsychUp
+	if_effect EFFECT_MIRROR_COAT, AI_CV_MirrorCoat
+	if_effect EFFECT_SKULL_BASH, AI_CV_ChargeUpMove
+	if_effect EFFECT_SOLAR_BEAM, AI_CV_ChargeUpMove
+	if_effect EFFECT_SEMI_INVULNERABLE, AI_CV_SemiInvulnerable
+	if_effect EFFECT_SOFTBOILED, AI_CV_Heal
+	if_effect EFFECT_FAKE_OUT, AI_CV_FakeOut
+	if_effect EFFECT_SPIT_UP, AI_CV_SpitUp
+	if_effect EFFECT_SWALLOW, AI_CV_Heal
+	if_effect EFFECT_HAIL, AI_CV_Hail
+	if_effect EFFECT_FLATTER, AI_CV_Flatter
+	if_effect EFFECT_MEMENTO, AI_CV_SelfKO
+	if_effect EFFECT_FACADE, AI_CV_Facade
+	if_effect EFFECT_FOCUS_PUNCH, AI_CV_FocusPunch
+	if_effect EFFECT_SMELLINGSALT, AI_CV_SmellingSalt
+	if_effect EFFECT_TRICK, AI_CV_Trick
+	if_effect EFFECT_ROLE_PLAY, AI_CV_ChangeSelfAbility
+	if_effect EFFECT_SUPERPOWER, AI_CV_Superpower
+	if_effect EFFECT_MAGIC_COAT, AI_CV_MagicCoat
+	if_effect EFFECT_RECYCLE, AI_CV_Recycle
+	if_effect EFFECT_REVENGE, AI_CV_Revenge
+	if_effect EFFECT_BRICK_BREAK, AI_CV_BrickBreak
+	if_effect EFFECT_KNOCK_OFF, AI_CV_KnockOff
+	if_effect EFFECT_ENDEAVOR, AI_CV_Endeavor
+	if_effect EFFECT_ERUPTION, AI_CV_Eruption
+	if_effect EFFECT_SKILL_SWAP, AI_CV_ChangeSelfAbility
+	if_effect EFFECT_IMPRISON, AI_CV_Imprison
+	if_effect EFFECT_REFRESH, AI_CV_Refresh
+	if_effect EFFECT_SNATCH, AI_CV_Snatch
+	if_effect EFFECT_BLAZE_KICK, AI_CV_HighCrit
+	if_effect EFFECT_MUD_SPORT, AI_CV_MudSport
+	if_effect EFFECT_OVERHEAT, AI_CV_Overheat
+	if_effect EFFECT_TICKLE, AI_CV_DefenseDown
+	if_effect EFFECT_COSMIC_POWER, AI_CV_SpDefUp
+	if_effect EFFECT_BULK_UP, AI_CV_DefenseUp
+	if_effect EFFECT_POISON_TAIL, AI_CV_HighCrit
+	if_effect EFFECT_WATER_SPORT, AI_CV_WaterSport
+	if_effect EFFECT_CALM_MIND, AI_CV_SpDefUp
+	if_effect EFFECT_DRAGON_DANCE, AI_CV_DragonDance
+	end
+
+AI_CV_Sleep: ; .global AI_CV_Sleep
+	if_has_move_with_effect AI_TARGET, EFFECT_DREAM_EATER, AI_CV_SleepEncourageSlpDamage
+	if_has_move_with_effect AI_TARGET, EFFECT_NIGHTMARE, AI_CV_SleepEncourageSlpDamage
+	goto AI_CV_Sleep_End
+
+AI_CV_SleepEncourageSlpDamage: ; .global AI_CV_SleepEncourageSlpDamage
+	if_random_less_than 128, AI_CV_Sleep_End
+	score +1
+
+AI_CV_Sleep_End: ; .global AI_CV_Sleep_End
+	end
+
+AI_CV_Absorb: ; .global AI_CV_Absorb
+	if_type_effectiveness AI_EFFECTIVENESS_x0_5, AI_CV_AbsorbEncourageMaybe
+	if_type_effectiveness AI_EFFECTIVENESS_x0_25, AI_CV_AbsorbEncourageMaybe
+	goto AI_CV_Absorb_End
+
+AI_CV_AbsorbEncourageMaybe: ; .global AI_CV_AbsorbEncourageMaybe
+	if_random_less_than 50, AI_CV_Absorb_End
+	score -3
+
+AI_CV_Absorb_End: ; .global AI_CV_Absorb_End
+	end
+
+AI_CV_SelfKO: ; .global AI_CV_SelfKO
+	if_stat_level_less_than AI_TARGET, STAT_EVASION, 7, AI_CV_SelfKO_Encourage1
+	score -1
+	if_stat_level_less_than AI_TARGET, STAT_EVASION, 10, AI_CV_SelfKO_Encourage1
+	if_random_less_than 128, AI_CV_SelfKO_Encourage1
+	score -1
+
+AI_CV_SelfKO_Encourage1: ; .global AI_CV_SelfKO_Encourage1
+	if_hp_less_than AI_USER, 80, AI_CV_SelfKO_Encourage2
+	if_target_faster AI_CV_SelfKO_Encourage2
+	if_random_less_than 50, AI_CV_SelfKO_End
+	goto Score_Minus3
+
+AI_CV_SelfKO_Encourage2: ; .global AI_CV_SelfKO_Encourage2
+	if_hp_more_than AI_USER, 50, AI_CV_SelfKO_Encourage4
+	if_random_less_than 128, AI_CV_SelfKO_Encourage3
+	score +1
+
+AI_CV_SelfKO_Encourage3: ; .global AI_CV_SelfKO_Encourage3
+	if_hp_more_than AI_USER, 30, AI_CV_SelfKO_End
+	if_random_less_than 50, AI_CV_SelfKO_End
+	score +1
+	goto AI_CV_SelfKO_End
+
+AI_CV_SelfKO_Encourage4: ; .global AI_CV_SelfKO_Encourage4
+	if_random_less_than 50, AI_CV_SelfKO_End
+	score -1
+
+AI_CV_SelfKO_End: ; .global AI_CV_SelfKO_End
+	end
+
+AI_CV_DreamEater: ; .global AI_CV_DreamEater
+	if_type_effectiveness AI_EFFECTIVENESS_x0_25, AI_CV_DreamEater_ScoreDown1
+	if_type_effectiveness AI_EFFECTIVENESS_x0_5, AI_CV_DreamEater_ScoreDown1
+	goto AI_CV_DreamEater_End
+
+AI_CV_DreamEater_ScoreDown1: ; .global AI_CV_DreamEater_ScoreDown1
+	score -1
+
+AI_CV_DreamEater_End: ; .global AI_CV_DreamEater_End
+	end
+
+AI_CV_MirrorMove: ; .global AI_CV_MirrorMove
+	if_target_faster AI_CV_MirrorMove2
+	get_last_used_move AI_TARGET
+	if_not_in_hwords AI_CV_MirrorMove_EncouragedMovesToMirror, AI_CV_MirrorMove2
+	if_random_less_than 128, AI_CV_MirrorMove_End
+	score +2
+	goto AI_CV_MirrorMove_End
+
+AI_CV_MirrorMove2: ; .global AI_CV_MirrorMove2
+	get_last_used_move AI_TARGET
+	if_in_hwords AI_CV_MirrorMove_EncouragedMovesToMirror, AI_CV_MirrorMove_End
+	if_random_less_than 80, AI_CV_MirrorMove_End
+	score -1
+
+AI_CV_MirrorMove_End: ; .global AI_CV_MirrorMove_End
+	end
+
+	.space 2
+AI_CV_MirrorMove_EncouragedMovesToMirror: ; .global AI_CV_MirrorMove_EncouragedMovesToMirror
+	.align 1
+	.2byte MOVE_SLEEP_POWDER
+	.2byte MOVE_LOVELY_KISS
+	.2byte MOVE_SPORE
+	.2byte MOVE_HYPNOSIS
+	.2byte MOVE_SING
+	.2byte MOVE_GRASS_WHISTLE
+	.2byte MOVE_SHADOW_PUNCH
+	.2byte MOVE_SAND_ATTACK
+	.2byte MOVE_SMOKESCREEN
+	.2byte MOVE_TOXIC
+	.2byte MOVE_GUILLOTINE
+	.2byte MOVE_HORN_DRILL
+	.2byte MOVE_FISSURE
+	.2byte MOVE_SHEER_COLD
+	.2byte MOVE_CROSS_CHOP
+	.2byte MOVE_AEROBLAST
+	.2byte MOVE_CONFUSE_RAY
+	.2byte MOVE_SWEET_KISS
+	.2byte MOVE_SCREECH
+	.2byte MOVE_COTTON_SPORE
+	.2byte MOVE_SCARY_FACE
+	.2byte MOVE_FAKE_TEARS
+	.2byte MOVE_METAL_SOUND
+	.2byte MOVE_THUNDER_WAVE
+	.2byte MOVE_GLARE
+	.2byte MOVE_POISON_POWDER
+	.2byte MOVE_SHADOW_BALL
+	.2byte MOVE_DYNAMIC_PUNCH
+	.2byte MOVE_HYPER_BEAM
+	.2byte MOVE_EXTREME_SPEED
+	.2byte MOVE_THIEF
+	.2byte MOVE_COVET
+	.2byte MOVE_ATTRACT
+	.2byte MOVE_SWAGGER
+	.2byte MOVE_TORMENT
+	.2byte MOVE_FLATTER
+	.2byte MOVE_TRICK
+	.2byte MOVE_SUPERPOWER
+	.2byte MOVE_SKILL_SWAP
+	.2byte -1
+
+AI_CV_AttackUp: ; .global AI_CV_AttackUp
+	if_stat_level_less_than AI_USER, STAT_ATK, 9, AI_CV_AttackUp2
+	if_random_less_than 100, AI_CV_AttackUp3
+	score -1
+	goto AI_CV_AttackUp3
+
+AI_CV_AttackUp2: ; .global AI_CV_AttackUp2
+	if_hp_not_equal AI_USER, 100, AI_CV_AttackUp3
+	if_random_less_than 128, AI_CV_AttackUp3
+	score +2
+
+AI_CV_AttackUp3: ; .global AI_CV_AttackUp3
+	if_hp_more_than AI_USER, 70, AI_CV_AttackUp_End
+	if_hp_less_than AI_USER, 40, AI_CV_AttackUp_ScoreDown2
+	if_random_less_than 40, AI_CV_AttackUp_End
+
+AI_CV_AttackUp_ScoreDown2: ; .global AI_CV_AttackUp_ScoreDown2
+	score -2
+
+AI_CV_AttackUp_End: ; .global AI_CV_AttackUp_End
+	end
+
+AI_CV_DefenseUp: ; .global AI_CV_DefenseUp
+	if_stat_level_less_than AI_USER, STAT_DEF, 9, AI_CV_DefenseUp2
+	if_random_less_than 100, AI_CV_DefenseUp3
+	score -1
+	goto AI_CV_DefenseUp3
+
+AI_CV_DefenseUp2: ; .global AI_CV_DefenseUp2
+	if_hp_not_equal AI_USER, 100, AI_CV_DefenseUp3
+	if_random_less_than 128, AI_CV_DefenseUp3
+	score +2
+
+AI_CV_DefenseUp3: ; .global AI_CV_DefenseUp3
+	if_hp_less_than AI_USER, 70, AI_CV_DefenseUp4
+	if_random_less_than 200, AI_CV_DefenseUp_End
+
+AI_CV_DefenseUp4: ; .global AI_CV_DefenseUp4
+	if_hp_less_than AI_USER, 40, AI_CV_DefenseUp_ScoreDown2
+	get_last_used_move AI_TARGET
+	get_move_power_from_result
+	if_equal 0, AI_CV_DefenseUp5
+	get_last_used_move AI_TARGET
+	get_move_type_from_result
+	if_not_in_bytes AI_CV_DefenseUp_PhysicalTypes, AI_CV_DefenseUp_ScoreDown2
+	if_random_less_than 60, AI_CV_DefenseUp_End
+
+AI_CV_DefenseUp5: ; .global AI_CV_DefenseUp5
+	if_random_less_than 60, AI_CV_DefenseUp_End
+
+AI_CV_DefenseUp_ScoreDown2: ; .global AI_CV_DefenseUp_ScoreDown2
+	score -2
+
+AI_CV_DefenseUp_End: ; .global AI_CV_DefenseUp_End
+	end
+
+AI_CV_DefenseUp_PhysicalTypes: ; .global AI_CV_DefenseUp_PhysicalTypes
+	.byte TYPE_NORMAL
+	.byte TYPE_FIGHTING
+	.byte TYPE_POISON
+	.byte TYPE_GROUND
+	.byte TYPE_FLYING
+	.byte TYPE_ROCK
+	.byte TYPE_BUG
+	.byte TYPE_GHOST
+	.byte TYPE_STEEL
+	.byte -1
+
+AI_CV_SpeedUp: ; .global AI_CV_SpeedUp
+	if_target_faster AI_CV_SpeedUp2
+	score -3
+	goto AI_CV_SpeedUp_End
+
+AI_CV_SpeedUp2: ; .global AI_CV_SpeedUp2
+	if_random_less_than 70, AI_CV_SpeedUp_End
+	score +3
+
+AI_CV_SpeedUp_End: ; .global AI_CV_SpeedUp_End
+	end
+
+AI_CV_SpAtkUp: ; .global AI_CV_SpAtkUp
+	if_stat_level_less_than AI_USER, STAT_SPATK, 9, AI_CV_SpAtkUp2
+	if_random_less_than 100, AI_CV_SpAtkUp3
+	score -1
+	goto AI_CV_SpAtkUp3
+
+AI_CV_SpAtkUp2: ; .global AI_CV_SpAtkUp2
+	if_hp_not_equal AI_USER, 100, AI_CV_SpAtkUp3
+	if_random_less_than 128, AI_CV_SpAtkUp3
+	score +2
+
+AI_CV_SpAtkUp3: ; .global AI_CV_SpAtkUp3
+	if_hp_more_than AI_USER, 70, AI_CV_SpAtkUp_End
+	if_hp_less_than AI_USER, 40, AI_CV_SpAtkUp_ScoreDown2
+	if_random_less_than 70, AI_CV_SpAtkUp_End
+
+AI_CV_SpAtkUp_ScoreDown2: ; .global AI_CV_SpAtkUp_ScoreDown2
+	score -2
+
+AI_CV_SpAtkUp_End: ; .global AI_CV_SpAtkUp_End
+	end
+
+AI_CV_SpDefUp: ; .global AI_CV_SpDefUp
+	if_stat_level_less_than AI_USER, STAT_SPDEF, 9, AI_CV_SpDefUp2
+	if_random_less_than 100, AI_CV_SpDefUp3
+	score -1
+	goto AI_CV_SpDefUp3
+
+AI_CV_SpDefUp2: ; .global AI_CV_SpDefUp2
+	if_hp_not_equal AI_USER, 100, AI_CV_SpDefUp3
+	if_random_less_than 128, AI_CV_SpDefUp3
+	score +2
+
+AI_CV_SpDefUp3: ; .global AI_CV_SpDefUp3
+	if_hp_less_than AI_USER, 70, AI_CV_SpDefUp4
+	if_random_less_than 200, AI_CV_SpDefUp_End
+
+AI_CV_SpDefUp4: ; .global AI_CV_SpDefUp4
+	if_hp_less_than AI_USER, 40, AI_CV_SpDefUp_ScoreDown2
+	get_last_used_move AI_TARGET
+	get_move_power_from_result
+	if_equal 0, AI_CV_SpDefUp5
+	get_last_used_move AI_TARGET
+	get_move_type_from_result
+	if_in_bytes AI_CV_SpDefUp_PhysicalTypes, AI_CV_SpDefUp_ScoreDown2
+	if_random_less_than 60, AI_CV_SpDefUp_End
+
+AI_CV_SpDefUp5: ; .global AI_CV_SpDefUp5
+	if_random_less_than 60, AI_CV_SpDefUp_End
+
+AI_CV_SpDefUp_ScoreDown2: ; .global AI_CV_SpDefUp_ScoreDown2
+	score -2
+
+AI_CV_SpDefUp_End: ; .global AI_CV_SpDefUp_End
+	end
+
+AI_CV_SpDefUp_PhysicalTypes: ; .global AI_CV_SpDefUp_PhysicalTypes
+	.byte TYPE_NORMAL
+	.byte TYPE_FIGHTING
+	.byte TYPE_POISON
+	.byte TYPE_GROUND
+	.byte TYPE_FLYING
+	.byte TYPE_ROCK
+	.byte TYPE_BUG
+	.byte TYPE_GHOST
+	.byte TYPE_STEEL
+	.byte -1
+
+AI_CV_AccuracyUp: ; .global AI_CV_AccuracyUp
+	if_stat_level_less_than AI_USER, STAT_ACC, 9, AI_CV_AccuracyUp2
+	if_random_less_than 50, AI_CV_AccuracyUp2
+	score -2
+
+AI_CV_AccuracyUp2: ; .global AI_CV_AccuracyUp2
+	if_hp_more_than AI_USER, 70, AI_CV_AccuracyUp_End
+	score -2
+
+AI_CV_AccuracyUp_End: ; .global AI_CV_AccuracyUp_End
+	end
+
+AI_CV_EvasionUp: ; .global AI_CV_EvasionUp
+	if_hp_less_than AI_USER, 90, AI_CV_EvasionUp2
+	if_random_less_than 100, AI_CV_EvasionUp2
+	score +3
+
+AI_CV_EvasionUp2: ; .global AI_CV_EvasionUp2
+	if_stat_level_less_than AI_USER, STAT_EVASION, 9, AI_CV_EvasionUp3
+	if_random_less_than 128, AI_CV_EvasionUp3
+	score -1
+
+AI_CV_EvasionUp3: ; .global AI_CV_EvasionUp3
+	if_not_status AI_TARGET, STATUS1_TOXIC_POISON, AI_CV_EvasionUp5
+	if_hp_more_than AI_USER, 50, AI_CV_EvasionUp4
+	if_random_less_than 80, AI_CV_EvasionUp5
+
+AI_CV_EvasionUp4: ; .global AI_CV_EvasionUp4
+	if_random_less_than 50, AI_CV_EvasionUp5
+	score +3
+
+AI_CV_EvasionUp5: ; .global AI_CV_EvasionUp5
+	if_not_status3 AI_TARGET, STATUS3_LEECHSEED, AI_CV_EvasionUp6
+	if_random_less_than 70, AI_CV_EvasionUp6
+	score +3
+
+AI_CV_EvasionUp6: ; .global AI_CV_EvasionUp6
+	if_not_status3 AI_USER, STATUS3_ROOTED, AI_CV_EvasionUp7
+	if_random_less_than 128, AI_CV_EvasionUp7
+	score +2
+
+AI_CV_EvasionUp7: ; .global AI_CV_EvasionUp7
+	if_not_status2 AI_TARGET, STATUS2_CURSED, AI_CV_EvasionUp8
+	if_random_less_than 70, AI_CV_EvasionUp8
+	score +3
+
+AI_CV_EvasionUp8: ; .global AI_CV_EvasionUp8
+	if_hp_more_than AI_USER, 70, AI_CV_EvasionUp_End
+	if_stat_level_equal AI_USER, STAT_EVASION, 6, AI_CV_EvasionUp_End
+	if_hp_less_than AI_USER, 40, AI_CV_EvasionUp_ScoreDown2
+	if_hp_less_than AI_TARGET, 40, AI_CV_EvasionUp_ScoreDown2
+	if_random_less_than 70, AI_CV_EvasionUp_End
+
+AI_CV_EvasionUp_ScoreDown2: ; .global AI_CV_EvasionUp_ScoreDown2
+	score -2
+
+AI_CV_EvasionUp_End: ; .global AI_CV_EvasionUp_End
+	end
+
+AI_CV_AlwaysHit: ; .global AI_CV_AlwaysHit
+	if_stat_level_more_than AI_TARGET, STAT_EVASION, 10, AI_CV_AlwaysHit_ScoreUp1
+	if_stat_level_less_than AI_USER, STAT_ACC, 2, AI_CV_AlwaysHit_ScoreUp1
+	if_stat_level_more_than AI_TARGET, STAT_EVASION, 8, AI_CV_AlwaysHit2
+	if_stat_level_less_than AI_USER, STAT_ACC, 4, AI_CV_AlwaysHit2
+	goto AI_CV_AlwaysHit_End
+
+AI_CV_AlwaysHit_ScoreUp1: ; .global AI_CV_AlwaysHit_ScoreUp1
+	score +1
+
+AI_CV_AlwaysHit2: ; .global AI_CV_AlwaysHit2
+	if_random_less_than 100, AI_CV_AlwaysHit_End
+	score +1
+
+AI_CV_AlwaysHit_End: ; .global AI_CV_AlwaysHit_End
+	end
+
+AI_CV_AttackDown: ; .global AI_CV_AttackDown
+	if_stat_level_equal AI_TARGET, STAT_ATK, 6, AI_CV_AttackDown3
+	score -1
+	if_hp_more_than AI_USER, 90, AI_CV_AttackDown2
+	score -1
+
+AI_CV_AttackDown2: ; .global AI_CV_AttackDown2
+	if_stat_level_more_than AI_TARGET, STAT_ATK, 3, AI_CV_AttackDown3
+	if_random_less_than 50, AI_CV_AttackDown3
+	score -2
+
+AI_CV_AttackDown3: ; .global AI_CV_AttackDown3
+	if_hp_more_than AI_TARGET, 70, AI_CV_AttackDown4
+	score -2
+
+AI_CV_AttackDown4: ; .global AI_CV_AttackDown4
+	get_target_type1
+	if_in_bytes AI_CV_AttackDown_PhysicalTypeList, AI_CV_AttackDown_End
+	get_target_type2
+	if_in_bytes AI_CV_AttackDown_PhysicalTypeList, AI_CV_AttackDown_End
+	if_random_less_than 50, AI_CV_AttackDown_End
+	score -2
+
+AI_CV_AttackDown_End: ; .global AI_CV_AttackDown_End
+	end
+
+                                                      
+AI_CV_AttackDown_PhysicalTypeList: ; .global AI_CV_AttackDown_PhysicalTypeList
+	.byte TYPE_NORMAL
+	.byte TYPE_FIGHTING
+	.byte TYPE_GROUND
+	.byte TYPE_ROCK
+	.byte TYPE_BUG
+	.byte TYPE_STEEL
+	.byte -1
+
+AI_CV_DefenseDown: ; .global AI_CV_DefenseDown
+	if_hp_less_than AI_USER, 70, AI_CV_DefenseDown2
+	if_stat_level_more_than AI_TARGET, STAT_DEF, 3, AI_CV_DefenseDown3
+
+AI_CV_DefenseDown2: ; .global AI_CV_DefenseDown2
+	if_random_less_than 50, AI_CV_DefenseDown3
+	score -2
+
+AI_CV_DefenseDown3: ; .global AI_CV_DefenseDown3
+	if_hp_more_than AI_TARGET, 70, AI_CV_DefenseDown_End
+	score -2
+
+AI_CV_DefenseDown_End: ; .global AI_CV_DefenseDown_End
+	end
+
+AI_CV_SpeedDownFromChance: ; .global AI_CV_SpeedDownFromChance
+	if_move MOVE_ICY_WIND, AI_CV_SpeedDown
+	if_move MOVE_ROCK_TOMB, AI_CV_SpeedDown
+	if_move MOVE_MUD_SHOT, AI_CV_SpeedDown
+	end
+
+AI_CV_SpeedDown: ; .global AI_CV_SpeedDown
+	if_target_faster AI_CV_SpeedDown2
+	score -3
+	goto AI_CV_SpeedDown_End
+
+AI_CV_SpeedDown2: ; .global AI_CV_SpeedDown2
+	if_random_less_than 70, AI_CV_SpeedDown_End
+	score +2
+
+AI_CV_SpeedDown_End: ; .global AI_CV_SpeedDown_End
+	end
+
+AI_CV_SpAtkDown: ; .global AI_CV_SpAtkDown
+	if_stat_level_equal AI_TARGET, STAT_ATK, 6, AI_CV_SpAtkDown3
+	score -1
+	if_hp_more_than AI_USER, 90, AI_CV_SpAtkDown2
+	score -1
+
+AI_CV_SpAtkDown2: ; .global AI_CV_SpAtkDown2
+	if_stat_level_more_than AI_TARGET, STAT_SPATK, 3, AI_CV_SpAtkDown3
+	if_random_less_than 50, AI_CV_SpAtkDown3
+	score -2
+
+AI_CV_SpAtkDown3: ; .global AI_CV_SpAtkDown3
+	if_hp_more_than AI_TARGET, 70, AI_CV_SpAtkDown4
+	score -2
+
+AI_CV_SpAtkDown4: ; .global AI_CV_SpAtkDown4
+	get_target_type1
+	if_in_bytes AI_CV_SpAtkDown_SpecialTypeList, AI_CV_SpAtkDown_End
+	get_target_type2
+	if_in_bytes AI_CV_SpAtkDown_SpecialTypeList, AI_CV_SpAtkDown_End
+	if_random_less_than 50, AI_CV_SpAtkDown_End
+	score -2
+
+AI_CV_SpAtkDown_End: ; .global AI_CV_SpAtkDown_End
+	end
+
+AI_CV_SpAtkDown_SpecialTypeList: ; .global AI_CV_SpAtkDown_SpecialTypeList
+	.byte TYPE_FIRE
+	.byte TYPE_WATER
+	.byte TYPE_GRASS
+	.byte TYPE_ELECTRIC
+	.byte TYPE_PSYCHIC
+	.byte TYPE_ICE
+	.byte TYPE_DRAGON
+	.byte TYPE_DARK
+	.byte -1
+
+AI_CV_SpDefDown: ; .global AI_CV_SpDefDown
+	if_hp_less_than AI_USER, 70, AI_CV_SpDefDown2
+	if_stat_level_more_than AI_TARGET, STAT_SPDEF, 3, AI_CV_SpDefDown3
+
+AI_CV_SpDefDown2: ; .global AI_CV_SpDefDown2
+	if_random_less_than 50, AI_CV_SpDefDown3
+	score -2
+
+AI_CV_SpDefDown3: ; .global AI_CV_SpDefDown3
+	if_hp_more_than AI_TARGET, 70, AI_CV_SpDefDown_End
+	score -2
+
+AI_CV_SpDefDown_End: ; .global AI_CV_SpDefDown_End
+	end
+
+AI_CV_AccuracyDown: ; .global AI_CV_AccuracyDown
+	if_hp_less_than AI_USER, 70, AI_CV_AccuracyDown2
+	if_hp_more_than AI_TARGET, 70, AI_CV_AccuracyDown3
+
+AI_CV_AccuracyDown2: ; .global AI_CV_AccuracyDown2
+	if_random_less_than 100, AI_CV_AccuracyDown3
+	score -1
+
+AI_CV_AccuracyDown3: ; .global AI_CV_AccuracyDown3
+	if_stat_level_more_than AI_USER, STAT_ACC, 4, AI_CV_AccuracyDown4
+	if_random_less_than 80, AI_CV_AccuracyDown4
+	score -2
+
+AI_CV_AccuracyDown4: ; .global AI_CV_AccuracyDown4
+	if_not_status AI_TARGET, STATUS1_TOXIC_POISON, AI_CV_AccuracyDown5
+	if_random_less_than 70, AI_CV_AccuracyDown5
+	score +2
+
+AI_CV_AccuracyDown5: ; .global AI_CV_AccuracyDown5
+	if_not_status3 AI_TARGET, STATUS3_LEECHSEED, AI_CV_AccuracyDown6
+	if_random_less_than 70, AI_CV_AccuracyDown6
+	score +2
+
+AI_CV_AccuracyDown6: ; .global AI_CV_AccuracyDown6
+	if_not_status3 AI_USER, STATUS3_ROOTED, AI_CV_AccuracyDown7
+	if_random_less_than 128, AI_CV_AccuracyDown7
+	score +1
+
+AI_CV_AccuracyDown7: ; .global AI_CV_AccuracyDown7
+	if_not_status2 AI_TARGET, STATUS2_CURSED, AI_CV_AccuracyDown8
+	if_random_less_than 70, AI_CV_AccuracyDown8
+	score +2
+
+AI_CV_AccuracyDown8: ; .global AI_CV_AccuracyDown8
+	if_hp_more_than AI_USER, 70, AI_CV_AccuracyDown_End
+	if_stat_level_equal AI_TARGET, STAT_ACC, 6, AI_CV_AccuracyDown_End
+	if_hp_less_than AI_USER, 40, AI_CV_AccuracyDown_ScoreDown2
+	if_hp_less_than AI_TARGET, 40, AI_CV_AccuracyDown_ScoreDown2
+	if_random_less_than 70, AI_CV_AccuracyDown_End
+
+AI_CV_AccuracyDown_ScoreDown2: ; .global AI_CV_AccuracyDown_ScoreDown2
+	score -2
+
+AI_CV_AccuracyDown_End: ; .global AI_CV_AccuracyDown_End
+	end
+
+AI_CV_EvasionDown: ; .global AI_CV_EvasionDown
+	if_hp_less_than AI_USER, 70, AI_CV_EvasionDown2
+	if_stat_level_more_than AI_TARGET, STAT_EVASION, 3, AI_CV_EvasionDown3
+
+AI_CV_EvasionDown2: ; .global AI_CV_EvasionDown2
+	if_random_less_than 50, AI_CV_EvasionDown3
+	score -2
+
+AI_CV_EvasionDown3: ; .global AI_CV_EvasionDown3
+	if_hp_more_than AI_TARGET, 70, AI_CV_EvasionDown_End
+	score -2
+
+AI_CV_EvasionDown_End: ; .global AI_CV_EvasionDown_End
+	end
+
+AI_CV_Haze: ; .global AI_CV_Haze
+	if_stat_level_more_than AI_USER, STAT_ATK, 8, AI_CV_Haze2
+	if_stat_level_more_than AI_USER, STAT_DEF, 8, AI_CV_Haze2
+	if_stat_level_more_than AI_USER, STAT_SPATK, 8, AI_CV_Haze2
+	if_stat_level_more_than AI_USER, STAT_SPDEF, 8, AI_CV_Haze2
+	if_stat_level_more_than AI_USER, STAT_EVASION, 8, AI_CV_Haze2
+	if_stat_level_less_than AI_TARGET, STAT_ATK, 4, AI_CV_Haze2
+	if_stat_level_less_than AI_TARGET, STAT_DEF, 4, AI_CV_Haze2
+	if_stat_level_less_than AI_TARGET, STAT_SPATK, 4, AI_CV_Haze2
+	if_stat_level_less_than AI_TARGET, STAT_SPDEF, 4, AI_CV_Haze2
+	if_stat_level_less_than AI_TARGET, STAT_ACC, 4, AI_CV_Haze2
+	goto AI_CV_Haze3
+
+AI_CV_Haze2: ; .global AI_CV_Haze2
+	if_random_less_than 50, AI_CV_Haze3
+	score -3
+
+AI_CV_Haze3: ; .global AI_CV_Haze3
+	if_stat_level_more_than AI_TARGET, STAT_ATK, 8, AI_CV_Haze4
+	if_stat_level_more_than AI_TARGET, STAT_DEF, 8, AI_CV_Haze4
+	if_stat_level_more_than AI_TARGET, STAT_SPATK, 8, AI_CV_Haze4
+	if_stat_level_more_than AI_TARGET, STAT_SPDEF, 8, AI_CV_Haze4
+	if_stat_level_more_than AI_TARGET, STAT_EVASION, 8, AI_CV_Haze4
+	if_stat_level_less_than AI_USER, STAT_ATK, 4, AI_CV_Haze4
+	if_stat_level_less_than AI_USER, STAT_DEF, 4, AI_CV_Haze4
+	if_stat_level_less_than AI_USER, STAT_SPATK, 4, AI_CV_Haze4
+	if_stat_level_less_than AI_USER, STAT_SPDEF, 4, AI_CV_Haze4
+	if_stat_level_less_than AI_USER, STAT_ACC, 4, AI_CV_Haze4
+	if_random_less_than 50, AI_CV_Haze_End
+	score -1
+	goto AI_CV_Haze_End
+
+AI_CV_Haze4: ; .global AI_CV_Haze4
+	if_random_less_than 50, AI_CV_Haze_End
+	score +3
+
+AI_CV_Haze_End: ; .global AI_CV_Haze_End
+	end
+
+AI_CV_Bide: ; .global AI_CV_Bide
+	if_hp_more_than AI_USER, 90, AI_CV_Bide_End
+	score -2
+
+AI_CV_Bide_End: ; .global AI_CV_Bide_End
+	end
+
+AI_CV_Roar: ; .global AI_CV_Roar
+	if_stat_level_more_than AI_TARGET, STAT_ATK, 8, AI_CV_Roar2
+	if_stat_level_more_than AI_TARGET, STAT_DEF, 8, AI_CV_Roar2
+	if_stat_level_more_than AI_TARGET, STAT_SPATK, 8, AI_CV_Roar2
+	if_stat_level_more_than AI_TARGET, STAT_SPDEF, 8, AI_CV_Roar2
+	if_stat_level_more_than AI_TARGET, STAT_EVASION, 8, AI_CV_Roar2
+	score -3
+	goto AI_CV_Roar_End
+
+AI_CV_Roar2: ; .global AI_CV_Roar2
+	if_random_less_than 128, AI_CV_Roar_End
+	score +2
+
+AI_CV_Roar_End: ; .global AI_CV_Roar_End
+	end
+
+AI_CV_Conversion: ; .global AI_CV_Conversion
+	if_hp_more_than AI_USER, 90, AI_CV_Conversion2
+	score -2
+
+AI_CV_Conversion2: ; .global AI_CV_Conversion2
+	get_turn_count
+	if_equal 0, AI_CV_Conversion_End
+	if_random_less_than 200, Score_Minus2
+
+AI_CV_Conversion_End: ; .global AI_CV_Conversion_End
+	end
+
+AI_CV_HealWeather: ; .global AI_CV_HealWeather
+	get_weather
+	if_equal AI_WEATHER_HAIL, AI_CV_HealWeather_ScoreDown2
+	if_equal AI_WEATHER_RAIN, AI_CV_HealWeather_ScoreDown2
+	if_equal AI_WEATHER_SANDSTORM, AI_CV_HealWeather_ScoreDown2
+	goto AI_CV_Heal
+
+AI_CV_HealWeather_ScoreDown2: ; .global AI_CV_HealWeather_ScoreDown2
+	score -2
+
+AI_CV_Heal: ; .global AI_CV_Heal
+	if_hp_equal AI_USER, 100, AI_CV_Heal3
+	if_target_faster AI_CV_Heal4
+	score -8
+	goto AI_CV_Heal_End
+
+               
+AI_CV_Heal2:
+	if_hp_less_than AI_USER, 50, AI_CV_Heal5
+	if_hp_more_than AI_USER, 80, AI_CV_Heal3
+	if_random_less_than 70, AI_CV_Heal5
+
+AI_CV_Heal3: ; .global AI_CV_Heal3
+	score -3
+	goto AI_CV_Heal_End
+
+AI_CV_Heal4: ; .global AI_CV_Heal4
+	if_hp_less_than AI_USER, 70, AI_CV_Heal5
+	if_random_less_than 30, AI_CV_Heal5
+	score -3
+	goto AI_CV_Heal_End
+
+AI_CV_Heal5: ; .global AI_CV_Heal5
+	if_doesnt_have_move_with_effect AI_TARGET, EFFECT_SNATCH, AI_CV_Heal6
+	if_random_less_than 100, AI_CV_Heal_End
+
+AI_CV_Heal6: ; .global AI_CV_Heal6
+	if_random_less_than 20, AI_CV_Heal_End
+	score +2
+
+AI_CV_Heal_End: ; .global AI_CV_Heal_End
+	end
+
+AI_CV_Toxic: ; .global AI_CV_Toxic
+	if_user_has_no_attacking_moves AI_CV_Toxic3
+	if_hp_more_than AI_USER, 50, AI_CV_Toxic2
+	if_random_less_than 50, AI_CV_Toxic2
+	score -3
+
+AI_CV_Toxic2: ; .global AI_CV_Toxic2
+	if_hp_more_than AI_TARGET, 50, AI_CV_Toxic3
+	if_random_less_than 50, AI_CV_Toxic3
+	score -3
+
+AI_CV_Toxic3: ; .global AI_CV_Toxic3
+	if_has_move_with_effect AI_USER, EFFECT_SPECIAL_DEFENSE_UP, AI_CV_Toxic4
+	if_has_move_with_effect AI_USER, EFFECT_PROTECT, AI_CV_Toxic4
+	goto AI_CV_Toxic_End
+
+AI_CV_Toxic4: ; .global AI_CV_Toxic4
+	if_random_less_than 60, AI_CV_Toxic_End
+	score +2
+
+AI_CV_Toxic_End: ; .global AI_CV_Toxic_End
+	end
+
+AI_CV_LightScreen: ; .global AI_CV_LightScreen
+	if_hp_less_than AI_USER, 50, AI_CV_LightScreen_ScoreDown2
+	get_target_type1
+	if_in_bytes AI_CV_LightScreen_SpecialTypeList, AI_CV_LightScreen_End
+	get_target_type2
+	if_in_bytes AI_CV_LightScreen_SpecialTypeList, AI_CV_LightScreen_End
+	if_random_less_than 50, AI_CV_LightScreen_End
+
+AI_CV_LightScreen_ScoreDown2: ; .global AI_CV_LightScreen_ScoreDown2
+	score -2
+
+AI_CV_LightScreen_End: ; .global AI_CV_LightScreen_End
+	end
+
+AI_CV_LightScreen_SpecialTypeList: ; .global AI_CV_LightScreen_SpecialTypeList
+	.byte TYPE_FIRE
+	.byte TYPE_WATER
+	.byte TYPE_GRASS
+	.byte TYPE_ELECTRIC
+	.byte TYPE_PSYCHIC
+	.byte TYPE_ICE
+	.byte TYPE_DRAGON
+	.byte TYPE_DARK
+	.byte -1
+
+AI_CV_Rest: ; .global AI_CV_Rest
+	if_target_faster AI_CV_Rest4
+	if_hp_not_equal AI_USER, 100, AI_CV_Rest2
+	score -8
+	goto AI_CV_Rest_End
+
+AI_CV_Rest2: ; .global AI_CV_Rest2
+	if_hp_less_than AI_USER, 40, AI_CV_Rest6
+	if_hp_more_than AI_USER, 50, AI_CV_Rest3
+	if_random_less_than 70, AI_CV_Rest6
+
+AI_CV_Rest3: ; .global AI_CV_Rest3
+	score -3
+	goto AI_CV_Rest_End
+
+AI_CV_Rest4: ; .global AI_CV_Rest4
+	if_hp_less_than AI_USER, 60, AI_CV_Rest6
+	if_hp_more_than AI_USER, 70, AI_CV_Rest5
+	if_random_less_than 50, AI_CV_Rest6
+
+AI_CV_Rest5: ; .global AI_CV_Rest5
+	score -3
+	goto AI_CV_Rest_End
+
+AI_CV_Rest6: ; .global AI_CV_Rest6
+	if_doesnt_have_move_with_effect AI_TARGET, EFFECT_SNATCH, AI_CV_Rest7
+	if_random_less_than 50, AI_CV_Rest_End
+
+AI_CV_Rest7: ; .global AI_CV_Rest7
+	if_random_less_than 10, AI_CV_Rest_End
+	score +3
+
+AI_CV_Rest_End: ; .global AI_CV_Rest_End
+	end
+
+AI_CV_OneHitKO: ; .global AI_CV_OneHitKO
+	end
+
+AI_CV_SuperFang: ; .global AI_CV_SuperFang
+	if_hp_more_than AI_TARGET, 50, AI_CV_SuperFang_End
+	score -1
+
+AI_CV_SuperFang_End: ; .global AI_CV_SuperFang_End
+	end
+
+AI_CV_Trap: ; .global AI_CV_Trap
+	if_status AI_TARGET, STATUS1_TOXIC_POISON, AI_CV_Trap2
+	if_status2 AI_TARGET, STATUS2_CURSED, AI_CV_Trap2
+	if_status3 AI_TARGET, STATUS3_PERISH_SONG, AI_CV_Trap2
+	if_status2 AI_TARGET, STATUS2_INFATUATION, AI_CV_Trap2
+	goto AI_CV_Trap_End
+
+AI_CV_Trap2: ; .global AI_CV_Trap2
+	if_random_less_than 128, AI_CV_Trap_End
+	score +1
+
+AI_CV_Trap_End: ; .global AI_CV_Trap_End
+	end
+
+AI_CV_HighCrit: ; .global AI_CV_HighCrit
+	if_type_effectiveness AI_EFFECTIVENESS_x0_25, AI_CV_HighCrit_End
+	if_type_effectiveness AI_EFFECTIVENESS_x0_5, AI_CV_HighCrit_End
+	if_type_effectiveness AI_EFFECTIVENESS_x2, AI_CV_HighCrit2
+	if_type_effectiveness AI_EFFECTIVENESS_x4, AI_CV_HighCrit2
+	if_random_less_than 128, AI_CV_HighCrit_End
+
+AI_CV_HighCrit2: ; .global AI_CV_HighCrit2
+	if_random_less_than 128, AI_CV_HighCrit_End
+	score +1
+
+AI_CV_HighCrit_End: ; .global AI_CV_HighCrit_End
+	end
+
+                        
+               
+                                                             
+
+AI_CV_Flatter: ; .global AI_CV_Flatter
+	if_random_less_than 128, AI_CV_Confuse
+	score +1
+
+AI_CV_Confuse: ; .global AI_CV_Confuse
+	if_hp_more_than AI_TARGET, 70, AI_CV_Confuse_End
+	if_random_less_than 128, AI_CV_Confuse2
+	score -1
+
+AI_CV_Confuse2: ; .global AI_CV_Confuse2
+	if_hp_more_than AI_TARGET, 50, AI_CV_Confuse_End
+	score -1
+	if_hp_more_than AI_TARGET, 30, AI_CV_Confuse_End
+	score -1
+
+AI_CV_Confuse_End: ; .global AI_CV_Confuse_End
+	end
+
+                        
+                         
+                                                                                
+          
+                
+                                             
+          
+                                  
+ 
+                                
+          
+ 
+                             
+     
+
+AI_CV_Reflect: ; .global AI_CV_Reflect
+	if_hp_less_than AI_USER, 50, AI_CV_Reflect_ScoreDown2
+	get_target_type1
+	if_in_bytes AI_CV_Reflect_PhysicalTypeList, AI_CV_Reflect_End
+	get_target_type2
+	if_in_bytes AI_CV_Reflect_PhysicalTypeList, AI_CV_Reflect_End
+	if_random_less_than 50, AI_CV_Reflect_End
+
+AI_CV_Reflect_ScoreDown2: ; .global AI_CV_Reflect_ScoreDown2
+	score -2
+
+AI_CV_Reflect_End: ; .global AI_CV_Reflect_End
+	end
+
+AI_CV_Reflect_PhysicalTypeList: ; .global AI_CV_Reflect_PhysicalTypeList
+	.byte TYPE_NORMAL
+	.byte TYPE_FIGHTING
+	.byte TYPE_FLYING
+	.byte TYPE_POISON
+	.byte TYPE_GROUND
+	.byte TYPE_ROCK
+	.byte TYPE_BUG
+	.byte TYPE_GHOST
+	.byte TYPE_STEEL
+	.byte -1
+
+AI_CV_Poison: ; .global AI_CV_Poison
+	if_hp_less_than AI_USER, 50, AI_CV_Poison_ScoreDown1
+	if_hp_more_than AI_TARGET, 50, AI_CV_Poison_End
+
+AI_CV_Poison_ScoreDown1: ; .global AI_CV_Poison_ScoreDown1
+	score -1
+
+AI_CV_Poison_End: ; .global AI_CV_Poison_End
+	end
+
+AI_CV_Paralyze: ; .global AI_CV_Paralyze
+	if_target_faster AI_CV_Paralyze2
+	if_hp_more_than AI_USER, 70, AI_CV_Paralyze_End
+	score -1
+	goto AI_CV_Paralyze_End
+
+AI_CV_Paralyze2: ; .global AI_CV_Paralyze2
+	if_random_less_than 20, AI_CV_Paralyze_End
+	score +3
+
+AI_CV_Paralyze_End: ; .global AI_CV_Paralyze_End
+	end
+
+AI_CV_VitalThrow: ; .global AI_CV_VitalThrow
+	if_target_faster AI_CV_VitalThrow_End
+	if_hp_more_than AI_USER, 60, AI_CV_VitalThrow_End
+	if_hp_less_than AI_USER, 40, AI_CV_VitalThrow2
+	if_random_less_than 180, AI_CV_VitalThrow_End
+
+AI_CV_VitalThrow2: ; .global AI_CV_VitalThrow2
+	if_random_less_than 50, AI_CV_VitalThrow_End
+	score -1
+
+AI_CV_VitalThrow_End: ; .global AI_CV_VitalThrow_End
+	end
+
+AI_CV_Substitute: ; .global AI_CV_Substitute
+	if_hp_more_than AI_USER, 90, AI_CV_Substitute4
+	if_hp_more_than AI_USER, 70, AI_CV_Substitute3
+	if_hp_more_than AI_USER, 50, AI_CV_Substitute2
+	if_random_less_than 100, AI_CV_Substitute2
+	score -1
+
+AI_CV_Substitute2: ; .global AI_CV_Substitute2
+	if_random_less_than 100, AI_CV_Substitute3
+	score -1
+
+AI_CV_Substitute3: ; .global AI_CV_Substitute3
+	if_random_less_than 100, AI_CV_Substitute4
+	score -1
+
+AI_CV_Substitute4: ; .global AI_CV_Substitute4
+	if_target_faster AI_CV_Substitute_End
+	get_last_used_move AI_TARGET
+	get_move_effect_from_result
+	if_equal EFFECT_SLEEP, AI_CV_Substitute5
+	if_equal EFFECT_TOXIC, AI_CV_Substitute5
+	if_equal EFFECT_POISON, AI_CV_Substitute5
+	if_equal EFFECT_PARALYZE, AI_CV_Substitute5
+	if_equal EFFECT_WILL_O_WISP, AI_CV_Substitute5
+	if_equal EFFECT_CONFUSE, AI_CV_Substitute6
+	if_equal EFFECT_LEECH_SEED, AI_CV_Substitute7
+	goto AI_CV_Substitute_End
+
+AI_CV_Substitute5: ; .global AI_CV_Substitute5
+	if_not_status AI_TARGET, STATUS1_ANY, AI_CV_Substitute8
+	goto AI_CV_Substitute_End
+
+AI_CV_Substitute6: ; .global AI_CV_Substitute6
+	if_not_status2 AI_TARGET, STATUS2_CONFUSION, AI_CV_Substitute8
+	goto AI_CV_Substitute_End
+
+AI_CV_Substitute7: ; .global AI_CV_Substitute7
+	if_status3 AI_TARGET, STATUS3_LEECHSEED, AI_CV_Substitute_End
+
+AI_CV_Substitute8: ; .global AI_CV_Substitute8
+	if_random_less_than 100, AI_CV_Substitute_End
+	score +1
+
+AI_CV_Substitute_End: ; .global AI_CV_Substitute_End
+	end
+
+AI_CV_Recharge: ; .global AI_CV_Recharge
+	if_type_effectiveness AI_EFFECTIVENESS_x0_25, AI_CV_Recharge_ScoreDown1
+	if_type_effectiveness AI_EFFECTIVENESS_x0_5, AI_CV_Recharge_ScoreDown1
+	if_target_faster AI_CV_Recharge2
+	if_hp_more_than AI_USER, 40, AI_CV_Recharge_ScoreDown1
+	goto AI_CV_Recharge_End
+
+AI_CV_Recharge2: ; .global AI_CV_Recharge2
+	if_hp_less_than AI_USER, 60, AI_CV_Recharge_End
+
+AI_CV_Recharge_ScoreDown1: ; .global AI_CV_Recharge_ScoreDown1
+	score -1
+
+AI_CV_Recharge_End: ; .global AI_CV_Recharge_End
+	end
+
+AI_CV_Disable: ; .global AI_CV_Disable
+	if_target_faster AI_CV_Disable_End
+	get_last_used_move AI_TARGET
+	get_move_power_from_result
+	if_equal 0, AI_CV_Disable2
+	score +1
+	goto AI_CV_Disable_End
+
+AI_CV_Disable2: ; .global AI_CV_Disable2
+	if_random_less_than 100, AI_CV_Disable_End
+	score -1
+
+AI_CV_Disable_End: ; .global AI_CV_Disable_End
+	end
+
+AI_CV_Counter: ; .global AI_CV_Counter
+	if_status AI_TARGET, STATUS1_SLEEP, AI_CV_Counter_ScoreDown1
+	if_status2 AI_TARGET, STATUS2_INFATUATION, AI_CV_Counter_ScoreDown1
+	if_status2 AI_TARGET, STATUS2_CONFUSION, AI_CV_Counter_ScoreDown1
+	if_hp_more_than AI_USER, 30, AI_CV_Counter2
+	if_random_less_than 10, AI_CV_Counter2
+	score -1
+
+AI_CV_Counter2: ; .global AI_CV_Counter2
+	if_hp_more_than AI_USER, 50, AI_CV_Counter3
+	if_random_less_than 100, AI_CV_Counter3
+	score -1
+
+AI_CV_Counter3: ; .global AI_CV_Counter3
+                                                                                 
+	get_last_used_move AI_TARGET
+	get_move_power_from_result
+	if_equal 0, AI_CV_Counter5
+	if_target_not_taunted AI_CV_Counter4
+	if_random_less_than 100, AI_CV_Counter4
+	score +1
+
+AI_CV_Counter4: ; .global AI_CV_Counter4
+	get_last_used_move AI_TARGET
+	get_move_type_from_result
+	if_not_in_bytes AI_CV_Counter_PhysicalTypeList, AI_CV_Counter_ScoreDown1
+	if_random_less_than 100, AI_CV_Counter_End
+	score +1
+	goto AI_CV_Counter_End
+
+AI_CV_Counter5: ; .global AI_CV_Counter5
+	if_target_not_taunted AI_CV_Counter6
+	if_random_less_than 100, AI_CV_Counter6
+	score +1
+
+AI_CV_Counter6: ; .global AI_CV_Counter6
+	get_target_type1
+	if_in_bytes AI_CV_Counter_PhysicalTypeList, AI_CV_Counter_End
+	get_target_type2
+	if_in_bytes AI_CV_Counter_PhysicalTypeList, AI_CV_Counter_End
+	if_random_less_than 50, AI_CV_Counter_End
+
+                        
+                
+                                         
+          
+ 
+                
+     
+
+AI_CV_Counter_ScoreDown1: ; .global AI_CV_Counter_ScoreDown1
+	score -1
+
+AI_CV_Counter_End: ; .global AI_CV_Counter_End
+	end
+
+AI_CV_Counter_PhysicalTypeList: ; .global AI_CV_Counter_PhysicalTypeList
+	.byte TYPE_NORMAL
+	.byte TYPE_FIGHTING
+	.byte TYPE_FLYING
+	.byte TYPE_POISON
+	.byte TYPE_GROUND
+	.byte TYPE_ROCK
+	.byte TYPE_BUG
+	.byte TYPE_GHOST
+	.byte TYPE_STEEL
+	.byte -1
+
+AI_CV_Encore: ; .global AI_CV_Encore
+	if_any_move_disabled AI_TARGET, AI_CV_Encore2
+	if_target_faster AI_CV_Encore_ScoreDown2
+	get_last_used_move AI_TARGET
+	get_move_effect_from_result
+	if_not_in_bytes AI_CV_Encore_EncouragedMovesToEncore, AI_CV_Encore_ScoreDown2
+
+AI_CV_Encore2: ; .global AI_CV_Encore2
+	if_random_less_than 30, AI_CV_Encore_End
+	score +3
+	goto AI_CV_Encore_End
+
+AI_CV_Encore_ScoreDown2: ; .global AI_CV_Encore_ScoreDown2
+	score -2
+
+AI_CV_Encore_End: ; .global AI_CV_Encore_End
+	end
+
+AI_CV_Encore_EncouragedMovesToEncore: ; .global AI_CV_Encore_EncouragedMovesToEncore
+	.byte EFFECT_DREAM_EATER
+	.byte EFFECT_ATTACK_UP
+	.byte EFFECT_DEFENSE_UP
+	.byte EFFECT_SPEED_UP
+	.byte EFFECT_SPECIAL_ATTACK_UP
+	.byte EFFECT_HAZE
+	.byte EFFECT_ROAR
+	.byte EFFECT_CONVERSION
+	.byte EFFECT_TOXIC
+	.byte EFFECT_LIGHT_SCREEN
+	.byte EFFECT_REST
+	.byte EFFECT_SUPER_FANG
+	.byte EFFECT_SPECIAL_DEFENSE_UP_2
+	.byte EFFECT_CONFUSE
+	.byte EFFECT_POISON
+	.byte EFFECT_PARALYZE
+	.byte EFFECT_LEECH_SEED
+	.byte EFFECT_SPLASH
+	.byte EFFECT_ATTACK_UP_2
+	.byte EFFECT_ENCORE
+	.byte EFFECT_CONVERSION_2
+	.byte EFFECT_LOCK_ON
+	.byte EFFECT_HEAL_BELL
+	.byte EFFECT_MEAN_LOOK
+	.byte EFFECT_NIGHTMARE
+	.byte EFFECT_PROTECT
+	.byte EFFECT_SKILL_SWAP
+	.byte EFFECT_FORESIGHT
+	.byte EFFECT_PERISH_SONG
+	.byte EFFECT_SANDSTORM
+	.byte EFFECT_ENDURE
+	.byte EFFECT_SWAGGER
+	.byte EFFECT_ATTRACT
+	.byte EFFECT_SAFEGUARD
+	.byte EFFECT_RAIN_DANCE
+	.byte EFFECT_SUNNY_DAY
+	.byte EFFECT_BELLY_DRUM
+	.byte EFFECT_PSYCH_UP
+	.byte EFFECT_FUTURE_SIGHT
+	.byte EFFECT_FAKE_OUT
+	.byte EFFECT_STOCKPILE
+	.byte EFFECT_SPIT_UP
+	.byte EFFECT_SWALLOW
+	.byte EFFECT_HAIL
+	.byte EFFECT_TORMENT
+	.byte EFFECT_WILL_O_WISP
+	.byte EFFECT_FOLLOW_ME
+	.byte EFFECT_CHARGE
+	.byte EFFECT_TRICK
+	.byte EFFECT_ROLE_PLAY
+	.byte EFFECT_INGRAIN
+	.byte EFFECT_RECYCLE
+	.byte EFFECT_KNOCK_OFF
+	.byte EFFECT_SKILL_SWAP
+	.byte EFFECT_IMPRISON
+	.byte EFFECT_REFRESH
+	.byte EFFECT_GRUDGE
+	.byte EFFECT_TEETER_DANCE
+	.byte EFFECT_MUD_SPORT
+	.byte EFFECT_WATER_SPORT
+	.byte EFFECT_DRAGON_DANCE
+	.byte EFFECT_CAMOUFLAGE
+	.byte -1
+
+AI_CV_PainSplit: ; .global AI_CV_PainSplit
+	if_hp_less_than AI_TARGET, 80, AI_CV_PainSplit_ScoreDown1
+	if_target_faster AI_CV_PainSplit2
+	if_hp_more_than AI_USER, 40, AI_CV_PainSplit_ScoreDown1
+	score +1
+	goto AI_CV_PainSplit_End
+
+AI_CV_PainSplit2: ; .global AI_CV_PainSplit2
+	if_hp_more_than AI_USER, 60, AI_CV_PainSplit_ScoreDown1
+	score +1
+	goto AI_CV_PainSplit_End
+
+AI_CV_PainSplit_ScoreDown1: ; .global AI_CV_PainSplit_ScoreDown1
+	score -1
+
+AI_CV_PainSplit_End: ; .global AI_CV_PainSplit_End
+	end
+
+AI_CV_Snore: ; .global AI_CV_Snore
+	score +2
+	end
+
+AI_CV_LockOn: ; .global AI_CV_LockOn
+	if_random_less_than 128, AI_CV_LockOn_End
+	score +2
+
+AI_CV_LockOn_End: ; .global AI_CV_LockOn_End
+	end
+
+AI_CV_SleepTalk: ; .global AI_CV_SleepTalk
+                                                                          
+	score +2                 
+	end
+
+AI_CV_DestinyBond: ; .global AI_CV_DestinyBond
+	score -1
+	if_target_faster AI_CV_DestinyBond_End
+	if_hp_more_than AI_USER, 70, AI_CV_DestinyBond_End
+	if_random_less_than 128, AI_CV_DestinyBond2
+	score +1
+
+AI_CV_DestinyBond2: ; .global AI_CV_DestinyBond2
+	if_hp_more_than AI_USER, 50, AI_CV_DestinyBond_End
+	if_random_less_than 128, AI_CV_DestinyBond3
+	score +1
+
+AI_CV_DestinyBond3: ; .global AI_CV_DestinyBond3
+	if_hp_more_than AI_USER, 30, AI_CV_DestinyBond_End
+	if_random_less_than 100, AI_CV_DestinyBond_End
+	score +2
+
+AI_CV_DestinyBond_End: ; .global AI_CV_DestinyBond_End
+	end
+
+AI_CV_Flail: ; .global AI_CV_Flail
+	if_target_faster AI_CV_Flail2
+	if_hp_more_than AI_USER, 33, AI_CV_Flail_ScoreDown1
+	if_hp_more_than AI_USER, 20, AI_CV_Flail_End
+	if_hp_less_than AI_USER, 8, AI_CV_Flail_ScoreUp1
+	goto AI_CV_Flail3
+
+AI_CV_Flail2: ; .global AI_CV_Flail2
+	if_hp_more_than AI_USER, 60, AI_CV_Flail_ScoreDown1
+	if_hp_more_than AI_USER, 40, AI_CV_Flail_End
+	goto AI_CV_Flail3
+
+AI_CV_Flail_ScoreUp1: ; .global AI_CV_Flail_ScoreUp1
+	score +1
+
+AI_CV_Flail3: ; .global AI_CV_Flail3
+	if_random_less_than 100, AI_CV_Flail_End
+	score +1
+	goto AI_CV_Flail_End
+
+AI_CV_Flail_ScoreDown1: ; .global AI_CV_Flail_ScoreDown1
+	score -1
+
+AI_CV_Flail_End: ; .global AI_CV_Flail_End
+	end
+
+AI_CV_HealBell: ; .global AI_CV_HealBell
+	if_status AI_TARGET, STATUS1_ANY, AI_CV_HealBell_End
+	if_status_in_party AI_TARGET, STATUS1_ANY, AI_CV_HealBell_End
+	score -5
+
+AI_CV_HealBell_End: ; .global AI_CV_HealBell_End
+	end
+
+AI_CV_Thief: ; .global AI_CV_Thief
+	get_hold_effect AI_TARGET
+	if_not_in_bytes AI_CV_Thief_EncourageItemsToSteal, AI_CV_Thief_ScoreDown2
+	if_random_less_than 50, AI_CV_Thief_End
+	score +1
+	goto AI_CV_Thief_End
+
+AI_CV_Thief_ScoreDown2: ; .global AI_CV_Thief_ScoreDown2
+	score -2
+
+AI_CV_Thief_End: ; .global AI_CV_Thief_End
+	end
+
+AI_CV_Thief_EncourageItemsToSteal: ; .global AI_CV_Thief_EncourageItemsToSteal
+	.byte HOLD_EFFECT_CURE_SLP
+	.byte HOLD_EFFECT_CURE_STATUS
+	.byte HOLD_EFFECT_RESTORE_HP
+	.byte HOLD_EFFECT_EVASION_UP
+	.byte HOLD_EFFECT_LEFTOVERS
+	.byte HOLD_EFFECT_LIGHT_BALL
+	.byte HOLD_EFFECT_THICK_CLUB
+	.byte -1
+
+AI_CV_Curse: ; .global AI_CV_Curse
+	get_user_type1
+	if_equal TYPE_GHOST, AI_CV_Curse4
+	get_user_type2
+	if_equal TYPE_GHOST, AI_CV_Curse4
+	if_stat_level_more_than AI_USER, STAT_DEF, 9, AI_CV_Curse_End
+	if_random_less_than 128, AI_CV_Curse2
+	score +1
+
+AI_CV_Curse2: ; .global AI_CV_Curse2
+	if_stat_level_more_than AI_USER, STAT_DEF, 7, AI_CV_Curse_End
+	if_random_less_than 128, AI_CV_Curse3
+	score +1
+
+AI_CV_Curse3: ; .global AI_CV_Curse3
+	if_stat_level_more_than AI_USER, STAT_DEF, 6, AI_CV_Curse_End
+	if_random_less_than 128, AI_CV_Curse_End
+	score +1
+	goto AI_CV_Curse_End
+
+AI_CV_Curse4: ; .global AI_CV_Curse4
+	if_hp_more_than AI_USER, 80, AI_CV_Curse_End
+	score -1
+
+AI_CV_Curse_End: ; .global AI_CV_Curse_End
+	end
+
+AI_CV_Protect: ; .global AI_CV_Protect
+	get_protect_count AI_USER
+	if_more_than 1, AI_CV_Protect_ScoreDown2
+	if_status AI_USER, STATUS1_TOXIC_POISON, AI_CV_Protect3
+	if_status2 AI_USER, STATUS2_CURSED, AI_CV_Protect3
+	if_status3 AI_USER, STATUS3_PERISH_SONG, AI_CV_Protect3
+	if_status2 AI_USER, STATUS2_INFATUATION, AI_CV_Protect3
+	if_status3 AI_USER, STATUS3_LEECHSEED, AI_CV_Protect3
+	if_status3 AI_USER, STATUS3_YAWN, AI_CV_Protect3
+	if_has_move_with_effect AI_TARGET, EFFECT_RESTORE_HP, AI_CV_Protect3
+	if_has_move_with_effect AI_TARGET, EFFECT_DEFENSE_CURL, AI_CV_Protect3
+	if_status AI_TARGET, STATUS1_TOXIC_POISON, AI_CV_Protect_ScoreUp2
+	if_status2 AI_TARGET, STATUS2_CURSED, AI_CV_Protect_ScoreUp2
+	if_status3 AI_TARGET, STATUS3_PERISH_SONG, AI_CV_Protect_ScoreUp2
+	if_status2 AI_TARGET, STATUS2_INFATUATION, AI_CV_Protect_ScoreUp2
+	if_status3 AI_TARGET, STATUS3_LEECHSEED, AI_CV_Protect_ScoreUp2
+	if_status3 AI_TARGET, STATUS3_YAWN, AI_CV_Protect_ScoreUp2
+	get_last_used_move AI_TARGET
+	get_move_effect_from_result
+	if_not_equal EFFECT_LOCK_ON, AI_CV_Protect_ScoreUp2
+	goto AI_CV_Protect2
+
+AI_CV_Protect_ScoreUp2: ; .global AI_CV_Protect_ScoreUp2
+	score +2
+
+AI_CV_Protect2: ; .global AI_CV_Protect2
+                                                                   
+          
+
+AI_CV_Protect4: ; .global AI_CV_Protect4
+	get_protect_count AI_USER
+	if_equal 0, AI_CV_Protect_End
+	score -1
+	if_random_less_than 128, AI_CV_Protect_End
+	score -1
+	goto AI_CV_Protect_End
+
+AI_CV_Protect3: ; .global AI_CV_Protect3
+	get_last_used_move AI_TARGET
+	get_move_effect_from_result
+	if_not_equal EFFECT_LOCK_ON, AI_CV_Protect_End
+
+AI_CV_Protect_ScoreDown2: ; .global AI_CV_Protect_ScoreDown2
+	score -2
+
+AI_CV_Protect_End: ; .global AI_CV_Protect_End
+	end
+
+AI_CV_Foresight: ; .global AI_CV_Foresight
+	get_user_type1
+	if_equal TYPE_GHOST, AI_CV_Foresight2
+	get_user_type2
+	if_equal TYPE_GHOST, AI_CV_Foresight2
+	if_stat_level_more_than AI_USER, STAT_EVASION, 8, AI_CV_Foresight3
+	score -2
+	goto AI_CV_Foresight_End
+
+AI_CV_Foresight2: ; .global AI_CV_Foresight2
+	if_random_less_than 80, AI_CV_Foresight_End
+
+AI_CV_Foresight3: ; .global AI_CV_Foresight3
+	if_random_less_than 80, AI_CV_Foresight_End
+	score +2
+
+AI_CV_Foresight_End: ; .global AI_CV_Foresight_End
+	end
+
+AI_CV_Endure: ; .global AI_CV_Endure
+	if_hp_less_than AI_USER, 4, AI_CV_Endure2
+	if_hp_less_than AI_USER, 35, AI_CV_Endure3
+
+AI_CV_Endure2: ; .global AI_CV_Endure2
+	score -1
+	goto AI_CV_Endure_End
+
+AI_CV_Endure3: ; .global AI_CV_Endure3
+	if_random_less_than 70, AI_CV_Endure_End
+	score +1
+
+AI_CV_Endure_End: ; .global AI_CV_Endure_End
+	end
+
+AI_CV_BatonPass: ; .global AI_CV_BatonPass
+	if_stat_level_more_than AI_USER, STAT_ATK, 8, AI_CV_BatonPass2
+	if_stat_level_more_than AI_USER, STAT_DEF, 8, AI_CV_BatonPass2
+	if_stat_level_more_than AI_USER, STAT_SPATK, 8, AI_CV_BatonPass2
+	if_stat_level_more_than AI_USER, STAT_SPDEF, 8, AI_CV_BatonPass2
+	if_stat_level_more_than AI_USER, STAT_EVASION, 8, AI_CV_BatonPass2
+	goto AI_CV_BatonPass5
+
+AI_CV_BatonPass2: ; .global AI_CV_BatonPass2
+	if_target_faster AI_CV_BatonPass3
+	if_hp_more_than AI_USER, 60, AI_CV_BatonPass_End
+	goto AI_CV_BatonPass4
+
+AI_CV_BatonPass3: ; .global AI_CV_BatonPass3
+	if_hp_more_than AI_USER, 70, AI_CV_BatonPass_End
+
+AI_CV_BatonPass4: ; .global AI_CV_BatonPass4
+	if_random_less_than 80, AI_CV_BatonPass_End
+	score +2
+	goto AI_CV_BatonPass_End
+
+AI_CV_BatonPass5: ; .global AI_CV_BatonPass5
+	if_stat_level_more_than AI_USER, STAT_ATK, 7, AI_CV_BatonPass7
+	if_stat_level_more_than AI_USER, STAT_DEF, 7, AI_CV_BatonPass7
+	if_stat_level_more_than AI_USER, STAT_SPATK, 7, AI_CV_BatonPass7
+	if_stat_level_more_than AI_USER, STAT_SPDEF, 7, AI_CV_BatonPass7
+	if_stat_level_more_than AI_USER, STAT_EVASION, 7, AI_CV_BatonPass7
+	goto AI_CV_BatonPass_ScoreDown2
+
+AI_CV_BatonPass7: ; .global AI_CV_BatonPass7
+	if_target_faster AI_CV_BatonPass8
+	if_hp_more_than AI_USER, 60, AI_CV_BatonPass_ScoreDown2
+	goto AI_CV_BatonPass_End
+
+AI_CV_BatonPass8: ; .global AI_CV_BatonPass8
+	if_hp_less_than AI_USER, 70, AI_CV_BatonPass_End
+
+AI_CV_BatonPass_ScoreDown2: ; .global AI_CV_BatonPass_ScoreDown2
+	score -2
+
+AI_CV_BatonPass_End: ; .global AI_CV_BatonPass_End
+	end
+
+AI_CV_Pursuit: ; .global AI_CV_Pursuit
+	is_first_turn_for AI_USER
+	if_not_equal 0, AI_CV_Pursuit_End
+	get_target_type1
+	if_equal TYPE_GHOST, AI_CV_Pursuit2
+	get_target_type1
+	if_equal TYPE_PSYCHIC, AI_CV_Pursuit2
+	get_target_type2
+	if_equal TYPE_GHOST, AI_CV_Pursuit2
+	get_target_type2
+	if_equal TYPE_PSYCHIC, AI_CV_Pursuit2
+	goto AI_CV_Pursuit_End
+
+AI_CV_Pursuit2: ; .global AI_CV_Pursuit2
+	if_random_less_than 128, AI_CV_Pursuit_End
+	score +1
+
+AI_CV_Pursuit_End: ; .global AI_CV_Pursuit_End
+	end
+
+AI_CV_RainDance: ; .global AI_CV_RainDance
+	if_user_faster AI_CV_RainDance2
+	get_ability AI_USER
+	if_equal ABILITY_SWIFT_SWIM, AI_CV_RainDance3
+
+AI_CV_RainDance2: ; .global AI_CV_RainDance2
+	if_hp_less_than AI_USER, 40, AI_CV_RainDance_ScoreDown1
+	get_weather
+	if_equal AI_WEATHER_HAIL, AI_CV_RainDance3
+	if_equal AI_WEATHER_SUN, AI_CV_RainDance3
+	if_equal AI_WEATHER_SANDSTORM, AI_CV_RainDance3
+	get_ability AI_USER
+	if_equal ABILITY_RAIN_DISH, AI_CV_RainDance3
+	goto AI_CV_RainDance_End
+
+AI_CV_RainDance3: ; .global AI_CV_RainDance3
+	score +1
+	goto AI_CV_RainDance_End
+
+AI_CV_RainDance_ScoreDown1: ; .global AI_CV_RainDance_ScoreDown1
+	score -1
+
+AI_CV_RainDance_End: ; .global AI_CV_RainDance_End
+	end
+
+AI_CV_SunnyDay: ; .global AI_CV_SunnyDay
+	if_hp_less_than AI_USER, 40, AI_CV_SunnyDay_ScoreDown1
+	get_weather
+	if_equal AI_WEATHER_HAIL, AI_CV_SunnyDay2
+	if_equal AI_WEATHER_RAIN, AI_CV_SunnyDay2
+	if_equal AI_WEATHER_SANDSTORM, AI_CV_SunnyDay2
+	goto AI_CV_SunnyDay_End
+
+AI_CV_SunnyDay2: ; .global AI_CV_SunnyDay2
+	score +1
+	goto AI_CV_SunnyDay_End
+
+AI_CV_SunnyDay_ScoreDown1: ; .global AI_CV_SunnyDay_ScoreDown1
+	score -1
+
+AI_CV_SunnyDay_End: ; .global AI_CV_SunnyDay_End
+	end
+
+AI_CV_BellyDrum: ; .global AI_CV_BellyDrum
+	if_hp_less_than AI_USER, 90, AI_CV_BellyDrum_ScoreDown2
+	goto AI_CV_BellyDrum_End
+
+AI_CV_BellyDrum_ScoreDown2: ; .global AI_CV_BellyDrum_ScoreDown2
+	score -2
+
+AI_CV_BellyDrum_End: ; .global AI_CV_BellyDrum_End
+	end
+
+AI_CV_PsychUp: ; .global AI_CV_PsychUp
+	if_stat_level_more_than AI_TARGET, STAT_ATK, 8, AI_CV_PsychUp2
+	if_stat_level_more_than AI_TARGET, STAT_DEF, 8, AI_CV_PsychUp2
+	if_stat_level_more_than AI_TARGET, STAT_SPATK, 8, AI_CV_PsychUp2
+	if_stat_level_more_than AI_TARGET, STAT_SPDEF, 8, AI_CV_PsychUp2
+	if_stat_level_more_than AI_TARGET, STAT_EVASION, 8, AI_CV_PsychUp2
+	goto AI_CV_PsychUp_ScoreDown2
+
+AI_CV_PsychUp2: ; .global AI_CV_PsychUp2
+	if_stat_level_less_than AI_USER, STAT_ATK, 7, AI_CV_PsychUp3
+	if_stat_level_less_than AI_USER, STAT_DEF, 7, AI_CV_PsychUp3
+	if_stat_level_less_than AI_USER, STAT_SPATK, 7, AI_CV_PsychUp3
+	if_stat_level_less_than AI_USER, STAT_SPDEF, 7, AI_CV_PsychUp3
+	if_stat_level_less_than AI_USER, STAT_EVASION, 7, AI_CV_PsychUp_ScoreUp1
+	if_random_less_than 50, AI_CV_PsychUp_End
+	goto AI_CV_PsychUp_ScoreDown2
+
+AI_CV_PsychUp_ScoreUp1: ; .global AI_CV_PsychUp_ScoreUp1
+	score +1
+
+AI_CV_PsychUp3: ; .global AI_CV_PsychUp3
+	if_random_less_than 128, AI_CV_PsychUp_End                    
+	score +1
+                               
+
+AI_CV_PsychUp_ScoreDown2: ; .global AI_CV_PsychUp_ScoreDown2
+	score -2
+
+AI_CV_PsychUp_End: ; .global AI_CV_PsychUp_End
+	end
+
+AI_CV_MirrorCoat: ; .global AI_CV_MirrorCoat
+	if_status AI_TARGET, STATUS1_SLEEP, AI_CV_MirrorCoat_ScoreDown1
+	if_status2 AI_TARGET, STATUS2_INFATUATION, AI_CV_MirrorCoat_ScoreDown1
+	if_status2 AI_TARGET, STATUS2_CONFUSION, AI_CV_MirrorCoat_ScoreDown1
+	if_hp_more_than AI_USER, 30, AI_CV_MirrorCoat2
+	if_random_less_than 10, AI_CV_MirrorCoat2
+	score -1
+
+AI_CV_MirrorCoat2: ; .global AI_CV_MirrorCoat2
+	if_hp_more_than AI_USER, 50, AI_CV_MirrorCoat3
+	if_random_less_than 100, AI_CV_MirrorCoat3
+	score -1
+
+AI_CV_MirrorCoat3: ; .global AI_CV_MirrorCoat3
+                                                                                        
+	get_last_used_move AI_TARGET
+	get_move_power_from_result
+	if_equal 0, AI_CV_MirrorCoat5
+	if_target_not_taunted AI_CV_MirrorCoat4
+	if_random_less_than 100, AI_CV_MirrorCoat4
+	score +1
+
+AI_CV_MirrorCoat4: ; .global AI_CV_MirrorCoat4
+	get_last_used_move AI_TARGET
+	get_move_type_from_result
+	if_not_in_bytes AI_CV_MirrorCoat_SpecialTypeList, AI_CV_MirrorCoat_ScoreDown1
+	if_random_less_than 100, AI_CV_MirrorCoat_End
+	score +1
+	goto AI_CV_MirrorCoat_End
+
+AI_CV_MirrorCoat5: ; .global AI_CV_MirrorCoat5
+	if_target_not_taunted AI_CV_MirrorCoat6
+	if_random_less_than 100, AI_CV_MirrorCoat6
+	score +1
+
+AI_CV_MirrorCoat6: ; .global AI_CV_MirrorCoat6
+	get_target_type1
+	if_in_bytes AI_CV_MirrorCoat_SpecialTypeList, AI_CV_MirrorCoat_End
+	get_target_type2
+	if_in_bytes AI_CV_MirrorCoat_SpecialTypeList, AI_CV_MirrorCoat_End
+	if_random_less_than 50, AI_CV_MirrorCoat_End
+
+                        
+                           
+                                                        
+          
+ 
+                               
+     
+
+AI_CV_MirrorCoat_ScoreDown1: ; .global AI_CV_MirrorCoat_ScoreDown1
+	score -1
+
+AI_CV_MirrorCoat_End: ; .global AI_CV_MirrorCoat_End
+	end
+
+AI_CV_MirrorCoat_SpecialTypeList: ; .global AI_CV_MirrorCoat_SpecialTypeList
+	.byte TYPE_FIRE
+	.byte TYPE_WATER
+	.byte TYPE_GRASS
+	.byte TYPE_ELECTRIC
+	.byte TYPE_PSYCHIC
+	.byte TYPE_ICE
+	.byte TYPE_DRAGON
+	.byte TYPE_DARK
+	.byte -1
+
+AI_CV_ChargeUpMove: ; .global AI_CV_ChargeUpMove
+	if_type_effectiveness AI_EFFECTIVENESS_x0_25, AI_CV_ChargeUpMove_ScoreDown2
+	if_type_effectiveness AI_EFFECTIVENESS_x0_5, AI_CV_ChargeUpMove_ScoreDown2
+	if_has_move_with_effect AI_TARGET, EFFECT_PROTECT, AI_CV_ChargeUpMove_ScoreDown2
+	if_hp_more_than AI_USER, 38, AI_CV_ChargeUpMove_End
+	score -1
+	goto AI_CV_ChargeUpMove_End
+
+AI_CV_ChargeUpMove_ScoreDown2: ; .global AI_CV_ChargeUpMove_ScoreDown2
+	score -2
+
+AI_CV_ChargeUpMove_End: ; .global AI_CV_ChargeUpMove_End
+	end
+
+AI_CV_SemiInvulnerable: ; .global AI_CV_SemiInvulnerable
+	if_doesnt_have_move_with_effect AI_TARGET, EFFECT_PROTECT, AI_CV_SemiInvulnerable2
+	score -1
+	goto AI_CV_SemiInvulnerable_End
+
+                                                                                                  
+                                                                                     
+                                                                       
+AI_CV_SemiInvulnerable2: ; .global AI_CV_SemiInvulnerable2
+	if_status AI_TARGET, STATUS1_TOXIC_POISON, AI_CV_SemiInvulnerable_TryEncourage
+	if_status2 AI_TARGET, STATUS2_CURSED, AI_CV_SemiInvulnerable_TryEncourage
+	if_status3 AI_TARGET, STATUS3_LEECHSEED, AI_CV_SemiInvulnerable_TryEncourage
+	get_weather
+	if_equal AI_WEATHER_HAIL, AI_CV_SemiInvulnerable_CheckSandstormTypes
+	if_equal AI_WEATHER_SANDSTORM, AI_CV_SemiInvulnerable_CheckIceType
+	goto AI_CV_SemiInvulnerable5
+
+AI_CV_SemiInvulnerable_CheckSandstormTypes: ; .global AI_CV_SemiInvulnerable_CheckSandstormTypes
+	get_user_type1
+	if_in_bytes AI_CV_SandstormResistantTypes, AI_CV_SemiInvulnerable_TryEncourage
+	get_user_type2
+	if_in_bytes AI_CV_SandstormResistantTypes, AI_CV_SemiInvulnerable_TryEncourage
+	goto AI_CV_SemiInvulnerable5
+
+AI_CV_SemiInvulnerable_CheckIceType: ; .global AI_CV_SemiInvulnerable_CheckIceType
+	get_user_type1
+	if_equal TYPE_ICE, AI_CV_SemiInvulnerable_TryEncourage
+	get_user_type2
+	if_equal TYPE_ICE, AI_CV_SemiInvulnerable_TryEncourage
+
+AI_CV_SemiInvulnerable5: ; .global AI_CV_SemiInvulnerable5
+	if_target_faster AI_CV_SemiInvulnerable_End
+	get_last_used_move AI_TARGET
+	get_move_effect_from_result
+	if_not_equal EFFECT_LOCK_ON, AI_CV_SemiInvulnerable_TryEncourage
+	goto AI_CV_SemiInvulnerable_End
+
+AI_CV_SemiInvulnerable_TryEncourage: ; .global AI_CV_SemiInvulnerable_TryEncourage
+	if_random_less_than 80, AI_CV_SemiInvulnerable_End
+	score +1
+
+AI_CV_SemiInvulnerable_End: ; .global AI_CV_SemiInvulnerable_End
+	end
+
+AI_CV_SandstormResistantTypes: ; .global AI_CV_SandstormResistantTypes
+	.byte TYPE_GROUND
+	.byte TYPE_ROCK
+	.byte TYPE_STEEL
+	.byte -1
+
+AI_CV_FakeOut: ; .global AI_CV_FakeOut
+	score +2
+	end
+
+AI_CV_SpitUp: ; .global AI_CV_SpitUp
+	get_stockpile_count AI_USER
+	if_less_than 2, AI_CV_SpitUp_End
+	if_random_less_than 80, AI_CV_SpitUp_End
+	score +2
+
+AI_CV_SpitUp_End: ; .global AI_CV_SpitUp_End
+	end
+
+AI_CV_Hail: ; .global AI_CV_Hail
+	if_hp_less_than AI_USER, 40, AI_CV_Hail_ScoreDown1
+	get_weather
+	if_equal AI_WEATHER_SUN, AI_CV_Hail2
+	if_equal AI_WEATHER_RAIN, AI_CV_Hail2
+	if_equal AI_WEATHER_SANDSTORM, AI_CV_Hail2
+	goto AI_CV_Hail_End
+
+AI_CV_Hail2: ; .global AI_CV_Hail2
+	score +1
+	goto AI_CV_Hail_End
+
+AI_CV_Hail_ScoreDown1: ; .global AI_CV_Hail_ScoreDown1
+	score -1
+
+AI_CV_Hail_End: ; .global AI_CV_Hail_End
+	end
+
+                                                                                                                        
+AI_CV_Facade: ; .global AI_CV_Facade
+	if_not_status AI_TARGET, STATUS1_POISON | STATUS1_BURN | STATUS1_PARALYSIS | STATUS1_TOXIC_POISON, AI_CV_Facade_End
+	score +1
+
+AI_CV_Facade_End: ; .global AI_CV_Facade_End
+	end
+
+AI_CV_FocusPunch: ; .global AI_CV_FocusPunch
+	if_type_effectiveness AI_EFFECTIVENESS_x0_25, AI_CV_FocusPunch2
+	if_type_effectiveness AI_EFFECTIVENESS_x0_5, AI_CV_FocusPunch2
+	if_status AI_TARGET, STATUS1_SLEEP, AI_CV_FocusPunch_ScoreUp1
+	if_status2 AI_TARGET, STATUS2_INFATUATION, AI_CV_FocusPunch3
+	if_status2 AI_TARGET, STATUS2_CONFUSION, AI_CV_FocusPunch3
+	is_first_turn_for AI_USER
+	if_not_equal 0, AI_CV_FocusPunch_End
+	if_random_less_than 100, AI_CV_FocusPunch_End
+	score +1
+	goto AI_CV_FocusPunch_End
+
+AI_CV_FocusPunch2: ; .global AI_CV_FocusPunch2
+	score -1
+	goto AI_CV_FocusPunch_End
+
+AI_CV_FocusPunch3: ; .global AI_CV_FocusPunch3
+	if_random_less_than 100, AI_CV_FocusPunch_End
+
+AI_CV_FocusPunch_ScoreUp1: ; .global AI_CV_FocusPunch_ScoreUp1
+	score +1
+
+AI_CV_FocusPunch_End: ; .global AI_CV_FocusPunch_End
+	end
+
+AI_CV_SmellingSalt: ; .global AI_CV_SmellingSalt
+	if_status AI_TARGET, STATUS1_PARALYSIS, AI_CV_SmellingSalt_ScoreUp1
+	goto AI_CV_SmellingSalt_End
+
+AI_CV_SmellingSalt_ScoreUp1: ; .global AI_CV_SmellingSalt_ScoreUp1
+	score +1
+
+AI_CV_SmellingSalt_End: ; .global AI_CV_SmellingSalt_End
+	end
+
+AI_CV_Trick: ; .global AI_CV_Trick
+	get_hold_effect AI_USER
+	if_in_bytes AI_CV_Trick_ChoiceEffects, AI_CV_Trick3
+	if_in_bytes AI_CV_Trick_EffectsToEncourage, AI_CV_Trick4
+
+AI_CV_Trick2: ; .global AI_CV_Trick2
+	score -3
+	goto AI_CV_Trick_End
+
+AI_CV_Trick3: ; .global AI_CV_Trick3
+	get_hold_effect AI_TARGET
+	if_in_bytes AI_CV_Trick_ChoiceEffects, AI_CV_Trick2
+	score +5
+	goto AI_CV_Trick_End
+
+AI_CV_Trick4: ; .global AI_CV_Trick4
+	get_hold_effect AI_TARGET
+	if_in_bytes AI_CV_Trick_EffectsToEncourage, AI_CV_Trick2
+	if_random_less_than 50, AI_CV_Trick_End
+	score +2
+
+AI_CV_Trick_End: ; .global AI_CV_Trick_End
+	end
+
+AI_CV_Trick_EffectsToEncourage: ; .global AI_CV_Trick_EffectsToEncourage
+	.byte HOLD_EFFECT_CONFUSE_SPICY
+	.byte HOLD_EFFECT_CONFUSE_DRY
+	.byte HOLD_EFFECT_CONFUSE_SWEET
+	.byte HOLD_EFFECT_CONFUSE_BITTER
+	.byte HOLD_EFFECT_CONFUSE_SOUR
+	.byte HOLD_EFFECT_MACHO_BRACE
+	.byte HOLD_EFFECT_CHOICE_BAND
+	.byte -1
+
+AI_CV_Trick_ChoiceEffects: ; .global AI_CV_Trick_ChoiceEffects
+	.byte HOLD_EFFECT_CHOICE_BAND
+	.byte -1
+
+AI_CV_ChangeSelfAbility: ; .global AI_CV_ChangeSelfAbility
+	get_ability AI_USER
+	if_in_bytes AI_CV_ChangeSelfAbility_AbilitiesToEncourage, AI_CV_ChangeSelfAbility2
+	get_ability AI_TARGET
+	if_in_bytes AI_CV_ChangeSelfAbility_AbilitiesToEncourage, AI_CV_ChangeSelfAbility3
+
+AI_CV_ChangeSelfAbility2: ; .global AI_CV_ChangeSelfAbility2
+	score -1
+	goto AI_CV_ChangeSelfAbility_End
+
+AI_CV_ChangeSelfAbility3: ; .global AI_CV_ChangeSelfAbility3
+	if_random_less_than 50, AI_CV_ChangeSelfAbility_End
+	score +2
+
+AI_CV_ChangeSelfAbility_End: ; .global AI_CV_ChangeSelfAbility_End
+	end
+
+AI_CV_ChangeSelfAbility_AbilitiesToEncourage: ; .global AI_CV_ChangeSelfAbility_AbilitiesToEncourage
+	.byte ABILITY_SPEED_BOOST
+	.byte ABILITY_BATTLE_ARMOR
+	.byte ABILITY_SAND_VEIL
+	.byte ABILITY_STATIC
+	.byte ABILITY_FLASH_FIRE
+	.byte ABILITY_WONDER_GUARD
+	.byte ABILITY_EFFECT_SPORE
+	.byte ABILITY_SWIFT_SWIM
+	.byte ABILITY_HUGE_POWER
+	.byte ABILITY_RAIN_DISH
+	.byte ABILITY_CUTE_CHARM
+	.byte ABILITY_SHED_SKIN
+	.byte ABILITY_MARVEL_SCALE
+	.byte ABILITY_PURE_POWER
+	.byte ABILITY_CHLOROPHYLL
+	.byte ABILITY_SHIELD_DUST
+	.byte -1
+
+AI_CV_Superpower: ; .global AI_CV_Superpower
+	if_type_effectiveness AI_EFFECTIVENESS_x0_25, AI_CV_Superpower_ScoreDown1
+	if_type_effectiveness AI_EFFECTIVENESS_x0_5, AI_CV_Superpower_ScoreDown1
+	if_stat_level_less_than AI_USER, STAT_ATK, 6, AI_CV_Superpower_ScoreDown1
+	if_target_faster AI_CV_Superpower2
+	if_hp_more_than AI_USER, 40, AI_CV_Superpower_ScoreDown1
+	goto AI_CV_Superpower_End
+
+AI_CV_Superpower2: ; .global AI_CV_Superpower2
+	if_hp_less_than AI_USER, 60, AI_CV_Superpower_End
+
+AI_CV_Superpower_ScoreDown1: ; .global AI_CV_Superpower_ScoreDown1
+	score -1
+
+AI_CV_Superpower_End: ; .global AI_CV_Superpower_End
+	end
+
+AI_CV_MagicCoat: ; .global AI_CV_MagicCoat
+	if_hp_more_than AI_TARGET, 30, AI_CV_MagicCoat2
+	if_random_less_than 100, AI_CV_MagicCoat2
+	score -1
+
+AI_CV_MagicCoat2: ; .global AI_CV_MagicCoat2
+	is_first_turn_for AI_USER
+	if_equal 0, AI_CV_MagicCoat4
+	if_random_less_than 150, AI_CV_MagicCoat_End
+	score +1
+	goto AI_CV_MagicCoat_End
+	if_random_less_than 50, AI_CV_MagicCoat_End
+
+AI_CV_MagicCoat3: ; .global AI_CV_MagicCoat3
+                                                                       
+
+AI_CV_MagicCoat4: ; .global AI_CV_MagicCoat4
+	if_random_less_than 30, AI_CV_MagicCoat_End
+	score -1
+
+AI_CV_MagicCoat_End: ; .global AI_CV_MagicCoat_End
+	end
+
+AI_CV_Recycle: ; .global AI_CV_Recycle
+	get_used_held_item AI_USER
+	if_not_in_bytes AI_CV_Recycle_ItemsToEncourage, AI_CV_Recycle_ScoreDown2
+	if_random_less_than 50, AI_CV_Recycle_End
+	score +1
+	goto AI_CV_Recycle_End
+
+AI_CV_Recycle_ScoreDown2: ; .global AI_CV_Recycle_ScoreDown2
+	score -2
+
+AI_CV_Recycle_End: ; .global AI_CV_Recycle_End
+	end
+
+AI_CV_Recycle_ItemsToEncourage: ; .global AI_CV_Recycle_ItemsToEncourage
+	.byte ITEM_CHESTO_BERRY
+	.byte ITEM_LUM_BERRY
+	.byte ITEM_STARF_BERRY
+	.byte -1
+
+AI_CV_Revenge: ; .global AI_CV_Revenge
+	if_status AI_TARGET, STATUS1_SLEEP, AI_CV_Revenge_ScoreDown2
+	if_status2 AI_TARGET, STATUS2_INFATUATION, AI_CV_Revenge_ScoreDown2
+	if_status2 AI_TARGET, STATUS2_CONFUSION, AI_CV_Revenge_ScoreDown2
+	if_random_less_than 180, AI_CV_Revenge_ScoreDown2
+	score +2
+	goto AI_CV_Revenge_End
+
+AI_CV_Revenge_ScoreDown2: ; .global AI_CV_Revenge_ScoreDown2
+	score -2
+
+AI_CV_Revenge_End: ; .global AI_CV_Revenge_End
+	end
+
+AI_CV_BrickBreak: ; .global AI_CV_BrickBreak
+	if_side_affecting AI_TARGET, SIDE_STATUS_REFLECT, AI_CV_BrickBreak_ScoreUp1
+	goto AI_CV_BrickBreak_End
+
+AI_CV_BrickBreak_ScoreUp1: ; .global AI_CV_BrickBreak_ScoreUp1
+	score +1
+
+AI_CV_BrickBreak_End: ; .global AI_CV_BrickBreak_End
+	end
+
+AI_CV_KnockOff: ; .global AI_CV_KnockOff
+	if_hp_less_than AI_TARGET, 30, AI_CV_KnockOff_End
+	is_first_turn_for AI_USER
+	if_more_than 0, AI_CV_KnockOff_End
+	if_random_less_than 180, AI_CV_KnockOff_End
+	score +1
+
+AI_CV_KnockOff_End: ; .global AI_CV_KnockOff_End
+	end
+
+AI_CV_Endeavor: ; .global AI_CV_Endeavor
+	if_hp_less_than AI_TARGET, 70, AI_CV_Endeavor_ScoreDown1
+	if_target_faster AI_CV_Endeavor2
+	if_hp_more_than AI_USER, 40, AI_CV_Endeavor_ScoreDown1
+	score +1
+	goto AI_CV_Endeavor_End
+
+AI_CV_Endeavor2: ; .global AI_CV_Endeavor2
+	if_hp_more_than AI_USER, 50, AI_CV_Endeavor_ScoreDown1
+	score +1
+	goto AI_CV_Endeavor_End
+
+AI_CV_Endeavor_ScoreDown1: ; .global AI_CV_Endeavor_ScoreDown1
+	score -1
+
+AI_CV_Endeavor_End: ; .global AI_CV_Endeavor_End
+	end
+
+AI_CV_Eruption: ; .global AI_CV_Eruption
+	if_type_effectiveness AI_EFFECTIVENESS_x0_25, AI_CV_Eruption_ScoreDown1
+	if_type_effectiveness AI_EFFECTIVENESS_x0_5, AI_CV_Eruption_ScoreDown1
+	if_target_faster AI_CV_Eruption2
+	if_hp_more_than AI_TARGET, 50, AI_CV_Eruption_End
+	goto AI_CV_Eruption_ScoreDown1
+
+AI_CV_Eruption2: ; .global AI_CV_Eruption2
+	if_hp_more_than AI_TARGET, 70, AI_CV_Eruption_End
+
+AI_CV_Eruption_ScoreDown1: ; .global AI_CV_Eruption_ScoreDown1
+	score -1
+
+AI_CV_Eruption_End: ; .global AI_CV_Eruption_End
+	end
+
+AI_CV_Imprison: ; .global AI_CV_Imprison
+	is_first_turn_for AI_USER
+	if_more_than 0, AI_CV_Imprison_End
+	if_random_less_than 100, AI_CV_Imprison_End
+	score +2
+
+AI_CV_Imprison_End: ; .global AI_CV_Imprison_End
+	end
+
+AI_CV_Refresh: ; .global AI_CV_Refresh
+	if_hp_less_than AI_TARGET, 50, AI_CV_Refresh_ScoreDown1
+	goto AI_CV_Refresh_End
+
+AI_CV_Refresh_ScoreDown1: ; .global AI_CV_Refresh_ScoreDown1
+	score -1
+
+AI_CV_Refresh_End: ; .global AI_CV_Refresh_End
+	end
+
+AI_CV_Snatch: ; .global AI_CV_Snatch
+	is_first_turn_for AI_USER
+	if_equal 1, AI_CV_Snatch3
+	if_random_less_than 30, AI_CV_Snatch_End
+	if_target_faster AI_CV_Snatch2
+	if_hp_not_equal AI_USER, 100, AI_CV_Snatch5
+	if_hp_less_than AI_TARGET, 70, AI_CV_Snatch5
+	if_random_less_than 60, AI_CV_Snatch_End
+	goto AI_CV_Snatch5
+
+AI_CV_Snatch2: ; .global AI_CV_Snatch2
+	if_hp_more_than AI_TARGET, 25, AI_CV_Snatch5
+	if_has_move_with_effect AI_TARGET, EFFECT_RESTORE_HP, AI_CV_Snatch3
+	if_has_move_with_effect AI_TARGET, EFFECT_DEFENSE_CURL, AI_CV_Snatch3
+	goto AI_CV_Snatch4
+
+AI_CV_Snatch3: ; .global AI_CV_Snatch3
+	if_random_less_than 150, AI_CV_Snatch_End
+	score +2
+	goto AI_CV_Snatch_End
+
+AI_CV_Snatch4: ; .global AI_CV_Snatch4
+	if_random_less_than 230, AI_CV_Snatch5
+	score +1
+	goto AI_CV_Snatch_End
+
+AI_CV_Snatch5: ; .global AI_CV_Snatch5
+	if_random_less_than 30, AI_CV_Snatch_End
+	score -2
+
+AI_CV_Snatch_End: ; .global AI_CV_Snatch_End
+	end
+
+AI_CV_MudSport: ; .global AI_CV_MudSport
+	if_hp_less_than AI_USER, 50, AI_CV_MudSport_ScoreDown1
+	get_target_type1
+	if_equal TYPE_ELECTRIC, AI_CV_MudSport2
+	get_target_type2
+	if_equal TYPE_ELECTRIC, AI_CV_MudSport2
+	goto AI_CV_MudSport_ScoreDown1
+
+AI_CV_MudSport2: ; .global AI_CV_MudSport2
+	score +1
+	goto AI_CV_MudSport_End
+
+AI_CV_MudSport_ScoreDown1: ; .global AI_CV_MudSport_ScoreDown1
+	score -1
+
+AI_CV_MudSport_End: ; .global AI_CV_MudSport_End
+	end
+
+AI_CV_Overheat: ; .global AI_CV_Overheat
+	if_type_effectiveness AI_EFFECTIVENESS_x0_25, AI_CV_Overheat_ScoreDown1
+	if_type_effectiveness AI_EFFECTIVENESS_x0_5, AI_CV_Overheat_ScoreDown1
+	if_target_faster AI_CV_Overheat2
+	if_hp_more_than AI_USER, 60, AI_CV_Overheat_End
+	goto AI_CV_Overheat_ScoreDown1
+
+AI_CV_Overheat2: ; .global AI_CV_Overheat2
+	if_hp_more_than AI_USER, 80, AI_CV_Overheat_End
+
+AI_CV_Overheat_ScoreDown1: ; .global AI_CV_Overheat_ScoreDown1
+	score -1
+
+AI_CV_Overheat_End: ; .global AI_CV_Overheat_End
+	end
+
+AI_CV_WaterSport: ; .global AI_CV_WaterSport
+	if_hp_less_than AI_USER, 50, AI_CV_WaterSport_ScoreDown1
+	get_target_type1
+	if_equal TYPE_FIRE, AI_CV_WaterSport2
+	get_target_type2
+	if_equal TYPE_FIRE, AI_CV_WaterSport2
+	goto AI_CV_WaterSport_ScoreDown1
+
+AI_CV_WaterSport2: ; .global AI_CV_WaterSport2
+	score +1
+	goto AI_CV_WaterSport_End
+
+AI_CV_WaterSport_ScoreDown1: ; .global AI_CV_WaterSport_ScoreDown1
+	score -1
+
+AI_CV_WaterSport_End: ; .global AI_CV_WaterSport_End
+	end
+
+AI_CV_DragonDance: ; .global AI_CV_DragonDance
+	if_target_faster AI_CV_DragonDance2
+	if_hp_more_than AI_USER, 50, AI_CV_DragonDance_End
+	if_random_less_than 70, AI_CV_DragonDance_End
+	score -1
+	goto AI_CV_DragonDance_End
+
+AI_CV_DragonDance2: ; .global AI_CV_DragonDance2
+	if_random_less_than 128, AI_CV_DragonDance_End
+	score +1
+
+AI_CV_DragonDance_End: ; .global AI_CV_DragonDance_End
+	end
+
+AI_TryToFaint: ; .global AI_TryToFaint
+	if_can_faint AI_TryToFaint_TryToEncourageQuickAttack
+	get_how_powerful_move_is
+	if_equal MOVE_NOT_MOST_POWERFUL, Score_Minus1
+                                                                                                         
+	end
+
+                        
+                                    
+                                           
+          
+     
+
+AI_TryToFaint_TryToEncourageQuickAttack: ; .global AI_TryToFaint_TryToEncourageQuickAttack
+	if_effect EFFECT_EXPLOSION, AI_TryToFaint_End
+	if_not_effect EFFECT_QUICK_ATTACK, AI_TryToFaint_ScoreUp4
+	score +2
+
+AI_TryToFaint_ScoreUp4: ; .global AI_TryToFaint_ScoreUp4
+	score +4
+
+AI_TryToFaint_End: ; .global AI_TryToFaint_End
+	end
+
+AI_SetupFirstTurn: ; .global AI_SetupFirstTurn
+	get_turn_count
+	if_not_equal 0, AI_SetupFirstTurn_End
+	get_considered_move_effect
+	if_not_in_bytes AI_SetupFirstTurn_SetupEffectsToEncourage, AI_SetupFirstTurn_End
+	if_random_less_than 80, AI_SetupFirstTurn_End
+	score +2
+
+AI_SetupFirstTurn_End: ; .global AI_SetupFirstTurn_End
+	end
+
+AI_SetupFirstTurn_SetupEffectsToEncourage: ; .global AI_SetupFirstTurn_SetupEffectsToEncourage
+	.byte EFFECT_ATTACK_UP
+	.byte EFFECT_DEFENSE_UP
+	.byte EFFECT_SPEED_UP
+	.byte EFFECT_SPECIAL_ATTACK_UP
+	.byte EFFECT_SPECIAL_DEFENSE_UP
+	.byte EFFECT_ACCURACY_UP
+	.byte EFFECT_EVASION_UP
+	.byte EFFECT_ATTACK_DOWN
+	.byte EFFECT_DEFENSE_DOWN
+	.byte EFFECT_SPEED_DOWN
+	.byte EFFECT_SPECIAL_ATTACK_DOWN
+	.byte EFFECT_SPECIAL_DEFENSE_DOWN
+	.byte EFFECT_ACCURACY_DOWN
+	.byte EFFECT_EVASION_DOWN
+	.byte EFFECT_CONVERSION
+	.byte EFFECT_LIGHT_SCREEN
+	.byte EFFECT_SPECIAL_DEFENSE_UP_2
+	.byte EFFECT_FOCUS_ENERGY
+	.byte EFFECT_CONFUSE
+	.byte EFFECT_ATTACK_UP_2
+	.byte EFFECT_DEFENSE_UP_2
+	.byte EFFECT_SPEED_UP_2
+	.byte EFFECT_SPECIAL_ATTACK_UP_2
+	.byte EFFECT_SPECIAL_DEFENSE_UP_2
+	.byte EFFECT_ACCURACY_UP_2
+	.byte EFFECT_EVASION_UP_2
+	.byte EFFECT_ATTACK_DOWN_2
+	.byte EFFECT_DEFENSE_DOWN_2
+	.byte EFFECT_SPEED_DOWN_2
+	.byte EFFECT_SPECIAL_ATTACK_DOWN_2
+	.byte EFFECT_SPECIAL_DEFENSE_DOWN_2
+	.byte EFFECT_ACCURACY_DOWN_2
+	.byte EFFECT_EVASION_DOWN_2
+	.byte EFFECT_REFLECT
+	.byte EFFECT_POISON
+	.byte EFFECT_PARALYZE
+	.byte EFFECT_SUBSTITUTE
+	.byte EFFECT_LEECH_SEED
+	.byte EFFECT_MINIMIZE
+	.byte EFFECT_CURSE
+	.byte EFFECT_SWAGGER
+	.byte EFFECT_CAMOUFLAGE
+	.byte EFFECT_YAWN
+	.byte EFFECT_DEFENSE_CURL
+	.byte EFFECT_TORMENT
+	.byte EFFECT_FLATTER
+	.byte EFFECT_WILL_O_WISP
+	.byte EFFECT_INGRAIN
+	.byte EFFECT_IMPRISON
+	.byte EFFECT_TEETER_DANCE
+	.byte EFFECT_TICKLE
+	.byte EFFECT_COSMIC_POWER
+	.byte EFFECT_BULK_UP
+	.byte EFFECT_CALM_MIND
+	.byte EFFECT_CAMOUFLAGE
+	.byte -1
+
+AI_PreferStrongestMove: ; .global AI_PreferStrongestMove
+	get_how_powerful_move_is
+	if_not_equal MOVE_POWER_DISCOURAGED, AI_PreferStrongestMove_End
+	if_random_less_than 100, AI_PreferStrongestMove_End
+	score +2
+
+AI_PreferStrongestMove_End: ; .global AI_PreferStrongestMove_End
+	end
+
+AI_Risky: ; .global AI_Risky
+	get_considered_move_effect
+	if_not_in_bytes AI_Risky_EffectsToEncourage, AI_Risky_End
+	if_random_less_than 128, AI_Risky_End
+	score +2
+
+AI_Risky_End: ; .global AI_Risky_End
+	end
+
+AI_Risky_EffectsToEncourage: ; .global AI_Risky_EffectsToEncourage
+	.byte EFFECT_SLEEP
+	.byte EFFECT_EXPLOSION
+	.byte EFFECT_MIRROR_MOVE
+	.byte EFFECT_OHKO
+	.byte EFFECT_HIGH_CRITICAL
+	.byte EFFECT_CONFUSE
+	.byte EFFECT_METRONOME
+	.byte EFFECT_PSYWAVE
+	.byte EFFECT_COUNTER
+	.byte EFFECT_DESTINY_BOND
+	.byte EFFECT_SWAGGER
+	.byte EFFECT_ATTRACT
+	.byte EFFECT_PRESENT
+	.byte EFFECT_ALL_STATS_UP_HIT
+	.byte EFFECT_BELLY_DRUM
+	.byte EFFECT_MIRROR_COAT
+	.byte EFFECT_FOCUS_PUNCH
+	.byte EFFECT_REVENGE
+	.byte EFFECT_TEETER_DANCE
+	.byte -1
+
+AI_PreferBatonPass: ; .global AI_PreferBatonPass
+	count_alive_pokemon AI_USER
+	if_equal 0, AI_PreferBatonPass_End
+	get_how_powerful_move_is
+	if_not_equal MOVE_POWER_DISCOURAGED, AI_PreferBatonPass_End
+	if_has_move_with_effect AI_USER, EFFECT_BATON_PASS, AI_PreferBatonPass_GoForBatonPass
+	if_random_less_than 80, AI_Risky_End
+
+                                        
+AI_PreferBatonPass_GoForBatonPass: ; .global AI_PreferBatonPass_GoForBatonPass
+                                                
+                                                
+                                             
+                                               
+                                                                  
+	if_random_less_than 20, AI_Risky_End
+	score +3
+
+                     
+                
+                         
+                                            
+                  
+ 
+                      
+                            
+                                                            
+          
+     
+ 
+                                 
+                       
+                      
+             
+ 
+                                         
+                
+                          
+                                                           
+                                                           
+                                                           
+                                                             
+                                                             
+                                                             
+     
+
+AI_PreferBatonPass_End: ; .global AI_PreferBatonPass_End
+	end
+
+                            
+AI_DoubleBattle: ; .global AI_DoubleBattle
+	end
+
+AI_HPAware: ; .global AI_HPAware
+	if_hp_more_than AI_USER, 70, AI_HPAware_UserHasHighHP
+	if_hp_more_than AI_USER, 30, AI_HPAware_UserHasMediumHP
+	get_considered_move_effect
+	if_in_bytes AI_HPAware_DiscouragedEffectsWhenLowHP, AI_HPAware_TryToDiscourage
+	goto AI_HPAware_ConsiderTarget
+
+AI_HPAware_UserHasHighHP: ; .global AI_HPAware_UserHasHighHP
+	get_considered_move_effect
+	if_in_bytes AI_HPAware_DiscouragedEffectsWhenHighHP, AI_HPAware_TryToDiscourage
+	goto AI_HPAware_ConsiderTarget
+
+AI_HPAware_UserHasMediumHP: ; .global AI_HPAware_UserHasMediumHP
+	get_considered_move_effect
+	if_in_bytes AI_HPAware_DiscouragedEffectsWhenMediumHP, AI_HPAware_TryToDiscourage
+	goto AI_HPAware_ConsiderTarget
+
+AI_HPAware_TryToDiscourage: ; .global AI_HPAware_TryToDiscourage
+	if_random_less_than 50, AI_HPAware_ConsiderTarget
+	score -2
+
+AI_HPAware_ConsiderTarget: ; .global AI_HPAware_ConsiderTarget
+	if_hp_more_than AI_TARGET, 70, AI_HPAware_TargetHasHighHP
+	if_hp_more_than AI_TARGET, 30, AI_HPAware_TargetHasMediumHP
+	get_considered_move_effect
+	if_in_bytes AI_HPAware_DiscouragedEffectsWhenTargetLowHP, AI_HPAware_TargetTryToDiscourage
+	goto AI_HPAware_End
+
+AI_HPAware_TargetHasHighHP: ; .global AI_HPAware_TargetHasHighHP
+	get_considered_move_effect
+	if_in_bytes AI_HPAware_DiscouragedEffectsWhenTargetHighHP, AI_HPAware_TargetTryToDiscourage
+	goto AI_HPAware_End
+
+AI_HPAware_TargetHasMediumHP: ; .global AI_HPAware_TargetHasMediumHP
+	get_considered_move_effect
+	if_in_bytes AI_HPAware_DiscouragedEffectsWhenTargetMediumHP, AI_HPAware_TargetTryToDiscourage
+	goto AI_HPAware_End
+
+AI_HPAware_TargetTryToDiscourage: ; .global AI_HPAware_TargetTryToDiscourage
+	if_random_less_than 50, AI_HPAware_End
+	score -2
+
+AI_HPAware_End: ; .global AI_HPAware_End
+	end
+
+AI_HPAware_DiscouragedEffectsWhenHighHP: ; .global AI_HPAware_DiscouragedEffectsWhenHighHP
+	.byte EFFECT_EXPLOSION
+	.byte EFFECT_RESTORE_HP
+	.byte EFFECT_REST
+	.byte EFFECT_DESTINY_BOND
+	.byte EFFECT_FLAIL
+	.byte EFFECT_ENDURE
+	.byte EFFECT_MORNING_SUN
+	.byte EFFECT_SYNTHESIS
+	.byte EFFECT_MOONLIGHT
+	.byte EFFECT_SOFTBOILED
+	.byte EFFECT_MEMENTO
+	.byte EFFECT_GRUDGE
+	.byte EFFECT_OVERHEAT
+	.byte -1
+
+AI_HPAware_DiscouragedEffectsWhenMediumHP: ; .global AI_HPAware_DiscouragedEffectsWhenMediumHP
+	.byte EFFECT_EXPLOSION
+	.byte EFFECT_ATTACK_UP
+	.byte EFFECT_DEFENSE_UP
+	.byte EFFECT_SPEED_UP
+	.byte EFFECT_SPECIAL_ATTACK_UP
+	.byte EFFECT_SPECIAL_DEFENSE_UP
+	.byte EFFECT_ACCURACY_UP
+	.byte EFFECT_EVASION_UP
+	.byte EFFECT_ATTACK_DOWN
+	.byte EFFECT_DEFENSE_DOWN
+	.byte EFFECT_SPEED_DOWN
+	.byte EFFECT_SPECIAL_ATTACK_DOWN
+	.byte EFFECT_SPECIAL_DEFENSE_DOWN
+	.byte EFFECT_ACCURACY_DOWN
+	.byte EFFECT_EVASION_DOWN
+	.byte EFFECT_BIDE
+	.byte EFFECT_CONVERSION
+	.byte EFFECT_LIGHT_SCREEN
+	.byte EFFECT_MIST
+	.byte EFFECT_FOCUS_ENERGY
+	.byte EFFECT_ATTACK_UP_2
+	.byte EFFECT_DEFENSE_UP_2
+	.byte EFFECT_SPEED_UP_2
+	.byte EFFECT_SPECIAL_ATTACK_UP_2
+	.byte EFFECT_SPECIAL_DEFENSE_UP_2
+	.byte EFFECT_ACCURACY_UP_2
+	.byte EFFECT_EVASION_UP_2
+	.byte EFFECT_ATTACK_DOWN_2
+	.byte EFFECT_DEFENSE_DOWN_2
+	.byte EFFECT_SPEED_DOWN_2
+	.byte EFFECT_SPECIAL_ATTACK_DOWN_2
+	.byte EFFECT_SPECIAL_DEFENSE_DOWN_2
+	.byte EFFECT_ACCURACY_DOWN_2
+	.byte EFFECT_EVASION_DOWN_2
+	.byte EFFECT_CONVERSION_2
+	.byte EFFECT_SAFEGUARD
+	.byte EFFECT_BELLY_DRUM
+	.byte EFFECT_TICKLE
+	.byte EFFECT_COSMIC_POWER
+	.byte EFFECT_BULK_UP
+	.byte EFFECT_CALM_MIND
+	.byte EFFECT_DRAGON_DANCE
+	.byte -1
+
+AI_HPAware_DiscouragedEffectsWhenLowHP: ; .global AI_HPAware_DiscouragedEffectsWhenLowHP
+	.byte EFFECT_ATTACK_UP
+	.byte EFFECT_DEFENSE_UP
+	.byte EFFECT_SPEED_UP
+	.byte EFFECT_SPECIAL_ATTACK_UP
+	.byte EFFECT_SPECIAL_DEFENSE_UP
+	.byte EFFECT_ACCURACY_UP
+	.byte EFFECT_EVASION_UP
+	.byte EFFECT_ATTACK_DOWN
+	.byte EFFECT_DEFENSE_DOWN
+	.byte EFFECT_SPEED_DOWN
+	.byte EFFECT_SPECIAL_ATTACK_DOWN
+	.byte EFFECT_SPECIAL_DEFENSE_DOWN
+	.byte EFFECT_ACCURACY_DOWN
+	.byte EFFECT_EVASION_DOWN
+	.byte EFFECT_BIDE
+	.byte EFFECT_CONVERSION
+	.byte EFFECT_LIGHT_SCREEN
+	.byte EFFECT_MIST
+	.byte EFFECT_FOCUS_ENERGY
+	.byte EFFECT_ATTACK_UP_2
+	.byte EFFECT_DEFENSE_UP_2
+	.byte EFFECT_SPEED_UP_2
+	.byte EFFECT_SPECIAL_ATTACK_UP_2
+	.byte EFFECT_SPECIAL_DEFENSE_UP_2
+	.byte EFFECT_ACCURACY_UP_2
+	.byte EFFECT_EVASION_UP_2
+	.byte EFFECT_ATTACK_DOWN_2
+	.byte EFFECT_DEFENSE_DOWN_2
+	.byte EFFECT_SPEED_DOWN_2
+	.byte EFFECT_SPECIAL_ATTACK_DOWN_2
+	.byte EFFECT_SPECIAL_DEFENSE_DOWN_2
+	.byte EFFECT_ACCURACY_DOWN_2
+	.byte EFFECT_EVASION_DOWN_2
+	.byte EFFECT_RAGE
+	.byte EFFECT_CONVERSION_2
+	.byte EFFECT_LOCK_ON
+	.byte EFFECT_SAFEGUARD
+	.byte EFFECT_BELLY_DRUM
+	.byte EFFECT_PSYCH_UP
+	.byte EFFECT_MIRROR_COAT
+	.byte EFFECT_SOLAR_BEAM
+	.byte EFFECT_ERUPTION
+	.byte EFFECT_TICKLE
+	.byte EFFECT_COSMIC_POWER
+	.byte EFFECT_BULK_UP
+	.byte EFFECT_CALM_MIND
+	.byte EFFECT_DRAGON_DANCE
+	.byte -1
+
+AI_HPAware_DiscouragedEffectsWhenTargetHighHP: ; .global AI_HPAware_DiscouragedEffectsWhenTargetHighHP
+	.byte -1
+
+AI_HPAware_DiscouragedEffectsWhenTargetMediumHP: ; .global AI_HPAware_DiscouragedEffectsWhenTargetMediumHP
+	.byte EFFECT_ATTACK_UP
+	.byte EFFECT_DEFENSE_UP
+	.byte EFFECT_SPEED_UP
+	.byte EFFECT_SPECIAL_ATTACK_UP
+	.byte EFFECT_SPECIAL_DEFENSE_UP
+	.byte EFFECT_ACCURACY_UP
+	.byte EFFECT_EVASION_UP
+	.byte EFFECT_ATTACK_DOWN
+	.byte EFFECT_DEFENSE_DOWN
+	.byte EFFECT_SPEED_DOWN
+	.byte EFFECT_SPECIAL_ATTACK_DOWN
+	.byte EFFECT_SPECIAL_DEFENSE_DOWN
+	.byte EFFECT_ACCURACY_DOWN
+	.byte EFFECT_EVASION_DOWN
+	.byte EFFECT_MIST
+	.byte EFFECT_FOCUS_ENERGY
+	.byte EFFECT_ATTACK_UP_2
+	.byte EFFECT_DEFENSE_UP_2
+	.byte EFFECT_SPEED_UP_2
+	.byte EFFECT_SPECIAL_ATTACK_UP_2
+	.byte EFFECT_SPECIAL_DEFENSE_UP_2
+	.byte EFFECT_ACCURACY_UP_2
+	.byte EFFECT_EVASION_UP_2
+	.byte EFFECT_ATTACK_DOWN_2
+	.byte EFFECT_DEFENSE_DOWN_2
+	.byte EFFECT_SPEED_DOWN_2
+	.byte EFFECT_SPECIAL_ATTACK_DOWN_2
+	.byte EFFECT_SPECIAL_DEFENSE_DOWN_2
+	.byte EFFECT_ACCURACY_DOWN_2
+	.byte EFFECT_EVASION_DOWN_2
+	.byte EFFECT_POISON
+	.byte EFFECT_PAIN_SPLIT
+	.byte EFFECT_PERISH_SONG
+	.byte EFFECT_SAFEGUARD
+	.byte EFFECT_TICKLE
+	.byte EFFECT_COSMIC_POWER
+	.byte EFFECT_BULK_UP
+	.byte EFFECT_CALM_MIND
+	.byte EFFECT_DRAGON_DANCE
+	.byte -1
+
+AI_HPAware_DiscouragedEffectsWhenTargetLowHP: ; .global AI_HPAware_DiscouragedEffectsWhenTargetLowHP
+	.byte EFFECT_SLEEP
+	.byte EFFECT_EXPLOSION
+	.byte EFFECT_ATTACK_UP
+	.byte EFFECT_DEFENSE_UP
+	.byte EFFECT_SPEED_UP
+	.byte EFFECT_SPECIAL_ATTACK_UP
+	.byte EFFECT_SPECIAL_DEFENSE_UP
+	.byte EFFECT_ACCURACY_UP
+	.byte EFFECT_EVASION_UP
+	.byte EFFECT_ATTACK_DOWN
+	.byte EFFECT_DEFENSE_DOWN
+	.byte EFFECT_SPEED_DOWN
+	.byte EFFECT_SPECIAL_ATTACK_DOWN
+	.byte EFFECT_SPECIAL_DEFENSE_DOWN
+	.byte EFFECT_ACCURACY_DOWN
+	.byte EFFECT_EVASION_DOWN
+	.byte EFFECT_BIDE
+	.byte EFFECT_CONVERSION
+	.byte EFFECT_TOXIC
+	.byte EFFECT_LIGHT_SCREEN
+	.byte EFFECT_OHKO
+	.byte EFFECT_SUPER_FANG                                          
+	.byte EFFECT_SUPER_FANG
+	.byte EFFECT_MIST
+	.byte EFFECT_FOCUS_ENERGY
+	.byte EFFECT_CONFUSE
+	.byte EFFECT_ATTACK_UP_2
+	.byte EFFECT_DEFENSE_UP_2
+	.byte EFFECT_SPEED_UP_2
+	.byte EFFECT_SPECIAL_ATTACK_UP_2
+	.byte EFFECT_SPECIAL_DEFENSE_UP_2
+	.byte EFFECT_ACCURACY_UP_2
+	.byte EFFECT_EVASION_UP_2
+	.byte EFFECT_ATTACK_DOWN_2
+	.byte EFFECT_DEFENSE_DOWN_2
+	.byte EFFECT_SPEED_DOWN_2
+	.byte EFFECT_SPECIAL_ATTACK_DOWN_2
+	.byte EFFECT_SPECIAL_DEFENSE_DOWN_2
+	.byte EFFECT_ACCURACY_DOWN_2
+	.byte EFFECT_EVASION_DOWN_2
+	.byte EFFECT_POISON
+	.byte EFFECT_PARALYZE
+	.byte EFFECT_PAIN_SPLIT
+	.byte EFFECT_CONVERSION_2
+	.byte EFFECT_LOCK_ON
+	.byte EFFECT_SPITE
+	.byte EFFECT_PERISH_SONG
+	.byte EFFECT_SWAGGER
+	.byte EFFECT_FURY_CUTTER
+	.byte EFFECT_ATTRACT
+	.byte EFFECT_SAFEGUARD
+	.byte EFFECT_PSYCH_UP
+	.byte EFFECT_MIRROR_COAT
+	.byte EFFECT_WILL_O_WISP
+	.byte EFFECT_TICKLE
+	.byte EFFECT_COSMIC_POWER
+	.byte EFFECT_BULK_UP
+	.byte EFFECT_CALM_MIND
+	.byte EFFECT_DRAGON_DANCE
+	.byte -1
+
+AI_Unknown: ; .global AI_Unknown
+	if_not_effect EFFECT_SUNNY_DAY, AI_Unknown_End
+	if_equal 0, AI_Unknown_End
+	is_first_turn_for AI_USER
+	if_equal 0, AI_Unknown_End
+	score +5
+
+AI_Unknown_End: ; .global AI_Unknown_End
+	end
+
+AI_Roaming: ; .global AI_Roaming
+	if_status2 AI_USER, STATUS2_WRAPPED, AI_Roaming_End
+	if_status2 AI_USER, STATUS2_ESCAPE_PREVENTION, AI_Roaming_End
+	get_ability AI_TARGET
+	if_equal ABILITY_SHADOW_TAG, AI_Roaming_End
+	get_ability AI_USER
+	if_equal ABILITY_LEVITATE, AI_Roaming_Flee
+	get_ability AI_TARGET
+	if_equal ABILITY_ARENA_TRAP, AI_Roaming_End
+
+AI_Roaming_Flee: ; .global AI_Roaming_Flee
+	flee
+
+AI_Roaming_End: ; .global AI_Roaming_End
+	end
+
+AI_Safari: ; .global AI_Safari
+	if_random_safari_flee AI_Safari_Flee
+	watch
+
+AI_Safari_Flee: ; .global AI_Safari_Flee
+	flee
+
+                                                    
+AI_FirstBattle: ; .global AI_FirstBattle
+	if_hp_equal AI_TARGET, 20, AI_FirstBattle_Flee
+	if_hp_less_than AI_TARGET, 20, AI_FirstBattle_Flee
+	end
+
+AI_FirstBattle_Flee: ; .global AI_FirstBattle_Flee
+	flee
+
+AI_Ret: ; .global AI_Ret
+	end
@@ -0,0 +1,5768 @@
+# 1 "data/battle_scripts_1.s"
+#include "constants/global.h"
+#include "constants/moves.h"
+#include "constants/battle.h"
+#include "constants/battle_move_effects.h"
+#include "constants/battle_script_commands.h"
+#include "constants/battle_anim.h"
+#include "constants/items.h"
+#include "constants/abilities.h"
+#include "constants/species.h"
+#include "constants/pokemon.h"
+#include "constants/songs.h"
+#include "constants/trainers.h"
+#include "constants/game_stat.h"
+#include "constants/battle_string_ids.h"
+# 1 "asm/macros/battle_script.inc"
+          
+	.macro attackcanceler
+	.byte 0x0
+	.endm
+
+	.macro accuracycheck param0:req, param1:req
+	.byte 0x1
+	.4byte \param0
+	.2byte \param1
+	.endm
+
+	.macro attackstring
+	.byte 0x2
+	.endm
+
+	.macro ppreduce
+	.byte 0x3
+	.endm
+
+	.macro critcalc
+	.byte 0x4
+	.endm
+
+	.macro damagecalc
+	.byte 0x5
+	.endm
+
+	.macro typecalc
+	.byte 0x6
+	.endm
+
+	.macro adjustnormaldamage
+	.byte 0x7
+	.endm
+
+	.macro adjustnormaldamage2
+	.byte 0x8
+	.endm
+
+	.macro attackanimation
+	.byte 0x9
+	.endm
+
+	.macro waitanimation
+	.byte 0xa
+	.endm
+
+	.macro healthbarupdate battler:req
+	.byte 0xb
+	.byte \battler
+	.endm
+
+	.macro datahpupdate battler:req
+	.byte 0xc
+	.byte \battler
+	.endm
+
+	.macro critmessage
+	.byte 0xd
+	.endm
+
+	.macro effectivenesssound
+	.byte 0xe
+	.endm
+
+	.macro resultmessage
+	.byte 0xf
+	.endm
+
+	.macro printstring id:req
+	.byte 0x10
+	.2byte \id
+	.endm
+
+	.macro printselectionstring id:req
+	.byte 0x11
+	.2byte \id
+	.endm
+
+	.macro waitmessage param0:req
+	.byte 0x12
+	.2byte \param0
+	.endm
+
+	.macro printfromtable ptr:req
+	.byte 0x13
+	.4byte \ptr
+	.endm
+
+	.macro printselectionstringfromtable ptr:req
+	.byte 0x14
+	.4byte \ptr
+	.endm
+
+	.macro seteffectwithchance
+	.byte 0x15
+	.endm
+
+	.macro seteffectprimary
+	.byte 0x16
+	.endm
+
+	.macro seteffectsecondary
+	.byte 0x17
+	.endm
+
+	.macro clearstatusfromeffect battler:req
+	.byte 0x18
+	.byte \battler
+	.endm
+
+	.macro tryfaintmon battler:req
+	.byte 0x19
+	.byte \battler
+	.byte FALSE
+	.4byte NULL
+	.endm
+
+	.macro tryfaintmon_spikes battler:req, ptr:req
+	.byte 0x19
+	.byte \battler
+	.byte TRUE
+	.4byte \ptr
+	.endm
+
+	.macro dofaintanimation battler:req
+	.byte 0x1a
+	.byte \battler
+	.endm
+
+	.macro cleareffectsonfaint battler:req
+	.byte 0x1b
+	.byte \battler
+	.endm
+
+	.macro jumpifstatus battler:req, status1:req, ptr:req
+	.byte 0x1c
+	.byte \battler
+	.4byte \status1
+	.4byte \ptr
+	.endm
+
+	.macro jumpifstatus2 battler:req, status2:req, ptr:req
+	.byte 0x1d
+	.byte \battler
+	.4byte \status2
+	.4byte \ptr
+	.endm
+
+	.macro jumpifability param0:req, ability:req, ptr:req
+	.byte 0x1e
+	.byte \param0
+	.byte \ability
+	.4byte \ptr
+	.endm
+
+	.macro jumpifsideaffecting battler:req, sidestatus:req, ptr:req
+	.byte 0x1f
+	.byte \battler
+	.2byte \sidestatus
+	.4byte \ptr
+	.endm
+
+	.macro jumpifstat battler:req, ifflag:req, stat:req, value:req, ptr
+	.byte 0x20
+	.byte \battler
+	.byte \ifflag
+	.byte \stat
+	.byte \value
+	.4byte \ptr
+	.endm
+
+	.macro jumpifstatus3condition battler:req, status3:req, param2:req, ptr:req
+	.byte 0x21
+	.byte \battler
+	.4byte \status3
+	.byte \param2
+	.4byte \ptr
+	.endm
+
+	.macro jumpiftype battler:req, type:req, ptr:req
+	.byte 0x22
+	.byte \battler
+	.byte \type
+	.4byte \ptr
+	.endm
+
+	.macro getexp battler:req
+	.byte 0x23
+	.byte \battler
+	.endm
+
+	.macro checkteamslost ptr:req
+	.byte 0x24
+	.4byte \ptr
+	.endm
+
+	.macro movevaluescleanup
+	.byte 0x25
+	.endm
+
+	.macro setmultihit value:req
+	.byte 0x26
+	.byte \value
+	.endm
+
+	.macro decrementmultihit value:req
+	.byte 0x27
+	.4byte \value
+	.endm
+
+	.macro goto ptr:req
+	.byte 0x28
+	.4byte \ptr
+	.endm
+
+	.macro jumpifbyte ifflag:req, param1:req, param2:req, param3:req
+	.byte 0x29
+	.byte \ifflag
+	.4byte \param1
+	.byte \param2
+	.4byte \param3
+	.endm
+
+	.macro jumpifhalfword ifflag:req, param1:req, param2:req, param3:req
+	.byte 0x2a
+	.byte \ifflag
+	.4byte \param1
+	.2byte \param2
+	.4byte \param3
+	.endm
+
+	.macro jumpifword ifflag:req, param1:req, param2:req, param3:req
+	.byte 0x2b
+	.byte \ifflag
+	.4byte \param1
+	.4byte \param2
+	.4byte \param3
+	.endm
+
+	.macro jumpifarrayequal param0:req, param1:req, param2:req, param3:req
+	.byte 0x2c
+	.4byte \param0
+	.4byte \param1
+	.byte \param2
+	.4byte \param3
+	.endm
+
+	.macro jumpifarraynotequal param0:req, param1:req, param2:req, param3:req
+	.byte 0x2d
+	.4byte \param0
+	.4byte \param1
+	.byte \param2
+	.4byte \param3
+	.endm
+
+	.macro setbyte ptr:req, param1:req
+	.byte 0x2e
+	.4byte \ptr
+	.byte \param1
+	.endm
+
+	.macro addbyte ptr:req, param1:req
+	.byte 0x2f
+	.4byte \ptr
+	.byte \param1
+	.endm
+
+	.macro subbyte ptr:req, param1:req
+	.byte 0x30
+	.4byte \ptr
+	.byte \param1
+	.endm
+
+	.macro copyarray param0:req, param1:req, param2:req
+	.byte 0x31
+	.4byte \param0
+	.4byte \param1
+	.byte \param2
+	.endm
+
+	.macro copyarraywithindex param0:req, param1:req, param2:req, param3:req
+	.byte 0x32
+	.4byte \param0
+	.4byte \param1
+	.4byte \param2
+	.byte \param3
+	.endm
+
+	.macro orbyte ptr:req, param1:req
+	.byte 0x33
+	.4byte \ptr
+	.byte \param1
+	.endm
+
+	.macro orhalfword ptr:req, param1:req
+	.byte 0x34
+	.4byte \ptr
+	.2byte \param1
+	.endm
+
+	.macro orword ptr:req, param1:req
+	.byte 0x35
+	.4byte \ptr
+	.4byte \param1
+	.endm
+
+	.macro bicbyte ptr:req, param1:req
+	.byte 0x36
+	.4byte \ptr
+	.byte \param1
+	.endm
+
+	.macro bichalfword ptr:req, param1:req
+	.byte 0x37
+	.4byte \ptr
+	.2byte \param1
+	.endm
+
+	.macro bicword ptr:req, param1:req
+	.byte 0x38
+	.4byte \ptr
+	.4byte \param1
+	.endm
+
+	.macro pause param0:req
+	.byte 0x39
+	.2byte \param0
+	.endm
+
+	.macro waitstate
+	.byte 0x3a
+	.endm
+
+	.macro healthbar_update battler:req
+	.byte 0x3b
+	.byte \battler
+	.endm
+
+	.macro return
+	.byte 0x3c
+	.endm
+
+	.macro end
+	.byte 0x3d
+	.endm
+
+	.macro end2
+	.byte 0x3e
+	.endm
+
+	.macro end3
+	.byte 0x3f
+	.endm
+
+	.macro jumpifaffectedbyprotect ptr:req
+	.byte 0x40
+	.4byte \ptr
+	.endm
+
+	.macro call ptr:req
+	.byte 0x41
+	.4byte \ptr
+	.endm
+
+	.macro jumpiftype2 battler:req, type:req, ptr:req
+	.byte 0x42
+	.byte \battler
+	.byte \type
+	.4byte \ptr
+	.endm
+
+	.macro jumpifabilitypresent ability:req, ptr:req
+	.byte 0x43
+	.byte \ability
+	.4byte \ptr
+	.endm
+
+	.macro endselectionscript
+	.byte 0x44
+	.endm
+
+	.macro playanimation battler:req, animType:req, arg=NULL
+	.byte 0x45
+	.byte \battler
+	.byte \animType
+	.4byte \arg
+	.endm
+
+	.macro playanimation_var battler:req, animType:req, arg=NULL
+	.byte 0x46
+	.byte \battler
+	.4byte \animType
+	.4byte \arg
+	.endm
+
+	.macro setgraphicalstatchangevalues
+	.byte 0x47
+	.endm
+
+	.macro playstatchangeanimation battler:req, param1:req, param2:req
+	.byte 0x48
+	.byte \battler
+	.byte \param1
+	.byte \param2
+	.endm
+
+	.macro moveend param0:req, param1:req
+	.byte 0x49
+	.byte \param0
+	.byte \param1
+	.endm
+
+	                                           
+
+	           
+	.macro moveendall
+	setbyte sMOVEEND_STATE, 0
+	moveend 0, 0
+	.endm
+
+	             
+	.macro moveendcase case:req
+	setbyte sMOVEEND_STATE, \case
+	moveend 1, 0
+	.endm
+
+	                            
+	.macro moveendfrom from:req
+	setbyte sMOVEEND_STATE, \from
+	moveend 0, 0
+	.endm
+
+	                                     
+	.macro moveendto to:req
+	setbyte sMOVEEND_STATE, 0
+	moveend 2, \to
+	.endm
+
+	                                           
+	.macro moveendfromto from:req, to:req
+	setbyte sMOVEEND_STATE, \from
+	moveend 2, \to
+	.endm
+
+	.macro typecalc2
+	.byte 0x4a
+	.endm
+
+	.macro returnatktoball
+	.byte 0x4b
+	.endm
+
+	.macro getswitchedmondata battler:req
+	.byte 0x4c
+	.byte \battler
+	.endm
+
+	.macro switchindataupdate battler:req
+	.byte 0x4d
+	.byte \battler
+	.endm
+
+	.macro switchinanim battler:req, dontclearsubstitutebit:req
+	.byte 0x4e
+	.byte \battler
+	.byte \dontclearsubstitutebit
+	.endm
+
+	.macro jumpifcantswitch battler:req, ptr:req
+	.byte 0x4f
+	.byte \battler
+	.4byte \ptr
+	.endm
+
+	.macro openpartyscreen param0:req, param1:req
+	.byte 0x50
+	.byte \param0
+	.4byte \param1
+	.endm
+
+	.macro switchhandleorder battler:req, param1:req
+	.byte 0x51
+	.byte \battler
+	.byte \param1
+	.endm
+
+	.macro switchineffects battler:req
+	.byte 0x52
+	.byte \battler
+	.endm
+
+	.macro trainerslidein battler:req
+	.byte 0x53
+	.byte \battler
+	.endm
+
+	.macro playse song:req
+	.byte 0x54
+	.2byte \song
+	.endm
+
+	.macro fanfare song:req
+	.byte 0x55
+	.2byte \song
+	.endm
+
+	.macro playfaintcry battler:req
+	.byte 0x56
+	.byte \battler
+	.endm
+
+	.macro endlinkbattle
+	.byte 0x57
+	.endm
+
+	.macro returntoball battler:req
+	.byte 0x58
+	.byte \battler
+	.endm
+
+	.macro handlelearnnewmove param0:req, param1:req, param2:req
+	.byte 0x59
+	.4byte \param0
+	.4byte \param1
+	.byte \param2
+	.endm
+
+	.macro yesnoboxlearnmove param0:req
+	.byte 0x5a
+	.4byte \param0
+	.endm
+
+	.macro yesnoboxstoplearningmove param0:req
+	.byte 0x5b
+	.4byte \param0
+	.endm
+
+	.macro hitanimation battler:req
+	.byte 0x5c
+	.byte \battler
+	.endm
+
+	.macro getmoneyreward addr
+	.byte 0x5d
+	.4byte \addr
+	.endm
+
+	.macro updatebattlermoves battler:req
+	.byte 0x5e
+	.byte \battler
+	.endm
+
+	.macro swapattackerwithtarget
+	.byte 0x5f
+	.endm
+
+	.macro incrementgamestat param0:req
+	.byte 0x60
+	.byte \param0
+	.endm
+
+	.macro drawpartystatussummary battler:req
+	.byte 0x61
+	.byte \battler
+	.endm
+
+	.macro hidepartystatussummary battler:req
+	.byte 0x62
+	.byte \battler
+	.endm
+
+	.macro jumptocalledmove param0:req
+	.byte 0x63
+	.byte \param0
+	.endm
+
+	.macro statusanimation battler:req
+	.byte 0x64
+	.byte \battler
+	.endm
+
+	.macro status2animation battler:req, status2:req
+	.byte 0x65
+	.byte \battler
+	.4byte \status2
+	.endm
+
+	.macro chosenstatusanimation battler:req, param1:req, param2:req
+	.byte 0x66
+	.byte \battler
+	.byte \param1
+	.4byte \param2
+	.endm
+
+	.macro yesnobox
+	.byte 0x67
+	.endm
+
+	.macro cancelallactions
+	.byte 0x68
+	.endm
+
+	.macro adjustsetdamage
+	.byte 0x69
+	.endm
+
+	.macro removeitem battler:req
+	.byte 0x6a
+	.byte \battler
+	.endm
+
+	.macro atknameinbuff1
+	.byte 0x6b
+	.endm
+
+	.macro drawlvlupbox
+	.byte 0x6c
+	.endm
+
+	.macro resetsentmonsvalue
+	.byte 0x6d
+	.endm
+
+	.macro setatktoplayer0
+	.byte 0x6e
+	.endm
+
+	.macro makevisible battler:req
+	.byte 0x6f
+	.byte \battler
+	.endm
+
+	.macro recordlastability battler:req
+	.byte 0x70
+	.byte \battler
+	.endm
+
+	.macro buffermovetolearn
+	.byte 0x71
+	.endm
+
+	.macro jumpifplayerran ptr:req
+	.byte 0x72
+	.4byte \ptr
+	.endm
+
+	.macro hpthresholds battler:req
+	.byte 0x73
+	.byte \battler
+	.endm
+
+	.macro hpthresholds2 battler:req
+	.byte 0x74
+	.byte \battler
+	.endm
+
+	.macro useitemonopponent
+	.byte 0x75
+	.endm
+
+	.macro various battler:req, param1:req
+	.byte 0x76
+	.byte \battler
+	.byte \param1
+	.endm
+
+	.macro setprotectlike
+	.byte 0x77
+	.endm
+
+	.macro tryexplosion
+	.byte 0x78
+	.endm
+
+	.macro setatkhptozero
+	.byte 0x79
+	.endm
+
+	.macro jumpifnexttargetvalid ptr:req
+	.byte 0x7a
+	.4byte \ptr
+	.endm
+
+	.macro tryhealhalfhealth param0:req, battler:req
+	.byte 0x7b
+	.4byte \param0
+	.byte \battler
+	.endm
+
+	.macro trymirrormove
+	.byte 0x7c
+	.endm
+
+	.macro setrain
+	.byte 0x7d
+	.endm
+
+	.macro setreflect
+	.byte 0x7e
+	.endm
+
+	.macro setseeded
+	.byte 0x7f
+	.endm
+
+	.macro manipulatedamage param0:req
+	.byte 0x80
+	.byte \param0
+	.endm
+
+	.macro trysetrest param0:req
+	.byte 0x81
+	.4byte \param0
+	.endm
+
+	.macro jumpifnotfirstturn ptr:req
+	.byte 0x82
+	.4byte \ptr
+	.endm
+
+	.macro nop
+	.byte 0x83
+	.endm
+
+	.macro jumpifcantmakeasleep param0:req
+	.byte 0x84
+	.4byte \param0
+	.endm
+
+	.macro stockpile
+	.byte 0x85
+	.endm
+
+	.macro stockpiletobasedamage param0:req
+	.byte 0x86
+	.4byte \param0
+	.endm
+
+	.macro stockpiletohpheal param0:req
+	.byte 0x87
+	.4byte \param0
+	.endm
+
+	.macro negativedamage
+	.byte 0x88
+	.endm
+
+	.macro statbuffchange param0:req, param1:req
+	.byte 0x89
+	.byte \param0
+	.4byte \param1
+	.endm
+
+	.macro normalisebuffs
+	.byte 0x8a
+	.endm
+
+	.macro setbide
+	.byte 0x8b
+	.endm
+
+	.macro confuseifrepeatingattackends
+	.byte 0x8c
+	.endm
+
+	.macro setmultihitcounter param0:req
+	.byte 0x8d
+	.byte \param0
+	.endm
+
+	.macro initmultihitstring
+	.byte 0x8e
+	.endm
+
+	.macro forcerandomswitch param0:req
+	.byte 0x8f
+	.4byte \param0
+	.endm
+
+	.macro tryconversiontypechange param0:req
+	.byte 0x90
+	.4byte \param0
+	.endm
+
+	.macro givepaydaymoney
+	.byte 0x91
+	.endm
+
+	.macro setlightscreen
+	.byte 0x92
+	.endm
+
+	.macro tryKO param0:req
+	.byte 0x93
+	.4byte \param0
+	.endm
+
+	.macro damagetohalftargethp
+	.byte 0x94
+	.endm
+
+	.macro setsandstorm
+	.byte 0x95
+	.endm
+
+	.macro weatherdamage
+	.byte 0x96
+	.endm
+
+	.macro tryinfatuating param0:req
+	.byte 0x97
+	.4byte \param0
+	.endm
+
+	.macro updatestatusicon battler:req
+	.byte 0x98
+	.byte \battler
+	.endm
+
+	.macro setmist
+	.byte 0x99
+	.endm
+
+	.macro setfocusenergy
+	.byte 0x9a
+	.endm
+
+	.macro transformdataexecution
+	.byte 0x9b
+	.endm
+
+	.macro setsubstitute
+	.byte 0x9c
+	.endm
+
+	.macro mimicattackcopy param0:req
+	.byte 0x9d
+	.4byte \param0
+	.endm
+
+	.macro metronome
+	.byte 0x9e
+	.endm
+
+	.macro dmgtolevel
+	.byte 0x9f
+	.endm
+
+	.macro psywavedamageeffect
+	.byte 0xa0
+	.endm
+
+	.macro counterdamagecalculator param0:req
+	.byte 0xa1
+	.4byte \param0
+	.endm
+
+	.macro mirrorcoatdamagecalculator param0:req
+	.byte 0xa2
+	.4byte \param0
+	.endm
+
+	.macro disablelastusedattack param0:req
+	.byte 0xa3
+	.4byte \param0
+	.endm
+
+	.macro trysetencore param0:req
+	.byte 0xa4
+	.4byte \param0
+	.endm
+
+	.macro painsplitdmgcalc param0:req
+	.byte 0xa5
+	.4byte \param0
+	.endm
+
+	.macro settypetorandomresistance param0:req
+	.byte 0xa6
+	.4byte \param0
+	.endm
+
+	.macro setalwayshitflag
+	.byte 0xa7
+	.endm
+
+	.macro copymovepermanently param0:req
+	.byte 0xa8
+	.4byte \param0
+	.endm
+
+	.macro trychoosesleeptalkmove param0:req
+	.byte 0xa9
+	.4byte \param0
+	.endm
+
+	.macro setdestinybond
+	.byte 0xaa
+	.endm
+
+	.macro trysetdestinybondtohappen
+	.byte 0xab
+	.endm
+
+	.macro remaininghptopower
+	.byte 0xac
+	.endm
+
+	.macro tryspiteppreduce param0:req
+	.byte 0xad
+	.4byte \param0
+	.endm
+
+	.macro healpartystatus
+	.byte 0xae
+	.endm
+
+	.macro cursetarget param0:req
+	.byte 0xaf
+	.4byte \param0
+	.endm
+
+	.macro trysetspikes param0:req
+	.byte 0xb0
+	.4byte \param0
+	.endm
+
+	.macro setforesight
+	.byte 0xb1
+	.endm
+
+	.macro trysetperishsong param0:req
+	.byte 0xb2
+	.4byte \param0
+	.endm
+
+	.macro rolloutdamagecalculation
+	.byte 0xb3
+	.endm
+
+	.macro jumpifconfusedandstatmaxed stat:req, ptr:req
+	.byte 0xb4
+	.byte \stat
+	.4byte \ptr
+	.endm
+
+	.macro furycuttercalc
+	.byte 0xb5
+	.endm
+
+	.macro friendshiptodamagecalculation
+	.byte 0xb6
+	.endm
+
+	.macro presentdamagecalculation
+	.byte 0xb7
+	.endm
+
+	.macro setsafeguard
+	.byte 0xb8
+	.endm
+
+	.macro magnitudedamagecalculation
+	.byte 0xb9
+	.endm
+
+	.macro jumpifnopursuitswitchdmg param0:req
+	.byte 0xba
+	.4byte \param0
+	.endm
+
+	.macro setsunny
+	.byte 0xbb
+	.endm
+
+	.macro maxattackhalvehp param0:req
+	.byte 0xbc
+	.4byte \param0
+	.endm
+
+	.macro copyfoestats param0:req
+	.byte 0xbd
+	.4byte \param0
+	.endm
+
+	.macro rapidspinfree
+	.byte 0xbe
+	.endm
+
+	.macro setdefensecurlbit
+	.byte 0xbf
+	.endm
+
+	.macro recoverbasedonsunlight param0:req
+	.byte 0xc0
+	.4byte \param0
+	.endm
+
+	.macro hiddenpowercalc
+	.byte 0xc1
+	.endm
+
+	.macro selectfirstvalidtarget
+	.byte 0xc2
+	.endm
+
+	.macro trysetfutureattack param0:req
+	.byte 0xc3
+	.4byte \param0
+	.endm
+
+	.macro trydobeatup param0:req, param1:req
+	.byte 0xc4
+	.4byte \param0
+	.4byte \param1
+	.endm
+
+	.macro setsemiinvulnerablebit
+	.byte 0xc5
+	.endm
+
+	.macro clearsemiinvulnerablebit
+	.byte 0xc6
+	.endm
+
+	.macro setminimize
+	.byte 0xc7
+	.endm
+
+	.macro sethail
+	.byte 0xc8
+	.endm
+
+	.macro trymemento ptr:req
+	.byte 0xc9
+	.4byte \ptr
+	.endm
+
+	.macro setforcedtarget
+	.byte 0xca
+	.endm
+
+	.macro setcharge
+	.byte 0xcb
+	.endm
+
+	.macro callterrainattack
+	.byte 0xcc
+	.endm
+
+	.macro cureifburnedparalysedorpoisoned param0:req
+	.byte 0xcd
+	.4byte \param0
+	.endm
+
+	.macro settorment param0:req
+	.byte 0xce
+	.4byte \param0
+	.endm
+
+	.macro jumpifnodamage param0:req
+	.byte 0xcf
+	.4byte \param0
+	.endm
+
+	.macro settaunt param0:req
+	.byte 0xd0
+	.4byte \param0
+	.endm
+
+	.macro trysethelpinghand param0:req
+	.byte 0xd1
+	.4byte \param0
+	.endm
+
+	.macro tryswapitems param0:req
+	.byte 0xd2
+	.4byte \param0
+	.endm
+
+	.macro trycopyability param0:req
+	.byte 0xd3
+	.4byte \param0
+	.endm
+
+	.macro trywish param0:req, param1:req
+	.byte 0xd4
+	.byte \param0
+	.4byte \param1
+	.endm
+
+	.macro trysetroots param0:req
+	.byte 0xd5
+	.4byte \param0
+	.endm
+
+	.macro doubledamagedealtifdamaged
+	.byte 0xd6
+	.endm
+
+	.macro setyawn param0:req
+	.byte 0xd7
+	.4byte \param0
+	.endm
+
+	.macro setdamagetohealthdifference param0:req
+	.byte 0xd8
+	.4byte \param0
+	.endm
+
+	.macro scaledamagebyhealthratio
+	.byte 0xd9
+	.endm
+
+	.macro tryswapabilities param0:req
+	.byte 0xda
+	.4byte \param0
+	.endm
+
+	.macro tryimprison param0:req
+	.byte 0xdb
+	.4byte \param0
+	.endm
+
+	.macro trysetgrudge param0:req
+	.byte 0xdc
+	.4byte \param0
+	.endm
+
+	.macro weightdamagecalculation
+	.byte 0xdd
+	.endm
+
+	.macro assistattackselect param0:req
+	.byte 0xde
+	.4byte \param0
+	.endm
+
+	.macro trysetmagiccoat param0:req
+	.byte 0xdf
+	.4byte \param0
+	.endm
+
+	.macro trysetsnatch param0:req
+	.byte 0xe0
+	.4byte \param0
+	.endm
+
+	.macro trygetintimidatetarget param0:req
+	.byte 0xe1
+	.4byte \param0
+	.endm
+
+	.macro switchoutabilities battler:req
+	.byte 0xe2
+	.byte \battler
+	.endm
+
+	.macro jumpifhasnohp battler:req, param1:req
+	.byte 0xe3
+	.byte \battler
+	.4byte \param1
+	.endm
+
+	.macro getsecretpowereffect
+	.byte 0xe4
+	.endm
+
+	.macro pickup
+	.byte 0xe5
+	.endm
+
+	.macro docastformchangeanimation
+	.byte 0xe6
+	.endm
+
+	.macro trycastformdatachange
+	.byte 0xe7
+	.endm
+
+	.macro settypebasedhalvers param0:req
+	.byte 0xe8
+	.4byte \param0
+	.endm
+
+	.macro setweatherballtype
+	.byte 0xe9
+	.endm
+
+	.macro tryrecycleitem param0:req
+	.byte 0xea
+	.4byte \param0
+	.endm
+
+	.macro settypetoterrain param0:req
+	.byte 0xeb
+	.4byte \param0
+	.endm
+
+	.macro pursuitrelated param0:req
+	.byte 0xec
+	.4byte \param0
+	.endm
+
+	.macro snatchsetbattlers
+	.byte 0xed
+	.endm
+
+	.macro removelightscreenreflect
+	.byte 0xee
+	.endm
+
+	.macro handleballthrow
+	.byte 0xef
+	.endm
+
+	.macro givecaughtmon
+	.byte 0xf0
+	.endm
+
+	.macro givecaptureexp
+	.byte 0xf1
+	.endm
+
+	.macro trysetcaughtmondexflags param0:req
+	.byte 0xf2
+	.4byte \param0
+	.endm
+
+	.macro displaydexinfo
+	.byte 0xf3
+	.endm
+
+	.macro trygivecaughtmonnick param0:req
+	.byte 0xf4
+	.4byte \param0
+	.endm
+
+	.macro subattackerhpbydmg
+	.byte 0xf5
+	.endm
+
+	.macro removeattackerstatus1
+	.byte 0xf6
+	.endm
+
+	.macro finishaction
+	.byte 0xf7
+	.endm
+
+	.macro finishturn
+	.byte 0xf8
+	.endm
+
+                                                 
+	.macro cancelmultiturnmoves battler:req
+	various \battler, VARIOUS_CANCEL_MULTI_TURN_MOVES
+	.endm
+
+	.macro setmagiccoattarget battler:req
+	various \battler, VARIOUS_SET_MAGIC_COAT_TARGET
+	.endm
+
+	.macro getifcantrunfrombattle battler:req
+	various \battler, VARIOUS_IS_RUNNING_IMPOSSIBLE
+	.endm
+
+	.macro getmovetarget battler:req
+	various \battler, VARIOUS_GET_MOVE_TARGET
+	.endm
+
+	.macro getbattlerfainted battler:req
+	various \battler, VARIOUS_GET_BATTLER_FAINTED
+	.endm
+
+	.macro resetintimidatetracebits battler:req
+	various \battler, VARIOUS_RESET_INTIMIDATE_TRACE_BITS
+	.endm
+
+	.macro updatechoicemoveonlvlup battler:req
+	various \battler, VARIOUS_UPDATE_CHOICE_MOVE_ON_LVL_UP
+	.endm
+
+	.macro resetplayerfainted
+	various BS_ATTACKER, VARIOUS_RESET_PLAYER_FAINTED
+	.endm
+
+	.macro getbattlersforrecall
+	various BS_ATTACKER, VARIOUS_GET_BATTLERS_FOR_RECALL
+	.endm
+
+	.macro returnopponentmon1toball
+	various BS_ATTACKER, VARIOUS_RETURN_OPPONENT_MON1
+	.endm
+
+	.macro returnopponentmon2toball
+	various BS_ATTACKER, VARIOUS_RETURN_OPPONENT_MON2
+	.endm
+
+	.macro checkpokeflute battler:req
+	various \battler, VARIOUS_CHECK_POKEFLUTE
+	.endm
+
+	.macro waitfanfare battler:req
+	various \battler, VARIOUS_WAIT_FANFARE
+	.endm
+
+                
+	.macro setstatchanger stat:req, stages:req, down:req
+	setbyte sSTATCHANGER \stat | \stages << 4 | \down << 7
+	.endm
+
+	.macro setmoveeffect effect:req
+	setbyte cEFFECT_CHOOSER, \effect
+	.endm
+
+	.macro chosenstatus1animation battler:req, status:req
+	chosenstatusanimation \battler, 0x0, \status
+	.endm
+
+	.macro chosenstatus2animation battler:req, status:req
+	chosenstatusanimation \battler, 0x1, \status
+	.endm
+
+	.macro sethword dst:req, value:req
+	setbyte \dst, (\value) & 0xFF
+	setbyte \dst + 1, ((\value) >> 8) & 0xFF
+	.endm
+
+	.macro setword dst:req, value:req
+	setbyte \dst, (\value) & 0xFF
+	setbyte \dst + 1, ((\value) >> 8) & 0xFF
+	setbyte \dst + 2, ((\value) >> 16) & 0xFF
+	setbyte \dst + 3, ((\value) >> 24) & 0xFF
+	.endm
+
+	.macro copybyte dst:req, src:req
+	copyarray \dst, \src, 0x1
+	.endm
+
+	.macro copyhword dst:req, src:req
+	copyarray \dst, \src, 0x2
+	.endm
+
+	.macro copyword dst:req, src:req
+	copyarray \dst, \src, 0x4
+	.endm
+
+	.macro jumpifbytenotequal byte1:req, byte2:req, jumpptr:req
+	jumpifarraynotequal \byte1, \byte2, 0x1, \jumpptr
+	.endm
+
+	.macro jumpifbyteequal byte1:req, byte2:req, jumpptr:req
+	jumpifarrayequal \byte1, \byte2, 0x1, \jumpptr
+	.endm
+
+	.macro jumpifmove move:req, jumpptr:req
+	jumpifhalfword CMP_EQUAL, gCurrentMove, \move, \jumpptr
+	.endm
+
+	.macro jumpifnotmove move:req, jumpptr:req
+	jumpifhalfword CMP_NOT_EQUAL, gCurrentMove, \move, \jumpptr
+	.endm
+
+	.macro jumpifstatus3 battler:req, status:req, jumpptr:req
+	jumpifstatus3condition \battler, \status, 0x0, \jumpptr
+	.endm
+
+	.macro jumpifnostatus3 battler:req, status:req, jumpptr:req
+	jumpifstatus3condition \battler, \status, 0x1, \jumpptr
+	.endm
+
+	.macro jumpifmovehadnoeffect jumpptr:req
+	jumpifbyte CMP_COMMON_BITS, gMoveResultFlags, MOVE_RESULT_NO_EFFECT, \jumpptr
+	.endm
+
+	.macro jumpifbattletype flags:req, jumpptr:req
+	jumpifword CMP_COMMON_BITS, gBattleTypeFlags, \flags, \jumpptr
+	.endm
+
+	.macro jumpifnotbattletype flags:req, jumpptr:req
+	jumpifword CMP_NO_COMMON_BITS, gBattleTypeFlags, \flags, \jumpptr
+	.endm
+# 16 "data/battle_scripts_1.s"
+                                                                         
+	.set NULL, 0
+	.set FALSE, 0
+	.set TRUE, 1
+	.section script_data, "aw", %progbits
+	.align 2
+
+gBattleScriptsForMoveEffects: ; .global gBattleScriptsForMoveEffects
+	.4byte BattleScript_EffectHit                                
+	.4byte BattleScript_EffectSleep                                
+	.4byte BattleScript_EffectPoisonHit                                 
+	.4byte BattleScript_EffectAbsorb                                
+	.4byte BattleScript_EffectBurnHit                                 
+	.4byte BattleScript_EffectFreezeHit                                 
+	.4byte BattleScript_EffectParalyzeHit                                 
+	.4byte BattleScript_EffectExplosion                                
+	.4byte BattleScript_EffectDreamEater                                 
+	.4byte BattleScript_EffectMirrorMove                                 
+	.4byte BattleScript_EffectAttackUp                                 
+	.4byte BattleScript_EffectDefenseUp                                 
+	.4byte BattleScript_EffectHit                                     
+	.4byte BattleScript_EffectSpecialAttackUp                                  
+	.4byte BattleScript_EffectHit                                               
+	.4byte BattleScript_EffectHit                                        
+	.4byte BattleScript_EffectEvasionUp                                 
+	.4byte BattleScript_EffectHit                                       
+	.4byte BattleScript_EffectAttackDown                                 
+	.4byte BattleScript_EffectDefenseDown                                 
+	.4byte BattleScript_EffectSpeedDown                                 
+	.4byte BattleScript_EffectHit                                                
+	.4byte BattleScript_EffectHit                                                 
+	.4byte BattleScript_EffectAccuracyDown                                 
+	.4byte BattleScript_EffectEvasionDown                                 
+	.4byte BattleScript_EffectHaze                                
+	.4byte BattleScript_EffectBide                                
+	.4byte BattleScript_EffectRampage                                
+	.4byte BattleScript_EffectRoar                                
+	.4byte BattleScript_EffectMultiHit                                 
+	.4byte BattleScript_EffectConversion                                
+	.4byte BattleScript_EffectFlinchHit                                 
+	.4byte BattleScript_EffectRestoreHp                                 
+	.4byte BattleScript_EffectToxic                                
+	.4byte BattleScript_EffectPayDay                                 
+	.4byte BattleScript_EffectLightScreen                                 
+	.4byte BattleScript_EffectTriAttack                                 
+	.4byte BattleScript_EffectRest                                
+	.4byte BattleScript_EffectOHKO                                
+	.4byte BattleScript_EffectRazorWind                                 
+	.4byte BattleScript_EffectSuperFang                                 
+	.4byte BattleScript_EffectDragonRage                                 
+	.4byte BattleScript_EffectTrap                                
+	.4byte BattleScript_EffectHit                                          
+	.4byte BattleScript_EffectDoubleHit                                 
+	.4byte BattleScript_EffectRecoilIfMiss                                  
+	.4byte BattleScript_EffectMist                                
+	.4byte BattleScript_EffectFocusEnergy                                 
+	.4byte BattleScript_EffectRecoil                                
+	.4byte BattleScript_EffectConfuse                                
+	.4byte BattleScript_EffectAttackUp2                                  
+	.4byte BattleScript_EffectDefenseUp2                                  
+	.4byte BattleScript_EffectSpeedUp2                                  
+	.4byte BattleScript_EffectSpecialAttackUp2                                   
+	.4byte BattleScript_EffectSpecialDefenseUp2                                   
+	.4byte BattleScript_EffectHit                                          
+	.4byte BattleScript_EffectHit                                         
+	.4byte BattleScript_EffectTransform                                
+	.4byte BattleScript_EffectAttackDown2                                  
+	.4byte BattleScript_EffectDefenseDown2                                  
+	.4byte BattleScript_EffectSpeedDown2                                  
+	.4byte BattleScript_EffectHit                                                  
+	.4byte BattleScript_EffectSpecialDefenseDown2                                   
+	.4byte BattleScript_EffectHit                                            
+	.4byte BattleScript_EffectHit                                           
+	.4byte BattleScript_EffectReflect                                
+	.4byte BattleScript_EffectPoison                                
+	.4byte BattleScript_EffectParalyze                                
+	.4byte BattleScript_EffectAttackDownHit                                  
+	.4byte BattleScript_EffectDefenseDownHit                                  
+	.4byte BattleScript_EffectSpeedDownHit                                  
+	.4byte BattleScript_EffectSpecialAttackDownHit                                   
+	.4byte BattleScript_EffectSpecialDefenseDownHit                                   
+	.4byte BattleScript_EffectAccuracyDownHit                                  
+	.4byte BattleScript_EffectHit                                             
+	.4byte BattleScript_EffectSkyAttack                                 
+	.4byte BattleScript_EffectConfuseHit                                 
+	.4byte BattleScript_EffectTwineedle                                
+	.4byte BattleScript_EffectHit                                        
+	.4byte BattleScript_EffectSubstitute                                
+	.4byte BattleScript_EffectRecharge                                
+	.4byte BattleScript_EffectRage                                
+	.4byte BattleScript_EffectMimic                                
+	.4byte BattleScript_EffectMetronome                                
+	.4byte BattleScript_EffectLeechSeed                                 
+	.4byte BattleScript_EffectSplash                                
+	.4byte BattleScript_EffectDisable                                
+	.4byte BattleScript_EffectLevelDamage                                 
+	.4byte BattleScript_EffectPsywave                                
+	.4byte BattleScript_EffectCounter                                
+	.4byte BattleScript_EffectEncore                                
+	.4byte BattleScript_EffectPainSplit                                 
+	.4byte BattleScript_EffectSnore                                
+	.4byte BattleScript_EffectConversion2                                 
+	.4byte BattleScript_EffectLockOn                                 
+	.4byte BattleScript_EffectSketch                                
+	.4byte BattleScript_EffectHit                                      
+	.4byte BattleScript_EffectSleepTalk                                 
+	.4byte BattleScript_EffectDestinyBond                                 
+	.4byte BattleScript_EffectFlail                                
+	.4byte BattleScript_EffectSpite                                
+	.4byte BattleScript_EffectHit                                        
+	.4byte BattleScript_EffectHealBell                                 
+	.4byte BattleScript_EffectHit                                         
+	.4byte BattleScript_EffectTripleKick                                 
+	.4byte BattleScript_EffectThief                                
+	.4byte BattleScript_EffectMeanLook                                 
+	.4byte BattleScript_EffectNightmare                                
+	.4byte BattleScript_EffectMinimize                                
+	.4byte BattleScript_EffectCurse                                
+	.4byte BattleScript_EffectHit                                      
+	.4byte BattleScript_EffectProtect                                
+	.4byte BattleScript_EffectSpikes                                
+	.4byte BattleScript_EffectForesight                                
+	.4byte BattleScript_EffectPerishSong                                 
+	.4byte BattleScript_EffectSandstorm                                
+	.4byte BattleScript_EffectEndure                                
+	.4byte BattleScript_EffectRollout                                
+	.4byte BattleScript_EffectSwagger                                
+	.4byte BattleScript_EffectFuryCutter                                 
+	.4byte BattleScript_EffectAttract                                
+	.4byte BattleScript_EffectReturn                                
+	.4byte BattleScript_EffectPresent                                
+	.4byte BattleScript_EffectFrustration                                
+	.4byte BattleScript_EffectSafeguard                                
+	.4byte BattleScript_EffectThawHit                                 
+	.4byte BattleScript_EffectMagnitude                                
+	.4byte BattleScript_EffectBatonPass                                 
+	.4byte BattleScript_EffectHit                                    
+	.4byte BattleScript_EffectRapidSpin                                 
+	.4byte BattleScript_EffectSonicboom                                
+	.4byte BattleScript_EffectHit                                      
+	.4byte BattleScript_EffectMorningSun                                 
+	.4byte BattleScript_EffectSynthesis                                
+	.4byte BattleScript_EffectMoonlight                                
+	.4byte BattleScript_EffectHiddenPower                                 
+	.4byte BattleScript_EffectRainDance                                 
+	.4byte BattleScript_EffectSunnyDay                                 
+	.4byte BattleScript_EffectDefenseUpHit                                  
+	.4byte BattleScript_EffectAttackUpHit                                  
+	.4byte BattleScript_EffectAllStatsUpHit                                   
+	.4byte BattleScript_EffectHit                                      
+	.4byte BattleScript_EffectBellyDrum                                 
+	.4byte BattleScript_EffectPsychUp                                 
+	.4byte BattleScript_EffectMirrorCoat                                 
+	.4byte BattleScript_EffectSkullBash                                 
+	.4byte BattleScript_EffectTwister                                
+	.4byte BattleScript_EffectEarthquake                                
+	.4byte BattleScript_EffectFutureSight                                 
+	.4byte BattleScript_EffectGust                                
+	.4byte BattleScript_EffectStomp                                              
+	.4byte BattleScript_EffectSolarBeam                                 
+	.4byte BattleScript_EffectThunder                                
+	.4byte BattleScript_EffectTeleport                                
+	.4byte BattleScript_EffectBeatUp                                 
+	.4byte BattleScript_EffectSemiInvulnerable                                 
+	.4byte BattleScript_EffectDefenseCurl                                 
+	.4byte BattleScript_EffectSoftboiled                                
+	.4byte BattleScript_EffectFakeOut                                 
+	.4byte BattleScript_EffectUproar                                
+	.4byte BattleScript_EffectStockpile                                
+	.4byte BattleScript_EffectSpitUp                                 
+	.4byte BattleScript_EffectSwallow                                
+	.4byte BattleScript_EffectHit                                      
+	.4byte BattleScript_EffectHail                                
+	.4byte BattleScript_EffectTorment                                
+	.4byte BattleScript_EffectFlatter                                
+	.4byte BattleScript_EffectWillOWisp                                  
+	.4byte BattleScript_EffectMemento                                
+	.4byte BattleScript_EffectFacade                                
+	.4byte BattleScript_EffectFocusPunch                                 
+	.4byte BattleScript_EffectSmellingsalt                                
+	.4byte BattleScript_EffectFollowMe                                 
+	.4byte BattleScript_EffectNaturePower                                 
+	.4byte BattleScript_EffectCharge                                
+	.4byte BattleScript_EffectTaunt                                
+	.4byte BattleScript_EffectHelpingHand                                 
+	.4byte BattleScript_EffectTrick                                
+	.4byte BattleScript_EffectRolePlay                                 
+	.4byte BattleScript_EffectWish                                
+	.4byte BattleScript_EffectAssist                                
+	.4byte BattleScript_EffectIngrain                                
+	.4byte BattleScript_EffectSuperpower                                
+	.4byte BattleScript_EffectMagicCoat                                 
+	.4byte BattleScript_EffectRecycle                                
+	.4byte BattleScript_EffectRevenge                                
+	.4byte BattleScript_EffectBrickBreak                                 
+	.4byte BattleScript_EffectYawn                                
+	.4byte BattleScript_EffectKnockOff                                 
+	.4byte BattleScript_EffectEndeavor                                
+	.4byte BattleScript_EffectEruption                                
+	.4byte BattleScript_EffectSkillSwap                                 
+	.4byte BattleScript_EffectImprison                                
+	.4byte BattleScript_EffectRefresh                                
+	.4byte BattleScript_EffectGrudge                                
+	.4byte BattleScript_EffectSnatch                                
+	.4byte BattleScript_EffectLowKick                                 
+	.4byte BattleScript_EffectSecretPower                                 
+	.4byte BattleScript_EffectDoubleEdge                                 
+	.4byte BattleScript_EffectTeeterDance                                 
+	.4byte BattleScript_EffectBurnHit                                   
+	.4byte BattleScript_EffectMudSport                                 
+	.4byte BattleScript_EffectPoisonFang                                 
+	.4byte BattleScript_EffectWeatherBall                                 
+	.4byte BattleScript_EffectOverheat                                
+	.4byte BattleScript_EffectTickle                                
+	.4byte BattleScript_EffectCosmicPower                                 
+	.4byte BattleScript_EffectSkyUppercut                                 
+	.4byte BattleScript_EffectBulkUp                                 
+	.4byte BattleScript_EffectPoisonHit                                  
+	.4byte BattleScript_EffectWaterSport                                 
+	.4byte BattleScript_EffectCalmMind                                 
+	.4byte BattleScript_EffectDragonDance                                 
+	.4byte BattleScript_EffectCamouflage                                
+
+BattleScript_EffectHit: ; .global BattleScript_EffectHit
+	jumpifnotmove MOVE_SURF, BattleScript_HitFromAtkCanceler
+	jumpifnostatus3 BS_TARGET, STATUS3_UNDERWATER, BattleScript_HitFromAtkCanceler
+	orword gHitMarker, HITMARKER_IGNORE_UNDERWATER
+	setbyte sDMG_MULTIPLIER, 2
+BattleScript_HitFromAtkCanceler: ; .global BattleScript_HitFromAtkCanceler
+	attackcanceler
+BattleScript_HitFromAccCheck: ; .global BattleScript_HitFromAccCheck
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+BattleScript_HitFromAtkString: ; .global BattleScript_HitFromAtkString
+	attackstring
+	ppreduce
+BattleScript_HitFromCritCalc: ; .global BattleScript_HitFromCritCalc
+	critcalc
+	damagecalc
+	typecalc
+	adjustnormaldamage
+BattleScript_HitFromAtkAnimation: ; .global BattleScript_HitFromAtkAnimation
+	attackanimation
+	waitanimation
+	effectivenesssound
+	hitanimation BS_TARGET
+	waitstate
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	critmessage
+	waitmessage B_WAIT_TIME_LONG
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	seteffectwithchance
+	tryfaintmon BS_TARGET
+BattleScript_MoveEnd: ; .global BattleScript_MoveEnd
+	moveendall
+	end
+
+BattleScript_MakeMoveMissed: ; .global BattleScript_MakeMoveMissed
+	orbyte gMoveResultFlags, MOVE_RESULT_MISSED
+BattleScript_PrintMoveMissed: ; .global BattleScript_PrintMoveMissed
+	attackstring
+	ppreduce
+BattleScript_MoveMissedPause: ; .global BattleScript_MoveMissedPause
+	pause B_WAIT_TIME_SHORT
+BattleScript_MoveMissed: ; .global BattleScript_MoveMissed
+	effectivenesssound
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectSleep: ; .global BattleScript_EffectSleep
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	jumpifstatus BS_TARGET, STATUS1_SLEEP, BattleScript_AlreadyAsleep
+	jumpifcantmakeasleep BattleScript_CantMakeAsleep
+	jumpifstatus BS_TARGET, STATUS1_ANY, BattleScript_ButItFailed
+	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
+	jumpifsideaffecting BS_TARGET, SIDE_STATUS_SAFEGUARD, BattleScript_SafeguardProtected
+	attackanimation
+	waitanimation
+	setmoveeffect MOVE_EFFECT_SLEEP
+	seteffectprimary
+	goto BattleScript_MoveEnd
+
+BattleScript_AlreadyAsleep: ; .global BattleScript_AlreadyAsleep
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNALREADYASLEEP
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_WasntAffected: ; .global BattleScript_WasntAffected
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNWASNTAFFECTED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_CantMakeAsleep: ; .global BattleScript_CantMakeAsleep
+	pause B_WAIT_TIME_SHORT
+	printfromtable gUproarAwakeStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectPoisonHit: ; .global BattleScript_EffectPoisonHit
+	setmoveeffect MOVE_EFFECT_POISON
+	goto BattleScript_EffectHit
+
+BattleScript_EffectAbsorb: ; .global BattleScript_EffectAbsorb
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	critcalc
+	damagecalc
+	typecalc
+	adjustnormaldamage
+	attackanimation
+	waitanimation
+	effectivenesssound
+	hitanimation BS_TARGET
+	waitstate
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	critmessage
+	waitmessage B_WAIT_TIME_LONG
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	negativedamage
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	jumpifability BS_TARGET, ABILITY_LIQUID_OOZE, BattleScript_AbsorbLiquidOoze
+	setbyte cMULTISTRING_CHOOSER, B_MSG_ABSORB
+	goto BattleScript_AbsorbUpdateHp
+BattleScript_AbsorbLiquidOoze: ; .global BattleScript_AbsorbLiquidOoze
+	manipulatedamage DMG_CHANGE_SIGN
+	setbyte cMULTISTRING_CHOOSER, B_MSG_ABSORB_OOZE
+BattleScript_AbsorbUpdateHp: ; .global BattleScript_AbsorbUpdateHp
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	jumpifmovehadnoeffect BattleScript_AbsorbTryFainting
+	printfromtable gAbsorbDrainStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_AbsorbTryFainting: ; .global BattleScript_AbsorbTryFainting
+	tryfaintmon BS_ATTACKER
+	tryfaintmon BS_TARGET
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectBurnHit: ; .global BattleScript_EffectBurnHit
+	setmoveeffect MOVE_EFFECT_BURN
+	goto BattleScript_EffectHit
+
+BattleScript_EffectFreezeHit: ; .global BattleScript_EffectFreezeHit
+	setmoveeffect MOVE_EFFECT_FREEZE
+	goto BattleScript_EffectHit
+
+BattleScript_EffectParalyzeHit: ; .global BattleScript_EffectParalyzeHit
+	setmoveeffect MOVE_EFFECT_PARALYSIS
+	goto BattleScript_EffectHit
+
+BattleScript_EffectExplosion: ; .global BattleScript_EffectExplosion
+	attackcanceler
+	attackstring
+	ppreduce
+                                                                              
+	tryexplosion
+	setatkhptozero
+	waitstate
+	jumpifbyte CMP_NO_COMMON_BITS, gMoveResultFlags, MOVE_RESULT_MISSED, BattleScript_ExplosionDoAnimStartLoop
+	call BattleScript_PreserveMissedBitDoMoveAnim
+	goto BattleScript_ExplosionLoop
+BattleScript_ExplosionDoAnimStartLoop:
+	attackanimation
+	waitanimation
+BattleScript_ExplosionLoop:
+	movevaluescleanup
+	critcalc
+	damagecalc
+	typecalc
+	adjustnormaldamage
+	accuracycheck BattleScript_ExplosionMissed, ACC_CURR_MOVE
+	effectivenesssound
+	hitanimation BS_TARGET
+	waitstate
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	critmessage
+	waitmessage B_WAIT_TIME_LONG
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	tryfaintmon BS_TARGET
+	moveendto MOVEEND_NEXT_TARGET
+	jumpifnexttargetvalid BattleScript_ExplosionLoop
+	tryfaintmon BS_ATTACKER
+	end
+BattleScript_ExplosionMissed:
+	effectivenesssound
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	moveendto MOVEEND_NEXT_TARGET
+	jumpifnexttargetvalid BattleScript_ExplosionLoop
+	tryfaintmon BS_ATTACKER
+	end
+
+BattleScript_PreserveMissedBitDoMoveAnim:
+	bicbyte gMoveResultFlags, MOVE_RESULT_MISSED
+	attackanimation
+	waitanimation
+	orbyte gMoveResultFlags, MOVE_RESULT_MISSED
+	return
+
+BattleScript_EffectDreamEater: ; .global BattleScript_EffectDreamEater
+	attackcanceler
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_DreamEaterNoEffect
+	jumpifstatus BS_TARGET, STATUS1_SLEEP, BattleScript_DreamEaterWorked
+BattleScript_DreamEaterNoEffect:
+	attackstring
+	ppreduce
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_WasntAffected
+BattleScript_DreamEaterWorked:
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	critcalc
+	damagecalc
+	typecalc
+	adjustnormaldamage
+	attackanimation
+	waitanimation
+	effectivenesssound
+	hitanimation BS_TARGET
+	waitstate
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	critmessage
+	waitmessage B_WAIT_TIME_LONG
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	negativedamage
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	jumpifmovehadnoeffect BattleScript_DreamEaterTryFaintEnd
+	printstring STRINGID_PKMNDREAMEATEN
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_DreamEaterTryFaintEnd:
+	tryfaintmon BS_TARGET
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectMirrorMove: ; .global BattleScript_EffectMirrorMove
+	attackcanceler
+	attackstring
+	pause B_WAIT_TIME_LONG
+	trymirrormove
+	ppreduce
+	orbyte gMoveResultFlags, MOVE_RESULT_FAILED
+	printstring STRINGID_MIRRORMOVEFAILED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectAttackUp: ; .global BattleScript_EffectAttackUp
+	setstatchanger STAT_ATK, 1, FALSE
+	goto BattleScript_EffectStatUp
+
+BattleScript_EffectDefenseUp: ; .global BattleScript_EffectDefenseUp
+	setstatchanger STAT_DEF, 1, FALSE
+	goto BattleScript_EffectStatUp
+
+BattleScript_EffectSpecialAttackUp: ; .global BattleScript_EffectSpecialAttackUp
+	setstatchanger STAT_SPATK, 1, FALSE
+	goto BattleScript_EffectStatUp
+
+BattleScript_EffectEvasionUp: ; .global BattleScript_EffectEvasionUp
+	setstatchanger STAT_EVASION, 1, FALSE
+BattleScript_EffectStatUp: ; .global BattleScript_EffectStatUp
+	attackcanceler
+BattleScript_EffectStatUpAfterAtkCanceler: ; .global BattleScript_EffectStatUpAfterAtkCanceler
+	attackstring
+	ppreduce
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_StatUpEnd
+	jumpifbyte CMP_NOT_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_INCREASE, BattleScript_StatUpAttackAnim
+	pause B_WAIT_TIME_SHORT
+	goto BattleScript_StatUpPrintString
+BattleScript_StatUpAttackAnim: ; .global BattleScript_StatUpAttackAnim
+	attackanimation
+	waitanimation
+BattleScript_StatUpDoAnim: ; .global BattleScript_StatUpDoAnim
+	setgraphicalstatchangevalues
+	playanimation BS_ATTACKER, B_ANIM_STATS_CHANGE, sB_ANIM_ARG1
+BattleScript_StatUpPrintString: ; .global BattleScript_StatUpPrintString
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_StatUpEnd: ; .global BattleScript_StatUpEnd
+	goto BattleScript_MoveEnd
+
+BattleScript_StatUp: ; .global BattleScript_StatUp
+	playanimation BS_EFFECT_BATTLER, B_ANIM_STATS_CHANGE, sB_ANIM_ARG1
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_EffectAttackDown: ; .global BattleScript_EffectAttackDown
+	setstatchanger STAT_ATK, 1, TRUE
+	goto BattleScript_EffectStatDown
+
+BattleScript_EffectDefenseDown: ; .global BattleScript_EffectDefenseDown
+	setstatchanger STAT_DEF, 1, TRUE
+	goto BattleScript_EffectStatDown
+
+BattleScript_EffectSpeedDown: ; .global BattleScript_EffectSpeedDown
+	setstatchanger STAT_SPEED, 1, TRUE
+	goto BattleScript_EffectStatDown
+
+BattleScript_EffectAccuracyDown: ; .global BattleScript_EffectAccuracyDown
+	setstatchanger STAT_ACC, 1, TRUE
+	goto BattleScript_EffectStatDown
+
+BattleScript_EffectEvasionDown: ; .global BattleScript_EffectEvasionDown
+	setstatchanger STAT_EVASION, 1, TRUE
+BattleScript_EffectStatDown: ; .global BattleScript_EffectStatDown
+	attackcanceler
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailedAtkStringPpReduce
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	statbuffchange STAT_CHANGE_ALLOW_PTR, BattleScript_StatDownEnd
+	jumpifbyte CMP_LESS_THAN, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_DECREASE, BattleScript_StatDownDoAnim
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_FELL_EMPTY, BattleScript_StatDownEnd
+	pause B_WAIT_TIME_SHORT
+	goto BattleScript_StatDownPrintString
+BattleScript_StatDownDoAnim: ; .global BattleScript_StatDownDoAnim
+	attackanimation
+	waitanimation
+	setgraphicalstatchangevalues
+	playanimation BS_TARGET, B_ANIM_STATS_CHANGE, sB_ANIM_ARG1
+BattleScript_StatDownPrintString: ; .global BattleScript_StatDownPrintString
+	printfromtable gStatDownStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_StatDownEnd: ; .global BattleScript_StatDownEnd
+	goto BattleScript_MoveEnd
+
+BattleScript_StatDown: ; .global BattleScript_StatDown
+	playanimation BS_EFFECT_BATTLER, B_ANIM_STATS_CHANGE, sB_ANIM_ARG1
+	printfromtable gStatDownStringIds
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_EffectHaze: ; .global BattleScript_EffectHaze
+	attackcanceler
+	attackstring
+	ppreduce
+	attackanimation
+	waitanimation
+	normalisebuffs
+	printstring STRINGID_STATCHANGESGONE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectBide: ; .global BattleScript_EffectBide
+	attackcanceler
+	attackstring
+	ppreduce
+	attackanimation
+	waitanimation
+	orword gHitMarker, HITMARKER_CHARGING
+	setbide
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectRampage: ; .global BattleScript_EffectRampage
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	jumpifstatus2 BS_ATTACKER, STATUS2_MULTIPLETURNS, BattleScript_EffectRampage2
+	ppreduce
+BattleScript_EffectRampage2:
+	confuseifrepeatingattackends
+	goto BattleScript_HitFromCritCalc
+
+BattleScript_EffectRoar: ; .global BattleScript_EffectRoar
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifability BS_TARGET, ABILITY_SUCTION_CUPS, BattleScript_AbilityPreventsPhasingOut
+	jumpifstatus3 BS_TARGET, STATUS3_ROOTED, BattleScript_PrintMonIsRooted
+	accuracycheck BattleScript_ButItFailed, NO_ACC_CALC_CHECK_LOCK_ON
+	accuracycheck BattleScript_MoveMissedPause, ACC_CURR_MOVE
+	forcerandomswitch BattleScript_ButItFailed
+
+BattleScript_EffectMultiHit: ; .global BattleScript_EffectMultiHit
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	setmultihitcounter 0
+	initmultihitstring
+	setbyte sMULTIHIT_EFFECT, 0
+BattleScript_MultiHitLoop: ; .global BattleScript_MultiHitLoop
+	jumpifhasnohp BS_ATTACKER, BattleScript_MultiHitEnd
+	jumpifhasnohp BS_TARGET, BattleScript_MultiHitPrintStrings
+	jumpifhalfword CMP_EQUAL, gChosenMove, MOVE_SLEEP_TALK, BattleScript_DoMultiHit
+	jumpifstatus BS_ATTACKER, STATUS1_SLEEP, BattleScript_MultiHitPrintStrings
+BattleScript_DoMultiHit: ; .global BattleScript_DoMultiHit
+	movevaluescleanup
+	copybyte cEFFECT_CHOOSER, sMULTIHIT_EFFECT
+	critcalc
+	damagecalc
+	typecalc
+	jumpifmovehadnoeffect BattleScript_MultiHitNoMoreHits
+	adjustnormaldamage
+	attackanimation
+	waitanimation
+	effectivenesssound
+	hitanimation BS_TARGET
+	waitstate
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	critmessage
+	waitmessage B_WAIT_TIME_LONG
+	printstring STRINGID_EMPTYSTRING3
+	waitmessage 1
+	addbyte sMULTIHIT_STRING + 4, 1
+	moveendto MOVEEND_NEXT_TARGET
+	jumpifbyte CMP_COMMON_BITS, gMoveResultFlags, MOVE_RESULT_FOE_ENDURED, BattleScript_MultiHitPrintStrings
+	decrementmultihit BattleScript_MultiHitLoop
+	goto BattleScript_MultiHitPrintStrings
+BattleScript_MultiHitNoMoreHits: ; .global BattleScript_MultiHitNoMoreHits
+	pause B_WAIT_TIME_SHORT
+BattleScript_MultiHitPrintStrings: ; .global BattleScript_MultiHitPrintStrings
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	jumpifmovehadnoeffect BattleScript_MultiHitEnd
+	copyarray gBattleTextBuff1, sMULTIHIT_STRING, 6
+	printstring STRINGID_HITXTIMES
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_MultiHitEnd: ; .global BattleScript_MultiHitEnd
+	seteffectwithchance
+	tryfaintmon BS_TARGET
+	moveendcase MOVEEND_SYNCHRONIZE_TARGET
+	moveendfrom MOVEEND_IMMUNITY_ABILITIES
+	end
+
+BattleScript_EffectConversion: ; .global BattleScript_EffectConversion
+	attackcanceler
+	attackstring
+	ppreduce
+	tryconversiontypechange BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNCHANGEDTYPE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectFlinchHit: ; .global BattleScript_EffectFlinchHit
+	setmoveeffect MOVE_EFFECT_FLINCH
+	goto BattleScript_EffectHit
+
+BattleScript_EffectRestoreHp: ; .global BattleScript_EffectRestoreHp
+	attackcanceler
+	attackstring
+	ppreduce
+	tryhealhalfhealth BattleScript_AlreadyAtFullHp, BS_ATTACKER
+	attackanimation
+	waitanimation
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	printstring STRINGID_PKMNREGAINEDHEALTH
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectToxic: ; .global BattleScript_EffectToxic
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifability BS_TARGET, ABILITY_IMMUNITY, BattleScript_ImmunityProtected
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	jumpifstatus BS_TARGET, STATUS1_POISON, BattleScript_AlreadyPoisoned
+	jumpifstatus BS_TARGET, STATUS1_TOXIC_POISON, BattleScript_AlreadyPoisoned
+	jumpifstatus BS_TARGET, STATUS1_ANY, BattleScript_ButItFailed
+	jumpiftype BS_TARGET, TYPE_POISON, BattleScript_NotAffected
+	jumpiftype BS_TARGET, TYPE_STEEL, BattleScript_NotAffected
+	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
+	jumpifsideaffecting BS_TARGET, SIDE_STATUS_SAFEGUARD, BattleScript_SafeguardProtected
+	attackanimation
+	waitanimation
+	setmoveeffect MOVE_EFFECT_TOXIC
+	seteffectprimary
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_AlreadyPoisoned: ; .global BattleScript_AlreadyPoisoned
+	pause B_WAIT_TIME_LONG
+	printstring STRINGID_PKMNALREADYPOISONED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_ImmunityProtected: ; .global BattleScript_ImmunityProtected
+	copybyte gEffectBattler, gBattlerTarget
+	setbyte cMULTISTRING_CHOOSER, B_MSG_ABILITY_PREVENTS_MOVE_STATUS
+	call BattleScript_PSNPrevention
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectPayDay: ; .global BattleScript_EffectPayDay
+	setmoveeffect MOVE_EFFECT_PAYDAY
+	goto BattleScript_EffectHit
+
+BattleScript_EffectLightScreen: ; .global BattleScript_EffectLightScreen
+	attackcanceler
+	attackstring
+	ppreduce
+	setlightscreen
+	goto BattleScript_PrintReflectLightScreenSafeguardString
+
+BattleScript_EffectTriAttack: ; .global BattleScript_EffectTriAttack
+	setmoveeffect MOVE_EFFECT_TRI_ATTACK
+	goto BattleScript_EffectHit
+
+BattleScript_EffectRest: ; .global BattleScript_EffectRest
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstatus BS_ATTACKER, STATUS1_SLEEP, BattleScript_RestIsAlreadyAsleep
+	jumpifcantmakeasleep BattleScript_RestCantSleep
+	trysetrest BattleScript_AlreadyAtFullHp
+	pause B_WAIT_TIME_SHORT
+	printfromtable gRestUsedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_ATTACKER
+	waitstate
+	goto BattleScript_PresentHealTarget
+
+BattleScript_RestCantSleep: ; .global BattleScript_RestCantSleep
+	pause B_WAIT_TIME_LONG
+	printfromtable gUproarAwakeStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_RestIsAlreadyAsleep: ; .global BattleScript_RestIsAlreadyAsleep
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNALREADYASLEEP2
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectOHKO: ; .global BattleScript_EffectOHKO
+	attackcanceler
+	attackstring
+	ppreduce
+	accuracycheck BattleScript_ButItFailed, NO_ACC_CALC_CHECK_LOCK_ON
+	typecalc
+	jumpifmovehadnoeffect BattleScript_HitFromAtkAnimation
+	tryKO BattleScript_KOFail
+	trysetdestinybondtohappen
+	goto BattleScript_HitFromAtkAnimation
+BattleScript_KOFail: ; .global BattleScript_KOFail
+	pause B_WAIT_TIME_LONG
+	printfromtable gKOFailedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectRazorWind: ; .global BattleScript_EffectRazorWind
+	jumpifstatus2 BS_ATTACKER, STATUS2_MULTIPLETURNS, BattleScript_TwoTurnMovesSecondTurn
+	jumpifword CMP_COMMON_BITS, gHitMarker, HITMARKER_NO_ATTACKSTRING, BattleScript_TwoTurnMovesSecondTurn
+	setbyte sTWOTURN_STRINGID, B_MSG_TURN1_RAZOR_WIND
+	call BattleScriptFirstChargingTurn
+	goto BattleScript_MoveEnd
+
+BattleScript_TwoTurnMovesSecondTurn: ; .global BattleScript_TwoTurnMovesSecondTurn
+	attackcanceler
+	setmoveeffect MOVE_EFFECT_CHARGING
+	setbyte sB_ANIM_TURN, 1
+	clearstatusfromeffect BS_ATTACKER
+	orword gHitMarker, HITMARKER_NO_PPDEDUCT
+	jumpifnotmove MOVE_SKY_ATTACK, BattleScript_HitFromAccCheck
+	setmoveeffect MOVE_EFFECT_FLINCH
+	goto BattleScript_HitFromAccCheck
+
+BattleScriptFirstChargingTurn: ; .global BattleScriptFirstChargingTurn
+	attackcanceler
+	printstring STRINGID_EMPTYSTRING3
+	ppreduce
+	attackanimation
+	waitanimation
+	orword gHitMarker, HITMARKER_CHARGING
+	setmoveeffect MOVE_EFFECT_CHARGING | MOVE_EFFECT_AFFECTS_USER
+	seteffectprimary
+	copybyte cMULTISTRING_CHOOSER, sTWOTURN_STRINGID
+	printfromtable gFirstTurnOfTwoStringIds
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_EffectSuperFang: ; .global BattleScript_EffectSuperFang
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	typecalc
+	bicbyte gMoveResultFlags, MOVE_RESULT_SUPER_EFFECTIVE | MOVE_RESULT_NOT_VERY_EFFECTIVE
+	damagetohalftargethp
+	goto BattleScript_HitFromAtkAnimation
+
+BattleScript_EffectDragonRage: ; .global BattleScript_EffectDragonRage
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	typecalc
+	bicbyte gMoveResultFlags, MOVE_RESULT_SUPER_EFFECTIVE | MOVE_RESULT_NOT_VERY_EFFECTIVE
+	setword gBattleMoveDamage, 40
+	adjustsetdamage
+	goto BattleScript_HitFromAtkAnimation
+
+BattleScript_EffectTrap: ; .global BattleScript_EffectTrap
+	jumpifnotmove MOVE_WHIRLPOOL, BattleScript_DoWrapEffect
+	jumpifnostatus3 BS_TARGET, STATUS3_UNDERWATER, BattleScript_DoWrapEffect
+	orword gHitMarker, HITMARKER_IGNORE_UNDERWATER
+	setbyte sDMG_MULTIPLIER, 2
+BattleScript_DoWrapEffect: ; .global BattleScript_DoWrapEffect
+	setmoveeffect MOVE_EFFECT_WRAP
+	goto BattleScript_EffectHit
+
+BattleScript_EffectDoubleHit: ; .global BattleScript_EffectDoubleHit
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	setmultihitcounter 2
+	initmultihitstring
+	setbyte sMULTIHIT_EFFECT, 0
+	goto BattleScript_MultiHitLoop
+
+BattleScript_EffectRecoilIfMiss: ; .global BattleScript_EffectRecoilIfMiss
+	attackcanceler
+	accuracycheck BattleScript_MoveMissedDoDamage, ACC_CURR_MOVE
+	goto BattleScript_HitFromAtkString
+BattleScript_MoveMissedDoDamage: ; .global BattleScript_MoveMissedDoDamage
+	attackstring
+	ppreduce
+	pause B_WAIT_TIME_LONG
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	jumpifbyte CMP_COMMON_BITS, gMoveResultFlags, MOVE_RESULT_DOESNT_AFFECT_FOE, BattleScript_MoveEnd
+	printstring STRINGID_PKMNCRASHED
+	waitmessage B_WAIT_TIME_LONG
+	damagecalc
+	typecalc
+	adjustnormaldamage
+	manipulatedamage DMG_RECOIL_FROM_MISS
+	bicbyte gMoveResultFlags, MOVE_RESULT_MISSED
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	tryfaintmon BS_ATTACKER
+	orbyte gMoveResultFlags, MOVE_RESULT_MISSED
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectMist: ; .global BattleScript_EffectMist
+	attackcanceler
+	attackstring
+	ppreduce
+	setmist
+	attackanimation
+	waitanimation
+	printfromtable gMistUsedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectFocusEnergy: ; .global BattleScript_EffectFocusEnergy
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstatus2 BS_ATTACKER, STATUS2_FOCUS_ENERGY, BattleScript_ButItFailed
+	setfocusenergy
+	attackanimation
+	waitanimation
+	printfromtable gFocusEnergyUsedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectRecoil: ; .global BattleScript_EffectRecoil
+	setmoveeffect MOVE_EFFECT_RECOIL_25 | MOVE_EFFECT_AFFECTS_USER | MOVE_EFFECT_CERTAIN
+	jumpifnotmove MOVE_STRUGGLE, BattleScript_EffectHit
+	incrementgamestat GAME_STAT_USED_STRUGGLE
+	goto BattleScript_EffectHit
+
+BattleScript_EffectConfuse: ; .global BattleScript_EffectConfuse
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifability BS_TARGET, ABILITY_OWN_TEMPO, BattleScript_OwnTempoPrevents
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	jumpifstatus2 BS_TARGET, STATUS2_CONFUSION, BattleScript_AlreadyConfused
+	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
+	jumpifsideaffecting BS_TARGET, SIDE_STATUS_SAFEGUARD, BattleScript_SafeguardProtected
+	attackanimation
+	waitanimation
+	setmoveeffect MOVE_EFFECT_CONFUSION
+	seteffectprimary
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_AlreadyConfused: ; .global BattleScript_AlreadyConfused
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNALREADYCONFUSED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectAttackUp2: ; .global BattleScript_EffectAttackUp2
+	setstatchanger STAT_ATK, 2, FALSE
+	goto BattleScript_EffectStatUp
+
+BattleScript_EffectDefenseUp2: ; .global BattleScript_EffectDefenseUp2
+	setstatchanger STAT_DEF, 2, FALSE
+	goto BattleScript_EffectStatUp
+
+BattleScript_EffectSpeedUp2: ; .global BattleScript_EffectSpeedUp2
+	setstatchanger STAT_SPEED, 2, FALSE
+	goto BattleScript_EffectStatUp
+
+BattleScript_EffectSpecialAttackUp2: ; .global BattleScript_EffectSpecialAttackUp2
+	setstatchanger STAT_SPATK, 2, FALSE
+	goto BattleScript_EffectStatUp
+
+BattleScript_EffectSpecialDefenseUp2: ; .global BattleScript_EffectSpecialDefenseUp2
+	setstatchanger STAT_SPDEF, 2, FALSE
+	goto BattleScript_EffectStatUp
+
+BattleScript_EffectTransform: ; .global BattleScript_EffectTransform
+	attackcanceler
+	attackstring
+	ppreduce
+	transformdataexecution
+	attackanimation
+	waitanimation
+	printfromtable gTransformUsedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectAttackDown2: ; .global BattleScript_EffectAttackDown2
+	setstatchanger STAT_ATK, 2, TRUE
+	goto BattleScript_EffectStatDown
+
+BattleScript_EffectDefenseDown2: ; .global BattleScript_EffectDefenseDown2
+	setstatchanger STAT_DEF, 2, TRUE
+	goto BattleScript_EffectStatDown
+
+BattleScript_EffectSpeedDown2: ; .global BattleScript_EffectSpeedDown2
+	setstatchanger STAT_SPEED, 2, TRUE
+	goto BattleScript_EffectStatDown
+
+BattleScript_EffectSpecialDefenseDown2: ; .global BattleScript_EffectSpecialDefenseDown2
+	setstatchanger STAT_SPDEF, 2, TRUE
+	goto BattleScript_EffectStatDown
+
+BattleScript_EffectReflect: ; .global BattleScript_EffectReflect
+	attackcanceler
+	attackstring
+	ppreduce
+	setreflect
+BattleScript_PrintReflectLightScreenSafeguardString: ; .global BattleScript_PrintReflectLightScreenSafeguardString
+	attackanimation
+	waitanimation
+	printfromtable gReflectLightScreenSafeguardStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectPoison: ; .global BattleScript_EffectPoison
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifability BS_TARGET, ABILITY_IMMUNITY, BattleScript_ImmunityProtected
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	jumpifstatus BS_TARGET, STATUS1_POISON, BattleScript_AlreadyPoisoned
+	jumpifstatus BS_TARGET, STATUS1_TOXIC_POISON, BattleScript_AlreadyPoisoned
+	jumpiftype BS_TARGET, TYPE_POISON, BattleScript_NotAffected
+	jumpiftype BS_TARGET, TYPE_STEEL, BattleScript_NotAffected
+	jumpifstatus BS_TARGET, STATUS1_ANY, BattleScript_ButItFailed
+	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
+	jumpifsideaffecting BS_TARGET, SIDE_STATUS_SAFEGUARD, BattleScript_SafeguardProtected
+	attackanimation
+	waitanimation
+	setmoveeffect MOVE_EFFECT_POISON
+	seteffectprimary
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectParalyze: ; .global BattleScript_EffectParalyze
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifability BS_TARGET, ABILITY_LIMBER, BattleScript_LimberProtected
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	typecalc
+	jumpifmovehadnoeffect BattleScript_ButItFailed
+	jumpifstatus BS_TARGET, STATUS1_PARALYSIS, BattleScript_AlreadyParalyzed
+	jumpifstatus BS_TARGET, STATUS1_ANY, BattleScript_ButItFailed
+	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
+	jumpifsideaffecting BS_TARGET, SIDE_STATUS_SAFEGUARD, BattleScript_SafeguardProtected
+	attackanimation
+	waitanimation
+	setmoveeffect MOVE_EFFECT_PARALYSIS
+	seteffectprimary
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_AlreadyParalyzed: ; .global BattleScript_AlreadyParalyzed
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNISALREADYPARALYZED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_LimberProtected: ; .global BattleScript_LimberProtected
+	copybyte gEffectBattler, gBattlerTarget
+	setbyte cMULTISTRING_CHOOSER, B_MSG_ABILITY_PREVENTS_MOVE_STATUS
+	call BattleScript_PRLZPrevention
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectAttackDownHit: ; .global BattleScript_EffectAttackDownHit
+	setmoveeffect MOVE_EFFECT_ATK_MINUS_1
+	goto BattleScript_EffectHit
+
+BattleScript_EffectDefenseDownHit: ; .global BattleScript_EffectDefenseDownHit
+	setmoveeffect MOVE_EFFECT_DEF_MINUS_1
+	goto BattleScript_EffectHit
+
+BattleScript_EffectSpeedDownHit: ; .global BattleScript_EffectSpeedDownHit
+	setmoveeffect MOVE_EFFECT_SPD_MINUS_1
+	goto BattleScript_EffectHit
+
+BattleScript_EffectSpecialAttackDownHit: ; .global BattleScript_EffectSpecialAttackDownHit
+	setmoveeffect MOVE_EFFECT_SP_ATK_MINUS_1
+	goto BattleScript_EffectHit
+
+BattleScript_EffectSpecialDefenseDownHit: ; .global BattleScript_EffectSpecialDefenseDownHit
+	setmoveeffect MOVE_EFFECT_SP_DEF_MINUS_1
+	goto BattleScript_EffectHit
+
+BattleScript_EffectAccuracyDownHit: ; .global BattleScript_EffectAccuracyDownHit
+	setmoveeffect MOVE_EFFECT_ACC_MINUS_1
+	goto BattleScript_EffectHit
+
+BattleScript_EffectSkyAttack: ; .global BattleScript_EffectSkyAttack
+	jumpifstatus2 BS_ATTACKER, STATUS2_MULTIPLETURNS, BattleScript_TwoTurnMovesSecondTurn
+	jumpifword CMP_COMMON_BITS, gHitMarker, HITMARKER_NO_ATTACKSTRING, BattleScript_TwoTurnMovesSecondTurn
+	setbyte sTWOTURN_STRINGID, B_MSG_TURN1_SKY_ATTACK
+	call BattleScriptFirstChargingTurn
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectConfuseHit: ; .global BattleScript_EffectConfuseHit
+	setmoveeffect MOVE_EFFECT_CONFUSION
+	goto BattleScript_EffectHit
+
+BattleScript_EffectTwineedle: ; .global BattleScript_EffectTwineedle
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	setbyte sMULTIHIT_EFFECT, MOVE_EFFECT_POISON
+	attackstring
+	ppreduce
+	setmultihitcounter 2
+	initmultihitstring
+	goto BattleScript_MultiHitLoop
+
+BattleScript_EffectSubstitute: ; .global BattleScript_EffectSubstitute
+	attackcanceler
+	ppreduce
+	attackstring
+	waitstate
+	jumpifstatus2 BS_ATTACKER, STATUS2_SUBSTITUTE, BattleScript_AlreadyHasSubstitute
+	setsubstitute
+	jumpifbyte CMP_NOT_EQUAL, cMULTISTRING_CHOOSER, B_MSG_SUBSTITUTE_FAILED, BattleScript_SubstituteAnim
+	pause B_WAIT_TIME_SHORT
+	goto BattleScript_SubstituteString
+BattleScript_SubstituteAnim: ; .global BattleScript_SubstituteAnim
+	attackanimation
+	waitanimation
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+BattleScript_SubstituteString: ; .global BattleScript_SubstituteString
+	printfromtable gSubstituteUsedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+BattleScript_AlreadyHasSubstitute: ; .global BattleScript_AlreadyHasSubstitute
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNHASSUBSTITUTE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectRecharge: ; .global BattleScript_EffectRecharge
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	setmoveeffect MOVE_EFFECT_RECHARGE | MOVE_EFFECT_AFFECTS_USER | MOVE_EFFECT_CERTAIN
+	goto BattleScript_HitFromAtkString
+
+BattleScript_MoveUsedMustRecharge: ; .global BattleScript_MoveUsedMustRecharge
+	printstring STRINGID_PKMNMUSTRECHARGE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectRage: ; .global BattleScript_EffectRage
+	attackcanceler
+	accuracycheck BattleScript_RageMiss, ACC_CURR_MOVE
+	setmoveeffect MOVE_EFFECT_RAGE
+	seteffectprimary
+	setmoveeffect 0
+	goto BattleScript_HitFromAtkString
+BattleScript_RageMiss: ; .global BattleScript_RageMiss
+	setmoveeffect MOVE_EFFECT_RAGE
+	clearstatusfromeffect BS_ATTACKER
+	goto BattleScript_PrintMoveMissed
+
+BattleScript_EffectMimic: ; .global BattleScript_EffectMimic
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	accuracycheck BattleScript_ButItFailed, NO_ACC_CALC_CHECK_LOCK_ON
+	mimicattackcopy BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNLEARNEDMOVE2
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectMetronome: ; .global BattleScript_EffectMetronome
+	attackcanceler
+	attackstring
+	pause B_WAIT_TIME_SHORT
+	attackanimation
+	waitanimation
+	setbyte sB_ANIM_TURN, 0
+	setbyte sB_ANIM_TARGETS_HIT, 0
+	metronome
+
+BattleScript_EffectLeechSeed: ; .global BattleScript_EffectLeechSeed
+	attackcanceler
+	attackstring
+	pause B_WAIT_TIME_SHORT
+	ppreduce
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	accuracycheck BattleScript_DoLeechSeed, ACC_CURR_MOVE
+BattleScript_DoLeechSeed: ; .global BattleScript_DoLeechSeed
+	setseeded
+	attackanimation
+	waitanimation
+	printfromtable gLeechSeedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectSplash: ; .global BattleScript_EffectSplash
+	attackcanceler
+	attackstring
+	ppreduce
+	attackanimation
+	waitanimation
+	incrementgamestat GAME_STAT_USED_SPLASH
+	printstring STRINGID_BUTNOTHINGHAPPENED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectDisable: ; .global BattleScript_EffectDisable
+	attackcanceler
+	attackstring
+	ppreduce
+	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
+	disablelastusedattack BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNMOVEWASDISABLED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectLevelDamage: ; .global BattleScript_EffectLevelDamage
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	typecalc
+	bicbyte gMoveResultFlags, MOVE_RESULT_SUPER_EFFECTIVE | MOVE_RESULT_NOT_VERY_EFFECTIVE
+	dmgtolevel
+	adjustsetdamage
+	goto BattleScript_HitFromAtkAnimation
+
+BattleScript_EffectPsywave: ; .global BattleScript_EffectPsywave
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	typecalc
+	bicbyte gMoveResultFlags, MOVE_RESULT_SUPER_EFFECTIVE | MOVE_RESULT_NOT_VERY_EFFECTIVE
+	psywavedamageeffect
+	adjustsetdamage
+	goto BattleScript_HitFromAtkAnimation
+
+BattleScript_EffectCounter: ; .global BattleScript_EffectCounter
+	attackcanceler
+	counterdamagecalculator BattleScript_ButItFailedAtkStringPpReduce
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	typecalc2
+	adjustsetdamage
+	goto BattleScript_HitFromAtkAnimation
+
+BattleScript_EffectEncore: ; .global BattleScript_EffectEncore
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	trysetencore BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNGOTENCORE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectPainSplit: ; .global BattleScript_EffectPainSplit
+	attackcanceler
+	attackstring
+	ppreduce
+	accuracycheck BattleScript_ButItFailed, NO_ACC_CALC_CHECK_LOCK_ON
+	painsplitdmgcalc BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	copyword gBattleMoveDamage, sPAINSPLIT_HP
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	printstring STRINGID_SHAREDPAIN
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectSnore: ; .global BattleScript_EffectSnore
+	attackcanceler
+	jumpifstatus BS_ATTACKER, STATUS1_SLEEP, BattleScript_SnoreIsAsleep
+	attackstring
+	ppreduce
+	goto BattleScript_ButItFailed
+BattleScript_SnoreIsAsleep: ; .global BattleScript_SnoreIsAsleep
+	jumpifhalfword CMP_EQUAL, gChosenMove, MOVE_SLEEP_TALK, BattleScript_DoSnore
+	printstring STRINGID_PKMNFASTASLEEP
+	waitmessage B_WAIT_TIME_LONG
+	statusanimation BS_ATTACKER
+BattleScript_DoSnore: ; .global BattleScript_DoSnore
+	attackstring
+	ppreduce
+	accuracycheck BattleScript_MoveMissedPause, ACC_CURR_MOVE
+	setmoveeffect MOVE_EFFECT_FLINCH
+	goto BattleScript_HitFromCritCalc
+
+BattleScript_EffectConversion2: ; .global BattleScript_EffectConversion2
+	attackcanceler
+	attackstring
+	ppreduce
+	settypetorandomresistance BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNCHANGEDTYPE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectLockOn: ; .global BattleScript_EffectLockOn
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
+	setalwayshitflag
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNTOOKAIM
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectSketch: ; .global BattleScript_EffectSketch
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	copymovepermanently BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNSKETCHEDMOVE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectSleepTalk: ; .global BattleScript_EffectSleepTalk
+	attackcanceler
+	jumpifstatus BS_ATTACKER, STATUS1_SLEEP, BattleScript_SleepTalkIsAsleep
+	attackstring
+	ppreduce
+	goto BattleScript_ButItFailed
+BattleScript_SleepTalkIsAsleep: ; .global BattleScript_SleepTalkIsAsleep
+	printstring STRINGID_PKMNFASTASLEEP
+	waitmessage B_WAIT_TIME_LONG
+	statusanimation BS_ATTACKER
+	attackstring
+	ppreduce
+	orword gHitMarker, HITMARKER_NO_PPDEDUCT
+	trychoosesleeptalkmove BattleScript_SleepTalkUsingMove
+	pause B_WAIT_TIME_LONG
+	goto BattleScript_ButItFailed
+BattleScript_SleepTalkUsingMove: ; .global BattleScript_SleepTalkUsingMove
+	attackanimation
+	waitanimation
+	setbyte sB_ANIM_TURN, 0
+	setbyte sB_ANIM_TARGETS_HIT, 0
+	jumptocalledmove TRUE
+
+BattleScript_EffectDestinyBond: ; .global BattleScript_EffectDestinyBond
+	attackcanceler
+	attackstring
+	ppreduce
+	setdestinybond
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNTRYINGTOTAKEFOE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectFlail: ; .global BattleScript_EffectFlail
+	remaininghptopower
+	goto BattleScript_EffectHit
+
+BattleScript_EffectSpite: ; .global BattleScript_EffectSpite
+	attackcanceler
+	attackstring
+	ppreduce
+	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
+	tryspiteppreduce BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNREDUCEDPP
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectHealBell: ; .global BattleScript_EffectHealBell
+	attackcanceler
+	attackstring
+	ppreduce
+	healpartystatus
+	waitstate
+	attackanimation
+	waitanimation
+	printfromtable gPartyStatusHealStringIds
+	waitmessage B_WAIT_TIME_LONG
+	jumpifnotmove MOVE_HEAL_BELL, BattleScript_PartyHealEnd
+	jumpifbyte CMP_NO_COMMON_BITS, cMULTISTRING_CHOOSER, B_MSG_BELL_SOUNDPROOF_ATTACKER, BattleScript_CheckHealBellMon2Unaffected
+	printstring STRINGID_PKMNSXBLOCKSY
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_CheckHealBellMon2Unaffected: ; .global BattleScript_CheckHealBellMon2Unaffected
+	jumpifbyte CMP_NO_COMMON_BITS, cMULTISTRING_CHOOSER, B_MSG_BELL_SOUNDPROOF_PARTNER, BattleScript_PartyHealEnd
+	printstring STRINGID_PKMNSXBLOCKSY2
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_PartyHealEnd: ; .global BattleScript_PartyHealEnd
+	updatestatusicon BS_ATTACKER_WITH_PARTNER
+	waitstate
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectTripleKick: ; .global BattleScript_EffectTripleKick
+	attackcanceler
+	attackstring
+	ppreduce
+	sethword sTRIPLE_KICK_POWER, 0
+	initmultihitstring
+	setmultihit 3
+BattleScript_TripleKickLoop: ; .global BattleScript_TripleKickLoop
+	jumpifhasnohp BS_ATTACKER, BattleScript_TripleKickEnd
+	jumpifhasnohp BS_TARGET, BattleScript_TripleKickNoMoreHits
+	jumpifhalfword CMP_EQUAL, gChosenMove, MOVE_SLEEP_TALK, BattleScript_DoTripleKickAttack
+	jumpifstatus BS_ATTACKER, STATUS1_SLEEP, BattleScript_TripleKickNoMoreHits
+BattleScript_DoTripleKickAttack: ; .global BattleScript_DoTripleKickAttack
+	accuracycheck BattleScript_TripleKickNoMoreHits, ACC_CURR_MOVE
+	movevaluescleanup
+	addbyte sTRIPLE_KICK_POWER, 10
+	addbyte sMULTIHIT_STRING + 4, 1
+	copyhword gDynamicBasePower, sTRIPLE_KICK_POWER
+	critcalc
+	damagecalc
+	typecalc
+	adjustnormaldamage
+	jumpifmovehadnoeffect BattleScript_TripleKickNoMoreHits
+	attackanimation
+	waitanimation
+	effectivenesssound
+	hitanimation BS_TARGET
+	waitstate
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	critmessage
+	waitmessage B_WAIT_TIME_LONG
+	printstring STRINGID_EMPTYSTRING3
+	waitmessage 1
+	moveendto MOVEEND_NEXT_TARGET
+	jumpifbyte CMP_COMMON_BITS, gMoveResultFlags, MOVE_RESULT_FOE_ENDURED, BattleScript_TripleKickPrintStrings
+	decrementmultihit BattleScript_TripleKickLoop
+	goto BattleScript_TripleKickPrintStrings
+BattleScript_TripleKickNoMoreHits: ; .global BattleScript_TripleKickNoMoreHits
+	pause B_WAIT_TIME_SHORT
+	jumpifbyte CMP_EQUAL, sMULTIHIT_STRING + 4, 0, BattleScript_TripleKickPrintStrings
+	bicbyte gMoveResultFlags, MOVE_RESULT_MISSED
+BattleScript_TripleKickPrintStrings: ; .global BattleScript_TripleKickPrintStrings
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	jumpifbyte CMP_EQUAL, sMULTIHIT_STRING + 4, 0, BattleScript_TripleKickEnd
+	jumpifbyte CMP_COMMON_BITS, gMoveResultFlags, MOVE_RESULT_DOESNT_AFFECT_FOE, BattleScript_TripleKickEnd
+	copyarray gBattleTextBuff1, sMULTIHIT_STRING, 6
+	printstring STRINGID_HITXTIMES
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_TripleKickEnd: ; .global BattleScript_TripleKickEnd
+	seteffectwithchance
+	tryfaintmon BS_TARGET
+	moveendfrom MOVEEND_UPDATE_LAST_MOVES
+	end
+
+BattleScript_EffectThief: ; .global BattleScript_EffectThief
+	setmoveeffect MOVE_EFFECT_STEAL_ITEM
+	goto BattleScript_EffectHit
+
+BattleScript_EffectMeanLook: ; .global BattleScript_EffectMeanLook
+	attackcanceler
+	attackstring
+	ppreduce
+	accuracycheck BattleScript_ButItFailed, NO_ACC_CALC
+	jumpifstatus2 BS_TARGET, STATUS2_ESCAPE_PREVENTION, BattleScript_ButItFailed
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	setmoveeffect MOVE_EFFECT_PREVENT_ESCAPE
+	seteffectprimary
+	printstring STRINGID_TARGETCANTESCAPENOW
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectNightmare: ; .global BattleScript_EffectNightmare
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	jumpifstatus2 BS_TARGET, STATUS2_NIGHTMARE, BattleScript_ButItFailed
+	jumpifstatus BS_TARGET, STATUS1_SLEEP, BattleScript_NightmareWorked
+	goto BattleScript_ButItFailed
+BattleScript_NightmareWorked: ; .global BattleScript_NightmareWorked
+	attackanimation
+	waitanimation
+	setmoveeffect MOVE_EFFECT_NIGHTMARE
+	seteffectprimary
+	printstring STRINGID_PKMNFELLINTONIGHTMARE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectMinimize: ; .global BattleScript_EffectMinimize
+	attackcanceler
+	setminimize
+	setstatchanger STAT_EVASION, 1, FALSE
+	goto BattleScript_EffectStatUpAfterAtkCanceler
+
+BattleScript_EffectCurse: ; .global BattleScript_EffectCurse
+	jumpiftype2 BS_ATTACKER, TYPE_GHOST, BattleScript_GhostCurse
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstat BS_ATTACKER, CMP_GREATER_THAN, STAT_SPEED, MIN_STAT_STAGE, BattleScript_CurseTrySpeed
+	jumpifstat BS_ATTACKER, CMP_NOT_EQUAL, STAT_ATK, MAX_STAT_STAGE, BattleScript_CurseTrySpeed
+	jumpifstat BS_ATTACKER, CMP_EQUAL, STAT_DEF, MAX_STAT_STAGE, BattleScript_ButItFailed
+BattleScript_CurseTrySpeed: ; .global BattleScript_CurseTrySpeed
+	copybyte gBattlerTarget, gBattlerAttacker
+	setbyte sB_ANIM_TURN, 1
+	attackanimation
+	waitanimation
+	setstatchanger STAT_SPEED, 1, TRUE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_CurseTryAttack
+	printfromtable gStatDownStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_CurseTryAttack: ; .global BattleScript_CurseTryAttack
+	setstatchanger STAT_ATK, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_CurseTryDefense
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_CurseTryDefense: ; .global BattleScript_CurseTryDefense
+	setstatchanger STAT_DEF, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_CurseEnd
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_CurseEnd: ; .global BattleScript_CurseEnd
+	goto BattleScript_MoveEnd
+BattleScript_GhostCurse: ; .global BattleScript_GhostCurse
+	jumpifbytenotequal gBattlerAttacker, gBattlerTarget, BattleScript_DoGhostCurse
+	getmovetarget BS_ATTACKER
+BattleScript_DoGhostCurse: ; .global BattleScript_DoGhostCurse
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	accuracycheck BattleScript_ButItFailed, NO_ACC_CALC_CHECK_LOCK_ON
+	cursetarget BattleScript_ButItFailed
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	setbyte sB_ANIM_TURN, 0
+	attackanimation
+	waitanimation
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	printstring STRINGID_PKMNLAIDCURSE
+	waitmessage B_WAIT_TIME_LONG
+	tryfaintmon BS_ATTACKER
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectProtect: ; .global BattleScript_EffectProtect
+BattleScript_EffectEndure: ; .global BattleScript_EffectEndure
+	attackcanceler
+	attackstring
+	ppreduce
+	setprotectlike
+	attackanimation
+	waitanimation
+	printfromtable gProtectLikeUsedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectSpikes: ; .global BattleScript_EffectSpikes
+	attackcanceler
+	trysetspikes BattleScript_ButItFailedAtkStringPpReduce
+	attackstring
+	ppreduce
+	attackanimation
+	waitanimation
+	printstring STRINGID_SPIKESSCATTERED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectForesight: ; .global BattleScript_EffectForesight
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	setforesight
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNIDENTIFIED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectPerishSong: ; .global BattleScript_EffectPerishSong
+	attackcanceler
+	attackstring
+	ppreduce
+	trysetperishsong BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_FAINTINTHREE
+	waitmessage B_WAIT_TIME_LONG
+	setbyte sBATTLER, 0
+BattleScript_PerishSongLoop: ; .global BattleScript_PerishSongLoop
+	jumpifability BS_SCRIPTING, ABILITY_SOUNDPROOF, BattleScript_PerishSongNotAffected
+BattleScript_PerishSongLoopIncrement: ; .global BattleScript_PerishSongLoopIncrement
+	addbyte sBATTLER, 1
+	jumpifbytenotequal sBATTLER, gBattlersCount, BattleScript_PerishSongLoop
+	goto BattleScript_MoveEnd
+
+BattleScript_PerishSongNotAffected: ; .global BattleScript_PerishSongNotAffected
+	printstring STRINGID_PKMNSXBLOCKSY2
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_PerishSongLoopIncrement
+
+BattleScript_EffectSandstorm: ; .global BattleScript_EffectSandstorm
+	attackcanceler
+	attackstring
+	ppreduce
+	setsandstorm
+	goto BattleScript_MoveWeatherChange
+
+BattleScript_EffectRollout: ; .global BattleScript_EffectRollout
+	attackcanceler
+	attackstring
+	jumpifstatus2 BS_ATTACKER, STATUS2_MULTIPLETURNS, BattleScript_RolloutCheckAccuracy
+	ppreduce
+BattleScript_RolloutCheckAccuracy: ; .global BattleScript_RolloutCheckAccuracy
+	accuracycheck BattleScript_RolloutHit, ACC_CURR_MOVE
+BattleScript_RolloutHit: ; .global BattleScript_RolloutHit
+	typecalc2
+	rolloutdamagecalculation
+	goto BattleScript_HitFromCritCalc
+
+BattleScript_EffectSwagger: ; .global BattleScript_EffectSwagger
+	attackcanceler
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_MakeMoveMissed
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	jumpifconfusedandstatmaxed STAT_ATK, BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	setstatchanger STAT_ATK, 2, FALSE
+	statbuffchange STAT_CHANGE_ALLOW_PTR, BattleScript_SwaggerTryConfuse
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_INCREASE, BattleScript_SwaggerTryConfuse
+	setgraphicalstatchangevalues
+	playanimation BS_TARGET, B_ANIM_STATS_CHANGE, sB_ANIM_ARG1
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_SwaggerTryConfuse: ; .global BattleScript_SwaggerTryConfuse
+	jumpifability BS_TARGET, ABILITY_OWN_TEMPO, BattleScript_OwnTempoPrevents
+	jumpifsideaffecting BS_TARGET, SIDE_STATUS_SAFEGUARD, BattleScript_SafeguardProtected
+	setmoveeffect MOVE_EFFECT_CONFUSION
+	seteffectprimary
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectFuryCutter: ; .global BattleScript_EffectFuryCutter
+	attackcanceler
+	attackstring
+	ppreduce
+	accuracycheck BattleScript_FuryCutterHit, ACC_CURR_MOVE
+BattleScript_FuryCutterHit: ; .global BattleScript_FuryCutterHit
+	furycuttercalc
+	critcalc
+	damagecalc
+	typecalc
+	jumpifmovehadnoeffect BattleScript_FuryCutterHit
+	adjustnormaldamage
+	goto BattleScript_HitFromAtkAnimation
+
+BattleScript_EffectAttract: ; .global BattleScript_EffectAttract
+	attackcanceler
+	attackstring
+	ppreduce
+	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
+	tryinfatuating BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNFELLINLOVE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectReturn: ; .global BattleScript_EffectReturn
+BattleScript_EffectFrustration: ; .global BattleScript_EffectFrustration
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	friendshiptodamagecalculation
+	goto BattleScript_HitFromAtkString
+
+BattleScript_EffectPresent: ; .global BattleScript_EffectPresent
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	typecalc
+	presentdamagecalculation
+
+BattleScript_EffectSafeguard: ; .global BattleScript_EffectSafeguard
+	attackcanceler
+	attackstring
+	ppreduce
+	setsafeguard
+	goto BattleScript_PrintReflectLightScreenSafeguardString
+
+BattleScript_EffectThawHit: ; .global BattleScript_EffectThawHit
+	setmoveeffect MOVE_EFFECT_BURN
+	goto BattleScript_EffectHit
+
+BattleScript_EffectMagnitude: ; .global BattleScript_EffectMagnitude
+	attackcanceler
+	attackstring
+	ppreduce
+	selectfirstvalidtarget
+	magnitudedamagecalculation
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_MAGNITUDESTRENGTH
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_HitsAllWithUndergroundBonusLoop
+
+BattleScript_EffectBatonPass: ; .global BattleScript_EffectBatonPass
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifcantswitch SWITCH_IGNORE_ESCAPE_PREVENTION | BS_ATTACKER, BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	openpartyscreen BS_ATTACKER, BattleScript_ButItFailed
+	switchoutabilities BS_ATTACKER
+	waitstate
+	switchhandleorder BS_ATTACKER, 2
+	returntoball BS_ATTACKER
+	getswitchedmondata BS_ATTACKER
+	switchindataupdate BS_ATTACKER
+	hpthresholds BS_ATTACKER
+	printstring STRINGID_SWITCHINMON
+	switchinanim BS_ATTACKER, TRUE
+	waitstate
+	switchineffects BS_ATTACKER
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectRapidSpin: ; .global BattleScript_EffectRapidSpin
+	setmoveeffect MOVE_EFFECT_RAPIDSPIN | MOVE_EFFECT_AFFECTS_USER | MOVE_EFFECT_CERTAIN
+	goto BattleScript_EffectHit
+
+BattleScript_EffectSonicboom: ; .global BattleScript_EffectSonicboom
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	typecalc
+	bicbyte gMoveResultFlags, MOVE_RESULT_SUPER_EFFECTIVE | MOVE_RESULT_NOT_VERY_EFFECTIVE
+	setword gBattleMoveDamage, 20
+	adjustsetdamage
+	goto BattleScript_HitFromAtkAnimation
+
+BattleScript_EffectMorningSun: ; .global BattleScript_EffectMorningSun
+BattleScript_EffectSynthesis: ; .global BattleScript_EffectSynthesis
+BattleScript_EffectMoonlight: ; .global BattleScript_EffectMoonlight
+	attackcanceler
+	attackstring
+	ppreduce
+	recoverbasedonsunlight BattleScript_AlreadyAtFullHp
+	goto BattleScript_PresentHealTarget
+
+BattleScript_EffectHiddenPower: ; .global BattleScript_EffectHiddenPower
+	attackcanceler
+	hiddenpowercalc
+	goto BattleScript_HitFromAccCheck
+
+BattleScript_EffectRainDance: ; .global BattleScript_EffectRainDance
+	attackcanceler
+	attackstring
+	ppreduce
+	setrain
+BattleScript_MoveWeatherChange: ; .global BattleScript_MoveWeatherChange
+	attackanimation
+	waitanimation
+	printfromtable gMoveWeatherChangeStringIds
+	waitmessage B_WAIT_TIME_LONG
+	call BattleScript_WeatherFormChanges
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectSunnyDay: ; .global BattleScript_EffectSunnyDay
+	attackcanceler
+	attackstring
+	ppreduce
+	setsunny
+	goto BattleScript_MoveWeatherChange
+
+BattleScript_EffectDefenseUpHit: ; .global BattleScript_EffectDefenseUpHit
+	setmoveeffect MOVE_EFFECT_DEF_PLUS_1 | MOVE_EFFECT_AFFECTS_USER
+	goto BattleScript_EffectHit
+
+BattleScript_EffectAttackUpHit: ; .global BattleScript_EffectAttackUpHit
+	setmoveeffect MOVE_EFFECT_ATK_PLUS_1 | MOVE_EFFECT_AFFECTS_USER
+	goto BattleScript_EffectHit
+
+BattleScript_EffectAllStatsUpHit: ; .global BattleScript_EffectAllStatsUpHit
+	setmoveeffect MOVE_EFFECT_ALL_STATS_UP | MOVE_EFFECT_AFFECTS_USER
+	goto BattleScript_EffectHit
+
+BattleScript_EffectBellyDrum: ; .global BattleScript_EffectBellyDrum
+	attackcanceler
+	attackstring
+	ppreduce
+	maxattackhalvehp BattleScript_ButItFailed
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	attackanimation
+	waitanimation
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	printstring STRINGID_PKMNCUTHPMAXEDATTACK
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectPsychUp: ; .global BattleScript_EffectPsychUp
+	attackcanceler
+	attackstring
+	ppreduce
+	copyfoestats BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNCOPIEDSTATCHANGES
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectMirrorCoat: ; .global BattleScript_EffectMirrorCoat
+	attackcanceler
+	mirrorcoatdamagecalculator BattleScript_ButItFailedAtkStringPpReduce
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	typecalc2
+	adjustsetdamage
+	goto BattleScript_HitFromAtkAnimation
+
+BattleScript_EffectSkullBash: ; .global BattleScript_EffectSkullBash
+	jumpifstatus2 BS_ATTACKER, STATUS2_MULTIPLETURNS, BattleScript_TwoTurnMovesSecondTurn
+	jumpifword CMP_COMMON_BITS, gHitMarker, HITMARKER_NO_ATTACKSTRING, BattleScript_TwoTurnMovesSecondTurn
+	setbyte sTWOTURN_STRINGID, B_MSG_TURN1_SKULL_BASH
+	call BattleScriptFirstChargingTurn
+	setstatchanger STAT_DEF, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_SkullBashEnd
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_INCREASE, BattleScript_SkullBashEnd
+	setgraphicalstatchangevalues
+	playanimation BS_ATTACKER, B_ANIM_STATS_CHANGE, sB_ANIM_ARG1
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_SkullBashEnd: ; .global BattleScript_SkullBashEnd
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectTwister: ; .global BattleScript_EffectTwister
+	jumpifnostatus3 BS_TARGET, STATUS3_ON_AIR, BattleScript_FlinchEffect
+	orword gHitMarker, HITMARKER_IGNORE_ON_AIR
+	setbyte sDMG_MULTIPLIER, 2
+BattleScript_FlinchEffect: ; .global BattleScript_FlinchEffect
+	setmoveeffect MOVE_EFFECT_FLINCH
+	goto BattleScript_EffectHit
+
+BattleScript_EffectEarthquake: ; .global BattleScript_EffectEarthquake
+	attackcanceler
+	attackstring
+	ppreduce
+	selectfirstvalidtarget
+BattleScript_HitsAllWithUndergroundBonusLoop: ; .global BattleScript_HitsAllWithUndergroundBonusLoop
+	movevaluescleanup
+	jumpifnostatus3 BS_TARGET, STATUS3_UNDERGROUND, BattleScript_HitsAllNoUndergroundBonus
+	orword gHitMarker, HITMARKER_IGNORE_UNDERGROUND
+	setbyte sDMG_MULTIPLIER, 2
+	goto BattleScript_DoHitAllWithUndergroundBonus
+BattleScript_HitsAllNoUndergroundBonus: ; .global BattleScript_HitsAllNoUndergroundBonus
+	bicword gHitMarker, HITMARKER_IGNORE_UNDERGROUND
+	setbyte sDMG_MULTIPLIER, 1
+BattleScript_DoHitAllWithUndergroundBonus: ; .global BattleScript_DoHitAllWithUndergroundBonus
+	accuracycheck BattleScript_HitAllWithUndergroundBonusMissed, ACC_CURR_MOVE
+	critcalc
+	damagecalc
+	typecalc
+	adjustnormaldamage
+	attackanimation
+	waitanimation
+	effectivenesssound
+	hitanimation BS_TARGET
+	waitstate
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	critmessage
+	waitmessage B_WAIT_TIME_LONG
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	printstring STRINGID_EMPTYSTRING3
+	waitmessage 1
+	tryfaintmon BS_TARGET
+	moveendto MOVEEND_NEXT_TARGET
+	jumpifnexttargetvalid BattleScript_HitsAllWithUndergroundBonusLoop
+	end
+BattleScript_HitAllWithUndergroundBonusMissed: ; .global BattleScript_HitAllWithUndergroundBonusMissed
+	pause B_WAIT_TIME_SHORT
+	typecalc
+	effectivenesssound
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	moveendto MOVEEND_NEXT_TARGET
+	jumpifnexttargetvalid BattleScript_HitsAllWithUndergroundBonusLoop
+	end
+
+BattleScript_EffectFutureSight: ; .global BattleScript_EffectFutureSight
+	attackcanceler
+	attackstring
+	ppreduce
+	trysetfutureattack BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printfromtable gFutureMoveUsedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectGust: ; .global BattleScript_EffectGust
+	jumpifnostatus3 BS_TARGET, STATUS3_ON_AIR, BattleScript_EffectHit
+	orword gHitMarker, HITMARKER_IGNORE_ON_AIR
+	setbyte sDMG_MULTIPLIER, 2
+	goto BattleScript_EffectHit
+
+BattleScript_EffectStomp: ; .global BattleScript_EffectStomp
+	jumpifnostatus3 BS_TARGET, STATUS3_MINIMIZED, BattleScript_FlinchEffect
+	setbyte sDMG_MULTIPLIER, 2
+	goto BattleScript_FlinchEffect
+
+BattleScript_EffectSolarBeam: ; .global BattleScript_EffectSolarBeam
+	jumpifabilitypresent ABILITY_CLOUD_NINE, BattleScript_SolarBeamDecideTurn
+	jumpifabilitypresent ABILITY_AIR_LOCK, BattleScript_SolarBeamDecideTurn
+	jumpifhalfword CMP_COMMON_BITS, gBattleWeather, B_WEATHER_SUN, BattleScript_SolarBeamOnFirstTurn
+BattleScript_SolarBeamDecideTurn: ; .global BattleScript_SolarBeamDecideTurn
+	jumpifstatus2 BS_ATTACKER, STATUS2_MULTIPLETURNS, BattleScript_TwoTurnMovesSecondTurn
+	jumpifword CMP_COMMON_BITS, gHitMarker, HITMARKER_NO_ATTACKSTRING, BattleScript_TwoTurnMovesSecondTurn
+	setbyte sTWOTURN_STRINGID, B_MSG_TURN1_SOLAR_BEAM
+	call BattleScriptFirstChargingTurn
+	goto BattleScript_MoveEnd
+BattleScript_SolarBeamOnFirstTurn: ; .global BattleScript_SolarBeamOnFirstTurn
+	orword gHitMarker, HITMARKER_CHARGING
+	setmoveeffect MOVE_EFFECT_CHARGING | MOVE_EFFECT_AFFECTS_USER
+	seteffectprimary
+	ppreduce
+	goto BattleScript_TwoTurnMovesSecondTurn
+
+BattleScript_EffectThunder: ; .global BattleScript_EffectThunder
+	setmoveeffect MOVE_EFFECT_PARALYSIS
+	orword gHitMarker, HITMARKER_IGNORE_ON_AIR
+	goto BattleScript_EffectHit
+
+BattleScript_EffectTeleport: ; .global BattleScript_EffectTeleport
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifbattletype BATTLE_TYPE_TRAINER, BattleScript_ButItFailed
+	getifcantrunfrombattle BS_ATTACKER
+	jumpifbyte CMP_EQUAL, gBattleCommunication, 1, BattleScript_ButItFailed
+	jumpifbyte CMP_EQUAL, gBattleCommunication, 2, BattleScript_PrintAbilityMadeIneffective
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNFLEDFROMBATTLE
+	waitmessage B_WAIT_TIME_LONG
+	setbyte gBattleOutcome, B_OUTCOME_PLAYER_TELEPORTED
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectBeatUp: ; .global BattleScript_EffectBeatUp
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	pause B_WAIT_TIME_SHORT
+	ppreduce
+	setbyte gBattleCommunication, 0
+BattleScript_BeatUpLoop: ; .global BattleScript_BeatUpLoop
+	movevaluescleanup
+	trydobeatup BattleScript_BeatUpEnd, BattleScript_ButItFailed
+	printstring STRINGID_PKMNATTACK
+	critcalc
+	jumpifbyte CMP_NOT_EQUAL, gCritMultiplier, 2, BattleScript_BeatUpAttack
+	manipulatedamage DMG_DOUBLED
+BattleScript_BeatUpAttack: ; .global BattleScript_BeatUpAttack
+	adjustnormaldamage
+	attackanimation
+	waitanimation
+	effectivenesssound
+	hitanimation BS_TARGET
+	waitstate
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	critmessage
+	waitmessage B_WAIT_TIME_LONG
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	tryfaintmon BS_TARGET
+	moveendto MOVEEND_NEXT_TARGET
+	goto BattleScript_BeatUpLoop
+BattleScript_BeatUpEnd: ; .global BattleScript_BeatUpEnd
+	end
+
+BattleScript_EffectSemiInvulnerable: ; .global BattleScript_EffectSemiInvulnerable
+	jumpifstatus2 BS_ATTACKER, STATUS2_MULTIPLETURNS, BattleScript_SecondTurnSemiInvulnerable
+	jumpifword CMP_COMMON_BITS, gHitMarker, HITMARKER_NO_ATTACKSTRING, BattleScript_SecondTurnSemiInvulnerable
+	jumpifmove MOVE_FLY, BattleScript_FirstTurnFly
+	jumpifmove MOVE_DIVE, BattleScript_FirstTurnDive
+	jumpifmove MOVE_BOUNCE, BattleScript_FirstTurnBounce
+	setbyte sTWOTURN_STRINGID, B_MSG_TURN1_DIG
+	goto BattleScript_FirstTurnSemiInvulnerable
+
+BattleScript_FirstTurnBounce: ; .global BattleScript_FirstTurnBounce
+	setbyte sTWOTURN_STRINGID, B_MSG_TURN1_BOUNCE
+	goto BattleScript_FirstTurnSemiInvulnerable
+
+BattleScript_FirstTurnDive: ; .global BattleScript_FirstTurnDive
+	setbyte sTWOTURN_STRINGID, B_MSG_TURN1_DIVE
+	goto BattleScript_FirstTurnSemiInvulnerable
+
+BattleScript_FirstTurnFly: ; .global BattleScript_FirstTurnFly
+	setbyte sTWOTURN_STRINGID, B_MSG_TURN1_FLY
+BattleScript_FirstTurnSemiInvulnerable: ; .global BattleScript_FirstTurnSemiInvulnerable
+	call BattleScriptFirstChargingTurn
+	setsemiinvulnerablebit
+	goto BattleScript_MoveEnd
+
+BattleScript_SecondTurnSemiInvulnerable: ; .global BattleScript_SecondTurnSemiInvulnerable
+	attackcanceler
+	setmoveeffect MOVE_EFFECT_CHARGING
+	setbyte sB_ANIM_TURN, 1
+	clearstatusfromeffect BS_ATTACKER
+	orword gHitMarker, HITMARKER_NO_PPDEDUCT
+	jumpifnotmove MOVE_BOUNCE, BattleScript_SemiInvulnerableTryHit
+	setmoveeffect MOVE_EFFECT_PARALYSIS
+BattleScript_SemiInvulnerableTryHit: ; .global BattleScript_SemiInvulnerableTryHit
+	accuracycheck BattleScript_SemiInvulnerableMiss, ACC_CURR_MOVE
+	clearsemiinvulnerablebit
+	goto BattleScript_HitFromAtkString
+
+BattleScript_SemiInvulnerableMiss: ; .global BattleScript_SemiInvulnerableMiss
+	clearsemiinvulnerablebit
+	goto BattleScript_PrintMoveMissed
+
+BattleScript_EffectDefenseCurl: ; .global BattleScript_EffectDefenseCurl
+	attackcanceler
+	attackstring
+	ppreduce
+	setdefensecurlbit
+	setstatchanger STAT_DEF, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_DefenseCurlDoStatUpAnim
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_INCREASE, BattleScript_StatUpPrintString
+	attackanimation
+	waitanimation
+BattleScript_DefenseCurlDoStatUpAnim: ; .global BattleScript_DefenseCurlDoStatUpAnim
+	goto BattleScript_StatUpDoAnim
+
+BattleScript_EffectSoftboiled: ; .global BattleScript_EffectSoftboiled
+	attackcanceler
+	attackstring
+	ppreduce
+	tryhealhalfhealth BattleScript_AlreadyAtFullHp, BS_TARGET
+BattleScript_PresentHealTarget: ; .global BattleScript_PresentHealTarget
+	attackanimation
+	waitanimation
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	printstring STRINGID_PKMNREGAINEDHEALTH
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_AlreadyAtFullHp: ; .global BattleScript_AlreadyAtFullHp
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNHPFULL
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectFakeOut: ; .global BattleScript_EffectFakeOut
+	attackcanceler
+	jumpifnotfirstturn BattleScript_ButItFailedAtkStringPpReduce
+	setmoveeffect MOVE_EFFECT_FLINCH | MOVE_EFFECT_CERTAIN
+	goto BattleScript_EffectHit
+
+BattleScript_ButItFailedAtkStringPpReduce: ; .global BattleScript_ButItFailedAtkStringPpReduce
+	attackstring
+BattleScript_ButItFailedPpReduce: ; .global BattleScript_ButItFailedPpReduce
+	ppreduce
+BattleScript_ButItFailed: ; .global BattleScript_ButItFailed
+	pause B_WAIT_TIME_SHORT
+	orbyte gMoveResultFlags, MOVE_RESULT_FAILED
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_NotAffected: ; .global BattleScript_NotAffected
+	pause B_WAIT_TIME_SHORT
+	orbyte gMoveResultFlags, MOVE_RESULT_DOESNT_AFFECT_FOE
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectUproar: ; .global BattleScript_EffectUproar
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	setmoveeffect MOVE_EFFECT_UPROAR | MOVE_EFFECT_AFFECTS_USER
+	attackstring
+	jumpifstatus2 BS_ATTACKER, STATUS2_MULTIPLETURNS, BattleScript_UproarHit
+	ppreduce
+BattleScript_UproarHit: ; .global BattleScript_UproarHit
+	nop
+	goto BattleScript_HitFromCritCalc
+
+BattleScript_EffectStockpile: ; .global BattleScript_EffectStockpile
+	attackcanceler
+	attackstring
+	ppreduce
+	stockpile
+	attackanimation
+	waitanimation
+	printfromtable gStockpileUsedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectSpitUp: ; .global BattleScript_EffectSpitUp
+	attackcanceler
+	jumpifbyte CMP_EQUAL, cMISS_TYPE, B_MSG_PROTECTED, BattleScript_SpitUpFailProtect
+	attackstring
+	ppreduce
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	stockpiletobasedamage BattleScript_SpitUpFail
+	typecalc
+	adjustsetdamage
+	goto BattleScript_HitFromAtkAnimation
+BattleScript_SpitUpFail: ; .global BattleScript_SpitUpFail
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_FAILEDTOSPITUP
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_SpitUpFailProtect: ; .global BattleScript_SpitUpFailProtect
+	attackstring
+	ppreduce
+	pause B_WAIT_TIME_LONG
+	stockpiletobasedamage BattleScript_SpitUpFail
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectSwallow: ; .global BattleScript_EffectSwallow
+	attackcanceler
+	attackstring
+	ppreduce
+	stockpiletohpheal BattleScript_SwallowFail
+	goto BattleScript_PresentHealTarget
+
+BattleScript_SwallowFail: ; .global BattleScript_SwallowFail
+	pause B_WAIT_TIME_SHORT
+	printfromtable gSwallowFailStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectHail: ; .global BattleScript_EffectHail
+	attackcanceler
+	attackstring
+	ppreduce
+	sethail
+	goto BattleScript_MoveWeatherChange
+
+BattleScript_EffectTorment: ; .global BattleScript_EffectTorment
+	attackcanceler
+	attackstring
+	ppreduce
+	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
+	settorment BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNSUBJECTEDTOTORMENT
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectFlatter: ; .global BattleScript_EffectFlatter
+	attackcanceler
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_MakeMoveMissed
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	jumpifconfusedandstatmaxed STAT_SPATK, BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	setstatchanger STAT_SPATK, 1, FALSE
+	statbuffchange STAT_CHANGE_ALLOW_PTR, BattleScript_FlatterTryConfuse
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_INCREASE, BattleScript_FlatterTryConfuse
+	setgraphicalstatchangevalues
+	playanimation BS_TARGET, B_ANIM_STATS_CHANGE, sB_ANIM_ARG1
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_FlatterTryConfuse: ; .global BattleScript_FlatterTryConfuse
+	jumpifability BS_TARGET, ABILITY_OWN_TEMPO, BattleScript_OwnTempoPrevents
+	jumpifsideaffecting BS_TARGET, SIDE_STATUS_SAFEGUARD, BattleScript_SafeguardProtected
+	setmoveeffect MOVE_EFFECT_CONFUSION
+	seteffectprimary
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectWillOWisp: ; .global BattleScript_EffectWillOWisp
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	jumpifstatus BS_TARGET, STATUS1_BURN, BattleScript_AlreadyBurned
+	jumpiftype BS_TARGET, TYPE_FIRE, BattleScript_NotAffected
+	jumpifability BS_TARGET, ABILITY_WATER_VEIL, BattleScript_WaterVeilPrevents
+	jumpifstatus BS_TARGET, STATUS1_ANY, BattleScript_ButItFailed
+	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
+	jumpifsideaffecting BS_TARGET, SIDE_STATUS_SAFEGUARD, BattleScript_SafeguardProtected
+	attackanimation
+	waitanimation
+	setmoveeffect MOVE_EFFECT_BURN
+	seteffectprimary
+	goto BattleScript_MoveEnd
+
+BattleScript_WaterVeilPrevents: ; .global BattleScript_WaterVeilPrevents
+	copybyte gEffectBattler, gBattlerTarget
+	setbyte cMULTISTRING_CHOOSER, B_MSG_ABILITY_PREVENTS_MOVE_STATUS
+	call BattleScript_BRNPrevention
+	goto BattleScript_MoveEnd
+
+BattleScript_AlreadyBurned: ; .global BattleScript_AlreadyBurned
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNALREADYHASBURN
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectMemento: ; .global BattleScript_EffectMemento
+	attackcanceler
+	jumpifbyte CMP_EQUAL, cMISS_TYPE, B_MSG_PROTECTED, BattleScript_MementoTargetProtect
+	attackstring
+	ppreduce
+	trymemento BattleScript_ButItFailed
+	setatkhptozero
+	attackanimation
+	waitanimation
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_EffectMementoPrintNoEffect
+	setbyte sSTAT_ANIM_PLAYED, FALSE
+	playstatchangeanimation BS_TARGET, BIT_ATK | BIT_SPATK, STAT_CHANGE_NEGATIVE | STAT_CHANGE_BY_TWO | STAT_CHANGE_MULTIPLE_STATS
+	playstatchangeanimation BS_TARGET, BIT_ATK, STAT_CHANGE_NEGATIVE | STAT_CHANGE_BY_TWO
+	setstatchanger STAT_ATK, 2, TRUE
+	statbuffchange STAT_CHANGE_ALLOW_PTR, BattleScript_EffectMementoTrySpAtk
+                                                                               
+	jumpifbyte CMP_GREATER_THAN, cMULTISTRING_CHOOSER, B_MSG_DEFENDER_STAT_FELL, BattleScript_EffectMementoTrySpAtk
+	printfromtable gStatDownStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_EffectMementoTrySpAtk:
+	playstatchangeanimation BS_TARGET, BIT_SPATK, STAT_CHANGE_NEGATIVE | STAT_CHANGE_BY_TWO
+	setstatchanger STAT_SPATK, 2, TRUE
+	statbuffchange STAT_CHANGE_ALLOW_PTR, BattleScript_EffectMementoTryFaint
+                                                                               
+	jumpifbyte CMP_GREATER_THAN, cMULTISTRING_CHOOSER, B_MSG_DEFENDER_STAT_FELL, BattleScript_EffectMementoTryFaint
+	printfromtable gStatDownStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_EffectMementoTryFaint:
+	tryfaintmon BS_ATTACKER
+	goto BattleScript_MoveEnd
+BattleScript_EffectMementoPrintNoEffect:
+	printstring STRINGID_BUTNOEFFECT
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_EffectMementoTryFaint
+                                                                                                             
+BattleScript_MementoTargetProtect:
+	attackstring
+	ppreduce
+	trymemento BattleScript_MementoTargetProtectEnd
+BattleScript_MementoTargetProtectEnd:
+	setatkhptozero
+	pause B_WAIT_TIME_LONG
+	effectivenesssound
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	tryfaintmon BS_ATTACKER
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectFacade: ; .global BattleScript_EffectFacade
+	jumpifstatus BS_ATTACKER, STATUS1_POISON | STATUS1_BURN | STATUS1_PARALYSIS | STATUS1_TOXIC_POISON, BattleScript_FacadeDoubleDmg
+	goto BattleScript_EffectHit
+
+BattleScript_FacadeDoubleDmg: ; .global BattleScript_FacadeDoubleDmg
+	setbyte sDMG_MULTIPLIER, 2
+	goto BattleScript_EffectHit
+
+BattleScript_EffectFocusPunch: ; .global BattleScript_EffectFocusPunch
+	attackcanceler
+	jumpifnodamage BattleScript_HitFromAccCheck
+	ppreduce
+	printstring STRINGID_PKMNLOSTFOCUS
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectSmellingsalt: ; .global BattleScript_EffectSmellingsalt
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_EffectHit
+	setmoveeffect MOVE_EFFECT_REMOVE_PARALYSIS | MOVE_EFFECT_CERTAIN
+	jumpifstatus BS_TARGET, STATUS1_PARALYSIS, BattleScript_SmellingsaltDoubleDmg
+	goto BattleScript_EffectHit
+BattleScript_SmellingsaltDoubleDmg: ; .global BattleScript_SmellingsaltDoubleDmg
+	setbyte sDMG_MULTIPLIER, 2
+	goto BattleScript_EffectHit
+
+BattleScript_EffectFollowMe: ; .global BattleScript_EffectFollowMe
+	attackcanceler
+	attackstring
+	ppreduce
+	setforcedtarget
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNCENTERATTENTION
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectNaturePower: ; .global BattleScript_EffectNaturePower
+	attackcanceler
+	attackstring
+	pause B_WAIT_TIME_SHORT
+	callterrainattack
+	printstring STRINGID_NATUREPOWERTURNEDINTO
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_EffectCharge: ; .global BattleScript_EffectCharge
+	attackcanceler
+	attackstring
+	ppreduce
+	setcharge
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNCHARGINGPOWER
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectTaunt: ; .global BattleScript_EffectTaunt
+	attackcanceler
+	attackstring
+	ppreduce
+	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
+	settaunt BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNFELLFORTAUNT
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectHelpingHand: ; .global BattleScript_EffectHelpingHand
+	attackcanceler
+	attackstring
+	ppreduce
+	trysethelpinghand BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNREADYTOHELP
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectTrick: ; .global BattleScript_EffectTrick
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
+	tryswapitems BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNSWITCHEDITEMS
+	waitmessage B_WAIT_TIME_LONG
+	printfromtable gItemSwapStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectRolePlay: ; .global BattleScript_EffectRolePlay
+	attackcanceler
+	attackstring
+	ppreduce
+	accuracycheck BattleScript_ButItFailed, NO_ACC_CALC_CHECK_LOCK_ON
+	trycopyability BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNCOPIEDFOE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectWish: ; .global BattleScript_EffectWish
+	attackcanceler
+	attackstring
+	ppreduce
+	trywish 0, BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectAssist: ; .global BattleScript_EffectAssist
+	attackcanceler
+	attackstring
+	assistattackselect BattleScript_ButItFailedPpReduce
+	attackanimation
+	waitanimation
+	setbyte sB_ANIM_TURN, 0
+	setbyte sB_ANIM_TARGETS_HIT, 0
+	jumptocalledmove TRUE
+
+BattleScript_EffectIngrain: ; .global BattleScript_EffectIngrain
+	attackcanceler
+	attackstring
+	ppreduce
+	trysetroots BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNPLANTEDROOTS
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectSuperpower: ; .global BattleScript_EffectSuperpower
+	setmoveeffect MOVE_EFFECT_ATK_DEF_DOWN | MOVE_EFFECT_AFFECTS_USER | MOVE_EFFECT_CERTAIN
+	goto BattleScript_EffectHit
+
+BattleScript_EffectMagicCoat: ; .global BattleScript_EffectMagicCoat
+	attackcanceler
+	trysetmagiccoat BattleScript_ButItFailedAtkStringPpReduce
+	attackstring
+	ppreduce
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNSHROUDEDITSELF
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectRecycle: ; .global BattleScript_EffectRecycle
+	attackcanceler
+	attackstring
+	ppreduce
+	tryrecycleitem BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_XFOUNDONEY
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectRevenge: ; .global BattleScript_EffectRevenge
+	doubledamagedealtifdamaged
+	goto BattleScript_EffectHit
+
+BattleScript_EffectBrickBreak: ; .global BattleScript_EffectBrickBreak
+	attackcanceler
+	accuracycheck BattleScript_PrintMoveMissed, ACC_CURR_MOVE
+	attackstring
+	ppreduce
+	removelightscreenreflect
+	critcalc
+	damagecalc
+	typecalc
+	adjustnormaldamage
+	jumpifbyte CMP_EQUAL, sB_ANIM_TURN, 0, BattleScript_BrickBreakAnim
+	bicbyte gMoveResultFlags, MOVE_RESULT_MISSED | MOVE_RESULT_DOESNT_AFFECT_FOE
+BattleScript_BrickBreakAnim: ; .global BattleScript_BrickBreakAnim
+	attackanimation
+	waitanimation
+	jumpifbyte CMP_LESS_THAN, sB_ANIM_TURN, 2, BattleScript_BrickBreakDoHit
+	printstring STRINGID_THEWALLSHATTERED
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_BrickBreakDoHit: ; .global BattleScript_BrickBreakDoHit
+	typecalc2
+	effectivenesssound
+	hitanimation BS_TARGET
+	waitstate
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	critmessage
+	waitmessage B_WAIT_TIME_LONG
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	seteffectwithchance
+	tryfaintmon BS_TARGET
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectYawn: ; .global BattleScript_EffectYawn
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifability BS_TARGET, ABILITY_VITAL_SPIRIT, BattleScript_PrintBankAbilityMadeIneffective
+	jumpifability BS_TARGET, ABILITY_INSOMNIA, BattleScript_PrintBankAbilityMadeIneffective
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_ButItFailed
+	jumpifsideaffecting BS_TARGET, SIDE_STATUS_SAFEGUARD, BattleScript_SafeguardProtected
+	accuracycheck BattleScript_ButItFailed, NO_ACC_CALC_CHECK_LOCK_ON
+	jumpifcantmakeasleep BattleScript_ButItFailed
+	setyawn BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNWASMADEDROWSY
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+BattleScript_PrintBankAbilityMadeIneffective: ; .global BattleScript_PrintBankAbilityMadeIneffective
+	copybyte sBATTLER, sBATTLER_WITH_ABILITY
+BattleScript_PrintAbilityMadeIneffective: ; .global BattleScript_PrintAbilityMadeIneffective
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNSXMADEITINEFFECTIVE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectKnockOff: ; .global BattleScript_EffectKnockOff
+	setmoveeffect MOVE_EFFECT_KNOCK_OFF
+	goto BattleScript_EffectHit
+
+BattleScript_EffectEndeavor: ; .global BattleScript_EffectEndeavor
+	attackcanceler
+	attackstring
+	ppreduce
+	setdamagetohealthdifference BattleScript_ButItFailed
+	copyword gHpDealt, gBattleMoveDamage
+	accuracycheck BattleScript_MoveMissedPause, ACC_CURR_MOVE
+	typecalc
+	jumpifmovehadnoeffect BattleScript_HitFromAtkAnimation
+	bicbyte gMoveResultFlags, MOVE_RESULT_SUPER_EFFECTIVE | MOVE_RESULT_NOT_VERY_EFFECTIVE
+	copyword gBattleMoveDamage, gHpDealt
+	adjustsetdamage
+	goto BattleScript_HitFromAtkAnimation
+
+BattleScript_EffectEruption: ; .global BattleScript_EffectEruption
+	scaledamagebyhealthratio
+	goto BattleScript_EffectHit
+
+BattleScript_EffectSkillSwap: ; .global BattleScript_EffectSkillSwap
+	attackcanceler
+	attackstring
+	ppreduce
+	accuracycheck BattleScript_ButItFailed, NO_ACC_CALC_CHECK_LOCK_ON
+	tryswapabilities BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNSWAPPEDABILITIES
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectImprison: ; .global BattleScript_EffectImprison
+	attackcanceler
+	attackstring
+	ppreduce
+	tryimprison BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNSEALEDOPPONENTMOVE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectRefresh: ; .global BattleScript_EffectRefresh
+	attackcanceler
+	attackstring
+	ppreduce
+	cureifburnedparalysedorpoisoned BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNSTATUSNORMAL
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_ATTACKER
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectGrudge: ; .global BattleScript_EffectGrudge
+	attackcanceler
+	attackstring
+	ppreduce
+	trysetgrudge BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNWANTSGRUDGE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectSnatch: ; .global BattleScript_EffectSnatch
+	attackcanceler
+	trysetsnatch BattleScript_ButItFailedAtkStringPpReduce
+	attackstring
+	ppreduce
+	attackanimation
+	waitanimation
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNWAITSFORTARGET
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectLowKick: ; .global BattleScript_EffectLowKick
+	attackcanceler
+	attackstring
+	ppreduce
+	weightdamagecalculation
+	accuracycheck BattleScript_MoveMissedPause, ACC_CURR_MOVE
+	goto BattleScript_HitFromCritCalc
+
+BattleScript_EffectSecretPower: ; .global BattleScript_EffectSecretPower
+	getsecretpowereffect
+	goto BattleScript_EffectHit
+
+BattleScript_EffectDoubleEdge: ; .global BattleScript_EffectDoubleEdge
+	setmoveeffect MOVE_EFFECT_RECOIL_33 | MOVE_EFFECT_AFFECTS_USER | MOVE_EFFECT_CERTAIN
+	goto BattleScript_EffectHit
+
+BattleScript_EffectTeeterDance: ; .global BattleScript_EffectTeeterDance
+	attackcanceler
+	attackstring
+	ppreduce
+	setbyte gBattlerTarget, 0
+BattleScript_TeeterDanceLoop: ; .global BattleScript_TeeterDanceLoop
+	movevaluescleanup
+	setmoveeffect MOVE_EFFECT_CONFUSION
+	jumpifbyteequal gBattlerAttacker, gBattlerTarget, BattleScript_TeeterDanceLoopIncrement
+	jumpifability BS_TARGET, ABILITY_OWN_TEMPO, BattleScript_TeeterDanceOwnTempoPrevents
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_TeeterDanceSubstitutePrevents
+	jumpifstatus2 BS_TARGET, STATUS2_CONFUSION, BattleScript_TeeterDanceAlreadyConfused
+	accuracycheck BattleScript_TeeterDanceMissed, ACC_CURR_MOVE
+	jumpifsideaffecting BS_TARGET, SIDE_STATUS_SAFEGUARD, BattleScript_TeeterDanceSafeguardProtected
+	attackanimation
+	waitanimation
+	seteffectprimary
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_TeeterDanceLoopIncrement: ; .global BattleScript_TeeterDanceLoopIncrement
+	moveendto MOVEEND_NEXT_TARGET
+	addbyte gBattlerTarget, 1
+	jumpifbytenotequal gBattlerTarget, gBattlersCount, BattleScript_TeeterDanceLoop
+	end
+
+BattleScript_TeeterDanceOwnTempoPrevents: ; .global BattleScript_TeeterDanceOwnTempoPrevents
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNPREVENTSCONFUSIONWITH
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_TeeterDanceLoopIncrement
+
+BattleScript_TeeterDanceSafeguardProtected: ; .global BattleScript_TeeterDanceSafeguardProtected
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNUSEDSAFEGUARD
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_TeeterDanceLoopIncrement
+
+BattleScript_TeeterDanceSubstitutePrevents: ; .global BattleScript_TeeterDanceSubstitutePrevents
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_BUTITFAILED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_TeeterDanceLoopIncrement
+
+BattleScript_TeeterDanceAlreadyConfused: ; .global BattleScript_TeeterDanceAlreadyConfused
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNALREADYCONFUSED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_TeeterDanceLoopIncrement
+
+BattleScript_TeeterDanceMissed: ; .global BattleScript_TeeterDanceMissed
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_TeeterDanceLoopIncrement
+
+BattleScript_EffectMudSport: ; .global BattleScript_EffectMudSport
+BattleScript_EffectWaterSport: ; .global BattleScript_EffectWaterSport
+	attackcanceler
+	attackstring
+	ppreduce
+	settypebasedhalvers BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printfromtable gSportsUsedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectPoisonFang: ; .global BattleScript_EffectPoisonFang
+	setmoveeffect MOVE_EFFECT_TOXIC
+	goto BattleScript_EffectHit
+
+BattleScript_EffectWeatherBall: ; .global BattleScript_EffectWeatherBall
+	setweatherballtype
+	goto BattleScript_EffectHit
+
+BattleScript_EffectOverheat: ; .global BattleScript_EffectOverheat
+	setmoveeffect MOVE_EFFECT_SP_ATK_TWO_DOWN | MOVE_EFFECT_AFFECTS_USER | MOVE_EFFECT_CERTAIN
+	goto BattleScript_EffectHit
+
+BattleScript_EffectTickle: ; .global BattleScript_EffectTickle
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstat BS_TARGET, CMP_GREATER_THAN, STAT_ATK, MIN_STAT_STAGE, BattleScript_TickleDoMoveAnim
+	jumpifstat BS_TARGET, CMP_EQUAL, STAT_DEF, MIN_STAT_STAGE, BattleScript_CantLowerMultipleStats
+BattleScript_TickleDoMoveAnim: ; .global BattleScript_TickleDoMoveAnim
+	accuracycheck BattleScript_ButItFailed, ACC_CURR_MOVE
+	attackanimation
+	waitanimation
+	setbyte sSTAT_ANIM_PLAYED, FALSE
+	playstatchangeanimation BS_TARGET, BIT_ATK | BIT_DEF, STAT_CHANGE_NEGATIVE | STAT_CHANGE_MULTIPLE_STATS
+	playstatchangeanimation BS_TARGET, BIT_ATK, STAT_CHANGE_NEGATIVE
+	setstatchanger STAT_ATK, 1, TRUE
+	statbuffchange STAT_CHANGE_ALLOW_PTR, BattleScript_TickleTryLowerDef
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_DECREASE, BattleScript_TickleTryLowerDef
+	printfromtable gStatDownStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_TickleTryLowerDef: ; .global BattleScript_TickleTryLowerDef
+	playstatchangeanimation BS_TARGET, BIT_DEF, STAT_CHANGE_NEGATIVE
+	setstatchanger STAT_DEF, 1, TRUE
+	statbuffchange STAT_CHANGE_ALLOW_PTR, BattleScript_TickleEnd
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_DECREASE, BattleScript_TickleEnd
+	printfromtable gStatDownStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_TickleEnd: ; .global BattleScript_TickleEnd
+	goto BattleScript_MoveEnd
+
+BattleScript_CantLowerMultipleStats: ; .global BattleScript_CantLowerMultipleStats
+	pause B_WAIT_TIME_SHORT
+	orbyte gMoveResultFlags, MOVE_RESULT_FAILED
+	printstring STRINGID_STATSWONTDECREASE2
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectCosmicPower: ; .global BattleScript_EffectCosmicPower
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstat BS_ATTACKER, CMP_LESS_THAN, STAT_DEF, MAX_STAT_STAGE, BattleScript_CosmicPowerDoMoveAnim
+	jumpifstat BS_ATTACKER, CMP_EQUAL, STAT_SPDEF, MAX_STAT_STAGE, BattleScript_CantRaiseMultipleStats
+BattleScript_CosmicPowerDoMoveAnim: ; .global BattleScript_CosmicPowerDoMoveAnim
+	attackanimation
+	waitanimation
+	setbyte sSTAT_ANIM_PLAYED, FALSE
+	playstatchangeanimation BS_ATTACKER, BIT_DEF | BIT_SPDEF, 0
+	setstatchanger STAT_DEF, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_CosmicPowerTrySpDef
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_INCREASE, BattleScript_CosmicPowerTrySpDef
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_CosmicPowerTrySpDef: ; .global BattleScript_CosmicPowerTrySpDef
+	setstatchanger STAT_SPDEF, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_CosmicPowerEnd
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_INCREASE, BattleScript_CosmicPowerEnd
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_CosmicPowerEnd: ; .global BattleScript_CosmicPowerEnd
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectSkyUppercut: ; .global BattleScript_EffectSkyUppercut
+	orword gHitMarker, HITMARKER_IGNORE_ON_AIR
+	goto BattleScript_EffectHit
+
+BattleScript_EffectBulkUp: ; .global BattleScript_EffectBulkUp
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstat BS_ATTACKER, CMP_LESS_THAN, STAT_ATK, MAX_STAT_STAGE, BattleScript_BulkUpDoMoveAnim
+	jumpifstat BS_ATTACKER, CMP_EQUAL, STAT_DEF, MAX_STAT_STAGE, BattleScript_CantRaiseMultipleStats
+BattleScript_BulkUpDoMoveAnim: ; .global BattleScript_BulkUpDoMoveAnim
+	attackanimation
+	waitanimation
+	setbyte sSTAT_ANIM_PLAYED, FALSE
+	playstatchangeanimation BS_ATTACKER, BIT_ATK | BIT_DEF, 0
+	setstatchanger STAT_ATK, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_BulkUpTryDef
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_INCREASE, BattleScript_BulkUpTryDef
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_BulkUpTryDef: ; .global BattleScript_BulkUpTryDef
+	setstatchanger STAT_DEF, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_BulkUpEnd
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_INCREASE, BattleScript_BulkUpEnd
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_BulkUpEnd: ; .global BattleScript_BulkUpEnd
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectCalmMind: ; .global BattleScript_EffectCalmMind
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstat BS_ATTACKER, CMP_LESS_THAN, STAT_SPATK, MAX_STAT_STAGE, BattleScript_CalmMindDoMoveAnim
+	jumpifstat BS_ATTACKER, CMP_EQUAL, STAT_SPDEF, MAX_STAT_STAGE, BattleScript_CantRaiseMultipleStats
+BattleScript_CalmMindDoMoveAnim: ; .global BattleScript_CalmMindDoMoveAnim
+	attackanimation
+	waitanimation
+	setbyte sSTAT_ANIM_PLAYED, FALSE
+	playstatchangeanimation BS_ATTACKER, BIT_SPATK | BIT_SPDEF, 0
+	setstatchanger STAT_SPATK, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_CalmMindTrySpDef
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_INCREASE, BattleScript_CalmMindTrySpDef
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_CalmMindTrySpDef: ; .global BattleScript_CalmMindTrySpDef
+	setstatchanger STAT_SPDEF, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_CalmMindEnd
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_INCREASE, BattleScript_CalmMindEnd
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_CalmMindEnd: ; .global BattleScript_CalmMindEnd
+	goto BattleScript_MoveEnd
+
+BattleScript_CantRaiseMultipleStats: ; .global BattleScript_CantRaiseMultipleStats
+	pause B_WAIT_TIME_SHORT
+	orbyte gMoveResultFlags, MOVE_RESULT_FAILED
+	printstring STRINGID_STATSWONTINCREASE2
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectDragonDance: ; .global BattleScript_EffectDragonDance
+	attackcanceler
+	attackstring
+	ppreduce
+	jumpifstat BS_ATTACKER, CMP_LESS_THAN, STAT_ATK, MAX_STAT_STAGE, BattleScript_DragonDanceDoMoveAnim
+	jumpifstat BS_ATTACKER, CMP_EQUAL, STAT_SPEED, MAX_STAT_STAGE, BattleScript_CantRaiseMultipleStats
+BattleScript_DragonDanceDoMoveAnim: ; .global BattleScript_DragonDanceDoMoveAnim
+	attackanimation
+	waitanimation
+	setbyte sSTAT_ANIM_PLAYED, FALSE
+	playstatchangeanimation BS_ATTACKER, BIT_ATK | BIT_SPEED, 0
+	setstatchanger STAT_ATK, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_DragonDanceTrySpeed
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_INCREASE, BattleScript_DragonDanceTrySpeed
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_DragonDanceTrySpeed: ; .global BattleScript_DragonDanceTrySpeed
+	setstatchanger STAT_SPEED, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_DragonDanceEnd
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_STAT_WONT_INCREASE, BattleScript_DragonDanceEnd
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_DragonDanceEnd: ; .global BattleScript_DragonDanceEnd
+	goto BattleScript_MoveEnd
+
+BattleScript_EffectCamouflage: ; .global BattleScript_EffectCamouflage
+	attackcanceler
+	attackstring
+	ppreduce
+	settypetoterrain BattleScript_ButItFailed
+	attackanimation
+	waitanimation
+	printstring STRINGID_PKMNCHANGEDTYPE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_FaintAttacker: ; .global BattleScript_FaintAttacker
+	playfaintcry BS_ATTACKER
+	pause B_WAIT_TIME_LONG
+	dofaintanimation BS_ATTACKER
+	cleareffectsonfaint BS_ATTACKER
+	printstring STRINGID_ATTACKERFAINTED
+	printstring STRINGID_EMPTYSTRING3
+	return
+
+BattleScript_FaintTarget: ; .global BattleScript_FaintTarget
+	playfaintcry BS_TARGET
+	pause B_WAIT_TIME_LONG
+	dofaintanimation BS_TARGET
+	cleareffectsonfaint BS_TARGET
+	printstring STRINGID_TARGETFAINTED
+	printstring STRINGID_EMPTYSTRING3
+	return
+
+BattleScript_GiveExp: ; .global BattleScript_GiveExp
+	setbyte sGIVEEXP_STATE, 0
+	getexp BS_TARGET
+	end2
+
+BattleScript_HandleFaintedMon: ; .global BattleScript_HandleFaintedMon
+	checkteamslost BattleScript_LinkHandleFaintedMonMultiple
+	jumpifbyte CMP_NOT_EQUAL, gBattleOutcome, 0, BattleScript_FaintedMonEnd
+	jumpifbattletype BATTLE_TYPE_TRAINER, BattleScript_FaintedMonTryChoose
+	jumpifword CMP_NO_COMMON_BITS, gHitMarker, HITMARKER_PLAYER_FAINTED, BattleScript_FaintedMonTryChoose
+	printstring STRINGID_USENEXTPKMN
+	setbyte gBattleCommunication, 0
+	yesnobox
+	jumpifbyte CMP_EQUAL, gBattleCommunication + 1, 0, BattleScript_FaintedMonTryChoose
+	jumpifplayerran BattleScript_FaintedMonEnd
+	printstring STRINGID_CANTESCAPE2
+BattleScript_FaintedMonTryChoose: ; .global BattleScript_FaintedMonTryChoose
+	openpartyscreen BS_FAINTED, BattleScript_FaintedMonEnd
+	switchhandleorder BS_FAINTED, 2
+	jumpifnotbattletype BATTLE_TYPE_TRAINER, BattleScript_FaintedMonSendOutNew
+	jumpifbattletype BATTLE_TYPE_LINK, BattleScript_FaintedMonSendOutNew
+	jumpifbattletype BATTLE_TYPE_BATTLE_TOWER, BattleScript_FaintedMonSendOutNew
+	jumpifbattletype BATTLE_TYPE_DOUBLE, BattleScript_FaintedMonSendOutNew
+	jumpifword CMP_COMMON_BITS, gHitMarker, HITMARKER_PLAYER_FAINTED, BattleScript_FaintedMonSendOutNew
+	jumpifbyte CMP_EQUAL, sBATTLE_STYLE, OPTIONS_BATTLE_STYLE_SET, BattleScript_FaintedMonSendOutNew
+	jumpifcantswitch BS_PLAYER1, BattleScript_FaintedMonSendOutNew
+                                                                      
+	printstring STRINGID_ENEMYABOUTTOSWITCHPKMN
+	setbyte gBattleCommunication, 0
+	yesnobox
+	jumpifbyte CMP_EQUAL, gBattleCommunication + 1, 1, BattleScript_FaintedMonSendOutNew
+                                                                                            
+	setatktoplayer0
+	openpartyscreen BS_ATTACKER | PARTY_SCREEN_OPTIONAL, BattleScript_FaintedMonSendOutNew
+	switchhandleorder BS_ATTACKER, 2
+	jumpifbyte CMP_EQUAL, gBattleCommunication, PARTY_SIZE, BattleScript_FaintedMonSendOutNew
+                                 
+	atknameinbuff1
+	resetintimidatetracebits BS_ATTACKER
+	hpthresholds2 BS_ATTACKER
+	printstring STRINGID_RETURNMON
+	switchoutabilities BS_ATTACKER
+	waitstate
+	returnatktoball
+	waitstate
+	drawpartystatussummary BS_ATTACKER
+	getswitchedmondata BS_ATTACKER
+	switchindataupdate BS_ATTACKER
+	hpthresholds BS_ATTACKER
+	printstring STRINGID_SWITCHINMON
+	hidepartystatussummary BS_ATTACKER
+	switchinanim BS_ATTACKER, 0
+	waitstate
+	switchineffects BS_ATTACKER
+	resetsentmonsvalue
+BattleScript_FaintedMonSendOutNew: ; .global BattleScript_FaintedMonSendOutNew
+	drawpartystatussummary BS_FAINTED
+	getswitchedmondata BS_FAINTED
+	switchindataupdate BS_FAINTED
+	hpthresholds BS_FAINTED
+	printstring STRINGID_SWITCHINMON
+	hidepartystatussummary BS_FAINTED
+	switchinanim BS_FAINTED, FALSE
+	waitstate
+	resetplayerfainted
+	switchineffects BS_FAINTED
+	jumpifbattletype BATTLE_TYPE_DOUBLE, BattleScript_FaintedMonEnd
+	cancelallactions
+BattleScript_FaintedMonEnd: ; .global BattleScript_FaintedMonEnd
+	end2
+
+BattleScript_LinkHandleFaintedMonMultiple: ; .global BattleScript_LinkHandleFaintedMonMultiple
+	openpartyscreen BS_FAINTED_LINK_MULTIPLE_1, BattleScript_LinkHandleFaintedMonMultipleStart
+BattleScript_LinkHandleFaintedMonMultipleStart: ; .global BattleScript_LinkHandleFaintedMonMultipleStart
+	switchhandleorder BS_FAINTED, 0
+	openpartyscreen BS_FAINTED_LINK_MULTIPLE_2, BattleScript_LinkHandleFaintedMonMultipleEnd
+	switchhandleorder BS_FAINTED, 0
+BattleScript_LinkHandleFaintedMonLoop: ; .global BattleScript_LinkHandleFaintedMonLoop
+	switchhandleorder BS_FAINTED, 2
+	drawpartystatussummary BS_FAINTED
+	getswitchedmondata BS_FAINTED
+	switchindataupdate BS_FAINTED
+	hpthresholds BS_FAINTED
+	printstring STRINGID_SWITCHINMON
+	hidepartystatussummary BS_FAINTED
+	switchinanim BS_FAINTED, FALSE
+	waitstate
+	switchineffects BS_FAINTED_LINK_MULTIPLE_1
+	jumpifbytenotequal gBattlerFainted, gBattlersCount, BattleScript_LinkHandleFaintedMonLoop
+BattleScript_LinkHandleFaintedMonMultipleEnd: ; .global BattleScript_LinkHandleFaintedMonMultipleEnd
+	end2
+
+BattleScript_LocalTrainerBattleWon: ; .global BattleScript_LocalTrainerBattleWon
+	printstring STRINGID_PLAYERDEFEATEDTRAINER1
+	trainerslidein BS_ATTACKER
+	waitstate
+	printstring STRINGID_TRAINER1LOSETEXT
+	getmoneyreward BattleScript_LocalTrainerBattleWonGotMoney
+BattleScript_LocalTrainerBattleWonGotMoney: ; .global BattleScript_LocalTrainerBattleWonGotMoney
+	printstring STRINGID_PLAYERGOTMONEY
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_PayDayMoneyAndPickUpItems: ; .global BattleScript_PayDayMoneyAndPickUpItems
+	givepaydaymoney
+	pickup
+	end2
+
+BattleScript_LocalBattleLost: ; .global BattleScript_LocalBattleLost
+	jumpifbattletype BATTLE_TYPE_TRAINER_TOWER, BattleScript_BattleTowerLost
+	jumpifbattletype BATTLE_TYPE_EREADER_TRAINER, BattleScript_EReaderOrSecretBaseTrainerEnd
+	jumpifhalfword CMP_EQUAL, gTrainerBattleOpponent_A, TRAINER_SECRET_BASE, BattleScript_EReaderOrSecretBaseTrainerEnd
+	jumpifbyte CMP_NOT_EQUAL, cMULTISTRING_CHOOSER, 0, BattleScript_RivalBattleLost
+BattleScript_LocalBattleLostPrintWhiteOut: ; .global BattleScript_LocalBattleLostPrintWhiteOut
+	jumpifbattletype BATTLE_TYPE_TRAINER, BattleScript_LocalBattleLostEnd
+	printstring STRINGID_PLAYERWHITEOUT
+	waitmessage B_WAIT_TIME_LONG
+	getmoneyreward BattleScript_LocalBattleLostPrintTrainersWinText
+	printstring STRINGID_PLAYERWHITEOUT2
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_EReaderOrSecretBaseTrainerEnd
+
+BattleScript_LocalBattleLostEnd: ; .global BattleScript_LocalBattleLostEnd
+	printstring STRINGID_PLAYERLOSTAGAINSTENEMYTRAINER
+	waitmessage B_WAIT_TIME_LONG
+	getmoneyreward BattleScript_LocalBattleLostPrintTrainersWinText
+	printstring STRINGID_PLAYERPAIDPRIZEMONEY
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_EReaderOrSecretBaseTrainerEnd: ; .global BattleScript_EReaderOrSecretBaseTrainerEnd
+	end2
+
+BattleScript_LocalBattleLostPrintTrainersWinText: ; .global BattleScript_LocalBattleLostPrintTrainersWinText
+	printstring STRINGID_PLAYERWHITEDOUT
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_RivalBattleLost: ; .global BattleScript_RivalBattleLost
+	jumpifhasnohp BS_ATTACKER, BattleScript_RivalBattleLostSkipMonRecall
+	printstring STRINGID_TRAINER1MON1COMEBACK
+	waitmessage B_WAIT_TIME_LONG
+	returnatktoball
+	waitstate
+BattleScript_RivalBattleLostSkipMonRecall: ; .global BattleScript_RivalBattleLostSkipMonRecall
+	trainerslidein BS_ATTACKER
+	waitstate
+	printstring STRINGID_TRAINER1WINTEXT
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, 2, BattleScript_LocalBattleLostPrintWhiteOut
+	end2
+
+BattleScript_BattleTowerLost: ; .global BattleScript_BattleTowerLost
+	getbattlersforrecall
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, 0, BattleScript_BattleTowerLostLostSkipMonRecall
+	printfromtable gDoubleBattleRecallStrings
+	waitmessage B_WAIT_TIME_LONG
+	returnopponentmon1toball
+	waitstate
+	returnopponentmon2toball
+	waitstate
+BattleScript_BattleTowerLostLostSkipMonRecall: ; .global BattleScript_BattleTowerLostLostSkipMonRecall
+	trainerslidein BS_ATTACKER
+	waitstate
+	printstring STRINGID_TRAINER1WINTEXT
+	jumpifnotbattletype BATTLE_TYPE_DOUBLE, BattleScript_BattleTowerLostLostSkipDouble
+	printstring STRINGID_TRAINER2WINTEXT
+BattleScript_BattleTowerLostLostSkipDouble: ; .global BattleScript_BattleTowerLostLostSkipDouble
+	end2
+
+BattleScript_LinkBattleWonOrLost: ; .global BattleScript_LinkBattleWonOrLost
+	printstring STRINGID_BATTLEEND
+	waitmessage B_WAIT_TIME_LONG
+	endlinkbattle
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_BattleTowerTrainerBattleWon: ; .global BattleScript_BattleTowerTrainerBattleWon
+	printstring STRINGID_PLAYERDEFEATEDTRAINER1
+	trainerslidein BS_ATTACKER
+	waitstate
+	jumpifnotbattletype BATTLE_TYPE_TRAINER_TOWER, BattleScript_BattleTowerEtcTrainerBattleWonSkipText
+	printstring STRINGID_TRAINER1LOSETEXT
+	jumpifnotbattletype BATTLE_TYPE_DOUBLE, BattleScript_BattleTowerEtcTrainerBattleWonSkipText
+	printstring STRINGID_TRAINER2LOSETEXT
+BattleScript_BattleTowerEtcTrainerBattleWonSkipText: ; .global BattleScript_BattleTowerEtcTrainerBattleWonSkipText
+	pickup
+	end2
+
+BattleScript_SmokeBallEscape: ; .global BattleScript_SmokeBallEscape
+	playanimation BS_ATTACKER, B_ANIM_SMOKEBALL_ESCAPE
+	printstring STRINGID_PKMNFLEDUSINGITS
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_RanAwayUsingMonAbility: ; .global BattleScript_RanAwayUsingMonAbility
+	printstring STRINGID_PKMNFLEDUSING
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_GotAwaySafely: ; .global BattleScript_GotAwaySafely
+	printstring STRINGID_GOTAWAYSAFELY
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_WildMonFled: ; .global BattleScript_WildMonFled
+	printstring STRINGID_WILDPKMNFLED
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_PrintCantRunFromTrainer: ; .global BattleScript_PrintCantRunFromTrainer
+	jumpifbattletype BATTLE_TYPE_FIRST_BATTLE, BattleScript_LeftoverBirchString
+	printstring STRINGID_NORUNNINGFROMTRAINERS
+	end2
+
+BattleScript_LeftoverBirchString: ; .global BattleScript_LeftoverBirchString
+	printstring STRINGID_DONTLEAVEBIRCH
+	end2
+
+BattleScript_PrintFailedToRunString: ; .global BattleScript_PrintFailedToRunString
+	printfromtable gNoEscapeStringIds
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_PrintCantEscapeFromBattle: ; .global BattleScript_PrintCantEscapeFromBattle
+	printselectionstringfromtable gNoEscapeStringIds
+	endselectionscript
+
+BattleScript_PrintFullBox: ; .global BattleScript_PrintFullBox
+	printselectionstring STRINGID_BOXISFULL
+	endselectionscript
+
+BattleScript_ActionSwitch: ; .global BattleScript_ActionSwitch
+	hpthresholds2 BS_ATTACKER
+	printstring STRINGID_RETURNMON
+	setbyte sDMG_MULTIPLIER, 2
+	jumpifbattletype BATTLE_TYPE_DOUBLE, BattleScript_PursuitSwitchDmgSetMultihit
+	setmultihit 1
+	goto BattleScript_PursuitSwitchDmgLoop
+BattleScript_PursuitSwitchDmgSetMultihit: ; .global BattleScript_PursuitSwitchDmgSetMultihit
+	setmultihit 2
+BattleScript_PursuitSwitchDmgLoop: ; .global BattleScript_PursuitSwitchDmgLoop
+	jumpifnopursuitswitchdmg BattleScript_DoSwitchOut
+	swapattackerwithtarget
+	trysetdestinybondtohappen
+	call BattleScript_PursuitDmgOnSwitchOut
+	swapattackerwithtarget
+BattleScript_DoSwitchOut: ; .global BattleScript_DoSwitchOut
+	decrementmultihit BattleScript_PursuitSwitchDmgLoop
+	switchoutabilities BS_ATTACKER
+	waitstate
+	returnatktoball
+	waitstate
+	drawpartystatussummary BS_ATTACKER
+	switchhandleorder BS_ATTACKER, 1
+	getswitchedmondata BS_ATTACKER
+	switchindataupdate BS_ATTACKER
+	hpthresholds BS_ATTACKER
+	printstring STRINGID_SWITCHINMON
+	hidepartystatussummary BS_ATTACKER
+	switchinanim BS_ATTACKER, FALSE
+	waitstate
+	switchineffects BS_ATTACKER
+	moveendcase MOVEEND_IMMUNITY_ABILITIES
+	moveendcase MOVEEND_MIRROR_MOVE
+	end2
+
+BattleScript_PursuitDmgOnSwitchOut: ; .global BattleScript_PursuitDmgOnSwitchOut
+	pause B_WAIT_TIME_SHORT
+	attackstring
+	ppreduce
+	critcalc
+	damagecalc
+	typecalc
+	adjustnormaldamage
+	attackanimation
+	waitanimation
+	effectivenesssound
+	hitanimation BS_TARGET
+	waitstate
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	critmessage
+	waitmessage B_WAIT_TIME_LONG
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	tryfaintmon BS_TARGET
+	moveendfromto MOVEEND_ON_DAMAGE_ABILITIES, MOVEEND_CHOICE_MOVE
+	getbattlerfainted BS_TARGET
+	jumpifbyte CMP_EQUAL, gBattleCommunication, FALSE, BattleScript_PursuitDmgOnSwitchOutRet
+	setbyte sGIVEEXP_STATE, 0
+	getexp BS_TARGET
+BattleScript_PursuitDmgOnSwitchOutRet:
+	return
+
+BattleScript_Pausex20: ; .global BattleScript_Pausex20
+	pause B_WAIT_TIME_SHORT
+	return
+
+BattleScript_LevelUp: ; .global BattleScript_LevelUp
+	fanfare MUS_LEVEL_UP
+	printstring STRINGID_PKMNGREWTOLV
+	setbyte sLVLBOX_STATE, 0
+	drawlvlupbox
+	handlelearnnewmove BattleScript_LearnedNewMove, BattleScript_LearnMoveReturn, TRUE
+	goto BattleScript_AskToLearnMove
+BattleScript_TryLearnMoveLoop: ; .global BattleScript_TryLearnMoveLoop
+	handlelearnnewmove BattleScript_LearnedNewMove, BattleScript_LearnMoveReturn, FALSE
+BattleScript_AskToLearnMove: ; .global BattleScript_AskToLearnMove
+	buffermovetolearn
+	printstring STRINGID_TRYTOLEARNMOVE1
+	printstring STRINGID_TRYTOLEARNMOVE2
+	printstring STRINGID_TRYTOLEARNMOVE3
+	waitstate
+	setbyte sLEARNMOVE_STATE, 0
+	yesnoboxlearnmove BattleScript_ForgotAndLearnedNewMove
+	printstring STRINGID_STOPLEARNINGMOVE
+	waitstate
+	setbyte sLEARNMOVE_STATE, 0
+	yesnoboxstoplearningmove BattleScript_AskToLearnMove
+	printstring STRINGID_DIDNOTLEARNMOVE
+	goto BattleScript_TryLearnMoveLoop
+BattleScript_ForgotAndLearnedNewMove: ; .global BattleScript_ForgotAndLearnedNewMove
+	printstring STRINGID_123POOF
+	printstring STRINGID_PKMNFORGOTMOVE
+	printstring STRINGID_ANDELLIPSIS
+BattleScript_LearnedNewMove: ; .global BattleScript_LearnedNewMove
+	buffermovetolearn
+	fanfare MUS_LEVEL_UP
+	printstring STRINGID_PKMNLEARNEDMOVE
+	waitmessage B_WAIT_TIME_LONG
+	updatechoicemoveonlvlup BS_ATTACKER
+	goto BattleScript_TryLearnMoveLoop
+BattleScript_LearnMoveReturn: ; .global BattleScript_LearnMoveReturn
+	return
+
+BattleScript_RainContinuesOrEnds: ; .global BattleScript_RainContinuesOrEnds
+	printfromtable gRainContinuesStringIds
+	waitmessage B_WAIT_TIME_LONG
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, B_MSG_RAIN_STOPPED, BattleScript_RainContinuesOrEndsEnd
+	playanimation BS_ATTACKER, B_ANIM_RAIN_CONTINUES
+BattleScript_RainContinuesOrEndsEnd: ; .global BattleScript_RainContinuesOrEndsEnd
+	end2
+
+BattleScript_DamagingWeatherContinues: ; .global BattleScript_DamagingWeatherContinues
+	printfromtable gSandstormHailContinuesStringIds
+	waitmessage B_WAIT_TIME_LONG
+	playanimation_var BS_ATTACKER, sB_ANIM_ARG1
+	setbyte gBattleCommunication, 0
+BattleScript_DamagingWeatherLoop: ; .global BattleScript_DamagingWeatherLoop
+	copyarraywithindex gBattlerAttacker, gBattlerByTurnOrder, gBattleCommunication, 1
+	weatherdamage
+	jumpifword CMP_EQUAL, gBattleMoveDamage, NULL, BattleScript_DamagingWeatherContinuesEnd
+	printfromtable gSandstormHailDmgStringIds
+	waitmessage B_WAIT_TIME_LONG
+	orword gHitMarker, HITMARKER_SKIP_DMG_TRACK | HITMARKER_IGNORE_SUBSTITUTE | HITMARKER_PASSIVE_DAMAGE | HITMARKER_GRUDGE
+	effectivenesssound
+	hitanimation BS_ATTACKER
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	tryfaintmon BS_ATTACKER
+	checkteamslost BattleScript_DamagingWeatherContinuesEnd
+BattleScript_DamagingWeatherContinuesEnd: ; .global BattleScript_DamagingWeatherContinuesEnd
+	jumpifbyte CMP_NOT_EQUAL, gBattleOutcome, 0, BattleScript_WeatherDamageEndedBattle
+	addbyte gBattleCommunication, 1
+	jumpifbytenotequal gBattleCommunication, gBattlersCount, BattleScript_DamagingWeatherLoop
+BattleScript_WeatherDamageEndedBattle: ; .global BattleScript_WeatherDamageEndedBattle
+	bicword gHitMarker, HITMARKER_SKIP_DMG_TRACK | HITMARKER_IGNORE_SUBSTITUTE | HITMARKER_PASSIVE_DAMAGE | HITMARKER_GRUDGE
+	end2
+
+BattleScript_SandStormHailEnds: ; .global BattleScript_SandStormHailEnds
+	printfromtable gSandstormHailEndStringIds
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_SunlightContinues: ; .global BattleScript_SunlightContinues
+	printstring STRINGID_SUNLIGHTSTRONG
+	waitmessage B_WAIT_TIME_LONG
+	playanimation BS_ATTACKER, B_ANIM_SUN_CONTINUES
+	end2
+
+BattleScript_SunlightFaded: ; .global BattleScript_SunlightFaded
+	printstring STRINGID_SUNLIGHTFADED
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_OverworldWeatherStarts: ; .global BattleScript_OverworldWeatherStarts
+	printfromtable gWeatherStartsStringIds
+	waitmessage B_WAIT_TIME_LONG
+	playanimation_var BS_ATTACKER, sB_ANIM_ARG1
+	end3
+
+BattleScript_SideStatusWoreOff: ; .global BattleScript_SideStatusWoreOff
+	printstring STRINGID_PKMNSXWOREOFF
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_SafeguardProtected: ; .global BattleScript_SafeguardProtected
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNUSEDSAFEGUARD
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_SafeguardEnds: ; .global BattleScript_SafeguardEnds
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNSAFEGUARDEXPIRED
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_LeechSeedTurnDrain: ; .global BattleScript_LeechSeedTurnDrain
+	playanimation BS_ATTACKER, B_ANIM_LEECH_SEED_DRAIN, sB_ANIM_ARG1
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE | HITMARKER_PASSIVE_DAMAGE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	copyword gBattleMoveDamage, gHpDealt
+	jumpifability BS_ATTACKER, ABILITY_LIQUID_OOZE, BattleScript_LeechSeedLiquidOoze
+	manipulatedamage 0
+	setbyte cMULTISTRING_CHOOSER, 3
+	goto BattleScript_LeechSeedTurnPrintAndUpdateHp
+
+BattleScript_LeechSeedLiquidOoze: ; .global BattleScript_LeechSeedLiquidOoze
+	setbyte cMULTISTRING_CHOOSER, 4
+BattleScript_LeechSeedTurnPrintAndUpdateHp: ; .global BattleScript_LeechSeedTurnPrintAndUpdateHp
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE | HITMARKER_PASSIVE_DAMAGE
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	printfromtable gLeechSeedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	tryfaintmon BS_ATTACKER
+	tryfaintmon BS_TARGET
+	end2
+
+BattleScript_BideStoringEnergy: ; .global BattleScript_BideStoringEnergy
+	printstring STRINGID_PKMNSTORINGENERGY
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_BideAttack: ; .global BattleScript_BideAttack
+	attackcanceler
+	setmoveeffect MOVE_EFFECT_CHARGING
+	clearstatusfromeffect BS_ATTACKER
+	printstring STRINGID_PKMNUNLEASHEDENERGY
+	waitmessage B_WAIT_TIME_LONG
+	accuracycheck BattleScript_MoveMissed, ACC_CURR_MOVE
+	typecalc
+	bicbyte gMoveResultFlags, MOVE_RESULT_SUPER_EFFECTIVE | MOVE_RESULT_NOT_VERY_EFFECTIVE
+	copyword gBattleMoveDamage, sBIDE_DMG
+	adjustsetdamage
+	setbyte sB_ANIM_TURN, 1
+	attackanimation
+	waitanimation
+	effectivenesssound
+	hitanimation BS_TARGET
+	waitstate
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	tryfaintmon BS_TARGET
+	goto BattleScript_MoveEnd
+
+BattleScript_BideNoEnergyToAttack: ; .global BattleScript_BideNoEnergyToAttack
+	attackcanceler
+	setmoveeffect MOVE_EFFECT_CHARGING
+	clearstatusfromeffect BS_ATTACKER
+	printstring STRINGID_PKMNUNLEASHEDENERGY
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_ButItFailed
+
+BattleScript_SuccessForceOut: ; .global BattleScript_SuccessForceOut
+	attackanimation
+	waitanimation
+	switchoutabilities BS_TARGET
+	returntoball BS_TARGET
+	waitstate
+	jumpifbattletype BATTLE_TYPE_TRAINER, BattleScript_TrainerBattleForceOut
+	setbyte gBattleOutcome, B_OUTCOME_PLAYER_TELEPORTED
+	finishaction
+
+BattleScript_TrainerBattleForceOut: ; .global BattleScript_TrainerBattleForceOut
+	getswitchedmondata BS_TARGET
+	switchindataupdate BS_TARGET
+	switchinanim BS_TARGET, FALSE
+	waitstate
+	printstring STRINGID_PKMNWASDRAGGEDOUT
+	switchineffects BS_TARGET
+	goto BattleScript_MoveEnd
+
+BattleScript_MistProtected: ; .global BattleScript_MistProtected
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNPROTECTEDBYMIST
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_RageIsBuilding: ; .global BattleScript_RageIsBuilding
+	printstring STRINGID_PKMNRAGEBUILDING
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_MoveUsedIsDisabled: ; .global BattleScript_MoveUsedIsDisabled
+	printstring STRINGID_PKMNMOVEISDISABLED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_SelectingDisabledMove: ; .global BattleScript_SelectingDisabledMove
+	printselectionstring STRINGID_PKMNMOVEISDISABLED
+	endselectionscript
+
+BattleScript_DisabledNoMore: ; .global BattleScript_DisabledNoMore
+	printstring STRINGID_PKMNMOVEDISABLEDNOMORE
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_EncoredNoMore: ; .global BattleScript_EncoredNoMore
+	printstring STRINGID_PKMNENCOREENDED
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_DestinyBondTakesLife: ; .global BattleScript_DestinyBondTakesLife
+	printstring STRINGID_PKMNTOOKFOE
+	waitmessage B_WAIT_TIME_LONG
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE | HITMARKER_PASSIVE_DAMAGE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	tryfaintmon BS_ATTACKER
+	return
+
+BattleScript_SpikesOnAttacker: ; .global BattleScript_SpikesOnAttacker
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE | HITMARKER_PASSIVE_DAMAGE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	call BattleScript_PrintHurtBySpikes
+	tryfaintmon BS_ATTACKER
+	tryfaintmon_spikes BS_ATTACKER, BattleScript_SpikesOnAttackerFainted
+	return
+
+BattleScript_SpikesOnAttackerFainted: ; .global BattleScript_SpikesOnAttackerFainted
+	setbyte sGIVEEXP_STATE, 0
+	getexp BS_ATTACKER
+	moveendall
+	goto BattleScript_HandleFaintedMon
+
+BattleScript_SpikesOnTarget: ; .global BattleScript_SpikesOnTarget
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE | HITMARKER_PASSIVE_DAMAGE
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	call BattleScript_PrintHurtBySpikes
+	tryfaintmon BS_TARGET
+	tryfaintmon_spikes BS_TARGET, BattleScript_SpikesOnTargetFainted
+	return
+
+BattleScript_SpikesOnTargetFainted: ; .global BattleScript_SpikesOnTargetFainted
+	setbyte sGIVEEXP_STATE, 0
+	getexp BS_TARGET
+	moveendall
+	goto BattleScript_HandleFaintedMon
+
+BattleScript_SpikesOnFaintedBattler: ; .global BattleScript_SpikesOnFaintedBattler
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE | HITMARKER_PASSIVE_DAMAGE
+	healthbarupdate BS_FAINTED
+	datahpupdate BS_FAINTED
+	call BattleScript_PrintHurtBySpikes
+	tryfaintmon BS_FAINTED
+	tryfaintmon_spikes BS_FAINTED, BattleScript_SpikesOnFaintedBattlerFainted
+	return
+
+BattleScript_SpikesOnFaintedBattlerFainted: ; .global BattleScript_SpikesOnFaintedBattlerFainted
+	setbyte sGIVEEXP_STATE, 0
+	getexp BS_FAINTED
+	moveendall
+	goto BattleScript_HandleFaintedMon
+
+BattleScript_PrintHurtBySpikes: ; .global BattleScript_PrintHurtBySpikes
+	printstring STRINGID_PKMNHURTBYSPIKES
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_PerishSongTakesLife: ; .global BattleScript_PerishSongTakesLife
+	printstring STRINGID_PKMNPERISHCOUNTFELL
+	waitmessage B_WAIT_TIME_LONG
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE | HITMARKER_PASSIVE_DAMAGE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	tryfaintmon BS_ATTACKER
+	end2
+
+BattleScript_PerishSongCountGoesDown: ; .global BattleScript_PerishSongCountGoesDown
+	printstring STRINGID_PKMNPERISHCOUNTFELL
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_AllStatsUp: ; .global BattleScript_AllStatsUp
+	jumpifstat BS_ATTACKER, CMP_LESS_THAN, STAT_ATK, MAX_STAT_STAGE, BattleScript_AllStatsUpAtk
+	jumpifstat BS_ATTACKER, CMP_LESS_THAN, STAT_DEF, MAX_STAT_STAGE, BattleScript_AllStatsUpAtk
+	jumpifstat BS_ATTACKER, CMP_LESS_THAN, STAT_SPEED, MAX_STAT_STAGE, BattleScript_AllStatsUpAtk
+	jumpifstat BS_ATTACKER, CMP_LESS_THAN, STAT_SPATK, MAX_STAT_STAGE, BattleScript_AllStatsUpAtk
+	jumpifstat BS_ATTACKER, CMP_EQUAL, STAT_SPDEF, MAX_STAT_STAGE, BattleScript_AllStatsUpRet
+BattleScript_AllStatsUpAtk: ; .global BattleScript_AllStatsUpAtk
+	setbyte sSTAT_ANIM_PLAYED, FALSE
+	playstatchangeanimation BS_ATTACKER, BIT_ATK | BIT_DEF | BIT_SPEED | BIT_SPATK | BIT_SPDEF, 0
+	setstatchanger STAT_ATK, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_AllStatsUpDef
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_AllStatsUpDef: ; .global BattleScript_AllStatsUpDef
+	setstatchanger STAT_DEF, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_AllStatsUpSpeed
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_AllStatsUpSpeed: ; .global BattleScript_AllStatsUpSpeed
+	setstatchanger STAT_SPEED, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_AllStatsUpSpAtk
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_AllStatsUpSpAtk: ; .global BattleScript_AllStatsUpSpAtk
+	setstatchanger STAT_SPATK, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_AllStatsUpSpDef
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_AllStatsUpSpDef: ; .global BattleScript_AllStatsUpSpDef
+	setstatchanger STAT_SPDEF, 1, FALSE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_AllStatsUpRet
+	printfromtable gStatUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_AllStatsUpRet: ; .global BattleScript_AllStatsUpRet
+	return
+
+BattleScript_RapidSpinAway: ; .global BattleScript_RapidSpinAway
+	rapidspinfree
+	return
+
+BattleScript_WrapFree: ; .global BattleScript_WrapFree
+	printstring STRINGID_PKMNGOTFREE
+	waitmessage B_WAIT_TIME_LONG
+	copybyte gBattlerTarget, sBATTLER
+	return
+
+BattleScript_LeechSeedFree: ; .global BattleScript_LeechSeedFree
+	printstring STRINGID_PKMNSHEDLEECHSEED
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_SpikesFree: ; .global BattleScript_SpikesFree
+	printstring STRINGID_PKMNBLEWAWAYSPIKES
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_MonTookFutureAttack: ; .global BattleScript_MonTookFutureAttack
+	printstring STRINGID_PKMNTOOKATTACK
+	waitmessage B_WAIT_TIME_LONG
+	jumpifbyte CMP_NOT_EQUAL, cMULTISTRING_CHOOSER, B_MSG_FUTURE_SIGHT, BattleScript_CheckDoomDesireMiss
+	accuracycheck BattleScript_FutureAttackMiss, MOVE_FUTURE_SIGHT
+	goto BattleScript_FutureAttackAnimate
+BattleScript_CheckDoomDesireMiss: ; .global BattleScript_CheckDoomDesireMiss
+	accuracycheck BattleScript_FutureAttackMiss, MOVE_DOOM_DESIRE
+BattleScript_FutureAttackAnimate: ; .global BattleScript_FutureAttackAnimate
+	adjustnormaldamage2
+	jumpifbyte CMP_NOT_EQUAL, cMULTISTRING_CHOOSER, B_MSG_FUTURE_SIGHT, BattleScript_FutureHitAnimDoomDesire
+	playanimation BS_ATTACKER, B_ANIM_FUTURE_SIGHT_HIT
+	goto BattleScript_DoFutureAttackHit
+BattleScript_FutureHitAnimDoomDesire: ; .global BattleScript_FutureHitAnimDoomDesire
+	playanimation BS_ATTACKER, B_ANIM_DOOM_DESIRE_HIT
+BattleScript_DoFutureAttackHit: ; .global BattleScript_DoFutureAttackHit
+	effectivenesssound
+	hitanimation BS_TARGET
+	waitstate
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	tryfaintmon BS_TARGET
+	checkteamslost BattleScript_FutureAttackEnd
+BattleScript_FutureAttackEnd: ; .global BattleScript_FutureAttackEnd
+	moveendcase MOVEEND_RAGE
+	moveendfromto MOVEEND_ITEM_EFFECTS_ALL, MOVEEND_UPDATE_LAST_MOVES
+	setbyte gMoveResultFlags, 0
+	end2
+
+BattleScript_FutureAttackMiss: ; .global BattleScript_FutureAttackMiss
+	pause B_WAIT_TIME_SHORT
+	setbyte gMoveResultFlags, 0
+	orbyte gMoveResultFlags, MOVE_RESULT_FAILED
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	setbyte gMoveResultFlags, 0
+	end2
+
+BattleScript_NoMovesLeft: ; .global BattleScript_NoMovesLeft
+	printselectionstring STRINGID_PKMNHASNOMOVESLEFT
+	endselectionscript
+
+BattleScript_SelectingMoveWithNoPP: ; .global BattleScript_SelectingMoveWithNoPP
+	printselectionstring STRINGID_NOPPLEFT
+	endselectionscript
+
+BattleScript_NoPPForMove: ; .global BattleScript_NoPPForMove
+	attackstring
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_BUTNOPPLEFT
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_SelectingTormentedMove: ; .global BattleScript_SelectingTormentedMove
+	printselectionstring STRINGID_PKMNCANTUSEMOVETORMENT
+	endselectionscript
+
+	printstring STRINGID_PKMNCANTUSEMOVETORMENT
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_SelectingNotAllowedMoveTaunt: ; .global BattleScript_SelectingNotAllowedMoveTaunt
+	printselectionstring STRINGID_PKMNCANTUSEMOVETAUNT
+	endselectionscript
+
+BattleScript_MoveUsedIsTaunted: ; .global BattleScript_MoveUsedIsTaunted
+	printstring STRINGID_PKMNCANTUSEMOVETAUNT
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_WishComesTrue: ; .global BattleScript_WishComesTrue
+	trywish 1, BattleScript_WishButFullHp
+	playanimation BS_TARGET, B_ANIM_WISH_HEAL
+	printstring STRINGID_PKMNWISHCAMETRUE
+	waitmessage B_WAIT_TIME_LONG
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	printstring STRINGID_PKMNREGAINEDHEALTH
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_WishButFullHp: ; .global BattleScript_WishButFullHp
+	printstring STRINGID_PKMNWISHCAMETRUE
+	waitmessage B_WAIT_TIME_LONG
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNHPFULL
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_IngrainTurnHeal: ; .global BattleScript_IngrainTurnHeal
+	playanimation BS_ATTACKER, B_ANIM_INGRAIN_HEAL
+	printstring STRINGID_PKMNABSORBEDNUTRIENTS
+	waitmessage B_WAIT_TIME_LONG
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	end2
+
+BattleScript_PrintMonIsRooted: ; .global BattleScript_PrintMonIsRooted
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNANCHOREDITSELF
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_AtkDefDown: ; .global BattleScript_AtkDefDown
+	setbyte sSTAT_ANIM_PLAYED, FALSE
+	playstatchangeanimation BS_ATTACKER, BIT_DEF | BIT_ATK, STAT_CHANGE_CANT_PREVENT | STAT_CHANGE_NEGATIVE | STAT_CHANGE_MULTIPLE_STATS
+	playstatchangeanimation BS_ATTACKER, BIT_ATK, STAT_CHANGE_CANT_PREVENT | STAT_CHANGE_NEGATIVE
+	setstatchanger STAT_ATK, 1, TRUE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | MOVE_EFFECT_CERTAIN | STAT_CHANGE_ALLOW_PTR, BattleScript_AtkDefDownAtkFail
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, 2, BattleScript_AtkDefDownAtkFail
+	printfromtable gStatDownStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_AtkDefDownAtkFail: ; .global BattleScript_AtkDefDownAtkFail
+	playstatchangeanimation BS_ATTACKER, BIT_DEF, STAT_CHANGE_NEGATIVE | STAT_CHANGE_CANT_PREVENT
+	setstatchanger STAT_DEF, 1, TRUE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR | MOVE_EFFECT_CERTAIN, BattleScript_AtkDefDownDefFail
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, 2, BattleScript_AtkDefDownDefFail
+	printfromtable gStatDownStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_AtkDefDownDefFail: ; .global BattleScript_AtkDefDownDefFail
+	return
+
+BattleScript_KnockedOff: ; .global BattleScript_KnockedOff
+	playanimation BS_TARGET, B_ANIM_ITEM_KNOCKOFF
+	printstring STRINGID_PKMNKNOCKEDOFF
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_MoveUsedIsImprisoned: ; .global BattleScript_MoveUsedIsImprisoned
+	printstring STRINGID_PKMNCANTUSEMOVESEALED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_SelectingImprisonedMove: ; .global BattleScript_SelectingImprisonedMove
+	printselectionstring STRINGID_PKMNCANTUSEMOVESEALED
+	endselectionscript
+
+BattleScript_GrudgeTakesPp: ; .global BattleScript_GrudgeTakesPp
+	printstring STRINGID_PKMNLOSTPPGRUDGE
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_MagicCoatBounce: ; .global BattleScript_MagicCoatBounce
+	attackstring
+	ppreduce
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNMOVEBOUNCED
+	waitmessage B_WAIT_TIME_LONG
+	orword gHitMarker, HITMARKER_ATTACKSTRING_PRINTED | HITMARKER_NO_PPDEDUCT | HITMARKER_ALLOW_NO_PP
+	setmagiccoattarget BS_ATTACKER
+	return
+
+BattleScript_SnatchedMove: ; .global BattleScript_SnatchedMove
+	attackstring
+	ppreduce
+	snatchsetbattlers
+	playanimation BS_TARGET, B_ANIM_SNATCH_MOVE
+	printstring STRINGID_PKMNSNATCHEDMOVE
+	waitmessage B_WAIT_TIME_LONG
+	orword gHitMarker, HITMARKER_ATTACKSTRING_PRINTED | HITMARKER_NO_PPDEDUCT | HITMARKER_ALLOW_NO_PP
+	swapattackerwithtarget
+	return
+
+BattleScript_EnduredMsg: ; .global BattleScript_EnduredMsg
+	printstring STRINGID_PKMNENDUREDHIT
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_OneHitKOMsg: ; .global BattleScript_OneHitKOMsg
+	printstring STRINGID_ONEHITKO
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_SAtkDown2: ; .global BattleScript_SAtkDown2
+	setbyte sSTAT_ANIM_PLAYED, 0
+	playstatchangeanimation BS_ATTACKER, BIT_SPATK, STAT_CHANGE_NEGATIVE | STAT_CHANGE_BY_TWO | STAT_CHANGE_CANT_PREVENT
+	setstatchanger STAT_SPATK, 2, TRUE
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR | MOVE_EFFECT_CERTAIN, BattleScript_SAtkDown2End
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, 2, BattleScript_SAtkDown2End
+	printfromtable gStatDownStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_SAtkDown2End: ; .global BattleScript_SAtkDown2End
+	return
+
+BattleScript_FocusPunchSetUp: ; .global BattleScript_FocusPunchSetUp
+	printstring STRINGID_EMPTYSTRING3
+	waitmessage 1
+	playanimation BS_ATTACKER, B_ANIM_FOCUS_PUNCH_SETUP
+	printstring STRINGID_PKMNTIGHTENINGFOCUS
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_MoveUsedIsAsleep: ; .global BattleScript_MoveUsedIsAsleep
+	printstring STRINGID_PKMNFASTASLEEP
+	waitmessage B_WAIT_TIME_LONG
+	statusanimation BS_ATTACKER
+	goto BattleScript_MoveEnd
+
+BattleScript_MoveUsedWokeUp: ; .global BattleScript_MoveUsedWokeUp
+	bicword gHitMarker, HITMARKER_WAKE_UP_CLEAR
+	printfromtable gWokeUpStringIds
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_ATTACKER
+	return
+
+BattleScript_MonWokeUpInUproar: ; .global BattleScript_MonWokeUpInUproar
+	printstring STRINGID_PKMNWOKEUPINUPROAR
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_ATTACKER
+	end2
+
+BattleScript_PoisonTurnDmg: ; .global BattleScript_PoisonTurnDmg
+	printstring STRINGID_PKMNHURTBYPOISON
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_DoStatusTurnDmg: ; .global BattleScript_DoStatusTurnDmg
+	statusanimation BS_ATTACKER
+BattleScript_DoTurnDmg: ; .global BattleScript_DoTurnDmg
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE | HITMARKER_PASSIVE_DAMAGE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	tryfaintmon BS_ATTACKER
+	checkteamslost BattleScript_DoTurnDmgEnd
+BattleScript_DoTurnDmgEnd: ; .global BattleScript_DoTurnDmgEnd
+	end2
+
+BattleScript_BurnTurnDmg: ; .global BattleScript_BurnTurnDmg
+	printstring STRINGID_PKMNHURTBYBURN
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_DoStatusTurnDmg
+
+BattleScript_MoveUsedIsFrozen: ; .global BattleScript_MoveUsedIsFrozen
+	printstring STRINGID_PKMNISFROZEN
+	waitmessage B_WAIT_TIME_LONG
+	statusanimation BS_ATTACKER
+	goto BattleScript_MoveEnd
+
+BattleScript_MoveUsedUnfroze: ; .global BattleScript_MoveUsedUnfroze
+	printfromtable gGotDefrostedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_ATTACKER
+	return
+
+BattleScript_DefrostedViaFireMove: ; .global BattleScript_DefrostedViaFireMove
+	printstring STRINGID_PKMNWASDEFROSTED
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_TARGET
+	return
+
+BattleScript_MoveUsedIsParalyzed: ; .global BattleScript_MoveUsedIsParalyzed
+	printstring STRINGID_PKMNISPARALYZED
+	waitmessage B_WAIT_TIME_LONG
+	statusanimation BS_ATTACKER
+	cancelmultiturnmoves BS_ATTACKER
+	goto BattleScript_MoveEnd
+
+BattleScript_MoveUsedFlinched: ; .global BattleScript_MoveUsedFlinched
+	printstring STRINGID_PKMNFLINCHED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_PrintUproarOverTurns: ; .global BattleScript_PrintUproarOverTurns
+	printfromtable gUproarOverTurnStringIds
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_ThrashConfuses: ; .global BattleScript_ThrashConfuses
+	chosenstatus2animation BS_ATTACKER, STATUS2_CONFUSION
+	printstring STRINGID_PKMNFATIGUECONFUSION
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_MoveUsedIsConfused: ; .global BattleScript_MoveUsedIsConfused
+	printstring STRINGID_PKMNISCONFUSED
+	waitmessage B_WAIT_TIME_LONG
+	status2animation BS_ATTACKER, STATUS2_CONFUSION
+	jumpifbyte CMP_EQUAL, cMULTISTRING_CHOOSER, FALSE, BattleScript_MoveUsedIsConfusedRet
+BattleScript_DoSelfConfusionDmg: ; .global BattleScript_DoSelfConfusionDmg
+	cancelmultiturnmoves BS_ATTACKER
+	adjustnormaldamage2
+	printstring STRINGID_ITHURTCONFUSION
+	waitmessage B_WAIT_TIME_LONG
+	effectivenesssound
+	hitanimation BS_ATTACKER
+	waitstate
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE | HITMARKER_PASSIVE_DAMAGE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	resultmessage
+	waitmessage B_WAIT_TIME_LONG
+	tryfaintmon BS_ATTACKER
+	goto BattleScript_MoveEnd
+BattleScript_MoveUsedIsConfusedRet: ; .global BattleScript_MoveUsedIsConfusedRet
+	return
+
+BattleScript_MoveUsedIsConfusedNoMore: ; .global BattleScript_MoveUsedIsConfusedNoMore
+	printstring STRINGID_PKMNHEALEDCONFUSION
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_PrintPayDayMoneyString: ; .global BattleScript_PrintPayDayMoneyString
+	printstring STRINGID_PLAYERPICKEDUPMONEY
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_WrapTurnDmg: ; .global BattleScript_WrapTurnDmg
+	playanimation BS_ATTACKER, B_ANIM_TURN_TRAP, sB_ANIM_ARG1
+	printstring STRINGID_PKMNHURTBY
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_DoTurnDmg
+
+BattleScript_WrapEnds: ; .global BattleScript_WrapEnds
+	printstring STRINGID_PKMNFREEDFROM
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_MoveUsedIsInLove: ; .global BattleScript_MoveUsedIsInLove
+	printstring STRINGID_PKMNINLOVE
+	waitmessage B_WAIT_TIME_LONG
+	status2animation BS_ATTACKER, STATUS2_INFATUATION
+	return
+
+BattleScript_MoveUsedIsInLoveCantAttack: ; .global BattleScript_MoveUsedIsInLoveCantAttack
+	printstring STRINGID_PKMNIMMOBILIZEDBYLOVE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_NightmareTurnDmg: ; .global BattleScript_NightmareTurnDmg
+	printstring STRINGID_PKMNLOCKEDINNIGHTMARE
+	waitmessage B_WAIT_TIME_LONG
+	status2animation BS_ATTACKER, STATUS2_NIGHTMARE
+	goto BattleScript_DoTurnDmg
+
+BattleScript_CurseTurnDmg: ; .global BattleScript_CurseTurnDmg
+	printstring STRINGID_PKMNAFFLICTEDBYCURSE
+	waitmessage B_WAIT_TIME_LONG
+	status2animation BS_ATTACKER, STATUS2_CURSED
+	goto BattleScript_DoTurnDmg
+
+BattleScript_TargetPRLZHeal: ; .global BattleScript_TargetPRLZHeal
+	printstring STRINGID_PKMNHEALEDPARALYSIS
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_TARGET
+	return
+
+BattleScript_TooScaredToMove: ; .global BattleScript_TooScaredToMove
+	printstring STRINGID_MONTOOSCAREDTOMOVE
+	waitmessage B_WAIT_TIME_LONG
+	playanimation BS_ATTACKER, B_ANIM_MON_SCARED
+	goto BattleScript_MoveEnd
+
+BattleScript_GhostGetOutGetOut: ; .global BattleScript_GhostGetOutGetOut
+	printstring STRINGID_GHOSTGETOUTGETOUT
+	playanimation BS_ATTACKER, B_ANIM_GHOST_GET_OUT
+	goto BattleScript_MoveEnd
+
+BattleScript_SilphScopeUnveiled: ; .global BattleScript_SilphScopeUnveiled
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_SILPHSCOPEUNVEILED
+	waitstate
+	playanimation BS_OPPONENT1, B_ANIM_SILPH_SCOPED
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_GHOSTWASMAROWAK
+	waitmessage B_WAIT_TIME_LONG
+	end2
+
+BattleScript_MoveEffectSleep: ; .global BattleScript_MoveEffectSleep
+	statusanimation BS_EFFECT_BATTLER
+	printfromtable gFellAsleepStringIds
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_UpdateEffectStatusIconRet: ; .global BattleScript_UpdateEffectStatusIconRet
+	updatestatusicon BS_EFFECT_BATTLER
+	waitstate
+	return
+
+BattleScript_YawnMakesAsleep: ; .global BattleScript_YawnMakesAsleep
+	statusanimation BS_EFFECT_BATTLER
+	printstring STRINGID_PKMNFELLASLEEP
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_EFFECT_BATTLER
+	waitstate
+	makevisible BS_EFFECT_BATTLER
+	end2
+
+BattleScript_MoveEffectPoison: ; .global BattleScript_MoveEffectPoison
+	statusanimation BS_EFFECT_BATTLER
+	printfromtable gGotPoisonedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_UpdateEffectStatusIconRet
+
+BattleScript_MoveEffectBurn: ; .global BattleScript_MoveEffectBurn
+	statusanimation BS_EFFECT_BATTLER
+	printfromtable gGotBurnedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_UpdateEffectStatusIconRet
+
+BattleScript_MoveEffectFreeze: ; .global BattleScript_MoveEffectFreeze
+	statusanimation BS_EFFECT_BATTLER
+	printfromtable gGotFrozenStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_UpdateEffectStatusIconRet
+
+BattleScript_MoveEffectParalysis: ; .global BattleScript_MoveEffectParalysis
+	statusanimation BS_EFFECT_BATTLER
+	printfromtable gGotParalyzedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_UpdateEffectStatusIconRet
+
+BattleScript_MoveEffectUproar: ; .global BattleScript_MoveEffectUproar
+	printstring STRINGID_PKMNCAUSEDUPROAR
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_MoveEffectToxic: ; .global BattleScript_MoveEffectToxic
+	statusanimation BS_EFFECT_BATTLER
+	printstring STRINGID_PKMNBADLYPOISONED
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_UpdateEffectStatusIconRet
+
+BattleScript_MoveEffectPayDay: ; .global BattleScript_MoveEffectPayDay
+	printstring STRINGID_COINSSCATTERED
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_MoveEffectWrap: ; .global BattleScript_MoveEffectWrap
+	printfromtable gWrappedStringIds
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_MoveEffectConfusion: ; .global BattleScript_MoveEffectConfusion
+	chosenstatus2animation BS_EFFECT_BATTLER, STATUS2_CONFUSION
+	printstring STRINGID_PKMNWASCONFUSED
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_MoveEffectRecoil: ; .global BattleScript_MoveEffectRecoil
+	jumpifmove MOVE_STRUGGLE, BattleScript_DoRecoil
+	jumpifability BS_ATTACKER, ABILITY_ROCK_HEAD, BattleScript_RecoilEnd
+BattleScript_DoRecoil: ; .global BattleScript_DoRecoil
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE | HITMARKER_PASSIVE_DAMAGE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	printstring STRINGID_PKMNHITWITHRECOIL
+	waitmessage B_WAIT_TIME_LONG
+	tryfaintmon BS_ATTACKER
+BattleScript_RecoilEnd: ; .global BattleScript_RecoilEnd
+	return
+
+BattleScript_ItemSteal: ; .global BattleScript_ItemSteal
+	playanimation BS_TARGET, B_ANIM_ITEM_STEAL
+	printstring STRINGID_PKMNSTOLEITEM
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_DrizzleActivates: ; .global BattleScript_DrizzleActivates
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNMADEITRAIN
+	waitstate
+	playanimation BS_BATTLER_0, B_ANIM_RAIN_CONTINUES
+	call BattleScript_WeatherFormChanges
+	end3
+
+BattleScript_SpeedBoostActivates: ; .global BattleScript_SpeedBoostActivates
+	playanimation BS_ATTACKER, B_ANIM_STATS_CHANGE, sB_ANIM_ARG1
+	printstring STRINGID_PKMNRAISEDSPEED
+	waitmessage B_WAIT_TIME_LONG
+	end3
+
+BattleScript_TraceActivates: ; .global BattleScript_TraceActivates
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNTRACED
+	waitmessage B_WAIT_TIME_LONG
+	end3
+
+BattleScript_RainDishActivates: ; .global BattleScript_RainDishActivates
+	printstring STRINGID_PKMNSXRESTOREDHPALITTLE2
+	waitmessage B_WAIT_TIME_LONG
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	end3
+
+BattleScript_SandstreamActivates: ; .global BattleScript_SandstreamActivates
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNSXWHIPPEDUPSANDSTORM
+	waitstate
+	playanimation BS_BATTLER_0, B_ANIM_SANDSTORM_CONTINUES
+	call BattleScript_WeatherFormChanges
+	end3
+
+BattleScript_ShedSkinActivates: ; .global BattleScript_ShedSkinActivates
+	printstring STRINGID_PKMNSXCUREDYPROBLEM
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_ATTACKER
+	end3
+
+BattleScript_WeatherFormChanges: ; .global BattleScript_WeatherFormChanges
+	setbyte sBATTLER, 0
+BattleScript_WeatherFormChangesLoop: ; .global BattleScript_WeatherFormChangesLoop
+	trycastformdatachange
+	addbyte sBATTLER, 1
+	jumpifbytenotequal sBATTLER, gBattlersCount, BattleScript_WeatherFormChangesLoop
+	return
+
+BattleScript_CastformChange: ; .global BattleScript_CastformChange
+	call BattleScript_DoCastformChangeAnim
+	end3
+
+BattleScript_DoCastformChangeAnim: ; .global BattleScript_DoCastformChangeAnim
+	docastformchangeanimation
+	waitstate
+	printstring STRINGID_PKMNTRANSFORMED
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_IntimidateActivatesEnd3: ; .global BattleScript_IntimidateActivatesEnd3
+	call BattleScript_DoIntimidateActivationAnim
+	end3
+
+BattleScript_DoIntimidateActivationAnim: ; .global BattleScript_DoIntimidateActivationAnim
+	pause B_WAIT_TIME_SHORT
+BattleScript_IntimidateActivates: ; .global BattleScript_IntimidateActivates
+	setbyte gBattlerTarget, 0
+	setstatchanger STAT_ATK, 1, TRUE
+BattleScript_IntimidateActivationAnimLoop: ; .global BattleScript_IntimidateActivationAnimLoop
+	trygetintimidatetarget BattleScript_IntimidateEnd
+	jumpifstatus2 BS_TARGET, STATUS2_SUBSTITUTE, BattleScript_IntimidateFail
+	jumpifability BS_TARGET, ABILITY_CLEAR_BODY, BattleScript_IntimidateAbilityFail
+	jumpifability BS_TARGET, ABILITY_HYPER_CUTTER, BattleScript_IntimidateAbilityFail
+	jumpifability BS_TARGET, ABILITY_WHITE_SMOKE, BattleScript_IntimidateAbilityFail
+	statbuffchange STAT_CHANGE_ALLOW_PTR | STAT_CHANGE_NOT_PROTECT_AFFECTED, BattleScript_IntimidateFail
+	jumpifbyte CMP_GREATER_THAN, cMULTISTRING_CHOOSER, 1, BattleScript_IntimidateFail
+	setgraphicalstatchangevalues
+	playanimation BS_TARGET, B_ANIM_STATS_CHANGE, sB_ANIM_ARG1
+	printstring STRINGID_PKMNCUTSATTACKWITH
+	waitmessage B_WAIT_TIME_LONG
+BattleScript_IntimidateFail: ; .global BattleScript_IntimidateFail
+	addbyte gBattlerTarget, 1
+	goto BattleScript_IntimidateActivationAnimLoop
+
+BattleScript_IntimidateEnd: ; .global BattleScript_IntimidateEnd
+	return
+
+BattleScript_IntimidateAbilityFail: ; .global BattleScript_IntimidateAbilityFail
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PREVENTEDFROMWORKING
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_IntimidateFail
+
+BattleScript_DroughtActivates: ; .global BattleScript_DroughtActivates
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNSXINTENSIFIEDSUN
+	waitstate
+	playanimation BS_BATTLER_0, B_ANIM_SUN_CONTINUES
+	call BattleScript_WeatherFormChanges
+	end3
+
+BattleScript_TookAttack: ; .global BattleScript_TookAttack
+	attackstring
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNSXTOOKATTACK
+	waitmessage B_WAIT_TIME_LONG
+	orword gHitMarker, HITMARKER_ATTACKSTRING_PRINTED
+	return
+
+BattleScript_SturdyPreventsOHKO: ; .global BattleScript_SturdyPreventsOHKO
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNPROTECTEDBY
+	pause B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_DampStopsExplosion: ; .global BattleScript_DampStopsExplosion
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNPREVENTSUSAGE
+	pause B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_MoveHPDrain_PPLoss: ; .global BattleScript_MoveHPDrain_PPLoss
+	ppreduce
+BattleScript_MoveHPDrain: ; .global BattleScript_MoveHPDrain
+	attackstring
+	pause B_WAIT_TIME_SHORT
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	healthbarupdate BS_TARGET
+	datahpupdate BS_TARGET
+	printstring STRINGID_PKMNRESTOREDHPUSING
+	waitmessage B_WAIT_TIME_LONG
+	orbyte gMoveResultFlags, MOVE_RESULT_DOESNT_AFFECT_FOE
+	goto BattleScript_MoveEnd
+
+BattleScript_MonMadeMoveUseless_PPLoss: ; .global BattleScript_MonMadeMoveUseless_PPLoss
+	ppreduce
+BattleScript_MonMadeMoveUseless: ; .global BattleScript_MonMadeMoveUseless
+	attackstring
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNSXMADEYUSELESS
+	waitmessage B_WAIT_TIME_LONG
+	orbyte gMoveResultFlags, MOVE_RESULT_DOESNT_AFFECT_FOE
+	goto BattleScript_MoveEnd
+
+BattleScript_FlashFireBoost_PPLoss: ; .global BattleScript_FlashFireBoost_PPLoss
+	ppreduce
+BattleScript_FlashFireBoost: ; .global BattleScript_FlashFireBoost
+	attackstring
+	pause B_WAIT_TIME_SHORT
+	printfromtable gFlashFireStringIds
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_AbilityPreventsPhasingOut: ; .global BattleScript_AbilityPreventsPhasingOut
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNANCHORSITSELFWITH
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_AbilityNoStatLoss: ; .global BattleScript_AbilityNoStatLoss
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNPREVENTSSTATLOSSWITH
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_BRNPrevention: ; .global BattleScript_BRNPrevention
+	pause B_WAIT_TIME_SHORT
+	printfromtable gBRNPreventionStringIds
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_PRLZPrevention: ; .global BattleScript_PRLZPrevention
+	pause B_WAIT_TIME_SHORT
+	printfromtable gPRLZPreventionStringIds
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_PSNPrevention: ; .global BattleScript_PSNPrevention
+	pause B_WAIT_TIME_SHORT
+	printfromtable gPSNPreventionStringIds
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_ObliviousPreventsAttraction: ; .global BattleScript_ObliviousPreventsAttraction
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNPREVENTSROMANCEWITH
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_FlinchPrevention: ; .global BattleScript_FlinchPrevention
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNSXPREVENTSFLINCHING
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_OwnTempoPrevents: ; .global BattleScript_OwnTempoPrevents
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNPREVENTSCONFUSIONWITH
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_SoundproofProtected: ; .global BattleScript_SoundproofProtected
+	attackstring
+	ppreduce
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNSXBLOCKSY
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_AbilityNoSpecificStatLoss: ; .global BattleScript_AbilityNoSpecificStatLoss
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNSXPREVENTSYLOSS
+	waitmessage B_WAIT_TIME_LONG
+	setbyte cMULTISTRING_CHOOSER, 3
+	return
+
+BattleScript_StickyHoldActivates: ; .global BattleScript_StickyHoldActivates
+	pause B_WAIT_TIME_SHORT
+	printstring STRINGID_PKMNSXMADEYINEFFECTIVE
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_MoveEnd
+
+BattleScript_ColorChangeActivates: ; .global BattleScript_ColorChangeActivates
+	printstring STRINGID_PKMNCHANGEDTYPEWITH
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_RoughSkinActivates: ; .global BattleScript_RoughSkinActivates
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE | HITMARKER_PASSIVE_DAMAGE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	printstring STRINGID_PKMNHURTSWITH
+	waitmessage B_WAIT_TIME_LONG
+	tryfaintmon BS_ATTACKER
+	return
+
+BattleScript_CuteCharmActivates: ; .global BattleScript_CuteCharmActivates
+	status2animation BS_ATTACKER, STATUS2_INFATUATION
+	printstring STRINGID_PKMNSXINFATUATEDY
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_ApplySecondaryEffect: ; .global BattleScript_ApplySecondaryEffect
+	waitstate
+	seteffectsecondary
+	return
+
+BattleScript_SynchronizeActivates: ; .global BattleScript_SynchronizeActivates
+	waitstate
+	seteffectprimary
+	return
+
+BattleScript_AbilityCuredStatus: ; .global BattleScript_AbilityCuredStatus
+	printstring STRINGID_PKMNSXCUREDITSYPROBLEM
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_SCRIPTING
+	return
+
+BattleScript_IgnoresWhileAsleep: ; .global BattleScript_IgnoresWhileAsleep
+	printstring STRINGID_PKMNIGNORESASLEEP
+	waitmessage B_WAIT_TIME_LONG
+	moveendto MOVEEND_NEXT_TARGET
+	end
+
+BattleScript_IgnoresAndUsesRandomMove: ; .global BattleScript_IgnoresAndUsesRandomMove
+	printstring STRINGID_PKMNIGNOREDORDERS
+	waitmessage B_WAIT_TIME_LONG
+	jumptocalledmove 0
+BattleScript_MoveUsedLoafingAround: ; .global BattleScript_MoveUsedLoafingAround
+	printfromtable gInobedientStringIds
+	waitmessage B_WAIT_TIME_LONG
+	moveendto MOVEEND_NEXT_TARGET
+	end
+
+BattleScript_IgnoresAndFallsAsleep: ; .global BattleScript_IgnoresAndFallsAsleep
+	printstring STRINGID_PKMNBEGANTONAP
+	waitmessage B_WAIT_TIME_LONG
+	setmoveeffect MOVE_EFFECT_SLEEP | MOVE_EFFECT_AFFECTS_USER
+	seteffectprimary
+	moveendto MOVEEND_NEXT_TARGET
+	end
+
+BattleScript_IgnoresAndHitsItself: ; .global BattleScript_IgnoresAndHitsItself
+	printstring STRINGID_PKMNWONTOBEY
+	waitmessage B_WAIT_TIME_LONG
+	goto BattleScript_DoSelfConfusionDmg
+
+BattleScript_SubstituteFade: ; .global BattleScript_SubstituteFade
+	playanimation BS_TARGET, B_ANIM_SUBSTITUTE_FADE
+	printstring STRINGID_PKMNSUBSTITUTEFADED
+	return
+
+BattleScript_BerryCurePrlzEnd2: ; .global BattleScript_BerryCurePrlzEnd2
+	call BattleScript_BerryCureParRet
+	end2
+
+BattleScript_BerryCureParRet: ; .global BattleScript_BerryCureParRet
+	playanimation BS_SCRIPTING, B_ANIM_HELD_ITEM_EFFECT
+	printstring STRINGID_PKMNSITEMCUREDPARALYSIS
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_SCRIPTING
+	removeitem BS_SCRIPTING
+	return
+
+BattleScript_BerryCurePsnEnd2: ; .global BattleScript_BerryCurePsnEnd2
+	call BattleScript_BerryCurePsnRet
+	end2
+
+BattleScript_BerryCurePsnRet: ; .global BattleScript_BerryCurePsnRet
+	playanimation BS_SCRIPTING, B_ANIM_HELD_ITEM_EFFECT
+	printstring STRINGID_PKMNSITEMCUREDPOISON
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_SCRIPTING
+	removeitem BS_SCRIPTING
+	return
+
+BattleScript_BerryCureBrnEnd2: ; .global BattleScript_BerryCureBrnEnd2
+	call BattleScript_BerryCureBrnRet
+	end2
+
+BattleScript_BerryCureBrnRet: ; .global BattleScript_BerryCureBrnRet
+	playanimation BS_SCRIPTING, B_ANIM_HELD_ITEM_EFFECT
+	printstring STRINGID_PKMNSITEMHEALEDBURN
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_SCRIPTING
+	removeitem BS_SCRIPTING
+	return
+
+BattleScript_BerryCureFrzEnd2: ; .global BattleScript_BerryCureFrzEnd2
+	call BattleScript_BerryCureFrzRet
+	end2
+
+BattleScript_BerryCureFrzRet: ; .global BattleScript_BerryCureFrzRet
+	playanimation BS_SCRIPTING, B_ANIM_HELD_ITEM_EFFECT
+	printstring STRINGID_PKMNSITEMDEFROSTEDIT
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_SCRIPTING
+	removeitem BS_SCRIPTING
+	return
+
+BattleScript_BerryCureSlpEnd2: ; .global BattleScript_BerryCureSlpEnd2
+	call BattleScript_BerryCureSlpRet
+	end2
+
+BattleScript_BerryCureSlpRet: ; .global BattleScript_BerryCureSlpRet
+	playanimation BS_SCRIPTING, B_ANIM_HELD_ITEM_EFFECT
+	printstring STRINGID_PKMNSITEMWOKEIT
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_SCRIPTING
+	removeitem BS_SCRIPTING
+	return
+
+BattleScript_BerryCureConfusionEnd2: ; .global BattleScript_BerryCureConfusionEnd2
+	call BattleScript_BerryCureConfusionRet
+	end2
+
+BattleScript_BerryCureConfusionRet: ; .global BattleScript_BerryCureConfusionRet
+	playanimation BS_SCRIPTING, B_ANIM_HELD_ITEM_EFFECT
+	printstring STRINGID_PKMNSITEMSNAPPEDOUT
+	waitmessage B_WAIT_TIME_LONG
+	removeitem BS_SCRIPTING
+	return
+
+BattleScript_BerryCureChosenStatusEnd2: ; .global BattleScript_BerryCureChosenStatusEnd2
+	call BattleScript_BerryCureChosenStatusRet
+	end2
+
+BattleScript_BerryCureChosenStatusRet: ; .global BattleScript_BerryCureChosenStatusRet
+	playanimation BS_SCRIPTING, B_ANIM_HELD_ITEM_EFFECT
+	printfromtable gBerryEffectStringIds
+	waitmessage B_WAIT_TIME_LONG
+	updatestatusicon BS_SCRIPTING
+	removeitem BS_SCRIPTING
+	return
+
+BattleScript_WhiteHerbEnd2: ; .global BattleScript_WhiteHerbEnd2
+	call BattleScript_WhiteHerbRet
+	end2
+
+BattleScript_WhiteHerbRet: ; .global BattleScript_WhiteHerbRet
+	playanimation BS_SCRIPTING, B_ANIM_HELD_ITEM_EFFECT
+	printstring STRINGID_PKMNSITEMRESTOREDSTATUS
+	waitmessage B_WAIT_TIME_LONG
+	removeitem BS_SCRIPTING
+	return
+
+BattleScript_ItemHealHP_RemoveItem: ; .global BattleScript_ItemHealHP_RemoveItem
+	playanimation BS_ATTACKER, B_ANIM_HELD_ITEM_EFFECT
+	printstring STRINGID_PKMNSITEMRESTOREDHEALTH
+	waitmessage B_WAIT_TIME_LONG
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	removeitem BS_ATTACKER
+	end2
+
+BattleScript_BerryPPHealEnd2: ; .global BattleScript_BerryPPHealEnd2
+	playanimation BS_ATTACKER, B_ANIM_HELD_ITEM_EFFECT
+	printstring STRINGID_PKMNSITEMRESTOREDPP
+	waitmessage B_WAIT_TIME_LONG
+	removeitem BS_ATTACKER
+	end2
+
+BattleScript_ItemHealHP_End2: ; .global BattleScript_ItemHealHP_End2
+	call BattleScript_ItemHealHP_Ret
+	end2
+
+BattleScript_ItemHealHP_Ret: ; .global BattleScript_ItemHealHP_Ret
+	playanimation BS_ATTACKER, B_ANIM_HELD_ITEM_EFFECT
+	printstring STRINGID_PKMNSITEMRESTOREDHPALITTLE
+	waitmessage B_WAIT_TIME_LONG
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	return
+
+BattleScript_SelectingNotAllowedMoveChoiceItem: ; .global BattleScript_SelectingNotAllowedMoveChoiceItem
+	printselectionstring STRINGID_ITEMALLOWSONLYYMOVE
+	endselectionscript
+
+BattleScript_FocusBandActivates: ; .global BattleScript_FocusBandActivates
+	playanimation BS_TARGET, B_ANIM_FOCUS_BAND
+	printstring STRINGID_PKMNHUNGONWITHX
+	waitmessage B_WAIT_TIME_LONG
+	return
+
+BattleScript_BerryConfuseHealEnd2: ; .global BattleScript_BerryConfuseHealEnd2
+	playanimation BS_ATTACKER, B_ANIM_HELD_ITEM_EFFECT
+	printstring STRINGID_PKMNSITEMRESTOREDHEALTH
+	waitmessage B_WAIT_TIME_LONG
+	orword gHitMarker, HITMARKER_IGNORE_SUBSTITUTE
+	healthbarupdate BS_ATTACKER
+	datahpupdate BS_ATTACKER
+	printstring STRINGID_FORXCOMMAYZ
+	waitmessage B_WAIT_TIME_LONG
+	setmoveeffect MOVE_EFFECT_CONFUSION | MOVE_EFFECT_AFFECTS_USER
+	seteffectprimary
+	removeitem BS_ATTACKER
+	end2
+
+BattleScript_BerryStatRaiseEnd2: ; .global BattleScript_BerryStatRaiseEnd2
+	playanimation BS_ATTACKER, B_ANIM_HELD_ITEM_EFFECT
+	statbuffchange MOVE_EFFECT_AFFECTS_USER | STAT_CHANGE_ALLOW_PTR, BattleScript_BerryStatRaiseDoStatUp
+BattleScript_BerryStatRaiseDoStatUp: ; .global BattleScript_BerryStatRaiseDoStatUp
+	setbyte cMULTISTRING_CHOOSER, B_MSG_STAT_ROSE_ITEM
+	call BattleScript_StatUp
+	removeitem BS_ATTACKER
+	end2
+
+BattleScript_BerryFocusEnergyEnd2: ; .global BattleScript_BerryFocusEnergyEnd2
+	playanimation BS_ATTACKER, B_ANIM_HELD_ITEM_EFFECT
+	printstring STRINGID_PKMNUSEDXTOGETPUMPED
+	waitmessage B_WAIT_TIME_LONG
+	removeitem BS_ATTACKER
+	end2
+
+BattleScript_ActionSelectionItemsCantBeUsed: ; .global BattleScript_ActionSelectionItemsCantBeUsed
+	printselectionstring STRINGID_ITEMSCANTBEUSEDNOW
+	endselectionscript
+
+BattleScript_FlushMessageBox: ; .global BattleScript_FlushMessageBox
+	printstring STRINGID_EMPTYSTRING3
+	return
@@ -0,0 +1,390 @@
+# 1 "data/field_effect_scripts.s"
+# 1 "asm/macros/field_effect_script.inc"
+	.macro loadtiles address
+	.byte 0
+	.4byte \address
+	.endm
+
+	.macro loadfadedpal address
+	.byte 1
+	.4byte \address
+	.endm
+
+	.macro loadpal address
+	.byte 2
+	.4byte \address
+	.endm
+
+	.macro callnative address
+	.byte 3
+	.4byte \address
+	.endm
+
+	.macro end
+	.byte 4
+	.endm
+
+	.macro loadgfx_callnative tiles_address, palette_address, function_address
+	.byte 5
+	.4byte \tiles_address
+	.4byte \palette_address
+	.4byte \function_address
+	.endm
+
+	.macro loadtiles_callnative tiles_address, function_address
+	.byte 6
+	.4byte \tiles_address
+	.4byte \function_address
+	.endm
+
+	.macro loadfadedpal_callnative palette_address, function_address
+	.byte 7
+	.4byte \palette_address
+	.4byte \function_address
+	.endm
+# 2 "data/field_effect_scripts.s"
+	.section script_data, "aw", %progbits
+	.align 2
+gFieldEffectScriptPointers: ; .global gFieldEffectScriptPointers
+	.4byte gFldEffScript_ExclamationMarkIcon                                   
+	.4byte gFldEffScript_UseCutOnGrass                                    
+	.4byte gFldEffScript_UseCutOnTree                                    
+	.4byte gFldEffScript_Shadow                                 
+	.4byte gFldEffScript_TallGrass                                  
+	.4byte gFldEffScript_Ripple                                 
+	.4byte gFldEffScript_FieldMoveShowMon                                    
+	.4byte gFldEffScript_Ash                                 
+	.4byte gFldEffScript_SurfBlob                                  
+	.4byte gFldEffScript_UseSurf                                  
+	.4byte gFldEffScript_Dust                                 
+	.4byte gFldEffScript_UseSecretPowerCave                                    
+	.4byte gFldEffScript_JumpTallGrass                                   
+	.4byte gFldEffScript_SandFootprints                                  
+	.4byte gFldEffScript_JumpBigSplash                                   
+	.4byte gFldEffScript_Splash                                 
+	.4byte gFldEffScript_JumpSmallSplash                                   
+	.4byte gFldEffScript_LongGrass                                  
+	.4byte gFldEffScript_JumpLongGrass                                   
+	.4byte gFldEffScript_UnusedGrass                                  
+	.4byte gFldEffScript_UnusedGrass2                                   
+	.4byte gFldEffScript_UnusedSand                                  
+	.4byte gFldEffScript_UnusedWaterSurfacing                                   
+	.4byte gFldEffScript_BerryTreeGrowthSparkle                                    
+	.4byte gFldEffScript_DeepSandFootprints                                   
+	.4byte gFldEffScript_PokecenterHeal                                  
+	.4byte gFldEffScript_UseSecretPowerTree                                    
+	.4byte gFldEffScript_UseSecretPowerShrub                                    
+	.4byte gFldEffScript_TreeDisguise                                  
+	.4byte gFldEffScript_MountainDisguise                                  
+	.4byte gFldEffScript_NpcflyOut                                  
+	.4byte gFldEffScript_FlyOut                                  
+	.4byte gFldEffScript_FlyIn                                  
+	.4byte gFldEffScript_QuestionMarkIcon                                   
+	.4byte gFldEffScript_FeetInFlowingWater                                    
+	.4byte gFldEffScript_BikeTireTracks                                   
+	.4byte gFldEffScript_SandDisguise                                  
+	.4byte gFldEffScript_UseRockSmash                                   
+	.4byte gFldEffScript_UseDig                                  
+	.4byte gFldEffScript_SandPile                                  
+	.4byte gFldEffScript_UseStrength                                  
+	.4byte gFldEffScript_ShortGrass                                  
+	.4byte gFldEffScript_HotSpringsWater                                   
+	.4byte gFldEffScript_UseWaterfall                                  
+	.4byte gFldEffScript_UseDive                                  
+	.4byte gFldEffScript_Pokeball                                 
+	.4byte gFldEffScript_XIcon                                  
+	.4byte gFldEffScript_Nop47                                  
+	.4byte gFldEffScript_Nop48                                  
+	.4byte gFldEffScript_PopOutOfAsh                                    
+	.4byte gFldEffScript_LavaridgeGymWarp                                   
+	.4byte gFldEffScript_SweetScent                                  
+	.4byte gFldEffScript_SandPillar                                  
+	.4byte gFldEffScript_Bubbles                                 
+	.4byte gFldEffScript_Sparkle                                 
+	.4byte gFldEffScript_SecretPowerCave                                   
+	.4byte gFldEffScript_SecretPowerTree                                   
+	.4byte gFldEffScript_SecretPowerShrub                                   
+	.4byte gFldEffScript_CutGrass                                  
+	.4byte gFldEffScript_FieldMoveShowMonInit                                     
+	.4byte gFldEffScript_UseFlyAncientTomb                                    
+	.4byte gFldEffScript_PcturnOn                                  
+	.4byte gFldEffScript_HallOfFameRecord                                    
+	.4byte gFldEffScript_UseTeleport                                  
+	.4byte gFldEffScript_SmileyFaceIcon                                   
+	.4byte gFldEffScript_UseVsSeeker                                   
+	.4byte gFldEffScript_DoubleExclMarkIcon                                    
+	.4byte gFldEffScript_MoveDeoxysRock                                   
+	.4byte gFldEffScript_DestroyDeoxysRock                                   
+	.4byte gFldEffScript_PhotoFlash                                  
+
+gFldEffScript_ExclamationMarkIcon: ; .global gFldEffScript_ExclamationMarkIcon
+	callnative FldEff_ExclamationMarkIcon1
+	end 
+
+gFldEffScript_UseCutOnGrass: ; .global gFldEffScript_UseCutOnGrass
+	callnative FldEff_UseCutOnGrass
+	end 
+
+gFldEffScript_UseCutOnTree: ; .global gFldEffScript_UseCutOnTree
+	callnative FldEff_UseCutOnTree
+	end 
+
+gFldEffScript_Shadow: ; .global gFldEffScript_Shadow
+	callnative FldEff_Shadow
+	end 
+
+gFldEffScript_TallGrass: ; .global gFldEffScript_TallGrass
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect1, FldEff_TallGrass
+	end 
+
+gFldEffScript_Ripple: ; .global gFldEffScript_Ripple
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect1, FldEff_Ripple
+	end 
+
+gFldEffScript_FieldMoveShowMon: ; .global gFldEffScript_FieldMoveShowMon
+	callnative FldEff_FieldMoveShowMon
+	end 
+
+gFldEffScript_Ash: ; .global gFldEffScript_Ash
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect1, FldEff_Ash
+	end 
+
+gFldEffScript_SurfBlob: ; .global gFldEffScript_SurfBlob
+	callnative FldEff_SurfBlob
+	end 
+
+gFldEffScript_UseSurf: ; .global gFldEffScript_UseSurf
+	callnative FldEff_UseSurf
+	end 
+
+gFldEffScript_Dust: ; .global gFldEffScript_Dust
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect0, FldEff_Dust
+	end 
+
+gFldEffScript_UseSecretPowerCave: ; .global gFldEffScript_UseSecretPowerCave
+	end 
+
+gFldEffScript_JumpTallGrass: ; .global gFldEffScript_JumpTallGrass
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect1, FldEff_JumpTallGrass
+	end 
+
+gFldEffScript_SandFootprints: ; .global gFldEffScript_SandFootprints
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect0, FldEff_SandFootprints
+	end 
+
+gFldEffScript_JumpBigSplash: ; .global gFldEffScript_JumpBigSplash
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect0, FldEff_JumpBigSplash
+	end 
+
+gFldEffScript_Splash: ; .global gFldEffScript_Splash
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect0, FldEff_Splash
+	end 
+
+gFldEffScript_JumpSmallSplash: ; .global gFldEffScript_JumpSmallSplash
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect0, FldEff_JumpSmallSplash
+	end 
+
+gFldEffScript_LongGrass: ; .global gFldEffScript_LongGrass
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect1, FldEff_LongGrass
+	end 
+
+gFldEffScript_JumpLongGrass: ; .global gFldEffScript_JumpLongGrass
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect1, FldEff_JumpLongGrass
+	end 
+
+gFldEffScript_UnusedGrass: ; .global gFldEffScript_UnusedGrass
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect1, FldEff_UnusedGrass
+	end 
+
+gFldEffScript_UnusedGrass2: ; .global gFldEffScript_UnusedGrass2
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect1, FldEff_UnusedGrass2
+	end 
+
+gFldEffScript_UnusedSand: ; .global gFldEffScript_UnusedSand
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect0, FldEff_UnusedSand
+	end 
+
+gFldEffScript_UnusedWaterSurfacing: ; .global gFldEffScript_UnusedWaterSurfacing
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect0, FldEff_UnusedWaterSurfacing
+	end 
+
+gFldEffScript_BerryTreeGrowthSparkle: ; .global gFldEffScript_BerryTreeGrowthSparkle
+	callnative FldEff_BerryTreeGrowthSparkle
+	end 
+
+gFldEffScript_DeepSandFootprints: ; .global gFldEffScript_DeepSandFootprints
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect0, FldEff_DeepSandFootprints
+	end 
+
+gFldEffScript_PokecenterHeal: ; .global gFldEffScript_PokecenterHeal
+	loadfadedpal gSpritePalette_PokeballGlow 
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect0, FldEff_PokecenterHeal
+	end 
+
+gFldEffScript_UseSecretPowerTree: ; .global gFldEffScript_UseSecretPowerTree
+	end 
+
+gFldEffScript_UseSecretPowerShrub: ; .global gFldEffScript_UseSecretPowerShrub
+	end 
+
+gFldEffScript_TreeDisguise: ; .global gFldEffScript_TreeDisguise
+	callnative ShowTreeDisguiseFieldEffect
+	end 
+
+gFldEffScript_MountainDisguise: ; .global gFldEffScript_MountainDisguise
+	callnative ShowMountainDisguiseFieldEffect
+	end 
+
+gFldEffScript_NpcflyOut: ; .global gFldEffScript_NpcflyOut
+	callnative FldEff_NpcFlyOut
+	end 
+
+gFldEffScript_FlyOut: ; .global gFldEffScript_FlyOut
+	callnative FldEff_FlyOut 
+	end 
+
+gFldEffScript_FlyIn: ; .global gFldEffScript_FlyIn
+	callnative FldEff_FlyIn
+	end 
+
+gFldEffScript_QuestionMarkIcon: ; .global gFldEffScript_QuestionMarkIcon
+	callnative FldEff_QuestionMarkIcon
+	end 
+
+gFldEffScript_FeetInFlowingWater: ; .global gFldEffScript_FeetInFlowingWater
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect0, FldEff_FeetInFlowingWater
+	end 
+
+gFldEffScript_BikeTireTracks: ; .global gFldEffScript_BikeTireTracks
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect0, FldEff_BikeTireTracks
+	end 
+
+gFldEffScript_SandDisguise: ; .global gFldEffScript_SandDisguise
+	callnative ShowSandDisguiseFieldEffect
+	end 
+
+gFldEffScript_UseRockSmash: ; .global gFldEffScript_UseRockSmash
+	callnative FldEff_UseRockSmash
+	end 
+
+gFldEffScript_UseStrength: ; .global gFldEffScript_UseStrength
+	callnative FldEff_UseStrength
+	end 
+
+gFldEffScript_UseDig: ; .global gFldEffScript_UseDig
+	callnative FldEff_UseDig
+	end 
+
+gFldEffScript_SandPile: ; .global gFldEffScript_SandPile
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect0, FldEff_SandPile
+	end 
+
+gFldEffScript_ShortGrass: ; .global gFldEffScript_ShortGrass
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect1, FldEff_ShortGrass
+	end 
+
+gFldEffScript_HotSpringsWater: ; .global gFldEffScript_HotSpringsWater
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect1, FldEff_HotSpringsWater
+	end 
+
+gFldEffScript_UseWaterfall: ; .global gFldEffScript_UseWaterfall
+	callnative FldEff_UseWaterfall
+	end 
+
+gFldEffScript_UseDive: ; .global gFldEffScript_UseDive
+	callnative FldEff_UseDive
+	end 
+
+gFldEffScript_Pokeball: ; .global gFldEffScript_Pokeball
+	loadpal gSpritePalette_Pokeball
+	callnative FldEff_PokeballTrail
+	end 
+
+gFldEffScript_XIcon: ; .global gFldEffScript_XIcon
+	callnative FldEff_XIcon
+	end 
+
+gFldEffScript_Nop47: ; .global gFldEffScript_Nop47
+	end 
+
+gFldEffScript_Nop48: ; .global gFldEffScript_Nop48
+	end 
+
+gFldEffScript_PopOutOfAsh: ; .global gFldEffScript_PopOutOfAsh
+	loadfadedpal_callnative gSpritePalette_Ash, FldEff_PopOutOfAsh
+	end 
+
+gFldEffScript_LavaridgeGymWarp: ; .global gFldEffScript_LavaridgeGymWarp
+	loadfadedpal_callnative gSpritePalette_Ash, FldEff_LavaridgeGymWarp
+	end 
+
+gFldEffScript_SweetScent: ; .global gFldEffScript_SweetScent
+	callnative FldEff_SweetScent
+	end 
+
+gFldEffScript_SandPillar: ; .global gFldEffScript_SandPillar
+	end 
+
+gFldEffScript_Bubbles: ; .global gFldEffScript_Bubbles
+	loadfadedpal_callnative gSpritePalette_GeneralFieldEffect0, FldEff_Bubbles
+	end 
+
+gFldEffScript_Sparkle: ; .global gFldEffScript_Sparkle
+	loadfadedpal_callnative gSpritePalette_SmallSparkle, FldEff_Sparkle
+	end 
+
+gFldEffScript_SecretPowerCave: ; .global gFldEffScript_SecretPowerCave
+	end 
+
+gFldEffScript_SecretPowerTree: ; .global gFldEffScript_SecretPowerTree
+	end 
+
+gFldEffScript_SecretPowerShrub: ; .global gFldEffScript_SecretPowerShrub
+	end 
+
+gFldEffScript_CutGrass: ; .global gFldEffScript_CutGrass
+	loadfadedpal_callnative gFldEffPalette_CutGrass, FldEff_CutGrass
+	end 
+
+gFldEffScript_FieldMoveShowMonInit: ; .global gFldEffScript_FieldMoveShowMonInit
+	callnative FldEff_FieldMoveShowMonInit
+	end 
+
+gFldEffScript_UseFlyAncientTomb: ; .global gFldEffScript_UseFlyAncientTomb
+	end 
+
+gFldEffScript_PcturnOn: ; .global gFldEffScript_PcturnOn
+	end 
+
+gFldEffScript_HallOfFameRecord: ; .global gFldEffScript_HallOfFameRecord
+	loadfadedpal gSpritePalette_PokeballGlow 
+	loadfadedpal_callnative gSpritePalette_HofMonitor, FldEff_HallOfFameRecord
+	end 
+
+gFldEffScript_UseTeleport: ; .global gFldEffScript_UseTeleport
+	callnative FldEff_UseTeleport
+	end 
+
+gFldEffScript_SmileyFaceIcon: ; .global gFldEffScript_SmileyFaceIcon
+	callnative FldEff_SmileyFaceIcon
+	end 
+
+gFldEffScript_UseVsSeeker: ; .global gFldEffScript_UseVsSeeker
+	callnative FldEff_UseVsSeeker
+	end 
+
+gFldEffScript_DoubleExclMarkIcon: ; .global gFldEffScript_DoubleExclMarkIcon
+	callnative FldEff_DoubleExclMarkIcon
+	end 
+
+gFldEffScript_MoveDeoxysRock: ; .global gFldEffScript_MoveDeoxysRock
+	callnative FldEff_MoveDeoxysRock
+	end 
+
+gFldEffScript_DestroyDeoxysRock: ; .global gFldEffScript_DestroyDeoxysRock
+	callnative FldEff_DestroyDeoxysRock
+	end 
+
+gFldEffScript_PhotoFlash: ; .global gFldEffScript_PhotoFlash
+	callnative FldEff_PhotoFlash
+	end 
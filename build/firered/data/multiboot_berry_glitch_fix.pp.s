@@ -0,0 +1,6 @@
+# 1 "data/multiboot_berry_glitch_fix.s"
+	.section .rodata
+
+gMultiBootProgram_BerryGlitchFix_Start: ; .global gMultiBootProgram_BerryGlitchFix_Start
+	.incbin "data/mb_berry_fix.gba"
+gMultiBootProgram_BerryGlitchFix_End: ; .global gMultiBootProgram_BerryGlitchFix_End
@@ -0,0 +1,6 @@
+# 1 "data/multiboot_ereader.s"
+	.section .rodata
+
+gMultiBootProgram_EReader_Start: ; .global gMultiBootProgram_EReader_Start
+	.incbin "data/mb_ereader.gba"
+gMultiBootProgram_EReader_End: ; .global gMultiBootProgram_EReader_End
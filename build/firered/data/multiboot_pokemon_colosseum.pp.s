@@ -0,0 +1,6 @@
+# 1 "data/multiboot_pokemon_colosseum.s"
+	.section .rodata
+
+gMultiBootProgram_PokemonColosseum_Start: ; .global gMultiBootProgram_PokemonColosseum_Start
+	.incbin "data/mb_colosseum.gba"
+gMultiBootProgram_PokemonColosseum_End: ; .global gMultiBootProgram_PokemonColosseum_End
@@ -0,0 +1,3475 @@
+# 1 "data/mystery_event_msg.s"
+                                                         
+
+#include "constants/global.h"
+#include "constants/flags.h"
+#include "constants/moves.h"
+#include "constants/songs.h"
+#include "constants/species.h"
+#include "constants/vars.h"
+#include "constants/items.h"
+#include "constants/region_map_sections.h"
+# 1 "asm/macros.inc"
+# 1 "asm/macros/asm.inc"
+	.ifndef GUARD_ASM_MACROS_ASM_INC
+	.set GUARD_ASM_MACROS_ASM_INC, 1
+
+	.macro inc x
+	.set \x, \x + 1
+	.endm
+
+	.macro enum_start x=0
+	.set __enum__, \x
+	.endm
+
+	.macro enum constant
+	.equiv \constant, __enum__
+	inc __enum__
+	.endm
+
+	.endif                           
+# 2 "asm/macros.inc"
+# 1 "asm/macros/function.inc"
+	.macro arm_func_start name
+	.align 2, 0
+	.global \name
+	.arm
+	.type \name, function
+	.endm
+
+	.macro arm_func_end name
+	.size \name, .-\name
+	.endm
+
+	.macro thumb_func_start name
+	.align 2, 0
+	.global \name
+	.thumb
+	.thumb_func
+	.type \name, function
+	.endm
+
+	.macro non_word_aligned_thumb_func_start name
+	.global \name
+	.thumb
+	.thumb_func
+	.type \name, function
+	.endm
+
+	.macro thumb_func_end name
+	.size \name, .-\name
+	.endm
+# 3 "asm/macros.inc"
+# 1 "asm/macros/movement.inc"
+	.macro create_movement_action name:req, value:req
+	.macro \name
+	.byte \value
+	.endm
+	.endm
+
+	create_movement_action face_down, MOVEMENT_ACTION_FACE_DOWN
+	create_movement_action face_up, MOVEMENT_ACTION_FACE_UP
+	create_movement_action face_left, MOVEMENT_ACTION_FACE_LEFT
+	create_movement_action face_right, MOVEMENT_ACTION_FACE_RIGHT
+	create_movement_action face_down_fast, MOVEMENT_ACTION_FACE_DOWN_FAST
+	create_movement_action face_up_fast, MOVEMENT_ACTION_FACE_UP_FAST
+	create_movement_action face_left_fast, MOVEMENT_ACTION_FACE_LEFT_FAST
+	create_movement_action face_right_fast, MOVEMENT_ACTION_FACE_RIGHT_FAST
+	create_movement_action walk_slower_down, MOVEMENT_ACTION_WALK_SLOWER_DOWN
+	create_movement_action walk_slower_up, MOVEMENT_ACTION_WALK_SLOWER_UP
+	create_movement_action walk_slower_left, MOVEMENT_ACTION_WALK_SLOWER_LEFT
+	create_movement_action walk_slower_right, MOVEMENT_ACTION_WALK_SLOWER_RIGHT
+	create_movement_action walk_slow_down, MOVEMENT_ACTION_WALK_SLOW_DOWN
+	create_movement_action walk_slow_up, MOVEMENT_ACTION_WALK_SLOW_UP
+	create_movement_action walk_slow_left, MOVEMENT_ACTION_WALK_SLOW_LEFT
+	create_movement_action walk_slow_right, MOVEMENT_ACTION_WALK_SLOW_RIGHT
+	create_movement_action walk_down, MOVEMENT_ACTION_WALK_NORMAL_DOWN
+	create_movement_action walk_up, MOVEMENT_ACTION_WALK_NORMAL_UP
+	create_movement_action walk_left, MOVEMENT_ACTION_WALK_NORMAL_LEFT
+	create_movement_action walk_right, MOVEMENT_ACTION_WALK_NORMAL_RIGHT
+	create_movement_action jump_2_down, MOVEMENT_ACTION_JUMP_2_DOWN
+	create_movement_action jump_2_up, MOVEMENT_ACTION_JUMP_2_UP
+	create_movement_action jump_2_left, MOVEMENT_ACTION_JUMP_2_LEFT
+	create_movement_action jump_2_right, MOVEMENT_ACTION_JUMP_2_RIGHT
+	create_movement_action delay_1, MOVEMENT_ACTION_DELAY_1
+	create_movement_action delay_2, MOVEMENT_ACTION_DELAY_2
+	create_movement_action delay_4, MOVEMENT_ACTION_DELAY_4
+	create_movement_action delay_8, MOVEMENT_ACTION_DELAY_8
+	create_movement_action delay_16, MOVEMENT_ACTION_DELAY_16
+	create_movement_action walk_fast_down, MOVEMENT_ACTION_WALK_FAST_DOWN
+	create_movement_action walk_fast_up, MOVEMENT_ACTION_WALK_FAST_UP
+	create_movement_action walk_fast_left, MOVEMENT_ACTION_WALK_FAST_LEFT
+	create_movement_action walk_fast_right, MOVEMENT_ACTION_WALK_FAST_RIGHT
+	create_movement_action walk_in_place_slow_down, MOVEMENT_ACTION_WALK_IN_PLACE_SLOW_DOWN
+	create_movement_action walk_in_place_slow_up, MOVEMENT_ACTION_WALK_IN_PLACE_SLOW_UP
+	create_movement_action walk_in_place_slow_left, MOVEMENT_ACTION_WALK_IN_PLACE_SLOW_LEFT
+	create_movement_action walk_in_place_slow_right, MOVEMENT_ACTION_WALK_IN_PLACE_SLOW_RIGHT
+	create_movement_action walk_in_place_down, MOVEMENT_ACTION_WALK_IN_PLACE_NORMAL_DOWN
+	create_movement_action walk_in_place_up, MOVEMENT_ACTION_WALK_IN_PLACE_NORMAL_UP
+	create_movement_action walk_in_place_left, MOVEMENT_ACTION_WALK_IN_PLACE_NORMAL_LEFT
+	create_movement_action walk_in_place_right, MOVEMENT_ACTION_WALK_IN_PLACE_NORMAL_RIGHT
+	create_movement_action walk_in_place_fast_down, MOVEMENT_ACTION_WALK_IN_PLACE_FAST_DOWN
+	create_movement_action walk_in_place_fast_up, MOVEMENT_ACTION_WALK_IN_PLACE_FAST_UP
+	create_movement_action walk_in_place_fast_left, MOVEMENT_ACTION_WALK_IN_PLACE_FAST_LEFT
+	create_movement_action walk_in_place_fast_right, MOVEMENT_ACTION_WALK_IN_PLACE_FAST_RIGHT
+	create_movement_action walk_in_place_faster_down, MOVEMENT_ACTION_WALK_IN_PLACE_FASTER_DOWN
+	create_movement_action walk_in_place_faster_up, MOVEMENT_ACTION_WALK_IN_PLACE_FASTER_UP
+	create_movement_action walk_in_place_faster_left, MOVEMENT_ACTION_WALK_IN_PLACE_FASTER_LEFT
+	create_movement_action walk_in_place_faster_right, MOVEMENT_ACTION_WALK_IN_PLACE_FASTER_RIGHT
+	create_movement_action ride_water_current_down, MOVEMENT_ACTION_RIDE_WATER_CURRENT_DOWN
+	create_movement_action ride_water_current_up, MOVEMENT_ACTION_RIDE_WATER_CURRENT_UP
+	create_movement_action ride_water_current_lefft, MOVEMENT_ACTION_RIDE_WATER_CURRENT_LEFT
+	create_movement_action ride_water_current_right, MOVEMENT_ACTION_RIDE_WATER_CURRENT_RIGHT
+	create_movement_action walk_faster_down, MOVEMENT_ACTION_WALK_FASTER_DOWN
+	create_movement_action walk_faster_up, MOVEMENT_ACTION_WALK_FASTER_UP
+	create_movement_action walk_faster_left, MOVEMENT_ACTION_WALK_FASTER_LEFT
+	create_movement_action walk_faster_right, MOVEMENT_ACTION_WALK_FASTER_RIGHT
+	create_movement_action slide_down, MOVEMENT_ACTION_SLIDE_DOWN
+	create_movement_action slide_up, MOVEMENT_ACTION_SLIDE_UP
+	create_movement_action slide_left, MOVEMENT_ACTION_SLIDE_LEFT
+	create_movement_action slide_right, MOVEMENT_ACTION_SLIDE_RIGHT
+	create_movement_action player_run_down, MOVEMENT_ACTION_PLAYER_RUN_DOWN
+	create_movement_action player_run_up, MOVEMENT_ACTION_PLAYER_RUN_UP
+	create_movement_action player_run_left, MOVEMENT_ACTION_PLAYER_RUN_LEFT
+	create_movement_action player_run_right, MOVEMENT_ACTION_PLAYER_RUN_RIGHT
+	create_movement_action player_run_down_slow, MOVEMENT_ACTION_PLAYER_RUN_DOWN_SLOW
+	create_movement_action player_run_up_slow, MOVEMENT_ACTION_PLAYER_RUN_UP_SLOW
+	create_movement_action player_run_left_slow, MOVEMENT_ACTION_PLAYER_RUN_LEFT_SLOW
+	create_movement_action player_run_right_slow, MOVEMENT_ACTION_PLAYER_RUN_RIGHT_SLOW
+	create_movement_action start_anim_in_direction, MOVEMENT_ACTION_START_ANIM_IN_DIRECTION
+	create_movement_action jump_special_down, MOVEMENT_ACTION_JUMP_SPECIAL_DOWN
+	create_movement_action jump_special_up, MOVEMENT_ACTION_JUMP_SPECIAL_UP
+	create_movement_action jump_special_left, MOVEMENT_ACTION_JUMP_SPECIAL_LEFT
+	create_movement_action jump_special_right, MOVEMENT_ACTION_JUMP_SPECIAL_RIGHT
+	create_movement_action face_player, MOVEMENT_ACTION_FACE_PLAYER
+	create_movement_action face_away_player, MOVEMENT_ACTION_FACE_AWAY_PLAYER
+	create_movement_action lock_facing_direction, MOVEMENT_ACTION_LOCK_FACING_DIRECTION
+	create_movement_action unlock_facing_direction, MOVEMENT_ACTION_UNLOCK_FACING_DIRECTION
+	create_movement_action jump_down, MOVEMENT_ACTION_JUMP_DOWN
+	create_movement_action jump_up, MOVEMENT_ACTION_JUMP_UP
+	create_movement_action jump_left, MOVEMENT_ACTION_JUMP_LEFT
+	create_movement_action jump_right, MOVEMENT_ACTION_JUMP_RIGHT
+	create_movement_action jump_in_place_down, MOVEMENT_ACTION_JUMP_IN_PLACE_DOWN
+	create_movement_action jump_in_place_up, MOVEMENT_ACTION_JUMP_IN_PLACE_UP
+	create_movement_action jump_in_place_left, MOVEMENT_ACTION_JUMP_IN_PLACE_LEFT
+	create_movement_action jump_in_place_right, MOVEMENT_ACTION_JUMP_IN_PLACE_RIGHT
+	create_movement_action jump_in_place_down_up, MOVEMENT_ACTION_JUMP_IN_PLACE_DOWN_UP
+	create_movement_action jump_in_place_up_down, MOVEMENT_ACTION_JUMP_IN_PLACE_UP_DOWN
+	create_movement_action jump_in_place_left_right, MOVEMENT_ACTION_JUMP_IN_PLACE_LEFT_RIGHT
+	create_movement_action jump_in_place_right_left, MOVEMENT_ACTION_JUMP_IN_PLACE_RIGHT_LEFT
+	create_movement_action face_original_direction, MOVEMENT_ACTION_FACE_ORIGINAL_DIRECTION
+	create_movement_action nurse_joy_bow, MOVEMENT_ACTION_NURSE_JOY_BOW_DOWN
+	create_movement_action enable_jump_landing_ground_effect, MOVEMENT_ACTION_ENABLE_JUMP_LANDING_GROUND_EFFECT
+	create_movement_action disable_jump_landing_ground_effect, MOVEMENT_ACTION_DISABLE_JUMP_LANDING_GROUND_EFFECT
+	create_movement_action disable_anim, MOVEMENT_ACTION_DISABLE_ANIMATION
+	create_movement_action restore_anim, MOVEMENT_ACTION_RESTORE_ANIMATION
+	create_movement_action set_invisible, MOVEMENT_ACTION_SET_INVISIBLE
+	create_movement_action set_visible, MOVEMENT_ACTION_SET_VISIBLE
+	create_movement_action emote_exclamation_mark, MOVEMENT_ACTION_EMOTE_EXCLAMATION_MARK
+	create_movement_action emote_question_mark, MOVEMENT_ACTION_EMOTE_QUESTION_MARK
+	create_movement_action emote_x, MOVEMENT_ACTION_EMOTE_X
+	create_movement_action emote_double_exclamation_mark, MOVEMENT_ACTION_EMOTE_DOUBLE_EXCL_MARK
+	create_movement_action emote_smile, MOVEMENT_ACTION_EMOTE_SMILE
+	create_movement_action reveal_trainer, MOVEMENT_ACTION_REVEAL_TRAINER
+	create_movement_action rock_smash_break, MOVEMENT_ACTION_ROCK_SMASH_BREAK
+	create_movement_action cut_tree, MOVEMENT_ACTION_CUT_TREE
+	create_movement_action set_fixed_priority, MOVEMENT_ACTION_SET_FIXED_PRIORITY
+	create_movement_action clear_fixed_priority, MOVEMENT_ACTION_CLEAR_FIXED_PRIORITY
+	create_movement_action init_affine_anim, MOVEMENT_ACTION_INIT_AFFINE_ANIM
+	create_movement_action clear_affine_anim, MOVEMENT_ACTION_CLEAR_AFFINE_ANIM
+	create_movement_action walk_down_start_affine, MOVEMENT_ACTION_WALK_DOWN_START_AFFINE
+	create_movement_action walk_down_affine, MOVEMENT_ACTION_WALK_DOWN_AFFINE
+	create_movement_action acro_wheelie_face_down, MOVEMENT_ACTION_ACRO_WHEELIE_FACE_DOWN
+	create_movement_action acro_wheelie_face_up, MOVEMENT_ACTION_ACRO_WHEELIE_FACE_UP
+	create_movement_action acro_wheelie_face_left, MOVEMENT_ACTION_ACRO_WHEELIE_FACE_LEFT
+	create_movement_action acro_wheelie_face_right, MOVEMENT_ACTION_ACRO_WHEELIE_FACE_RIGHT
+	create_movement_action acro_pop_wheelie_down, MOVEMENT_ACTION_ACRO_POP_WHEELIE_DOWN
+	create_movement_action acro_pop_wheelie_up, MOVEMENT_ACTION_ACRO_POP_WHEELIE_UP
+	create_movement_action acro_pop_wheelie_left, MOVEMENT_ACTION_ACRO_POP_WHEELIE_LEFT
+	create_movement_action acro_pop_wheelie_right, MOVEMENT_ACTION_ACRO_POP_WHEELIE_RIGHT
+	create_movement_action acro_end_wheelie_face_down, MOVEMENT_ACTION_ACRO_END_WHEELIE_FACE_DOWN
+	create_movement_action acro_end_wheelie_face_up, MOVEMENT_ACTION_ACRO_END_WHEELIE_FACE_UP
+	create_movement_action acro_end_wheelie_face_left, MOVEMENT_ACTION_ACRO_END_WHEELIE_FACE_LEFT
+	create_movement_action acro_end_wheelie_face_right, MOVEMENT_ACTION_ACRO_END_WHEELIE_FACE_RIGHT
+	create_movement_action acro_wheelie_hop_face_down, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_FACE_DOWN
+	create_movement_action acro_wheelie_hop_face_up, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_FACE_UP
+	create_movement_action acro_wheelie_hop_face_left, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_FACE_LEFT
+	create_movement_action acro_wheelie_hop_face_right, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_FACE_RIGHT
+	create_movement_action acro_wheelie_hop_down, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_DOWN
+	create_movement_action acro_wheelie_hop_up, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_UP
+	create_movement_action acro_wheelie_hop_left, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_LEFT
+	create_movement_action acro_wheelie_hop_right, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_RIGHT
+	create_movement_action acro_wheelie_jump_down, MOVEMENT_ACTION_ACRO_WHEELIE_JUMP_DOWN
+	create_movement_action acro_wheelie_jump_up, MOVEMENT_ACTION_ACRO_WHEELIE_JUMP_UP
+	create_movement_action acro_wheelie_jump_left, MOVEMENT_ACTION_ACRO_WHEELIE_JUMP_LEFT
+	create_movement_action acro_wheelie_jump_right, MOVEMENT_ACTION_ACRO_WHEELIE_JUMP_RIGHT
+	create_movement_action acro_wheelie_in_place_down, MOVEMENT_ACTION_ACRO_WHEELIE_IN_PLACE_DOWN
+	create_movement_action acro_wheelie_in_place_up, MOVEMENT_ACTION_ACRO_WHEELIE_IN_PLACE_UP
+	create_movement_action acro_wheelie_in_place_left, MOVEMENT_ACTION_ACRO_WHEELIE_IN_PLACE_LEFT
+	create_movement_action acro_wheelie_in_place_right, MOVEMENT_ACTION_ACRO_WHEELIE_IN_PLACE_RIGHT
+	create_movement_action acro_pop_wheelie_move_down, MOVEMENT_ACTION_ACRO_POP_WHEELIE_MOVE_DOWN
+	create_movement_action acro_pop_wheelie_move_up, MOVEMENT_ACTION_ACRO_POP_WHEELIE_MOVE_UP
+	create_movement_action acro_pop_wheelie_move_left, MOVEMENT_ACTION_ACRO_POP_WHEELIE_MOVE_LEFT
+	create_movement_action acro_pop_wheelie_move_right, MOVEMENT_ACTION_ACRO_POP_WHEELIE_MOVE_RIGHT
+	create_movement_action acro_wheelie_move_down, MOVEMENT_ACTION_ACRO_WHEELIE_MOVE_DOWN
+	create_movement_action acro_wheelie_move_up, MOVEMENT_ACTION_ACRO_WHEELIE_MOVE_UP
+	create_movement_action acro_wheelie_move_left, MOVEMENT_ACTION_ACRO_WHEELIE_MOVE_LEFT
+	create_movement_action acro_wheelie_move_right, MOVEMENT_ACTION_ACRO_WHEELIE_MOVE_RIGHT
+	create_movement_action spin_down, MOVEMENT_ACTION_SPIN_DOWN
+	create_movement_action spin_up, MOVEMENT_ACTION_SPIN_UP
+	create_movement_action spin_left, MOVEMENT_ACTION_SPIN_LEFT
+	create_movement_action spin_right, MOVEMENT_ACTION_SPIN_RIGHT
+	create_movement_action raise_hand_and_stop, MOVEMENT_ACTION_RAISE_HAND_AND_STOP
+	create_movement_action raise_hand_and_jump, MOVEMENT_ACTION_RAISE_HAND_AND_JUMP
+	create_movement_action raise_hand_and_swim, MOVEMENT_ACTION_RAISE_HAND_AND_SWIM
+	create_movement_action walk_slowest_down, MOVEMENT_ACTION_WALK_SLOWEST_DOWN
+	create_movement_action walk_slowest_up, MOVEMENT_ACTION_WALK_SLOWEST_UP
+	create_movement_action walk_slowest_left, MOVEMENT_ACTION_WALK_SLOWEST_LEFT
+	create_movement_action walk_slowest_right, MOVEMENT_ACTION_WALK_SLOWEST_RIGHT
+	create_movement_action shake_head_or_walk_in_place, MOVEMENT_ACTION_SHAKE_HEAD_OR_WALK_IN_PLACE
+	create_movement_action glide_down, MOVEMENT_ACTION_GLIDE_DOWN
+	create_movement_action glide_up, MOVEMENT_ACTION_GLIDE_UP
+	create_movement_action glide_left, MOVEMENT_ACTION_GLIDE_LEFT
+	create_movement_action glide_right, MOVEMENT_ACTION_GLIDE_RIGHT
+	create_movement_action fly_up, MOVEMENT_ACTION_FLY_UP
+	create_movement_action fly_down, MOVEMENT_ACTION_FLY_DOWN
+	create_movement_action jump_special_with_effect_down, MOVEMENT_ACTION_JUMP_SPECIAL_WITH_EFFECT_DOWN
+	create_movement_action jump_special_with_effect_up, MOVEMENT_ACTION_JUMP_SPECIAL_WITH_EFFECT_UP
+	create_movement_action jump_special_with_effect_left, MOVEMENT_ACTION_JUMP_SPECIAL_WITH_EFFECT_LEFT
+	create_movement_action jump_special_with_effect_right, MOVEMENT_ACTION_JUMP_SPECIAL_WITH_EFFECT_RIGHT
+	create_movement_action step_end, MOVEMENT_ACTION_STEP_END
+# 4 "asm/macros.inc"
+# 1 "asm/macros/ec.inc"
+
+	.macro ec_duplicates count
+	.2byte 0xff00 + \count
+	.endm
+
+	.macro ec_words_by_letter label
+	.2byte (gEasyChatWordsByLetter_\label - gEasyChatWordsAlphabetized) / 2
+	.endm
+# 5 "asm/macros.inc"
+# 1 "asm/macros/map.inc"
+                                                                                                                                   
+
+	                                                                                 
+	.macro map map_id:req
+	.byte \map_id >> 8               
+	.byte \map_id & 0xFF           
+	.endm
+
+	                                                                                                 
+	.macro map_script type:req, script:req
+	.byte \type
+	.4byte \script
+	.endm
+
+	                                                                                              
+	.macro map_script_2 var:req, compare:req, script:req
+	.2byte \var
+	.2byte \compare
+	.4byte \script
+	.endm
+
+	                                                                                                                                                             
+	.macro object_event index:req, gfx:req, x:req, y:req, elevation:req, movement_type:req, x_radius:req, y_radius:req, trainer_type:req, sight_radius_tree_etc:req, script:req, event_flag:req
+	.byte \index
+	.byte \gfx
+	.byte OBJ_KIND_NORMAL
+	.space 1           
+	.2byte \x, \y
+	.byte \elevation
+	.byte \movement_type
+	.byte ((\y_radius << 4) | \x_radius)
+	.space 1           
+	.2byte \trainer_type
+	.2byte \sight_radius_tree_etc
+	.4byte \script
+	.2byte \event_flag
+	.space 2           
+	inc _num_npcs
+	.endm
+
+	                                                                                                                                                            
+	.macro clone_event index:req, gfx:req, x:req, y:req, target_local_id:req, target_map_id:req
+	.byte \index
+	.byte \gfx
+	.byte OBJ_KIND_CLONE
+	.space 1           
+	.2byte \x, \y
+	.byte \target_local_id
+	.space 3           
+	.2byte \target_map_id & 0xFF           
+	.2byte \target_map_id >> 8               
+	.space 8           
+	inc _num_npcs
+	.endm
+
+	                                                                                                        
+	.macro warp_def x:req, y:req, elevation:req, warpId:req, map_id:req
+	.2byte \x, \y
+	.byte \elevation
+	.byte \warpId
+	.byte \map_id & 0xFF           
+	.byte \map_id >> 8               
+	inc _num_warps
+	.endm
+
+	                                                                                                          
+	.macro coord_event x:req, y:req, elevation:req, var:req, varValue:req, script:req
+	.2byte \x, \y
+	.byte \elevation
+	.space 1           
+	.2byte \var
+	.2byte \varValue
+	.space 2           
+	.4byte \script
+	inc _num_traps
+	.endm
+
+	                                                                                                                        
+	                                                                                              
+	.macro coord_weather_event x:req, y:req, elevation:req, weather:req
+	coord_event \x, \y, \elevation, \weather, 0, NULL
+	.endm
+
+	                                                                                                                    
+	                                                                       
+	                                                                                                                     
+	                   
+	.macro bg_event x:req, y, elevation:req, kind:req, arg6:req, arg7, arg8
+	.2byte \x, \y
+	.byte \elevation
+	.byte \kind
+	.space 2           
+	.if \kind != BG_EVENT_HIDDEN_ITEM
+		.4byte \arg6
+	.else
+		.2byte \arg6
+		.byte \arg7
+		.byte \arg8
+	.endif
+	inc _num_signs
+	.endm
+
+	                                                                                                                                                
+	.macro bg_sign_event x:req, y:req, elevation:req, facing_dir:req, script:req
+	bg_event \x, \y, \elevation, \facing_dir, \script
+	.endm
+
+	                                                     
+	.macro bg_hidden_item_event x:req, y:req, elevation:req, item:req, flag:req, quantity:req, underfoot:req
+	bg_event \x, \y, \elevation, BG_EVENT_HIDDEN_ITEM, \item, ((\flag) - FLAG_HIDDEN_ITEMS_START), \quantity | (\underfoot << 7)
+	.endm
+
+	                                                      
+	                
+	.macro bg_secret_base_event x:req, y:req, elevation:req, secret_base_id:req
+	bg_event \x, \y, \elevation, BG_EVENT_SECRET_BASE, \secret_base_id
+	.endm
+
+	                                                                                                                
+	.macro map_events npcs:req, warps:req, traps:req, signs:req
+	.byte _num_npcs, _num_warps, _num_traps, _num_signs
+	.4byte \npcs, \warps, \traps, \signs
+	reset_map_events
+	.endm
+
+	                                                                                                                       
+	.macro reset_map_events
+	.set _num_npcs, 0
+	.set _num_warps, 0
+	.set _num_traps, 0
+	.set _num_signs, 0
+	.endm
+
+	                                                 
+	reset_map_events
+
+	                                
+	                                                                                                                                     
+	.equiv connection_down, CONNECTION_SOUTH
+	.equiv connection_up, CONNECTION_NORTH
+	.equiv connection_left, CONNECTION_WEST
+	.equiv connection_right, CONNECTION_EAST
+	.equiv connection_dive, CONNECTION_DIVE
+	.equiv connection_emerge, CONNECTION_EMERGE
+
+	                                                                                                   
+	.macro connection direction:req, offset:req, map:req
+	.byte connection_\direction
+	.space 3           
+	.4byte \offset
+	map \map
+	.space 2           
+	.endm
+
+	                                                                                                                         
+	.macro map_header_flags allow_cycling:req, allow_escaping:req, allow_running:req, show_map_name:req
+	.byte \allow_cycling
+	.byte ((\show_map_name & 1) << 2) | ((\allow_running & 1) << 1) | ((\allow_escaping & 1) << 0)
+	.endm
+# 6 "asm/macros.inc"
+# 1 "asm/macros/m4a.inc"
+	.macro song label, music_player, unknown
+	.4byte \label
+	.2byte \music_player
+	.2byte \unknown
+	.endm
+
+	.macro music_player info_struct, track_struct, unknown_1, unknown_2
+	.4byte \info_struct
+	.4byte \track_struct
+	.byte \unknown_1
+	.space 1
+	.2byte \unknown_2
+	.endm
+# 7 "asm/macros.inc"
+# 1 "asm/macros/trainer_tower.inc"
+	                                                                            
+	.macro ttower_initfloor
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_INIT_FLOOR
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                         
+	.macro ttower_getspeech speech:req, trainer=0xFF
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_SPEECH
+	setvar VAR_0x8005, \speech
+	.if \trainer >= VARS_START && \trainer != 0xFF
+	copyvar VAR_0x8006, \trainer
+	.elseif \trainer != 0xFF
+	setvar VAR_0x8006, \trainer
+	.endif
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                     
+	.macro ttower_dobattle
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_DO_BATTLE
+	setvar VAR_0x8005, 0
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                                                                                     
+	.macro ttower_getchallengetype
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_CHALLENGE_TYPE
+	setvar VAR_0x8005, FALSE
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                         
+	.macro ttower_clearedfloor
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_CLEARED_FLOOR
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                         
+	.macro ttower_isfloorcleared
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_FLOOR_CLEARED
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                              
+	.macro ttower_startchallenge
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_START_CHALLENGE
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                    
+	.macro ttower_getownerstate
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_OWNER_STATE
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                                           
+	.macro ttower_giveprize
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GIVE_PRIZE
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                                
+	.macro ttower_checkfinaltime
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_CHECK_FINAL_TIME
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                            
+	.macro ttower_resumetimer
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_RESUME_TIMER
+	special CallTrainerTowerFunc
+	.endm
+
+	                                         
+	.macro ttower_setlost
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_SET_LOST
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                
+	.macro ttower_getchallengestatus
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_CHALLENGE_STATUS
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                                          
+	.macro ttower_gettime
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_TIME
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                              
+	.macro ttower_showresults
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_SHOW_RESULTS
+	special CallTrainerTowerFunc
+	.endm
+
+	                   
+	.macro ttower_closeresults
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_CLOSE_RESULTS
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                                
+	.macro ttower_checkdoubles
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_CHECK_DOUBLES
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                                               
+	.macro ttower_getnumfloors
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_NUM_FLOORS
+	special CallTrainerTowerFunc
+	.endm
+
+	                               
+	.macro ttower_shouldexit
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_SHOULD_WARP_TO_COUNTER
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                
+	.macro ttower_encountermusic
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_ENCOUNTER_MUSIC
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                    
+	.macro ttower_getbeatchallenge
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_BEAT_CHALLENGE
+	special CallTrainerTowerFunc
+	.endm
+# 8 "asm/macros.inc"
+
+	.macro region_map_location x, y, width, height, name
+	.byte \x
+	.byte \y
+	.byte \width
+	.byte \height
+	.4byte gMapName_\name
+	.endm
+
+	.macro obj_tiles address, uncompressed_size, tag
+	.4byte \address
+	.2byte \uncompressed_size
+	.2byte \tag
+	.endm
+
+	.macro null_obj_tiles
+	obj_tiles 0, 0, 0
+	.endm
+
+	.macro obj_pal address, tag
+	.4byte \address
+	.2byte \tag
+	.2byte 0          
+	.endm
+
+	.macro null_obj_pal
+	obj_pal 0, 0
+	.endm
+
+	.macro paired_pals tag, address
+	.2byte \tag
+	.2byte 0          
+	.4byte \address
+	.endm
+
+                              
+	.macro obj_frame_tiles address, uncompressed_size
+	.4byte \address
+	.2byte \uncompressed_size
+	.2byte 0          
+	.endm
+
+	.macro spr_template tile_tag, pal_tag, oam, anims, images, affine_anims, callback
+	.2byte \tile_tag
+	.2byte \pal_tag
+	.4byte \oam
+	.4byte \anims
+	.4byte \images
+	.4byte \affine_anims
+	.4byte \callback
+	.endm
+
+                                                                             
+                                                                             
+                                                                              
+	.macro berry_tree_palette_slot_table slot
+	.byte 3, 4, \slot, \slot, \slot
+	.endm
+
+	.macro subsprite x, y, priority, tile_num_offset, size
+	.byte \x
+	.byte \y
+	.2byte ((\priority) << 14) | ((\tile_num_offset) << 4) | SPRITE_SIZE_\size
+	.endm
+
+	.macro obj_image_anim_frame pic_id, duration, flags = 0
+	.2byte \pic_id
+	.byte (\flags) | (\duration)
+	.byte 0          
+	.endm
+
+	.macro obj_image_anim_loop count
+	.2byte 0xfffd
+	.byte \count
+	.byte 0          
+	.endm
+
+	.macro obj_image_anim_jump target_index
+	.2byte 0xfffe
+	.byte \target_index
+	.byte 0          
+	.endm
+
+	.macro obj_image_anim_end
+	.2byte 0xffff
+	.2byte 0          
+	.endm
+
+	.macro obj_rot_scal_anim_frame delta_x_scale, delta_y_scale, delta_angle, duration
+	.2byte \delta_x_scale
+	.2byte \delta_y_scale
+	.byte \delta_angle
+	.byte \duration
+	.2byte 0          
+	.endm
+
+	.macro obj_rot_scal_anim_loop count
+	.2byte 0x7ffd
+	.2byte \count
+	.4byte 0          
+	.endm
+
+	.macro obj_rot_scal_anim_jump target_index
+	.2byte 0x7ffe
+	.2byte \target_index
+	.4byte 0          
+	.endm
+
+	.macro obj_rot_scal_anim_end unknown=0
+	.2byte 0x7fff
+	.2byte \unknown
+	.fill 4          
+	.endm
+
+	.macro overworld_frame ptr:req, width:req, height:req, frame:req
+	.4byte (\ptr + (\width * \height * \frame * 64) / 2)
+	.2byte (\width * \height * 64) / 2
+	.2byte 0          
+	.endm
+
+	.macro credits_entry number, text
+	.4byte \number
+	.4byte \text
+	.endm
+
+	.macro door_anim_frame unknown, offset
+	.byte \unknown
+	.byte 0          
+	.2byte \offset
+	.endm
+
+	.macro door_anim_gfx metatile_num, unknown, tile_addr, palette_addr
+	.2byte \metatile_num
+	.2byte \unknown
+	.4byte \tile_addr
+	.4byte \palette_addr
+	.endm
+
+	.macro trainer_eye_trainer opp_1, opp_2, opp_3, opp_4, opp_5, map_name
+	.2byte OPPONENT_\opp_1
+	.2byte OPPONENT_\opp_2
+	.2byte OPPONENT_\opp_3
+	.2byte OPPONENT_\opp_4
+	.2byte OPPONENT_\opp_5
+	.2byte GROUP_\map_name
+	.2byte MAP_\map_name
+	.space 2
+	.endm
+
+	.macro window_template bg, top, left, height, width, palno, baseBlock
+	.byte \bg, \top, \left, \height, \width, \palno
+	.2byte \baseBlock
+	.endm
+
+	.macro abspath relative
+	.if REVISION == 0
+	.ascii "C:/WORK/POKeFRLG/src/pm_lgfr_ose/source/"
+	.else
+	.ascii "C:/WORK/POKeFRLG/Src/pm_lgfr_ose/source/"
+	.endif
+	.asciz "\relative"
+	.endm
+# 12 "data/mystery_event_msg.s"
+# 1 "asm/macros/event.inc"
+	               
+	.macro nop
+	.byte 0x00
+	.endm
+
+	               
+	.macro nop1
+	.byte 0x01
+	.endm
+
+	                              
+	.macro end
+	.byte 0x02
+	.endm
+
+	                                                                                                  
+	.macro return
+	.byte 0x03
+	.endm
+
+	                                                                                                                                                
+	.macro call destination:req
+	.byte 0x04
+	.4byte \destination
+	.endm
+
+	                                                                 
+	.macro goto destination:req
+	.byte 0x05
+	.4byte \destination
+	.endm
+
+	                                                                                                                                                    
+	.macro goto_if condition:req, destination:req
+	.byte 0x06
+	.byte \condition
+	.4byte \destination
+	.endm
+
+	                                                                                                       
+	.macro call_if condition:req, destination:req
+	.byte 0x07
+	.byte \condition
+	.4byte \destination
+	.endm
+
+	                                                       
+	.macro gotostd function:req
+	.byte 0x08
+	.byte \function
+	.endm
+
+	             
+	STD_OBTAIN_ITEM = 0
+	STD_FIND_ITEM = 1
+
+	MSGBOX_NPC = 2
+	MSGBOX_SIGN = 3
+	MSGBOX_DEFAULT = 4
+	MSGBOX_YESNO = 5
+	MSGBOX_AUTOCLOSE = 6
+
+	STD_OBTAIN_DECORATION = 7
+	STD_PUT_ITEM_AWAY = 8
+	STD_RECEIVED_ITEM = 9
+
+	                                                    
+	.macro callstd function:req
+	.byte 0x09
+	.byte \function
+	.endm
+
+	                                                                                                                                          
+	.macro gotostd_if condition:req, function:req
+	.byte 0x0a
+	.byte \condition
+	.byte \function
+	.endm
+
+	                                                                                                                                       
+	.macro callstd_if condition:req, function:req
+	.byte 0x0b
+	.byte \condition
+	.byte \function
+	.endm
+
+	                                                      
+	.macro returnram
+	.byte 0x0c
+	.endm
+
+	                                                   
+	.macro endram
+	.byte 0x0d
+	.endm
+
+	                                                         
+	.macro setmysteryeventstatus value:req
+	.byte 0x0e
+	.byte \value
+	.endm
+
+	                                                                            
+	.macro loadword destIndex:req, value:req
+	.byte 0x0f
+	.byte \destIndex
+	.4byte \value
+	.endm
+
+	                                                                          
+	.macro loadbyte destIndex:req, value:req
+	.byte 0x10
+	.byte \destIndex
+	.byte \value
+	.endm
+
+	                                          
+	.macro setptr value:req, ptr:req
+	.byte 0x11
+	.byte \value
+	.4byte \ptr
+	.endm
+
+	                                                                                     
+	.macro loadbytefromptr destIndex:req, source:req
+	.byte 0x12
+	.byte \destIndex
+	.4byte \source
+	.endm
+
+	                                                                                           
+	.macro setptrbyte srcIndex:req, destination:req
+	.byte 0x13
+	.byte \srcIndex
+	.4byte \destination
+	.endm
+
+	                                                                   
+	.macro copylocal destIndex:req, srcIndex:req
+	.byte 0x14
+	.byte \destIndex
+	.byte \srcIndex
+	.endm
+
+	                                                                                         
+	.macro copybyte destination:req, source:req
+	.byte 0x15
+	.4byte \destination
+	.4byte \source
+	.endm
+
+	                                            
+	.macro setvar destination:req, value:req
+	.byte 0x16
+	.2byte \destination
+	.2byte \value
+	.endm
+
+	                                                                                                          
+	.macro addvar destination:req, value:req
+	.byte 0x17
+	.2byte \destination
+	.2byte \value
+	.endm
+
+	                                                                                                               
+	.macro subvar destination:req, value:req
+	.byte 0x18
+	.2byte \destination
+	.2byte \value
+	.endm
+
+	                                              
+	.macro copyvar destination:req, source:req
+	.byte 0x19
+	.2byte \destination
+	.2byte \source
+	.endm
+
+	                                                                                                    
+	.macro setorcopyvar destination:req, source:req
+	.byte 0x1a
+	.2byte \destination
+	.2byte \source
+	.endm
+
+	                                                                          
+	                                                                              
+	.macro compare_local_to_local local1:req, local2:req
+	.byte 0x1b
+	.byte \local1
+	.byte \local2
+	.endm
+
+	                                                                          
+	                                                                              
+	.macro compare_local_to_value local:req, value:req
+	.byte 0x1c
+	.byte \local
+	.byte \value
+	.endm
+
+	                                                                              
+	                                                                              
+	.macro compare_local_to_ptr local:req, ptr:req
+	.byte 0x1d
+	.byte \local
+	.4byte \ptr
+	.endm
+
+	                                                                               
+	                                                                              
+	.macro compare_ptr_to_local ptr:req, local:req
+	.byte 0x1e
+	.4byte \ptr
+	.byte \local
+	.endm
+
+	                                               
+	                                                                              
+	.macro compare_ptr_to_value ptr:req, value:req
+	.byte 0x1f
+	.4byte \ptr
+	.byte \value
+	.endm
+
+	                                                      
+	                                                                              
+	.macro compare_ptr_to_ptr ptr1:req, ptr2:req
+	.byte 0x20
+	.4byte \ptr1
+	.4byte \ptr2
+	.endm
+
+	                                               
+	                                                                              
+	.macro compare_var_to_value var:req, value:req
+	.byte 0x21
+	.2byte \var
+	.2byte \value
+	.endm
+
+	                                                      
+	                                                                              
+	.macro compare_var_to_var var1:req, var2:req
+	.byte 0x22
+	.2byte \var1
+	.2byte \var2
+	.endm
+
+	                                                                                     
+	                                                                                                                                
+	.macro compare var:req, arg:req
+		.if ((\arg >= VARS_START && \arg <= VARS_END) || (\arg >= SPECIAL_VARS_START && \arg <= SPECIAL_VARS_END))
+			compare_var_to_var \var, \arg
+		.else
+			compare_var_to_value \var, \arg
+		.endif
+	.endm
+
+	                                             
+	.macro callnative func:req
+	.byte 0x23
+	.4byte \func
+	.endm
+
+	                                                                                                                        
+	.macro gotonative func:req
+	.byte 0x24
+	.4byte \func
+	.endm
+
+	                                                            
+	.macro special function:req
+	.byte 0x25
+	.2byte SPECIAL_\function
+	.endm
+
+	                                                            
+	                                                                                        
+	.macro specialvar output:req, function:req
+	.byte 0x26
+	.2byte \output
+	.2byte SPECIAL_\function
+	.endm
+
+	                                                                                                       
+	                                                                                                    
+	.macro waitstate
+	.byte 0x27
+	.endm
+
+	                                                                                                 
+	.macro delay frames:req
+	.byte 0x28
+	.2byte \frames
+	.endm
+
+	                    
+	.macro setflag flag:req
+	.byte 0x29
+	.2byte \flag
+	.endm
+
+	                     
+	.macro clearflag flag:req
+	.byte 0x2a
+	.2byte \flag
+	.endm
+
+	                                                                                            
+	                                             
+	.macro checkflag flag:req
+	.byte 0x2b
+	.2byte \flag
+	.endm
+
+	                                                                                                               
+	.macro initclock hour:req, minute:req
+	.byte 0x2c
+	.2byte \hour
+	.2byte \minute
+	.endm
+
+	                                                                                                      
+	.macro dotimebasedevents
+	.byte 0x2d
+	.endm
+
+	                                                                                                                                                 
+	.macro gettime
+	.byte 0x2e
+	.endm
+
+	                                                                                                        
+	.macro playse song:req
+	.byte 0x2f
+	.2byte \song
+	.endm
+
+	                                                                                                   
+	.macro waitse
+	.byte 0x30
+	.endm
+
+	                                                                                                                                          
+	.macro playfanfare song:req
+	.byte 0x31
+	.2byte \song
+	.endm
+
+	                                                                      
+	.macro waitfanfare
+	.byte 0x32
+	.endm
+
+	                                                     
+	                                                                
+	.macro playbgm song:req, save_song:req
+	.byte 0x33
+	.2byte \song
+	.byte \save_song
+	.endm
+
+	                                                                                                                                     
+	                     
+	.macro savebgm song:req
+	.byte 0x34
+	.2byte \song
+	.endm
+
+	                                                                    
+	.macro fadedefaultbgm
+	.byte 0x35
+	.endm
+
+	                                                                
+	.macro fadenewbgm song:req
+	.byte 0x36
+	.2byte \song
+	.endm
+
+	                                       
+	.macro fadeoutbgm speed:req
+	.byte 0x37
+	.byte \speed
+	.endm
+
+	                                            
+	.macro fadeinbgm speed:req
+	.byte 0x38
+	.byte \speed
+	.endm
+
+	                                                              
+	                                                                                       
+	                                                                                       
+	                                                                                       
+	                                                             
+	                                              
+	                  
+	                    
+	            
+	                          
+	.macro formatwarp map:req, a, b, c
+	map \map
+	.ifb \a                                                      
+		.byte WARP_ID_NONE
+		.2byte -1    
+		.2byte -1    
+	.else
+	.ifb \b                                                                         
+		.byte \a           
+		.2byte -1     
+		.2byte -1     
+	.else
+	.ifb \c                                                                                
+		.byte WARP_ID_NONE
+		.2byte \a     
+		.2byte \b     
+	.else                                                                                    
+		.byte \a          
+		.2byte \b    
+		.2byte \c    
+	.endif
+	.endif
+	.endif
+	.endm
+
+	                                        
+	                                                                                                 
+	                                                                        
+	.macro warp map:req, a, b, c
+	.byte 0x39
+	formatwarp \map, \a, \b, \c
+	.endm
+
+	                                                                       
+	                                                                                                 
+	                                                                        
+	.macro warpsilent map:req, a, b, c
+	.byte 0x3a
+	formatwarp \map, \a, \b, \c
+	.endm
+
+	                                                                                                           
+	                                                                                                 
+	                                                                        
+	.macro warpdoor map:req, a, b, c
+	.byte 0x3b
+	formatwarp \map, \a, \b, \c
+	.endm
+
+	                                                                                                               
+	                                                                                                          
+	                            
+	.macro warphole map:req
+	.byte 0x3c
+	map \map
+	.endm
+
+	                                                                                                       
+	                                                                                    
+	                                                                                                 
+	                                                                        
+	.macro warpteleport map:req, a, b, c
+	.byte 0x3d
+	formatwarp \map, \a, \b, \c
+	.endm
+
+	                                             
+	                                                                                                 
+	                                                                        
+	.macro setwarp map:req, a, b, c
+	.byte 0x3e
+	formatwarp \map, \a, \b, \c
+	.endm
+
+	                                                                                                              
+	                                                                                                 
+	                                                                        
+	.macro setdynamicwarp map:req, a, b, c
+	.byte 0x3f
+	formatwarp \map, \a, \b, \c
+	.endm
+
+	                                                                                                       
+	                                                                                                    
+	                                                                                                            
+	                                                                                                 
+	                                                                        
+	.macro setdivewarp map:req, a, b, c
+	.byte 0x40
+	formatwarp \map, \a, \b, \c
+	.endm
+
+	                                                                        
+	                                                                                           
+	                                                                                       
+	                                           
+	                                                                                                 
+	                                                                        
+	.macro setholewarp map:req, a=0, b=0, c
+	.byte 0x41
+	formatwarp \map, \a, \b, \c
+	.endm
+
+	                                                                                                                  
+	.macro getplayerxy x:req, y:req
+	.byte 0x42
+	.2byte \x
+	.2byte \y
+	.endm
+
+	                                                                                              
+	.macro getpartysize
+	.byte 0x43
+	.endm
+
+	                                                                                                                  
+	                                                                                     
+	.macro additem itemId:req, quantity=1
+	.byte 0x44
+	.2byte \itemId
+	.2byte \quantity
+	.endm
+
+	                                                                                                                    
+	                                                                                                  
+	.macro removeitem itemId:req, quantity=1
+	.byte 0x45
+	.2byte \itemId
+	.2byte \quantity
+	.endm
+
+	                                                                                                                    
+	                                                      
+	.macro checkitemspace itemId:req, quantity=1
+	.byte 0x46
+	.2byte \itemId
+	.2byte \quantity
+	.endm
+
+	                                                                                                                         
+	                                                                            
+	.macro checkitem itemId:req, quantity=1
+	.byte 0x47
+	.2byte \itemId
+	.2byte \quantity
+	.endm
+
+	                                                                                                              
+	                                                                                                      
+	.macro checkitemtype itemId:req
+	.byte 0x48
+	.2byte \itemId
+	.endm
+
+	                                                         
+	.macro addpcitem itemId:req, quantity=1
+	.byte 0x49
+	.2byte \itemId
+	.2byte \quantity
+	.endm
+
+	                                                               
+	.macro checkpcitem itemId:req, quantity=1
+	.byte 0x4a
+	.2byte \itemId
+	.2byte \quantity
+	.endm
+
+	                                                                               
+	.macro adddecoration decoration:req
+	.byte 0x4b
+	.2byte \decoration
+	.endm
+
+	                                                                                    
+	.macro removedecoration decoration:req
+	.byte 0x4c
+	.2byte \decoration
+	.endm
+
+	                                                                                   
+	.macro checkdecor decoration:req
+	.byte 0x4d
+	.2byte \decoration
+	.endm
+
+	                                                                                                                   
+	.macro checkdecorspace decoration:req
+	.byte 0x4e
+	.2byte \decoration
+	.endm
+
+	                                                                                                                                 
+	.macro applymovement localId:req, movements:req, map
+		.ifb \map
+			.byte 0x4f
+			.2byte \localId
+			.4byte \movements
+		.else
+			                                                                                                               
+			.byte 0x50
+			.2byte \localId
+			.4byte \movements
+			map \map
+		.endif
+	.endm
+
+	                                                                                                     
+	                                                                                            
+	                                                                                                                
+	                                                       
+	.macro waitmovement localId=LOCALID_NONE, map
+		.ifb \map
+			.byte 0x51
+			.2byte \localId
+		.else
+			.byte 0x52
+			.2byte \localId
+			map \map
+		.endif
+	.endm
+
+	                                                                          
+	                                                          
+	                                                       
+	.macro removeobject localId:req, map
+		.ifb \map
+			.byte 0x53
+			.2byte \localId
+		.else
+			.byte 0x54
+			.2byte \localId
+			map \map
+		.endif
+	.endm
+
+	                                                                     
+	                                                                       
+	                                                       
+	.macro addobject localId:req, map
+		.ifb \map
+			.byte 0x55
+			.2byte \localId
+		.else
+			.byte 0x56
+			.2byte \localId
+			map \map
+		.endif
+	.endm
+
+	                                                                    
+	.macro setobjectxy localId:req, x:req, y:req
+	.byte 0x57
+	.2byte \localId
+	.2byte \x
+	.2byte \y
+	.endm
+
+	                                                    
+	.macro showobjectat localId:req, map:req
+	.byte 0x58
+	.2byte \localId
+	map \map
+	.endm
+
+	                                                   
+	.macro hideobjectat localId:req, map:req
+	.byte 0x59
+	.2byte \localId
+	map \map
+	.endm
+
+	                                                                           
+	.macro faceplayer
+	.byte 0x5a
+	.endm
+
+	                                                        
+	.macro turnobject localId:req, direction:req
+	.byte 0x5b
+	.2byte \localId
+	.byte \direction
+	.endm
+
+	                                                                                                                   
+	.macro trainerbattle type:req, trainer:req, local_id:req, pointer1:req, pointer2, pointer3, pointer4
+		.byte 0x5c
+		.byte \type
+		.2byte \trainer
+		.2byte \local_id
+		.if \type == TRAINER_BATTLE_SINGLE
+			.4byte \pointer1       
+			.4byte \pointer2       
+		.elseif \type == TRAINER_BATTLE_CONTINUE_SCRIPT_NO_MUSIC
+			.4byte \pointer1       
+			.4byte \pointer2       
+			.4byte \pointer3               
+		.elseif \type == TRAINER_BATTLE_CONTINUE_SCRIPT
+			.4byte \pointer1       
+			.4byte \pointer2       
+			.4byte \pointer3               
+		.elseif \type == TRAINER_BATTLE_SINGLE_NO_INTRO_TEXT
+			.4byte \pointer1       
+		.elseif \type == TRAINER_BATTLE_DOUBLE
+			.4byte \pointer1       
+			.4byte \pointer2       
+			.4byte \pointer3       
+		.elseif \type == TRAINER_BATTLE_REMATCH
+			.4byte \pointer1       
+			.4byte \pointer2       
+		.elseif \type == TRAINER_BATTLE_CONTINUE_SCRIPT_DOUBLE
+			.4byte \pointer1       
+			.4byte \pointer2       
+			.4byte \pointer3       
+			.4byte \pointer4               
+		.elseif \type == TRAINER_BATTLE_REMATCH_DOUBLE
+			.4byte \pointer1       
+			.4byte \pointer2       
+			.4byte \pointer3       
+		.elseif \type == TRAINER_BATTLE_CONTINUE_SCRIPT_DOUBLE_NO_MUSIC
+			.4byte \pointer1       
+			.4byte \pointer2       
+			.4byte \pointer3       
+			.4byte \pointer4               
+		.elseif \type == TRAINER_BATTLE_EARLY_RIVAL
+			.4byte \pointer1       
+			.4byte \pointer2       
+		.endif
+	.endm
+
+	NO_MUSIC = FALSE
+
+	                                                                                                       
+	                                                                                        
+	.macro trainerbattle_single trainer:req, intro_text:req, lose_text:req, event_script=FALSE, music=TRUE
+	.if \event_script == FALSE
+	trainerbattle TRAINER_BATTLE_SINGLE, \trainer, 0, \intro_text, \lose_text
+	.elseif \music == TRUE
+	trainerbattle TRAINER_BATTLE_CONTINUE_SCRIPT, \trainer, 0, \intro_text, \lose_text, \event_script
+	.else
+	trainerbattle TRAINER_BATTLE_CONTINUE_SCRIPT_NO_MUSIC, \trainer, 0, \intro_text, \lose_text, \event_script
+	.endif
+	.endm
+
+	                                                                                                                
+	                                                                                                                
+	.macro trainerbattle_double trainer:req, intro_text:req, lose_text:req, not_enough_pkmn_text:req, event_script=FALSE, music=TRUE
+	.if \event_script == FALSE
+	trainerbattle TRAINER_BATTLE_DOUBLE, \trainer, 0, \intro_text, \lose_text, \not_enough_pkmn_text
+	.elseif \music == TRUE
+	trainerbattle TRAINER_BATTLE_CONTINUE_SCRIPT_DOUBLE, \trainer, 0, \intro_text, \lose_text, \not_enough_pkmn_text, \event_script
+	.else
+	trainerbattle TRAINER_BATTLE_CONTINUE_SCRIPT_DOUBLE_NO_MUSIC, \trainer, 0, \intro_text, \lose_text, \not_enough_pkmn_text, \event_script
+	.endif
+	.endm
+
+	                                                                    
+	.macro trainerbattle_rematch trainer:req, intro_text:req, lose_text:req
+	trainerbattle TRAINER_BATTLE_REMATCH, \trainer, 0, \intro_text, \lose_text
+	.endm
+
+	                                                                                                                    
+	.macro trainerbattle_rematch_double trainer:req, intro_text:req, lose_text:req, not_enough_pkmn_text:req
+	trainerbattle TRAINER_BATTLE_REMATCH_DOUBLE, \trainer, 0, \intro_text, \lose_text, \not_enough_pkmn_text
+	.endm
+
+	                                                                             
+	.macro trainerbattle_no_intro trainer:req, lose_text:req
+	trainerbattle TRAINER_BATTLE_SINGLE_NO_INTRO_TEXT, \trainer, 0, \lose_text
+	.endm
+
+	                                                                                                                                                                        
+	.macro trainerbattle_earlyrival trainer:req, flags:req, defeat_text:req, victory_text:req
+	trainerbattle TRAINER_BATTLE_EARLY_RIVAL, \trainer, \flags, \defeat_text, \victory_text
+	.endm
+
+	                                                                                                                         
+	                                                                                   
+	.macro dotrainerbattle
+	.byte 0x5d
+	.endm
+
+	                                                                                                      
+	.macro gotopostbattlescript
+	.byte 0x5e
+	.endm
+
+	                                                                                                             
+	.macro gotobeatenscript
+	.byte 0x5f
+	.endm
+
+	                                                                                                                        
+	.macro checktrainerflag trainer:req
+	.byte 0x60
+	.2byte \trainer
+	.endm
+
+	                                                                           
+	.macro settrainerflag trainer:req
+	.byte 0x61
+	.2byte \trainer
+	.endm
+
+	                                                                                
+	.macro cleartrainerflag trainer:req
+	.byte 0x62
+	.2byte \trainer
+	.endm
+
+	                                                                                     
+	                                                    
+	.macro setobjectxyperm localId:req, x:req, y:req
+	.byte 0x63
+	.2byte \localId
+	.2byte \x
+	.2byte \y
+	.endm
+
+	                                                                                                 
+	                                                    
+	.macro copyobjectxytoperm localId:req
+	.byte 0x64
+	.2byte \localId
+	.endm
+
+	                                                                    
+	.macro setobjectmovementtype localId:req, movementType:req
+	.byte 0x65
+	.2byte \localId
+	.byte \movementType
+	.endm
+
+	                                                                                                                  
+	                                         
+	.macro waitmessage
+	.byte 0x66
+	.endm
+
+	                                                                                                                  
+	                                                                                                          
+	                                                                                  
+	.macro message text:req
+	.byte 0x67
+	.4byte \text
+	.endm
+
+	                                 
+	.macro closemessage
+	.byte 0x68
+	.endm
+
+	                                                                                                          
+	.macro lockall
+	.byte 0x69
+	.endm
+
+	                                                                                                                                                       
+	.macro lock
+	.byte 0x6a
+	.endm
+
+	                                                                                                               
+	.macro releaseall
+	.byte 0x6b
+	.endm
+
+	                                                                                                                                               
+	.macro release
+	.byte 0x6c
+	.endm
+
+	                                                                     
+	.macro waitbuttonpress
+	.byte 0x6d
+	.endm
+
+	                                                                                                                               
+	                                                                                                        
+	.macro yesnobox x:req, y:req
+	.byte 0x6e
+	.byte \x
+	.byte \y
+	.endm
+
+	                                                                                                                               
+	                                                                                                             
+	                                                                                                                                 
+	.macro multichoice x:req, y:req, multichoiceId:req, ignoreBPress:req
+	.byte 0x6f
+	.byte \x
+	.byte \y
+	.byte \multichoiceId
+	.byte \ignoreBPress
+	.endm
+
+	                                                                                                                               
+	                                                                                                             
+	                                                                                                                                                                  
+	                                                                                                                                 
+	.macro multichoicedefault x:req, y:req, multichoiceId:req, default:req, ignoreBPress:req
+	.byte 0x70
+	.byte \x
+	.byte \y
+	.byte \multichoiceId
+	.byte \default
+	.byte \ignoreBPress
+	.endm
+
+	                                                                                                                               
+	                                                                                                             
+	                                                                                               
+	                                                                                                                                 
+	.macro multichoicegrid x:req, y:req, multichoiceId:req, per_row:req, ignoreBPress:req
+	.byte 0x71
+	.byte \x
+	.byte \y
+	.byte \multichoiceId
+	.byte \per_row
+	.byte \ignoreBPress
+	.endm
+
+	                                 
+	.macro drawbox
+	.byte 0x72
+	.endm
+
+	                                                            
+	.macro erasebox left:req, top:req, right:req, bottom:req
+	.byte 0x73
+	.byte \left
+	.byte \top
+	.byte \right
+	.byte \bottom
+	.endm
+
+	                                                            
+	.macro drawboxtext left:req, top:req, multichoiceId:req, ignoreBPress:req
+	.byte 0x74
+	.byte \left
+	.byte \top
+	.byte \multichoiceId
+	.byte \ignoreBPress
+	.endm
+
+	                                                                                                 
+	.macro showmonpic species:req, x:req, y:req
+	.byte 0x75
+	.2byte \species
+	.byte \x
+	.byte \y
+	.endm
+
+	                                        
+	.macro hidemonpic
+	.byte 0x76
+	.endm
+
+	                                                                                                                                 
+	.macro showcontestpainting winnerId:req
+	.byte 0x77
+	.byte \winnerId
+	.endm
+
+	                                                                                                                   
+	                                                                                                                    
+	                                                                                                   
+	.macro braillemessage text:req
+	.byte 0x78
+	.4byte \text
+	.endm
+
+	                                                                                                
+	.macro brailleformat winLeft:req, winTop:req, winRight:req, winBottom:req, textLeft:req, textTop:req
+	.byte \winLeft
+	.byte \winTop
+	.byte \winRight
+	.byte \winBottom
+	.byte \textLeft
+	.byte \textTop
+	.endm
+
+	                                                                                                                                    
+	                                                                                                            
+	.macro givemon species:req, level:req, item=ITEM_NONE
+	.byte 0x79
+	.2byte \species
+	.byte \level
+	.2byte \item
+	.4byte 0
+	.4byte 0
+	.byte 0
+	.endm
+
+	                                                   
+	                                                                                                            
+	.macro giveegg species:req
+	.byte 0x7a
+	.2byte \species
+	.endm
+
+	                                                                                                            
+	                                                                                                                
+	                                                                                                   
+	.macro setmonmove partyIndex:req, slot:req, move:req
+	.byte 0x7b
+	.byte \partyIndex
+	.byte \slot
+	.2byte \move
+	.endm
+
+	                                                                                                                
+	                                                                                                               
+	                                                   
+	.macro checkpartymove move:req
+	.byte 0x7c
+	.2byte \move
+	.endm
+
+	                                                                                                             
+	                                                    
+	                                                                                                           
+	                                                                                                       
+	.macro stringvar id:req
+	.if \id == STR_VAR_1
+		.byte 0
+	.elseif \id == STR_VAR_2
+		.byte 1
+	.elseif \id == STR_VAR_3
+		.byte 2
+	.else
+		.byte \id
+	.endif
+	.endm
+
+	                                                                       
+	.macro bufferspeciesname stringVarId:req, species:req
+	.byte 0x7d
+	stringvar \stringVarId
+	.2byte \species
+	.endm
+
+	                                                                                                    
+	.macro bufferleadmonspeciesname stringVarId:req
+	.byte 0x7e
+	stringvar \stringVarId
+	.endm
+
+	                                                                                                            
+	                                                                                      
+	.macro bufferpartymonnick stringVarId:req, slot:req
+	.byte 0x7f
+	stringvar \stringVarId
+	.2byte \slot
+	.endm
+
+	                                                                                             
+	                                                              
+	.macro bufferitemname stringVarId:req, item:req
+	.byte 0x80
+	stringvar \stringVarId
+	.2byte \item
+	.endm
+
+	                                                                                                              
+	.macro bufferdecorationname stringVarId:req, decoration:req
+	.byte 0x81
+	stringvar \stringVarId
+	.2byte \decoration
+	.endm
+
+	                                                                
+	.macro buffermovename stringVarId:req, move:req
+	.byte 0x82
+	stringvar \stringVarId
+	.2byte \move
+	.endm
+
+	                                                                                                  
+	.macro buffernumberstring stringVarId:req, input:req
+	.byte 0x83
+	stringvar \stringVarId
+	.2byte \input
+	.endm
+
+	                                                                                                                 
+	.macro bufferstdstring stringVarId:req, index:req
+	.byte 0x84
+	stringvar \stringVarId
+	.2byte \index
+	.endm
+
+	                                                                 
+	.macro bufferstring stringVarId:req, text:req
+	.byte 0x85
+	stringvar \stringVarId
+	.4byte \text
+	.endm
+
+	                                                                      
+	                                                                         
+	.macro pokemart products:req
+	.byte 0x86
+	.4byte \products
+	.endm
+
+	                                                                        
+	                                                                               
+	.macro pokemartdecoration products:req
+	.byte 0x87
+	.4byte \products
+	.endm
+
+	                                                                                                               
+	.macro pokemartdecoration2 products:req
+	.byte 0x88
+	.4byte \products
+	.endm
+
+	                                                                                                                           
+	.macro playslotmachine id:req
+	.byte 0x89
+	.2byte \id
+	.endm
+
+	                                                                                     
+	.macro setberrytree treeId:req, berry:req, growthStage:req
+	.byte 0x8a
+	.byte \treeId
+	.byte \berry
+	.byte \growthStage
+	.endm
+
+	                                                                                                 
+	.macro choosecontestmon
+	.byte 0x8b
+	.endm
+
+	                                                                                
+	.macro startcontest
+	.byte 0x8c
+	.endm
+
+	                                                                                
+	.macro showcontestresults
+	.byte 0x8d
+	.endm
+
+	                                                                                            
+	.macro contestlinktransfer
+	.byte 0x8e
+	.endm
+
+	                                                                                 
+	.macro random limit:req
+	.byte 0x8f
+	.2byte \limit
+	.endm
+
+	                                                                                                                           
+	                                                                       
+	.macro addmoney value:req, disable=0
+	.byte 0x90
+	.4byte \value
+	.byte \disable
+	.endm
+
+	                                                                                                              
+	                                                                       
+	.macro removemoney value:req, disable=0
+	.byte 0x91
+	.4byte \value
+	.byte \disable
+	.endm
+
+	                                                                                                                             
+	                                                                       
+	.macro checkmoney value:req, disable=0
+	.byte 0x92
+	.4byte \value
+	.byte \disable
+	.endm
+
+	                                                         
+	                                                                       
+	.macro showmoneybox x:req, y:req, disable=0
+	.byte 0x93
+	.byte \x
+	.byte \y
+	.byte \disable
+	.endm
+
+	                                                                                                    
+	.macro hidemoneybox
+	.byte 0x94
+	.byte 0      
+	.byte 0      
+	.endm
+
+	                                                                                                   
+	                                                                       
+	.macro updatemoneybox disable=0
+	.byte 0x95
+	.byte 0      
+	.byte 0      
+	.byte \disable
+	.endm
+
+	                                                                                                                
+	.macro getpokenewsactive newsKind:req
+	.byte 0x96
+	.2byte \newsKind
+	.endm
+
+	                                                                                      
+	.macro fadescreen mode:req
+	.byte 0x97
+	.byte \mode
+	.endm
+
+	                                                                                      
+	.macro fadescreenspeed mode:req, speed:req
+	.byte 0x98
+	.byte \mode
+	.byte \speed
+	.endm
+
+	                                                                                                       
+	                                                                 
+	.macro setflashlevel level:req
+	.byte 0x99
+	.2byte \level
+	.endm
+
+	                                                                                                 
+	                                                                                                                   
+	.macro animateflash level:req
+	.byte 0x9a
+	.byte \level
+	.endm
+
+	                                                                                      
+	.macro messageautoscroll text:req
+	.byte 0x9b
+	.4byte \text
+	.endm
+
+	                                                           
+	.macro dofieldeffect animation:req
+	.byte 0x9c
+	.2byte \animation
+	.endm
+
+	                                                              
+	.macro setfieldeffectargument argNum:req, value:req
+	.byte 0x9d
+	.byte \argNum
+	.2byte \value
+	.endm
+
+	                                                                             
+	.macro waitfieldeffect animation:req
+	.byte 0x9e
+	.2byte \animation
+	.endm
+
+	                                                                                                
+	.macro setrespawn heallocation:req
+	.byte 0x9f
+	.2byte \heallocation
+	.endm
+
+	                                                                                       
+	.macro checkplayergender
+	.byte 0xa0
+	.endm
+
+	                                                                      
+	                                                                          
+	.macro playmoncry species:req, mode:req
+	.byte 0xa1
+	.2byte \species
+	.2byte \mode
+	.endm
+
+	                                                                                        
+	.macro setmetatile x:req, y:req, metatileId:req, impassable:req
+	.byte 0xa2
+	.2byte \x
+	.2byte \y
+	.2byte \metatileId
+	.2byte \impassable
+	.endm
+
+	                                                             
+	.macro resetweather
+	.byte 0xa3
+	.endm
+
+	                                          
+	.macro setweather type:req
+	.byte 0xa4
+	.2byte \type
+	.endm
+
+	                                                                                                                                     
+	.macro doweather
+	.byte 0xa5
+	.endm
+
+	                                                                                                                               
+	.macro setstepcallback stepCbId:req
+	.byte 0xa6
+	.byte \stepCbId
+	.endm
+
+	                                                                       
+	                                                                                             
+	.macro setmaplayoutindex index:req
+	.byte 0xa7
+	.2byte \index
+	.endm
+
+	                                                                                   
+	                                                          
+	.macro setobjectsubpriority localId:req, map:req, subpriority:req
+	.byte 0xa8
+	.2byte \localId
+	map \map
+	.byte \subpriority
+	.endm
+
+	                                                                                            
+	.macro resetobjectsubpriority localId:req, map:req
+	.byte 0xa9
+	.2byte \localId
+	map \map
+	.endm
+
+	                                                                                                                           
+	                                                                                   
+	.macro createvobject graphicsId:req, id:req, x:req, y:req, elevation=3, direction=DIR_SOUTH
+	.byte 0xaa
+	.byte \graphicsId
+	.byte \id
+	.2byte \x
+	.2byte \y
+	.byte \elevation
+	.byte \direction
+	.endm
+
+	                                            
+	.macro turnvobject id:req, direction:req
+	.byte 0xab
+	.byte \id
+	.byte \direction
+	.endm
+
+	                                                      
+	.macro opendoor x:req, y:req
+	.byte 0xac
+	.2byte \x
+	.2byte \y
+	.endm
+
+	                                                       
+	.macro closedoor x:req, y:req
+	.byte 0xad
+	.2byte \x
+	.2byte \y
+	.endm
+
+	                                                                            
+	.macro waitdooranim
+	.byte 0xae
+	.endm
+
+	                                                                   
+	.macro setdooropen x:req, y:req
+	.byte 0xaf
+	.2byte \x
+	.2byte \y
+	.endm
+
+	                                                                     
+	.macro setdoorclosed x:req, y:req
+	.byte 0xb0
+	.2byte \x
+	.2byte \y
+	.endm
+
+	                                                                                
+	.macro addelevmenuitem a:req, b:req, c:req, d:req
+	.byte 0xb1
+	.byte \a
+	.2byte \b
+	.2byte \c
+	.2byte \d
+	.endm
+
+	                                                                                
+	.macro showelevmenu
+	.byte 0xb2
+	.endm
+
+	                                                                              
+	.macro checkcoins out:req
+	.byte 0xb3
+	.2byte \out
+	.endm
+
+	                                                                 
+	                                                                                                   
+	.macro addcoins count:req
+	.byte 0xb4
+	.2byte \count
+	.endm
+
+	                                      
+	                                                                                                   
+	                                       
+	.macro removecoins count:req
+	.byte 0xb5
+	.2byte \count
+	.endm
+
+	                                                                                                                     
+	                                                                       
+	.macro setwildbattle species:req, level:req, item=ITEM_NONE
+	.byte 0xb6
+	.2byte \species
+	.byte \level
+	.2byte \item
+	.endm
+
+	                                                                                                                         
+	.macro dowildbattle
+	.byte 0xb7
+	.endm
+
+	                                                                                             
+	.macro setvaddress pointer:req
+	.byte 0xb8
+	.4byte \pointer
+	.endm
+
+	                                                                   
+	.macro vgoto destination:req
+	.byte 0xb9
+	.4byte \destination
+	.endm
+
+	                                                                   
+	.macro vcall destination:req
+	.byte 0xba
+	.4byte \destination
+	.endm
+
+	                                                                      
+	.macro vgoto_if condition:req, destination:req
+	.byte 0xbb
+	.byte \condition
+	.4byte \destination
+	.endm
+
+	                                                                      
+	.macro vcall_if condition:req, destination:req
+	.byte 0xbc
+	.byte \condition
+	.4byte \destination
+	.endm
+
+	                                                                      
+	.macro vmessage text:req
+	.byte 0xbd
+	.4byte \text
+	.endm
+
+	                                                                                                    
+	.macro vbuffermessage text:req
+	.byte 0xbe
+	.4byte \text
+	.endm
+
+	                                                                           
+	.macro vbufferstring stringVarIndex:req, text:req
+	.byte 0xbf
+	stringvar \stringVarIndex
+	.4byte \text
+	.endm
+
+	                                                        
+	.macro showcoinsbox x:req, y:req
+	.byte 0xc0
+	.byte \x
+	.byte \y
+	.endm
+
+	                                                                                           
+	.macro hidecoinsbox x:req, y:req
+	.byte 0xc1
+	.byte \x
+	.byte \y
+	.endm
+
+	                                                                                          
+	.macro updatecoinsbox x:req, y:req
+	.byte 0xc2
+	.byte \x
+	.byte \y
+	.endm
+
+	                                                                                                                                 
+	.macro incrementgamestat stat:req
+	.byte 0xc3
+	.byte \stat
+	.endm
+
+	                                                                                
+	                                                                                                 
+	                                                                        
+	.macro setescapewarp map:req, a, b, c
+	.byte 0xc4
+	formatwarp \map, \a, \b, \c
+	.endm
+
+	                                             
+	.macro waitmoncry
+	.byte 0xc5
+	.endm
+
+	                                                                  
+	.macro bufferboxname stringVarId:req, box:req
+	.byte 0xc6
+	stringvar \stringVarId
+	.2byte \box
+	.endm
+
+	                                                                                               
+	                                                                                               
+	.macro textcolor color:req
+	.byte 0xc7
+	.byte \color
+	.endm
+
+	                                             
+	.macro loadhelp msg:req
+	.byte 0xc8
+	.4byte \msg
+	.endm
+
+	                      
+	.macro unloadhelp
+	.byte 0xc9
+	.endm
+
+	                                                                                   
+	.macro signmsg
+	.byte 0xca
+	.endm
+
+	                                                                      
+	.macro normalmsg
+	.byte 0xcb
+	.endm
+
+	                                                                                    
+	                                                                                                   
+	.macro comparestat statId:req, value:req
+	.byte 0xcc
+	.byte \statId
+	.4byte \value
+	.endm
+
+	                                                                                                  
+	.macro setmonmodernfatefulencounter slot:req
+	.byte 0xcd
+	.2byte \slot
+	.endm
+
+	                                                                                                                               
+	                                                                                                            
+	.macro checkmonmodernfatefulencounter slot:req
+	.byte 0xce
+	.2byte \slot
+	.endm
+
+	                                                                                                    
+	                                               
+	.macro trywondercardscript
+	.byte 0xcf
+	.endm
+
+	                                                                                                               
+	.macro setworldmapflag worldmapflag:req
+	.byte 0xd0
+	.2byte \worldmapflag
+	.endm
+
+	                                                                                                       
+	                                                                        
+	                                                                                                 
+	                                                                        
+	.macro warpspinenter map:req, a, b, c
+	.byte 0xd1
+	formatwarp \map, \a, \b, \c
+	.endm
+
+	                                                                                                
+	.macro setmonmetlocation slot:req, location:req
+	.byte 0xd2
+	.2byte \slot
+	.byte \location
+	.endm
+
+	                                                                                                
+	.macro getbraillestringwidth msg:req
+	.byte 0xd3
+	.4byte \msg
+	.endm
+
+	                                                                                                       
+	                                                                                                   
+	                                                                                                      
+	.macro bufferitemnameplural stringVarId:req, item:req, quantity:req
+	.byte 0xd4
+	stringvar \stringVarId
+	.2byte \item
+	.2byte \quantity
+	.endm
+
+
+               
+
+	.macro goto_if_unset flag:req, dest:req
+	checkflag \flag
+	goto_if FALSE, \dest
+	.endm
+
+	.macro goto_if_set flag:req, dest:req
+	checkflag \flag
+	goto_if TRUE, \dest
+	.endm
+
+	                                                                                              
+	                                                                            
+	                          
+	                     
+	        
+	                                       
+	 
+	                                                                                              
+	                                                         
+	                                                                                                   
+	                                                                                                   
+	.macro trycompare jump:req, condition:req, a:req, b, c
+	.ifnb \c
+		compare \a, \b
+		\jump \condition, \c
+	.else
+		\jump \condition, \a
+	.endif
+	.endm
+
+	.macro goto_if_lt a:req, b, c            
+	trycompare goto_if, 0, \a, \b, \c
+	.endm
+
+	.macro goto_if_eq a:req, b, c        
+	trycompare goto_if, 1, \a, \b, \c
+	.endm
+
+	.macro goto_if_gt a:req, b, c               
+	trycompare goto_if, 2, \a, \b, \c
+	.endm
+
+	.macro goto_if_le a:req, b, c                     
+	trycompare goto_if, 3, \a, \b, \c
+	.endm
+
+	.macro goto_if_ge a:req, b, c                        
+	trycompare goto_if, 4, \a, \b, \c
+	.endm
+
+	.macro goto_if_ne a:req, b, c            
+	trycompare goto_if, 5, \a, \b, \c
+	.endm
+
+	.macro call_if_unset flag:req, dest:req
+	checkflag \flag
+	call_if FALSE, \dest
+	.endm
+
+	.macro call_if_set flag:req, dest:req
+	checkflag \flag
+	call_if TRUE, \dest
+	.endm
+
+	.macro call_if_lt a:req, b, c            
+	trycompare call_if, 0, \a, \b, \c
+	.endm
+
+	.macro call_if_eq a:req, b, c        
+	trycompare call_if, 1, \a, \b, \c
+	.endm
+
+	.macro call_if_gt a:req, b, c               
+	trycompare call_if, 2, \a, \b, \c
+	.endm
+
+	.macro call_if_le a:req, b, c                     
+	trycompare call_if, 3, \a, \b, \c
+	.endm
+
+	.macro call_if_ge a:req, b, c                        
+	trycompare call_if, 4, \a, \b, \c
+	.endm
+
+	.macro call_if_ne a:req, b, c            
+	trycompare call_if, 5, \a, \b, \c
+	.endm
+
+	.macro vgoto_if_eq a:req, b, c
+	trycompare vgoto_if, TRUE, \a, \b, \c
+	.endm
+
+	.macro vgoto_if_ne a:req, b, c
+	trycompare vgoto_if, FALSE, \a, \b, \c
+	.endm
+
+	.macro vgoto_if_set flag:req, dest:req
+	checkflag \flag
+	vgoto_if TRUE, \dest
+	.endm
+
+	.macro vgoto_if_unset flag:req, dest:req
+	checkflag \flag
+	vgoto_if FALSE, \dest
+	.endm
+
+	.macro goto_if_defeated trainer:req, dest:req
+	checktrainerflag \trainer
+	goto_if TRUE, \dest
+	.endm
+
+	.macro goto_if_not_defeated trainer:req, dest:req
+	checktrainerflag \trainer
+	goto_if FALSE, \dest
+	.endm
+
+	.macro call_if_defeated trainer:req, dest:req
+	checktrainerflag \trainer
+	call_if TRUE, \dest
+	.endm
+
+	.macro call_if_not_defeated trainer:req, dest:req
+	checktrainerflag \trainer
+	call_if FALSE, \dest
+	.endm
+
+	.macro switch var:req
+	copyvar VAR_0x8000, \var
+	.endm
+
+	.macro case condition:req, dest:req
+	compare VAR_0x8000, \condition
+	goto_if_eq \dest
+	.endm
+
+	YES = 1
+	NO  = 0
+
+	                                                                                          
+	.macro msgbox text:req, type=MSGBOX_DEFAULT
+	loadword 0, \text
+	callstd \type
+	.endm
+
+	                                                                                         
+	                                                                                            
+	                                                                      
+	                                                                                                
+	.macro giveitem item:req, amount=1
+	setorcopyvar VAR_0x8000, \item
+	setorcopyvar VAR_0x8001, \amount
+	callstd STD_OBTAIN_ITEM
+	.endm
+
+	                                                                                             
+	                                                                             
+	.macro finditem item:req, amount=1
+	setorcopyvar VAR_0x8000, \item
+	setorcopyvar VAR_0x8001, \amount
+	callstd STD_FIND_ITEM
+	.endm
+
+	                                                                                                           
+	.macro putitemaway item:req, amount=1
+	setorcopyvar VAR_0x8000, \item
+	setorcopyvar VAR_0x8001, \amount
+	callstd STD_PUT_ITEM_AWAY
+	.endm
+
+	                                                                                                                
+	                                                        
+	.macro msgreceiveditem msg:req, item:req, amount=1, fanfare=MUS_LEVEL_UP
+	loadword 0, \msg
+	setorcopyvar VAR_0x8000, \item
+	setorcopyvar VAR_0x8001, \amount
+	setorcopyvar VAR_0x8002, \fanfare
+	callstd STD_RECEIVED_ITEM
+	.endm
+
+	                                                                                                             
+	.macro giveitem_msg msg:req, item:req, amount=1, fanfare=MUS_LEVEL_UP
+	additem \item, \amount
+	msgreceiveditem \msg, \item, \amount, \fanfare
+	.endm
+
+	                                                                                                               
+	.macro famechecker person:req, index:req, function=SetFlavorTextFlagFromSpecialVars
+	setvar VAR_0x8004, \person
+	setvar VAR_0x8005, \index
+	special \function
+	.endm
+
+	                                                                 
+	.macro set_gym_trainers gym:req
+	setvar VAR_0x8008, \gym
+	call EventScript_SetGymTrainers
+	.endm
+
+	                                                                                                     
+	.macro goto_if_questlog dest:req
+	special GetQuestLogState
+	compare VAR_RESULT, 2
+	goto_if_eq \dest
+	.endm
+
+	                                                       
+	.macro braillemessage_wait text:req
+	setvar VAR_0x8006, 0
+	braillemessage \text
+	getbraillestringwidth \text
+	call EventScript_BrailleCursorWaitButton
+	.endm
+
+	                                                                             
+	.macro seteventmon species:req, level:req, item=ITEM_NONE
+	setvar VAR_0x8004, \species
+	setvar VAR_0x8005, \level
+	setvar VAR_0x8006, \item
+	special CreateEnemyEventMon
+	.endm
+# 13 "data/mystery_event_msg.s"
+# 1 "constants/constants.inc"
+# 1 "constants/gba_constants.inc"
+	.set PSR_USR_MODE,  0x00000010
+	.set PSR_FIQ_MODE,  0x00000011
+	.set PSR_IRQ_MODE,  0x00000012
+	.set PSR_SVC_MODE,  0x00000013
+	.set PSR_ABT_MODE,  0x00000017
+	.set PSR_UND_MODE,  0x0000001b
+	.set PSR_SYS_MODE,  0x0000001f
+	.set PSR_MODE_MASK, 0x0000001f
+	.set PSR_T_BIT,     0x00000020
+	.set PSR_F_BIT,     0x00000040
+	.set PSR_I_BIT,     0x00000080
+
+	.set EWRAM_START, 0x02000000
+	.set EWRAM_END,   EWRAM_START + 0x40000
+	.set IWRAM_START, 0x03000000
+	.set IWRAM_END,   IWRAM_START + 0x8000
+
+	.set PLTT,     0x5000000
+	.set BG_PLTT,  PLTT
+	.set OBJ_PLTT, PLTT + 0x200
+
+	.set VRAM,      0x6000000
+	.set BG_VRAM,   VRAM
+	.set OBJ_VRAM0, VRAM + 0x10000               
+	.set OBJ_VRAM1, VRAM + 0x14000                 
+
+	.set OAM, 0x7000000
+
+	.set SOUND_INFO_PTR, 0x3007FF0
+	.set INTR_CHECK,     0x3007FF8
+	.set INTR_VECTOR,    0x3007FFC
+
+	.set INTR_FLAG_VBLANK,  1 << 0
+	.set INTR_FLAG_HBLANK,  1 << 1
+	.set INTR_FLAG_VCOUNT,  1 << 2
+	.set INTR_FLAG_TIMER0,  1 << 3
+	.set INTR_FLAG_TIMER1,  1 << 4
+	.set INTR_FLAG_TIMER2,  1 << 5
+	.set INTR_FLAG_TIMER3,  1 << 6
+	.set INTR_FLAG_SERIAL,  1 << 7
+	.set INTR_FLAG_DMA0,    1 << 8
+	.set INTR_FLAG_DMA1,    1 << 9
+	.set INTR_FLAG_DMA2,    1 << 10
+	.set INTR_FLAG_DMA3,    1 << 11
+	.set INTR_FLAG_KEYPAD,  1 << 12
+	.set INTR_FLAG_GAMEPAK, 1 << 13
+
+	.set VCOUNT_VBLANK, 160
+	.set TOTAL_SCANLINES, 228
+
+	.set REG_BASE, 0x4000000                            
+
+                      
+	.set OFFSET_REG_DISPCNT,     0x0
+	.set OFFSET_REG_DISPSTAT,    0x4
+	.set OFFSET_REG_VCOUNT,      0x6
+	.set OFFSET_REG_BG0CNT,      0x8
+	.set OFFSET_REG_BG1CNT,      0xa
+	.set OFFSET_REG_BG2CNT,      0xc
+	.set OFFSET_REG_BG3CNT,      0xe
+	.set OFFSET_REG_BG0HOFS,     0x10
+	.set OFFSET_REG_BG0VOFS,     0x12
+	.set OFFSET_REG_BG1HOFS,     0x14
+	.set OFFSET_REG_BG1VOFS,     0x16
+	.set OFFSET_REG_BG2HOFS,     0x18
+	.set OFFSET_REG_BG2VOFS,     0x1a
+	.set OFFSET_REG_BG3HOFS,     0x1c
+	.set OFFSET_REG_BG3VOFS,     0x1e
+	.set OFFSET_REG_BG2PA,       0x20
+	.set OFFSET_REG_BG2PB,       0x22
+	.set OFFSET_REG_BG2PC,       0x24
+	.set OFFSET_REG_BG2PD,       0x26
+	.set OFFSET_REG_BG2X_L,      0x28
+	.set OFFSET_REG_BG2X_H,      0x2a
+	.set OFFSET_REG_BG2Y_L,      0x2c
+	.set OFFSET_REG_BG2Y_H,      0x2e
+	.set OFFSET_REG_BG3PA,       0x30
+	.set OFFSET_REG_BG3PB,       0x32
+	.set OFFSET_REG_BG3PC,       0x34
+	.set OFFSET_REG_BG3PD,       0x36
+	.set OFFSET_REG_BG3X_L,      0x38
+	.set OFFSET_REG_BG3X_H,      0x3a
+	.set OFFSET_REG_BG3Y_L,      0x3c
+	.set OFFSET_REG_BG3Y_H,      0x3e
+	.set OFFSET_REG_WIN0H,       0x40
+	.set OFFSET_REG_WIN1H,       0x42
+	.set OFFSET_REG_WIN0V,       0x44
+	.set OFFSET_REG_WIN1V,       0x46
+	.set OFFSET_REG_WININ,       0x48
+	.set OFFSET_REG_WINOUT,      0x4a
+	.set OFFSET_REG_MOSAIC,      0x4c
+	.set OFFSET_REG_BLDCNT,      0x50
+	.set OFFSET_REG_BLDALPHA,    0x52
+	.set OFFSET_REG_BLDY,        0x54
+
+	.set OFFSET_REG_SOUND1CNT,   0x60
+	.set OFFSET_REG_SOUND1CNT_L, 0x60
+	.set OFFSET_REG_NR10,        0x60
+	.set OFFSET_REG_SOUND1CNT_H, 0x62
+	.set OFFSET_REG_NR11,        0x62
+	.set OFFSET_REG_NR12,        0x63
+	.set OFFSET_REG_SOUND1CNT_X, 0x64
+	.set OFFSET_REG_NR13,        0x64
+	.set OFFSET_REG_NR14,        0x65
+	.set OFFSET_REG_SOUND2CNT,   0x68
+	.set OFFSET_REG_SOUND2CNT_L, 0x68
+	.set OFFSET_REG_NR21,        0x68
+	.set OFFSET_REG_NR22,        0x69
+	.set OFFSET_REG_SOUND2CNT_H, 0x6c
+	.set OFFSET_REG_NR23,        0x6c
+	.set OFFSET_REG_NR24,        0x6d
+	.set OFFSET_REG_SOUND3CNT,   0x70
+	.set OFFSET_REG_SOUND3CNT_L, 0x70
+	.set OFFSET_REG_NR30,        0x70
+	.set OFFSET_REG_SOUND3CNT_H, 0x72
+	.set OFFSET_REG_NR31,        0x72
+	.set OFFSET_REG_NR32,        0x73
+	.set OFFSET_REG_SOUND3CNT_X, 0x74
+	.set OFFSET_REG_NR33,        0x74
+	.set OFFSET_REG_NR34,        0x75
+	.set OFFSET_REG_SOUND4CNT,   0x78
+	.set OFFSET_REG_SOUND4CNT_L, 0x78
+	.set OFFSET_REG_NR41,        0x78
+	.set OFFSET_REG_NR42,        0x79
+	.set OFFSET_REG_SOUND4CNT_H, 0x7c
+	.set OFFSET_REG_NR43,        0x7c
+	.set OFFSET_REG_NR44,        0x7d
+	.set OFFSET_REG_SOUNDCNT,    0x80
+	.set OFFSET_REG_SOUNDCNT_L,  0x80
+	.set OFFSET_REG_NR50,        0x80
+	.set OFFSET_REG_NR51,        0x81
+	.set OFFSET_REG_SOUNDCNT_H,  0x82
+	.set OFFSET_REG_SOUNDCNT_X,  0x84
+	.set OFFSET_REG_NR52,        0x84
+	.set OFFSET_REG_SOUNDBIAS,   0x88
+	.set OFFSET_REG_WAVE_RAM,    0x90
+	.set OFFSET_REG_WAVE_RAM0,   0x90
+	.set OFFSET_REG_WAVE_RAM0_L, 0x90
+	.set OFFSET_REG_WAVE_RAM0_H, 0x92
+	.set OFFSET_REG_WAVE_RAM1,   0x94
+	.set OFFSET_REG_WAVE_RAM1_L, 0x94
+	.set OFFSET_REG_WAVE_RAM1_H, 0x96
+	.set OFFSET_REG_WAVE_RAM2,   0x98
+	.set OFFSET_REG_WAVE_RAM2_L, 0x98
+	.set OFFSET_REG_WAVE_RAM2_H, 0x9a
+	.set OFFSET_REG_WAVE_RAM3,   0x9c
+	.set OFFSET_REG_WAVE_RAM3_L, 0x9c
+	.set OFFSET_REG_WAVE_RAM3_H, 0x9e
+	.set OFFSET_REG_FIFO,        0xa0
+	.set OFFSET_REG_FIFO_A,      0xa0
+	.set OFFSET_REG_FIFO_A_L,    0xa0
+	.set OFFSET_REG_FIFO_A_H,    0xa2
+	.set OFFSET_REG_FIFO_B,      0xa4
+	.set OFFSET_REG_FIFO_B_L,    0xa4
+	.set OFFSET_REG_FIFO_B_H,    0xa6
+
+	.set OFFSET_REG_DMA0,        0xb0
+	.set OFFSET_REG_DMA0SAD,     0xb0
+	.set OFFSET_REG_DMA0SAD_L,   0xb0
+	.set OFFSET_REG_DMA0SAD_H,   0xb2
+	.set OFFSET_REG_DMA0DAD,     0xb4
+	.set OFFSET_REG_DMA0DAD_L,   0xb4
+	.set OFFSET_REG_DMA0DAD_H,   0xb6
+	.set OFFSET_REG_DMA0CNT,     0xb8
+	.set OFFSET_REG_DMA0CNT_L,   0xb8
+	.set OFFSET_REG_DMA0CNT_H,   0xba
+	.set OFFSET_REG_DMA1,        0xbc
+	.set OFFSET_REG_DMA1SAD,     0xbc
+	.set OFFSET_REG_DMA1SAD_L,   0xbc
+	.set OFFSET_REG_DMA1SAD_H,   0xbe
+	.set OFFSET_REG_DMA1DAD,     0xc0
+	.set OFFSET_REG_DMA1DAD_L,   0xc0
+	.set OFFSET_REG_DMA1DAD_H,   0xc2
+	.set OFFSET_REG_DMA1CNT,     0xc4
+	.set OFFSET_REG_DMA1CNT_L,   0xc4
+	.set OFFSET_REG_DMA1CNT_H,   0xc6
+	.set OFFSET_REG_DMA2,        0xc8
+	.set OFFSET_REG_DMA2SAD,     0xc8
+	.set OFFSET_REG_DMA2SAD_L,   0xc8
+	.set OFFSET_REG_DMA2SAD_H,   0xca
+	.set OFFSET_REG_DMA2DAD,     0xcc
+	.set OFFSET_REG_DMA2DAD_L,   0xcc
+	.set OFFSET_REG_DMA2DAD_H,   0xce
+	.set OFFSET_REG_DMA2CNT,     0xd0
+	.set OFFSET_REG_DMA2CNT_L,   0xd0
+	.set OFFSET_REG_DMA2CNT_H,   0xd2
+	.set OFFSET_REG_DMA3,        0xd4
+	.set OFFSET_REG_DMA3SAD,     0xd4
+	.set OFFSET_REG_DMA3SAD_L,   0xd4
+	.set OFFSET_REG_DMA3SAD_H,   0xd6
+	.set OFFSET_REG_DMA3DAD,     0xd8
+	.set OFFSET_REG_DMA3DAD_L,   0xd8
+	.set OFFSET_REG_DMA3DAD_H,   0xda
+	.set OFFSET_REG_DMA3CNT,     0xdc
+	.set OFFSET_REG_DMA3CNT_L,   0xdc
+	.set OFFSET_REG_DMA3CNT_H,   0xde
+
+	.set OFFSET_REG_TM0CNT,      0x100
+	.set OFFSET_REG_TM0CNT_L,    0x100
+	.set OFFSET_REG_TM0CNT_H,    0x102
+	.set OFFSET_REG_TM1CNT,      0x104
+	.set OFFSET_REG_TM1CNT_L,    0x104
+	.set OFFSET_REG_TM1CNT_H,    0x106
+	.set OFFSET_REG_TM2CNT,      0x108
+	.set OFFSET_REG_TM2CNT_L,    0x108
+	.set OFFSET_REG_TM2CNT_H,    0x10a
+	.set OFFSET_REG_TM3CNT,      0x10c
+	.set OFFSET_REG_TM3CNT_L,    0x10c
+	.set OFFSET_REG_TM3CNT_H,    0x10e
+
+	.set OFFSET_REG_SIOCNT,      0x128
+	.set OFFSET_REG_SIODATA8,    0x12a
+	.set OFFSET_REG_SIODATA32,   0x120
+	.set OFFSET_REG_SIOMLT_SEND, 0x12a
+	.set OFFSET_REG_SIOMLT_RECV, 0x120
+	.set OFFSET_REG_SIOMULTI0,   0x120
+	.set OFFSET_REG_SIOMULTI1,   0x122
+	.set OFFSET_REG_SIOMULTI2,   0x124
+	.set OFFSET_REG_SIOMULTI3,   0x126
+
+	.set OFFSET_REG_KEYINPUT,    0x130
+	.set OFFSET_REG_KEYCNT,      0x132
+
+	.set OFFSET_REG_RCNT,        0x134
+
+	.set OFFSET_REG_JOYCNT,      0x140
+	.set OFFSET_REG_JOYSTAT,     0x158
+	.set OFFSET_REG_JOY_RECV,    0x150
+	.set OFFSET_REG_JOY_RECV_L,  0x150
+	.set OFFSET_REG_JOY_RECV_H,  0x152
+	.set OFFSET_REG_JOY_TRANS,   0x154
+	.set OFFSET_REG_JOY_TRANS_L, 0x154
+	.set OFFSET_REG_JOY_TRANS_H, 0x156
+
+	.set OFFSET_REG_IME,         0x208
+	.set OFFSET_REG_IE,          0x200
+	.set OFFSET_REG_IF,          0x202
+
+	.set OFFSET_REG_WAITCNT,     0x204
+
+                        
+	.set REG_DISPCNT,     REG_BASE + OFFSET_REG_DISPCNT
+	.set REG_DISPSTAT,    REG_BASE + OFFSET_REG_DISPSTAT
+	.set REG_VCOUNT,      REG_BASE + OFFSET_REG_VCOUNT
+	.set REG_BG0CNT,      REG_BASE + OFFSET_REG_BG0CNT
+	.set REG_BG1CNT,      REG_BASE + OFFSET_REG_BG1CNT
+	.set REG_BG2CNT,      REG_BASE + OFFSET_REG_BG2CNT
+	.set REG_BG3CNT,      REG_BASE + OFFSET_REG_BG3CNT
+	.set REG_BG0HOFS,     REG_BASE + OFFSET_REG_BG0HOFS
+	.set REG_BG0VOFS,     REG_BASE + OFFSET_REG_BG0VOFS
+	.set REG_BG1HOFS,     REG_BASE + OFFSET_REG_BG1HOFS
+	.set REG_BG1VOFS,     REG_BASE + OFFSET_REG_BG1VOFS
+	.set REG_BG2HOFS,     REG_BASE + OFFSET_REG_BG2HOFS
+	.set REG_BG2VOFS,     REG_BASE + OFFSET_REG_BG2VOFS
+	.set REG_BG3HOFS,     REG_BASE + OFFSET_REG_BG3HOFS
+	.set REG_BG3VOFS,     REG_BASE + OFFSET_REG_BG3VOFS
+	.set REG_BG2PA,       REG_BASE + OFFSET_REG_BG2PA
+	.set REG_BG2PB,       REG_BASE + OFFSET_REG_BG2PB
+	.set REG_BG2PC,       REG_BASE + OFFSET_REG_BG2PC
+	.set REG_BG2PD,       REG_BASE + OFFSET_REG_BG2PD
+	.set REG_BG2X_L,      REG_BASE + OFFSET_REG_BG2X_L
+	.set REG_BG2X_H,      REG_BASE + OFFSET_REG_BG2X_H
+	.set REG_BG2Y_L,      REG_BASE + OFFSET_REG_BG2Y_L
+	.set REG_BG2Y_H,      REG_BASE + OFFSET_REG_BG2Y_H
+	.set REG_BG3PA,       REG_BASE + OFFSET_REG_BG3PA
+	.set REG_BG3PB,       REG_BASE + OFFSET_REG_BG3PB
+	.set REG_BG3PC,       REG_BASE + OFFSET_REG_BG3PC
+	.set REG_BG3PD,       REG_BASE + OFFSET_REG_BG3PD
+	.set REG_BG3X_L,      REG_BASE + OFFSET_REG_BG3X_L
+	.set REG_BG3X_H,      REG_BASE + OFFSET_REG_BG3X_H
+	.set REG_BG3Y_L,      REG_BASE + OFFSET_REG_BG3Y_L
+	.set REG_BG3Y_H,      REG_BASE + OFFSET_REG_BG3Y_H
+	.set REG_WIN0H,       REG_BASE + OFFSET_REG_WIN0H
+	.set REG_WIN1H,       REG_BASE + OFFSET_REG_WIN1H
+	.set REG_WIN0V,       REG_BASE + OFFSET_REG_WIN0V
+	.set REG_WIN1V,       REG_BASE + OFFSET_REG_WIN1V
+	.set REG_WININ,       REG_BASE + OFFSET_REG_WININ
+	.set REG_WINOUT,      REG_BASE + OFFSET_REG_WINOUT
+	.set REG_MOSAIC,      REG_BASE + OFFSET_REG_MOSAIC
+	.set REG_BLDCNT,      REG_BASE + OFFSET_REG_BLDCNT
+	.set REG_BLDALPHA,    REG_BASE + OFFSET_REG_BLDALPHA
+	.set REG_BLDY,        REG_BASE + OFFSET_REG_BLDY
+
+	.set REG_SOUND1CNT,   REG_BASE + OFFSET_REG_SOUND1CNT
+	.set REG_SOUND1CNT_L, REG_BASE + OFFSET_REG_SOUND1CNT_L
+	.set REG_NR10,        REG_BASE + OFFSET_REG_NR10
+	.set REG_SOUND1CNT_H, REG_BASE + OFFSET_REG_SOUND1CNT_H
+	.set REG_NR11,        REG_BASE + OFFSET_REG_NR11
+	.set REG_NR12,        REG_BASE + OFFSET_REG_NR12
+	.set REG_SOUND1CNT_X, REG_BASE + OFFSET_REG_SOUND1CNT_X
+	.set REG_NR13,        REG_BASE + OFFSET_REG_NR13
+	.set REG_NR14,        REG_BASE + OFFSET_REG_NR14
+	.set REG_SOUND2CNT,   REG_BASE + OFFSET_REG_SOUND2CNT
+	.set REG_SOUND2CNT_L, REG_BASE + OFFSET_REG_SOUND2CNT_L
+	.set REG_NR21,        REG_BASE + OFFSET_REG_NR21
+	.set REG_NR22,        REG_BASE + OFFSET_REG_NR22
+	.set REG_SOUND2CNT_H, REG_BASE + OFFSET_REG_SOUND2CNT_H
+	.set REG_NR23,        REG_BASE + OFFSET_REG_NR23
+	.set REG_NR24,        REG_BASE + OFFSET_REG_NR24
+	.set REG_SOUND3CNT,   REG_BASE + OFFSET_REG_SOUND3CNT
+	.set REG_SOUND3CNT_L, REG_BASE + OFFSET_REG_SOUND3CNT_L
+	.set REG_NR30,        REG_BASE + OFFSET_REG_NR30
+	.set REG_SOUND3CNT_H, REG_BASE + OFFSET_REG_SOUND3CNT_H
+	.set REG_NR31,        REG_BASE + OFFSET_REG_NR31
+	.set REG_NR32,        REG_BASE + OFFSET_REG_NR32
+	.set REG_SOUND3CNT_X, REG_BASE + OFFSET_REG_SOUND3CNT_X
+	.set REG_NR33,        REG_BASE + OFFSET_REG_NR33
+	.set REG_NR34,        REG_BASE + OFFSET_REG_NR34
+	.set REG_SOUND4CNT,   REG_BASE + OFFSET_REG_SOUND4CNT
+	.set REG_SOUND4CNT_L, REG_BASE + OFFSET_REG_SOUND4CNT_L
+	.set REG_NR41,        REG_BASE + OFFSET_REG_NR41
+	.set REG_NR42,        REG_BASE + OFFSET_REG_NR42
+	.set REG_SOUND4CNT_H, REG_BASE + OFFSET_REG_SOUND4CNT_H
+	.set REG_NR43,        REG_BASE + OFFSET_REG_NR43
+	.set REG_NR44,        REG_BASE + OFFSET_REG_NR44
+	.set REG_SOUNDCNT,    REG_BASE + OFFSET_REG_SOUNDCNT
+	.set REG_SOUNDCNT_L,  REG_BASE + OFFSET_REG_SOUNDCNT_L
+	.set REG_NR50,        REG_BASE + OFFSET_REG_NR50
+	.set REG_NR51,        REG_BASE + OFFSET_REG_NR51
+	.set REG_SOUNDCNT_H,  REG_BASE + OFFSET_REG_SOUNDCNT_H
+	.set REG_SOUNDCNT_X,  REG_BASE + OFFSET_REG_SOUNDCNT_X
+	.set REG_NR52,        REG_BASE + OFFSET_REG_NR52
+	.set REG_SOUNDBIAS,   REG_BASE + OFFSET_REG_SOUNDBIAS
+	.set REG_WAVE_RAM,    REG_BASE + OFFSET_REG_WAVE_RAM
+	.set REG_WAVE_RAM0,   REG_BASE + OFFSET_REG_WAVE_RAM0
+	.set REG_WAVE_RAM0_L, REG_BASE + OFFSET_REG_WAVE_RAM0_L
+	.set REG_WAVE_RAM0_H, REG_BASE + OFFSET_REG_WAVE_RAM0_H
+	.set REG_WAVE_RAM1,   REG_BASE + OFFSET_REG_WAVE_RAM1
+	.set REG_WAVE_RAM1_L, REG_BASE + OFFSET_REG_WAVE_RAM1_L
+	.set REG_WAVE_RAM1_H, REG_BASE + OFFSET_REG_WAVE_RAM1_H
+	.set REG_WAVE_RAM2,   REG_BASE + OFFSET_REG_WAVE_RAM2
+	.set REG_WAVE_RAM2_L, REG_BASE + OFFSET_REG_WAVE_RAM2_L
+	.set REG_WAVE_RAM2_H, REG_BASE + OFFSET_REG_WAVE_RAM2_H
+	.set REG_WAVE_RAM3,   REG_BASE + OFFSET_REG_WAVE_RAM3
+	.set REG_WAVE_RAM3_L, REG_BASE + OFFSET_REG_WAVE_RAM3_L
+	.set REG_WAVE_RAM3_H, REG_BASE + OFFSET_REG_WAVE_RAM3_H
+	.set REG_FIFO,        REG_BASE + OFFSET_REG_FIFO
+	.set REG_FIFO_A,      REG_BASE + OFFSET_REG_FIFO_A
+	.set REG_FIFO_A_L,    REG_BASE + OFFSET_REG_FIFO_A_L
+	.set REG_FIFO_A_H,    REG_BASE + OFFSET_REG_FIFO_A_H
+	.set REG_FIFO_B,      REG_BASE + OFFSET_REG_FIFO_B
+	.set REG_FIFO_B_L,    REG_BASE + OFFSET_REG_FIFO_B_L
+	.set REG_FIFO_B_H,    REG_BASE + OFFSET_REG_FIFO_B_H
+
+	.set REG_DMA0,        REG_BASE + OFFSET_REG_DMA0
+	.set REG_DMA0SAD,     REG_BASE + OFFSET_REG_DMA0SAD
+	.set REG_DMA0SAD_L,   REG_BASE + OFFSET_REG_DMA0SAD_L
+	.set REG_DMA0SAD_H,   REG_BASE + OFFSET_REG_DMA0SAD_H
+	.set REG_DMA0DAD,     REG_BASE + OFFSET_REG_DMA0DAD
+	.set REG_DMA0DAD_L,   REG_BASE + OFFSET_REG_DMA0DAD_L
+	.set REG_DMA0DAD_H,   REG_BASE + OFFSET_REG_DMA0DAD_H
+	.set REG_DMA0CNT,     REG_BASE + OFFSET_REG_DMA0CNT
+	.set REG_DMA0CNT_L,   REG_BASE + OFFSET_REG_DMA0CNT_L
+	.set REG_DMA0CNT_H,   REG_BASE + OFFSET_REG_DMA0CNT_H
+	.set REG_DMA1,        REG_BASE + OFFSET_REG_DMA1
+	.set REG_DMA1SAD,     REG_BASE + OFFSET_REG_DMA1SAD
+	.set REG_DMA1SAD_L,   REG_BASE + OFFSET_REG_DMA1SAD_L
+	.set REG_DMA1SAD_H,   REG_BASE + OFFSET_REG_DMA1SAD_H
+	.set REG_DMA1DAD,     REG_BASE + OFFSET_REG_DMA1DAD
+	.set REG_DMA1DAD_L,   REG_BASE + OFFSET_REG_DMA1DAD_L
+	.set REG_DMA1DAD_H,   REG_BASE + OFFSET_REG_DMA1DAD_H
+	.set REG_DMA1CNT,     REG_BASE + OFFSET_REG_DMA1CNT
+	.set REG_DMA1CNT_L,   REG_BASE + OFFSET_REG_DMA1CNT_L
+	.set REG_DMA1CNT_H,   REG_BASE + OFFSET_REG_DMA1CNT_H
+	.set REG_DMA2,        REG_BASE + OFFSET_REG_DMA2
+	.set REG_DMA2SAD,     REG_BASE + OFFSET_REG_DMA2SAD
+	.set REG_DMA2SAD_L,   REG_BASE + OFFSET_REG_DMA2SAD_L
+	.set REG_DMA2SAD_H,   REG_BASE + OFFSET_REG_DMA2SAD_H
+	.set REG_DMA2DAD,     REG_BASE + OFFSET_REG_DMA2DAD
+	.set REG_DMA2DAD_L,   REG_BASE + OFFSET_REG_DMA2DAD_L
+	.set REG_DMA2DAD_H,   REG_BASE + OFFSET_REG_DMA2DAD_H
+	.set REG_DMA2CNT,     REG_BASE + OFFSET_REG_DMA2CNT
+	.set REG_DMA2CNT_L,   REG_BASE + OFFSET_REG_DMA2CNT_L
+	.set REG_DMA2CNT_H,   REG_BASE + OFFSET_REG_DMA2CNT_H
+	.set REG_DMA3,        REG_BASE + OFFSET_REG_DMA3
+	.set REG_DMA3SAD,     REG_BASE + OFFSET_REG_DMA3SAD
+	.set REG_DMA3SAD_L,   REG_BASE + OFFSET_REG_DMA3SAD_L
+	.set REG_DMA3SAD_H,   REG_BASE + OFFSET_REG_DMA3SAD_H
+	.set REG_DMA3DAD,     REG_BASE + OFFSET_REG_DMA3DAD
+	.set REG_DMA3DAD_L,   REG_BASE + OFFSET_REG_DMA3DAD_L
+	.set REG_DMA3DAD_H,   REG_BASE + OFFSET_REG_DMA3DAD_H
+	.set REG_DMA3CNT,     REG_BASE + OFFSET_REG_DMA3CNT
+	.set REG_DMA3CNT_L,   REG_BASE + OFFSET_REG_DMA3CNT_L
+	.set REG_DMA3CNT_H,   REG_BASE + OFFSET_REG_DMA3CNT_H
+
+	.set REG_TM0CNT,      REG_BASE + OFFSET_REG_TM0CNT
+	.set REG_TM0CNT_L,    REG_BASE + OFFSET_REG_TM0CNT_L
+	.set REG_TM0CNT_H,    REG_BASE + OFFSET_REG_TM0CNT_H
+	.set REG_TM1CNT,      REG_BASE + OFFSET_REG_TM1CNT
+	.set REG_TM1CNT_L,    REG_BASE + OFFSET_REG_TM1CNT_L
+	.set REG_TM1CNT_H,    REG_BASE + OFFSET_REG_TM1CNT_H
+	.set REG_TM2CNT,      REG_BASE + OFFSET_REG_TM2CNT
+	.set REG_TM2CNT_L,    REG_BASE + OFFSET_REG_TM2CNT_L
+	.set REG_TM2CNT_H,    REG_BASE + OFFSET_REG_TM2CNT_H
+	.set REG_TM3CNT,      REG_BASE + OFFSET_REG_TM3CNT
+	.set REG_TM3CNT_L,    REG_BASE + OFFSET_REG_TM3CNT_L
+	.set REG_TM3CNT_H,    REG_BASE + OFFSET_REG_TM3CNT_H
+
+	.set REG_SIOCNT,      REG_BASE + OFFSET_REG_SIOCNT
+	.set REG_SIODATA8,    REG_BASE + OFFSET_REG_SIODATA8
+	.set REG_SIODATA32,   REG_BASE + OFFSET_REG_SIODATA32
+	.set REG_SIOMLT_SEND, REG_BASE + OFFSET_REG_SIOMLT_SEND
+	.set REG_SIOMLT_RECV, REG_BASE + OFFSET_REG_SIOMLT_RECV
+	.set REG_SIOMULTI0,   REG_BASE + OFFSET_REG_SIOMULTI0
+	.set REG_SIOMULTI1,   REG_BASE + OFFSET_REG_SIOMULTI1
+	.set REG_SIOMULTI2,   REG_BASE + OFFSET_REG_SIOMULTI2
+	.set REG_SIOMULTI3,   REG_BASE + OFFSET_REG_SIOMULTI3
+
+	.set REG_KEYINPUT,    REG_BASE + OFFSET_REG_KEYINPUT
+	.set REG_KEYCNT,      REG_BASE + OFFSET_REG_KEYCNT
+
+	.set REG_RCNT,        REG_BASE + OFFSET_REG_RCNT
+
+	.set REG_JOYCNT,      REG_BASE + OFFSET_REG_JOYCNT
+	.set REG_JOYSTAT,     REG_BASE + OFFSET_REG_JOYSTAT
+	.set REG_JOY_RECV,    REG_BASE + OFFSET_REG_JOY_RECV
+	.set REG_JOY_RECV_L,  REG_BASE + OFFSET_REG_JOY_RECV_L
+	.set REG_JOY_RECV_H,  REG_BASE + OFFSET_REG_JOY_RECV_H
+	.set REG_JOY_TRANS,   REG_BASE + OFFSET_REG_JOY_TRANS
+	.set REG_JOY_TRANS_L, REG_BASE + OFFSET_REG_JOY_TRANS_L
+	.set REG_JOY_TRANS_H, REG_BASE + OFFSET_REG_JOY_TRANS_H
+
+	.set REG_IME,         REG_BASE + OFFSET_REG_IME
+	.set REG_IE,          REG_BASE + OFFSET_REG_IE
+	.set REG_IF,          REG_BASE + OFFSET_REG_IF
+
+	.set REG_WAITCNT,     REG_BASE + OFFSET_REG_WAITCNT
+
+                        
+
+	.set DMA_DEST_INC,      0x0000
+	.set DMA_DEST_DEC,      0x0020
+	.set DMA_DEST_FIXED,    0x0040
+	.set DMA_DEST_RELOAD,   0x0060
+	.set DMA_SRC_INC,       0x0000
+	.set DMA_SRC_DEC,       0x0080
+	.set DMA_SRC_FIXED,     0x0100
+	.set DMA_REPEAT,        0x0200
+	.set DMA_16BIT,         0x0000
+	.set DMA_32BIT,         0x0400
+	.set DMA_DREQ_ON,       0x0800
+	.set DMA_START_NOW,     0x0000
+	.set DMA_START_VBLANK,  0x1000
+	.set DMA_START_HBLANK,  0x2000
+	.set DMA_START_SPECIAL, 0x3000
+	.set DMA_INTR_ENABLE,   0x4000
+	.set DMA_ENABLE,        0x8000
+
+                         
+
+	.set OAM_OBJ_NORMAL,         0x00000000
+	.set OAM_OBJ_BLEND,          0x00000400
+	.set OAM_OBJ_WINDOW,         0x00000800
+
+	.set OAM_AFFINE_NONE,        0x00000000
+	.set OAM_AFFINE_NORMAL_SIZE, 0x00000100
+	.set OAM_OBJ_DISABLED,       0x00000200
+	.set OAM_AFFINE_DOUBLE_SIZE, 0x00000300
+
+	.set OAM_MOSAIC_OFF,         0x00000000
+	.set OAM_MOSAIC_ON,          0x00001000
+
+	.set OAM_4BPP,               0x00000000
+	.set OAM_8BPP,               0x00002000
+
+	.set OAM_H_FLIP,             0x10000000
+	.set OAM_V_FLIP,             0x20000000
+
+	.set OAM_SQUARE,             0x00000000
+	.set OAM_H_RECTANGLE,        0x00004000
+	.set OAM_V_RECTANGLE,        0x00008000
+	.set OAM_SIZE_0,             0x00000000
+	.set OAM_SIZE_1,             0x40000000
+	.set OAM_SIZE_2,             0x80000000
+	.set OAM_SIZE_3,             0xc0000000
+
+	.set OAM_SIZE_8x8,           OAM_SIZE_0 | OAM_SQUARE
+	.set OAM_SIZE_16x16,         OAM_SIZE_1 | OAM_SQUARE
+	.set OAM_SIZE_32x32,         OAM_SIZE_2 | OAM_SQUARE
+	.set OAM_SIZE_64x64,         OAM_SIZE_3 | OAM_SQUARE
+
+	.set OAM_SIZE_16x8,          OAM_SIZE_0 | OAM_H_RECTANGLE
+	.set OAM_SIZE_32x8,          OAM_SIZE_1 | OAM_H_RECTANGLE
+	.set OAM_SIZE_32x16,         OAM_SIZE_2 | OAM_H_RECTANGLE
+	.set OAM_SIZE_64x32,         OAM_SIZE_3 | OAM_H_RECTANGLE
+
+	.set OAM_SIZE_8x16,          OAM_SIZE_0 | OAM_V_RECTANGLE
+	.set OAM_SIZE_8x32,          OAM_SIZE_1 | OAM_V_RECTANGLE
+	.set OAM_SIZE_16x32,         OAM_SIZE_2 | OAM_V_RECTANGLE
+	.set OAM_SIZE_32x64,         OAM_SIZE_3 | OAM_V_RECTANGLE
+
+        
+
+	.set BLDCNT_TGT1_BG0,       1 << 0
+	.set BLDCNT_TGT1_BG1,       1 << 1
+	.set BLDCNT_TGT1_BG2,       1 << 2
+	.set BLDCNT_TGT1_BG3,       1 << 3
+	.set BLDCNT_TGT1_OBJ,       1 << 4
+	.set BLDCNT_TGT1_BD,        1 << 5
+	.set BLDCNT_TGT1_ALL,       BLDCNT_TGT1_BG0 | BLDCNT_TGT1_BG1 | BLDCNT_TGT1_BG2 | BLDCNT_TGT1_BG3 | BLDCNT_TGT1_OBJ | BLDCNT_TGT1_BD
+
+	.set BLDCNT_EFFECT_NONE,    0 << 6
+	.set BLDCNT_EFFECT_BLEND,   1 << 6
+	.set BLDCNT_EFFECT_LIGHTEN, 2 << 6
+	.set BLDCNT_EFFECT_DARKEN,  3 << 6
+
+	.set BLDCNT_TGT2_BG0,       1 << 8
+	.set BLDCNT_TGT2_BG1,       1 << 9
+	.set BLDCNT_TGT2_BG2,       1 << 10
+	.set BLDCNT_TGT2_BG3,       1 << 11
+	.set BLDCNT_TGT2_OBJ,       1 << 12
+	.set BLDCNT_TGT2_BD,        1 << 13
+	.set BLDCNT_TGT2_ALL,       BLDCNT_TGT2_BG0 | BLDCNT_TGT2_BG1 | BLDCNT_TGT2_BG2 | BLDCNT_TGT2_BG3 | BLDCNT_TGT2_OBJ | BLDCNT_TGT2_BD
+# 2 "constants/constants.inc"
+# 1 "constants/misc_constants.inc"
+	.set TRUE, 1
+	.set FALSE, 0
+
+	.set NULL, 0
+
+	.set SPRITE_SIZE_8x8,   (OAM_SIZE_0 >> 28) | (OAM_SQUARE >> 14)
+	.set SPRITE_SIZE_16x16, (OAM_SIZE_1 >> 28) | (OAM_SQUARE >> 14)
+	.set SPRITE_SIZE_32x32, (OAM_SIZE_2 >> 28) | (OAM_SQUARE >> 14)
+	.set SPRITE_SIZE_64x64, (OAM_SIZE_3 >> 28) | (OAM_SQUARE >> 14)
+
+	.set SPRITE_SIZE_16x8,  (OAM_SIZE_0 >> 28) | (OAM_H_RECTANGLE >> 14)
+	.set SPRITE_SIZE_32x8,  (OAM_SIZE_1 >> 28) | (OAM_H_RECTANGLE >> 14)
+	.set SPRITE_SIZE_32x16, (OAM_SIZE_2 >> 28) | (OAM_H_RECTANGLE >> 14)
+	.set SPRITE_SIZE_64x32, (OAM_SIZE_3 >> 28) | (OAM_H_RECTANGLE >> 14)
+
+	.set SPRITE_SIZE_8x16,  (OAM_SIZE_0 >> 28) | (OAM_V_RECTANGLE >> 14)
+	.set SPRITE_SIZE_8x32,  (OAM_SIZE_1 >> 28) | (OAM_V_RECTANGLE >> 14)
+	.set SPRITE_SIZE_16x32, (OAM_SIZE_2 >> 28) | (OAM_V_RECTANGLE >> 14)
+	.set SPRITE_SIZE_32x64, (OAM_SIZE_3 >> 28) | (OAM_V_RECTANGLE >> 14)
+
+	.set OBJ_IMAGE_ANIM_H_FLIP, 1 << 6
+	.set OBJ_IMAGE_ANIM_V_FLIP, 1 << 7
+# 3 "constants/constants.inc"
+# 1 "constants/version.inc"
+	.ifdef FIRERED
+	.equiv GAME_VERSION, 4
+	.else
+	.equiv GAME_VERSION, 5
+	.endif
+
+	.ifdef ENGLISH
+	.equiv GAME_LANGUAGE, 2
+	.else
+	.ifdef GERMAN
+	.equiv GAME_LANGUAGE, 5
+	.endif
+	.endif
+# 4 "constants/constants.inc"
+# 14 "data/mystery_event_msg.s"
+
+	.section .rodata
+	
+	.align 2
+MysteryEventScript_StampCard: ; .global MysteryEventScript_StampCard
+	setvaddress MysteryEventScript_StampCard
+	setorcopyvar VAR_RESULT, 1
+	specialvar VAR_0x8008, GetMysteryGiftCardStat
+	setorcopyvar VAR_RESULT, 0
+	specialvar VAR_0x8009, GetMysteryGiftCardStat
+	subvar VAR_0x8008, VAR_0x8009
+	buffernumberstring STR_VAR_1, VAR_0x8008
+	lock
+	faceplayer
+	vmessage sText_MysteryGiftStampCard
+	waitmessage
+	waitbuttonpress
+	release
+	end
+
+sText_MysteryGiftStampCard:
+	.byte 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCD, 0xCE, 0xBB, 0xC7, 0xCA, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xFE
+	.byte 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAD, 0xFB
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xFD, 0x02, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0x00, 0xE8, 0xE3, 0x00, 0xD7, 0xE3, 0xE0, 0xE0, 0xD9, 0xD7, 0xE8, 0x00, 0xE8, 0xE3, 0xFE
+	.byte 0xDA, 0xDD, 0xE0, 0xE0, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCD, 0xCE, 0xBB, 0xC7, 0xCA, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xAD, 0xFF
+
+MysteryEventScript_SurfPichu: ; .global MysteryEventScript_SurfPichu
+	setvaddress MysteryEventScript_SurfPichu
+	vgoto_if_unset FLAG_MYSTERY_GIFT_DONE, SurfPichu_GiveIfPossible
+	returnram
+
+SurfPichu_GiveIfPossible:
+	specialvar VAR_EVENT_PICHU_SLOT, CalculatePlayerPartyCount
+	vgoto_if_eq VAR_EVENT_PICHU_SLOT, PARTY_SIZE, SurfPichu_FullParty
+	setflag FLAG_MYSTERY_GIFT_DONE
+	vcall SurfPichu_GiveEgg
+	lock
+	faceplayer
+	vmessage sText_MysteryGiftEgg
+	waitmessage
+	waitbuttonpress
+	playfanfare MUS_OBTAIN_ITEM
+	waitfanfare
+	release
+	end
+
+SurfPichu_FullParty:
+	lock
+	faceplayer
+	vmessage sText_FullParty
+	waitmessage
+	waitbuttonpress
+	release
+	end
+
+SurfPichu_GiveEgg:
+	giveegg SPECIES_PICHU
+	setmonmodernfatefulencounter VAR_EVENT_PICHU_SLOT
+	setmonmetlocation VAR_EVENT_PICHU_SLOT, METLOC_FATEFUL_ENCOUNTER
+	vgoto_if_eq VAR_EVENT_PICHU_SLOT, 1, SurfPichu_Slot1
+	vgoto_if_eq VAR_EVENT_PICHU_SLOT, 2, SurfPichu_Slot2
+	vgoto_if_eq VAR_EVENT_PICHU_SLOT, 3, SurfPichu_Slot3
+	vgoto_if_eq VAR_EVENT_PICHU_SLOT, 4, SurfPichu_Slot4
+	vgoto_if_eq VAR_EVENT_PICHU_SLOT, 5, SurfPichu_Slot5
+	return
+
+SurfPichu_Slot1:
+	setmonmove 1, 2, MOVE_SURF
+	return
+
+SurfPichu_Slot2:
+	setmonmove 2, 2, MOVE_SURF
+	return
+
+SurfPichu_Slot3:
+	setmonmove 3, 2, MOVE_SURF
+	return
+
+SurfPichu_Slot4:
+	setmonmove 4, 2, MOVE_SURF
+	return
+
+SurfPichu_Slot5:
+	setmonmove 5, 2, MOVE_SURF
+	return
+
+sText_MysteryGiftEgg:
+	.byte 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0xFE
+	.byte 0xC1, 0xC3, 0xC0, 0xCE, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAD, 0xFB
+	.byte 0xC0, 0xE6, 0xE3, 0xE1, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBD, 0xBF, 0xC8, 0xCE, 0xBF, 0xCC, 0x00, 0xEB, 0xD9, 0xFE
+	.byte 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xD5, 0x00, 0xDB, 0xDD, 0xDA, 0xE8, 0x00, 0xAE, 0x00, 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xBF, 0xC1, 0xC1, 0xAB, 0xFB
+	.byte 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xE6, 0xD5, 0xDD, 0xE7, 0xD9, 0x00, 0xDD, 0xE8, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE0, 0xE3, 0xEA, 0xD9, 0x00, 0xD5, 0xE2, 0xD8, 0xFE
+	.byte 0xDF, 0xDD, 0xE2, 0xD8, 0xE2, 0xD9, 0xE7, 0xE7, 0xAD, 0xFF
+
+sText_FullParty:
+	.byte 0xC9, 0xDC, 0xB8, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0xED, 0x00, 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD9, 0x00, 0xDA, 0xE9, 0xE0, 0xE0, 0xAD, 0xFB
+	.byte 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xD7, 0xE3, 0xE1, 0xD9, 0x00, 0xE7, 0xD9, 0xD9, 0x00, 0xE1, 0xD9, 0x00, 0xD5, 0xDA, 0xE8, 0xD9, 0xE6, 0x00, 0xE7, 0xE8, 0xE3, 0xE6, 0xDD, 0xE2, 0xDB, 0xFE
+	.byte 0xD5, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xE3, 0xE2, 0x00, 0xD5, 0x00, 0xCA, 0xBD, 0xAD, 0xFF
+
+MysteryEventScript_VisitingTrainer: ; .global MysteryEventScript_VisitingTrainer
+	setvaddress MysteryEventScript_VisitingTrainer
+	special ValidateEReaderTrainer
+	vgoto_if_eq VAR_RESULT, 0, MysteryEventScript_VisitingTrainerArrived
+	lock
+	faceplayer
+	vmessage sText_MysteryGiftVisitingTrainer
+	waitmessage
+	waitbuttonpress
+	release
+	end
+
+MysteryEventScript_VisitingTrainerArrived:
+	lock
+	faceplayer
+	vmessage sText_MysteryGiftVisitingTrainer_2
+	waitmessage
+	waitbuttonpress
+	release
+	end
+
+sText_MysteryGiftVisitingTrainer:
+	.byte 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0xFE
+	.byte 0xC1, 0xC3, 0xC0, 0xCE, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAD, 0xFB
+	.byte 0xBC, 0xED, 0x00, 0xDC, 0xE3, 0xE0, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0x00, 0xD1, 0xC9, 0xC8, 0xBE, 0xBF, 0xCC, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xB8, 0x00, 0xED, 0xE3, 0xE9, 0xFE
+	.byte 0xE1, 0xD5, 0xED, 0x00, 0xE8, 0xD5, 0xDF, 0xD9, 0x00, 0xE4, 0xD5, 0xE6, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xD5, 0x00, 0xE7, 0xE9, 0xE6, 0xEA, 0xD9, 0xED, 0x00, 0xD5, 0xE8, 0x00, 0xD5, 0xFA
+	.byte 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xC7, 0xBB, 0xCC, 0xCE, 0xAD, 0xFB
+	.byte 0xCF, 0xE7, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0xE7, 0xD9, 0x00, 0xE7, 0xE9, 0xE6, 0xEA, 0xD9, 0xED, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xDD, 0xE2, 0xEA, 0xDD, 0xE8, 0xD9, 0xFE
+	.byte 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xCD, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCD, 0xBF, 0xD0, 0xC3, 0xC3, 0x00, 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xCD, 0xAD, 0xFB
+	.byte 0xB0, 0xC6, 0xD9, 0xE8, 0x00, 0xE1, 0xD9, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xD5, 0x00, 0xE7, 0xD9, 0xD7, 0xE6, 0xD9, 0xE8, 0xFE
+	.byte 0xE4, 0xD5, 0xE7, 0xE7, 0xEB, 0xE3, 0xE6, 0xD8, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xD5, 0x00, 0xE7, 0xE9, 0xE6, 0xEA, 0xD9, 0xED, 0xF0, 0xFB
+	.byte 0xB1, 0xC1, 0xC3, 0xD0, 0xBF, 0x00, 0xC7, 0xBF, 0xFE
+	.byte 0xBB, 0xD1, 0xBF, 0xCD, 0xC9, 0xC7, 0xBF, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xB2, 0xFB
+	.byte 0xD1, 0xE6, 0xDD, 0xE8, 0xD9, 0x00, 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xDD, 0xE2, 0x00, 0xE3, 0xE2, 0x00, 0xD5, 0x00, 0xE7, 0xE9, 0xE6, 0xEA, 0xD9, 0xED, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xD9, 0xE2, 0xD8, 0xFE
+	.byte 0xDD, 0xE8, 0x00, 0xE8, 0xE3, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xD1, 0xC3, 0xCC, 0xBF, 0xC6, 0xBF, 0xCD, 0xCD, 0xFA
+	.byte 0xBD, 0xC9, 0xC7, 0xC7, 0xCF, 0xC8, 0xC3, 0xBD, 0xBB, 0xCE, 0xC3, 0xC9, 0xC8, 0x00, 0xCD, 0xD3, 0xCD, 0xCE, 0xBF, 0xC7, 0xAD, 0xFF
+
+sText_MysteryGiftVisitingTrainer_2:
+	.byte 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0xFE
+	.byte 0xC1, 0xC3, 0xC0, 0xCE, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAD, 0xFB
+	.byte 0xBB, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0x00, 0xDC, 0xD5, 0xE7, 0x00, 0xD5, 0xE6, 0xE6, 0xDD, 0xEA, 0xD9, 0xD8, 0x00, 0xDD, 0xE2, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xCD, 0xBF, 0xD0, 0xC3, 0xC3, 0xFE
+	.byte 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xCD, 0x00, 0xE0, 0xE3, 0xE3, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xED, 0xE3, 0xE9, 0xAD, 0xFB
+	.byte 0xD1, 0xD9, 0x00, 0xDC, 0xE3, 0xE4, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD9, 0xE2, 0xDE, 0xE3, 0xED, 0xFE
+	.byte 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xEA, 0xDD, 0xE7, 0xDD, 0xE8, 0xDD, 0xE2, 0xDB, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xAD, 0xFB
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xDD, 0xE2, 0xEA, 0xDD, 0xE8, 0xD9, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xCD, 0x00, 0xD6, 0xED, 0xFE
+	.byte 0xD9, 0xE2, 0xE8, 0xD9, 0xE6, 0xDD, 0xE2, 0xDB, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xE4, 0xD5, 0xE7, 0xE7, 0xEB, 0xE3, 0xE6, 0xD8, 0xE7, 0xAD, 0xFB
+	.byte 0xCE, 0xE6, 0xED, 0x00, 0xE0, 0xE3, 0xE3, 0xDF, 0xDD, 0xE2, 0xDB, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE3, 0xE8, 0xDC, 0xD9, 0xE6, 0x00, 0xE4, 0xD5, 0xE7, 0xE7, 0xEB, 0xE3, 0xE6, 0xD8, 0xE7, 0xFE
+	.byte 0xE8, 0xDC, 0xD5, 0xE8, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xEB, 0xE3, 0xE6, 0xDF, 0xAD, 0xFF
+
+MysteryEventScript_BattleCard: ; .global MysteryEventScript_BattleCard
+	setvaddress MysteryEventScript_BattleCard
+	vgoto_if_set FLAG_MYSTERY_GIFT_DONE, MysteryEventScript_BattleCardInfo
+	setorcopyvar VAR_RESULT, 2
+	specialvar VAR_0x8008, GetMysteryGiftCardStat
+	vgoto_if_ne VAR_0x8008, 3, MysteryEventScript_BattleCardInfo
+	lock
+	faceplayer
+	vmessage sText_MysteryGiftBattleCountCard_2
+	waitmessage
+	waitbuttonpress
+	giveitem ITEM_POTION
+	release
+	setflag FLAG_MYSTERY_GIFT_DONE
+	end
+
+MysteryEventScript_BattleCardInfo:
+	lock
+	faceplayer
+	vmessage sText_MysteryGiftBattleCountCard
+	waitmessage
+	waitbuttonpress
+	release
+	end
+
+sText_MysteryGiftBattleCountCard:
+	.byte 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0xFE
+	.byte 0xC1, 0xC3, 0xC0, 0xCE, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAD, 0xFB
+	.byte 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xBC, 0xBB, 0xCE, 0xCE, 0xC6, 0xBF, 0x00, 0xBD, 0xC9, 0xCF, 0xC8, 0xCE, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0x00, 0xDF, 0xD9, 0xD9, 0xE4, 0xE7, 0xFE
+	.byte 0xE8, 0xE6, 0xD5, 0xD7, 0xDF, 0x00, 0xE3, 0xDA, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0x00, 0xE6, 0xD9, 0xD7, 0xE3, 0xE6, 0xD8, 0x00, 0xD5, 0xDB, 0xD5, 0xDD, 0xE2, 0xE7, 0xE8, 0xFA
+	.byte 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xCD, 0x00, 0xEB, 0xDD, 0xE8, 0xDC, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD5, 0xE1, 0xD9, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0xAD, 0xFB
+	.byte 0xC6, 0xE3, 0xE3, 0xDF, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0x00, 0xCE, 0xCC, 0xBB, 0xC3, 0xC8, 0xBF, 0xCC, 0xCD, 0x00, 0xEB, 0xDC, 0xE3, 0xFE
+	.byte 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE7, 0xD5, 0xE1, 0xD9, 0x00, 0xBD, 0xBB, 0xCC, 0xBE, 0x00, 0xD5, 0xE7, 0x00, 0xED, 0xE3, 0xE9, 0xAD, 0xFB
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xD5, 0xED, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xE3, 0xEA, 0xD9, 0xE6, 0xD5, 0xE0, 0xE0, 0x00, 0xE6, 0xD5, 0xE2, 0xDF, 0xDD, 0xE2, 0xDB, 0xE7, 0xFE
+	.byte 0xD6, 0xED, 0x00, 0xE6, 0xD9, 0xD5, 0xD8, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC8, 0xBF, 0xD1, 0xCD, 0xAD, 0xFB
+	.byte 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xD8, 0xE3, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0x00, 0xDD, 0xE8, 0x00, 0xD5, 0x00, 0xE8, 0xE6, 0xED, 0xAB, 0xFF
+
+sText_MysteryGiftBattleCountCard_2:
+	.byte 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0xFE
+	.byte 0xC1, 0xC3, 0xC0, 0xCE, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAD, 0xFB
+	.byte 0xBD, 0xE3, 0xE2, 0xDB, 0xE6, 0xD5, 0xE8, 0xE9, 0xE0, 0xD5, 0xE8, 0xDD, 0xE3, 0xE2, 0xE7, 0xAB, 0xFB
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xEB, 0xE3, 0xE2, 0x00, 0xD5, 0x00, 0xE4, 0xE6, 0xDD, 0xEE, 0xD9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xEB, 0xDD, 0xE2, 0xE2, 0xDD, 0xE2, 0xDB, 0xFE
+	.byte 0xE8, 0xDC, 0xE6, 0xD9, 0xD9, 0x00, 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0xE7, 0xAB, 0xFB
+	.byte 0xD1, 0xD9, 0x00, 0xDC, 0xE3, 0xE4, 0xD9, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xEB, 0xDD, 0xE0, 0xE0, 0x00, 0xD6, 0xD9, 0x00, 0xDD, 0xE2, 0xE7, 0xE4, 0xDD, 0xE6, 0xD9, 0xD8, 0x00, 0xE8, 0xE3, 0xFE
+	.byte 0xD6, 0xD5, 0xE8, 0xE8, 0xE0, 0xD9, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0x00, 0xE1, 0xE3, 0xE6, 0xD9, 0xAD, 0xFF
+
+MysteryEventScript_AuroraTicket: ; .global MysteryEventScript_AuroraTicket
+	setvaddress MysteryEventScript_AuroraTicket
+	lock
+	faceplayer
+	vgoto_if_set FLAG_RECEIVED_AURORA_TICKET, AuroraTicket_Obtained
+	vgoto_if_set FLAG_FOUGHT_DEOXYS, AuroraTicket_Obtained
+	checkitem ITEM_AURORA_TICKET, 1
+	vgoto_if_eq VAR_RESULT, TRUE, AuroraTicket_Obtained
+	vmessage sText_AuroraTicket1
+	waitmessage
+	waitbuttonpress
+	checkitemspace ITEM_AURORA_TICKET, 1
+	vgoto_if_eq VAR_RESULT, FALSE, AuroraTicket_NoBagSpace
+	giveitem ITEM_AURORA_TICKET
+	setflag FLAG_ENABLE_SHIP_BIRTH_ISLAND
+	setflag FLAG_RECEIVED_AURORA_TICKET
+	vmessage sText_AuroraTicket2
+	waitmessage
+	waitbuttonpress
+	release
+	end
+
+AuroraTicket_NoBagSpace:
+	vmessage sText_AuroraTicketNoPlace
+	waitmessage
+	waitbuttonpress
+	release
+	end
+
+AuroraTicket_Obtained:
+	vmessage sText_AuroraTicketGot
+	waitmessage
+	waitbuttonpress
+	release
+	end
+
+sText_AuroraTicket1:
+	.byte 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0xFE
+	.byte 0xC1, 0xC3, 0xC0, 0xCE, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAD, 0xFB
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xE9, 0xE7, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xFD, 0x01, 0xAD, 0xFE
+	.byte 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xE8, 0xDD, 0xD7, 0xDF, 0xD9, 0xE8, 0x00, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xED, 0xE3, 0xE9, 0xAD, 0xFF
+
+sText_AuroraTicket2:
+	.byte 0xC3, 0xE8, 0x00, 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xD5, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0xD0, 0xBF, 0xCC, 0xC7, 0xC3, 0xC6, 0xC3, 0xC9, 0xC8, 0x00, 0xBD, 0xC3, 0xCE, 0xD3, 0x00, 0xE4, 0xE3, 0xE6, 0xE8, 0xAD, 0xFB
+	.byte 0xD1, 0xDC, 0xED, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0x00, 0xDD, 0xE8, 0x00, 0xD5, 0x00, 0xE8, 0xE6, 0xED, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xD9, 0xD9, 0x00, 0xEB, 0xDC, 0xD5, 0xE8, 0xFE
+	.byte 0xDD, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0xD6, 0xE3, 0xE9, 0xE8, 0xAC, 0xFF
+
+sText_AuroraTicketGot:
+	.byte 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0xFE
+	.byte 0xC1, 0xC3, 0xC0, 0xCE, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAD, 0xFF
+
+sText_AuroraTicketNoPlace:
+	.byte 0xC9, 0xDC, 0xB8, 0x00, 0xC3, 0xB4, 0xE1, 0x00, 0xE7, 0xE3, 0xE6, 0xE6, 0xED, 0xB8, 0x00, 0xFD, 0x01, 0xAD, 0x00, 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xBC, 0xBB, 0xC1, 0xB4, 0xE7, 0xFE
+	.byte 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0x00, 0xDD, 0xE7, 0x00, 0xDA, 0xE9, 0xE0, 0xE0, 0xAD, 0xFB
+	.byte 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xE3, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xBD, 0xB8, 0xFE
+	.byte 0xE8, 0xDC, 0xD9, 0xE2, 0x00, 0xD7, 0xE3, 0xE1, 0xD9, 0x00, 0xD6, 0xD5, 0xD7, 0xDF, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0xAD, 0xFF
+
+MysteryEventScript_MysticTicket: ; .global MysteryEventScript_MysticTicket
+	setvaddress MysteryEventScript_MysticTicket
+	lock
+	faceplayer
+	vgoto_if_set FLAG_RECEIVED_MYSTIC_TICKET, MysticTicket_Obtained
+	vgoto_if_set FLAG_FOUGHT_LUGIA, MysticTicket_Obtained
+	vgoto_if_set FLAG_FOUGHT_HO_OH, MysticTicket_Obtained
+	checkitem ITEM_MYSTIC_TICKET, 1
+	vgoto_if_eq VAR_RESULT, TRUE, MysticTicket_Obtained
+	vmessage sText_MysticTicket2
+	waitmessage
+	waitbuttonpress
+	checkitemspace ITEM_MYSTIC_TICKET, 1
+	vgoto_if_eq VAR_RESULT, FALSE, MysticTicket_NoBagSpace
+	giveitem ITEM_MYSTIC_TICKET
+	setflag FLAG_ENABLE_SHIP_NAVEL_ROCK
+	setflag FLAG_RECEIVED_MYSTIC_TICKET
+	vmessage sText_MysticTicket1
+	waitmessage
+	waitbuttonpress
+	release
+	end
+
+MysticTicket_NoBagSpace:
+	vmessage sText_MysticTicketNoPlace
+	waitmessage
+	waitbuttonpress
+	release
+	end
+
+MysticTicket_Obtained:
+	vmessage sText_MysticTicketGot
+	waitmessage
+	waitbuttonpress
+	release
+	end
+
+sText_MysticTicket2:
+	.byte 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0xFE
+	.byte 0xC1, 0xC3, 0xC0, 0xCE, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAD, 0xFB
+	.byte 0xD3, 0xE3, 0xE9, 0x00, 0xE1, 0xE9, 0xE7, 0xE8, 0x00, 0xD6, 0xD9, 0x00, 0xFD, 0x01, 0xAD, 0xFE
+	.byte 0xCE, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0x00, 0xE8, 0xDD, 0xD7, 0xDF, 0xD9, 0xE8, 0x00, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xED, 0xE3, 0xE9, 0xAD, 0xFF
+
+sText_MysticTicket1:
+	.byte 0xC3, 0xE8, 0x00, 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0xE7, 0x00, 0xE8, 0xE3, 0x00, 0xD6, 0xD9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xD9, 0x00, 0xD5, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0xFE
+	.byte 0xD0, 0xBF, 0xCC, 0xC7, 0xC3, 0xC6, 0xC3, 0xC9, 0xC8, 0x00, 0xBD, 0xC3, 0xCE, 0xD3, 0x00, 0xE4, 0xE3, 0xE6, 0xE8, 0xAD, 0xFB
+	.byte 0xD1, 0xDC, 0xED, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xDB, 0xDD, 0xEA, 0xD9, 0x00, 0xDD, 0xE8, 0x00, 0xD5, 0x00, 0xE8, 0xE6, 0xED, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xE7, 0xD9, 0xD9, 0x00, 0xEB, 0xDC, 0xD5, 0xE8, 0xFE
+	.byte 0xDD, 0xE8, 0x00, 0xDD, 0xE7, 0x00, 0xD5, 0xD6, 0xE3, 0xE9, 0xE8, 0xAC, 0xFF
+
+sText_MysticTicketGot:
+	.byte 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0xFE
+	.byte 0xC1, 0xC3, 0xC0, 0xCE, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAD, 0xFF
+
+sText_MysticTicketNoPlace:
+	.byte 0xC9, 0xDC, 0xB8, 0x00, 0xC3, 0xB4, 0xE1, 0x00, 0xE7, 0xE3, 0xE6, 0xE6, 0xED, 0xB8, 0x00, 0xFD, 0x01, 0xAD, 0x00, 0xD3, 0xE3, 0xE9, 0xE6, 0x00, 0xBC, 0xBB, 0xC1, 0xB4, 0xE7, 0xFE
+	.byte 0xC5, 0xBF, 0xD3, 0x00, 0xC3, 0xCE, 0xBF, 0xC7, 0xCD, 0x00, 0xCA, 0xC9, 0xBD, 0xC5, 0xBF, 0xCE, 0x00, 0xDD, 0xE7, 0x00, 0xDA, 0xE9, 0xE0, 0xE0, 0xAD, 0xFB
+	.byte 0xCA, 0xE0, 0xD9, 0xD5, 0xE7, 0xD9, 0x00, 0xE7, 0xE8, 0xE3, 0xE6, 0xD9, 0x00, 0xE7, 0xE3, 0xE1, 0xD9, 0xE8, 0xDC, 0xDD, 0xE2, 0xDB, 0x00, 0xE3, 0xE2, 0x00, 0xED, 0xE3, 0xE9, 0xE6, 0x00, 0xCA, 0xBD, 0xB8, 0xFE
+	.byte 0xE8, 0xDC, 0xD9, 0xE2, 0x00, 0xD7, 0xE3, 0xE1, 0xD9, 0x00, 0xD6, 0xD5, 0xD7, 0xDF, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE8, 0xDC, 0xDD, 0xE7, 0xAD, 0xFF
+
+MysteryEventScript_AlteringCave: ; .global MysteryEventScript_AlteringCave
+	setvaddress MysteryEventScript_AlteringCave
+	addvar VAR_ALTERING_CAVE_WILD_SET, 1
+	vgoto_if_ne VAR_ALTERING_CAVE_WILD_SET, 10, MysteryEventScript_AlteringCave_
+	setvar VAR_ALTERING_CAVE_WILD_SET, 0
+MysteryEventScript_AlteringCave_:
+	lock
+	faceplayer
+	vmessage sText_MysteryGiftAlteringCave
+	waitmessage
+	waitbuttonpress
+	release
+	end
+
+sText_MysteryGiftAlteringCave:
+	.byte 0xCE, 0xDC, 0xD5, 0xE2, 0xDF, 0x00, 0xED, 0xE3, 0xE9, 0x00, 0xDA, 0xE3, 0xE6, 0x00, 0xE9, 0xE7, 0xDD, 0xE2, 0xDB, 0x00, 0xE8, 0xDC, 0xD9, 0x00, 0xC7, 0xD3, 0xCD, 0xCE, 0xBF, 0xCC, 0xD3, 0xFE
+	.byte 0xC1, 0xC3, 0xC0, 0xCE, 0x00, 0xCD, 0xED, 0xE7, 0xE8, 0xD9, 0xE1, 0xAD, 0xFB
+	.byte 0xCC, 0xD9, 0xD7, 0xD9, 0xE2, 0xE8, 0xE0, 0xED, 0xB8, 0x00, 0xE8, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xDC, 0xD5, 0xEA, 0xD9, 0x00, 0xD6, 0xD9, 0xD9, 0xE2, 0x00, 0xE6, 0xE9, 0xE1, 0xE3, 0xE6, 0xE7, 0xFE
+	.byte 0xE3, 0xDA, 0x00, 0xE6, 0xD5, 0xE6, 0xD9, 0x00, 0xCA, 0xC9, 0xC5, 0x1B, 0xC7, 0xC9, 0xC8, 0x00, 0xD5, 0xE4, 0xE4, 0xD9, 0xD5, 0xE6, 0xD5, 0xE2, 0xD7, 0xD9, 0xE7, 0xAD, 0xFB
+	.byte 0xCE, 0xDC, 0xD9, 0x00, 0xE6, 0xE9, 0xE1, 0xE3, 0xE6, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xD5, 0xD6, 0xE3, 0xE9, 0xE8, 0x00, 0xBB, 0xC6, 0xCE, 0xBF, 0xCC, 0xC3, 0xC8, 0xC1, 0xFE
+	.byte 0xBD, 0xBB, 0xD0, 0xBF, 0x00, 0xE3, 0xE2, 0x00, 0xC9, 0xCF, 0xCE, 0xBD, 0xBB, 0xCD, 0xCE, 0x00, 0xC3, 0xCD, 0xC6, 0xBB, 0xC8, 0xBE, 0xAD, 0xFB
+	.byte 0xD1, 0xDC, 0xED, 0x00, 0xE2, 0xE3, 0xE8, 0x00, 0xEA, 0xDD, 0xE7, 0xDD, 0xE8, 0x00, 0xE8, 0xDC, 0xD9, 0xE6, 0xD9, 0x00, 0xD5, 0xE2, 0xD8, 0x00, 0xD7, 0xDC, 0xD9, 0xD7, 0xDF, 0x00, 0xDD, 0xDA, 0xFE
+	.byte 0xE8, 0xDC, 0xD9, 0x00, 0xE6, 0xE9, 0xE1, 0xE3, 0xE6, 0xE7, 0x00, 0xD5, 0xE6, 0xD9, 0x00, 0xDD, 0xE2, 0xD8, 0xD9, 0xD9, 0xD8, 0x00, 0xE8, 0xE6, 0xE9, 0xD9, 0xAC, 0xFF
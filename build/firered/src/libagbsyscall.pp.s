@@ -0,0 +1,1322 @@
+# 1 "src/libagbsyscall.s"
+# 1 "constants/gba_constants.inc"
+	.set PSR_USR_MODE,  0x00000010
+	.set PSR_FIQ_MODE,  0x00000011
+	.set PSR_IRQ_MODE,  0x00000012
+	.set PSR_SVC_MODE,  0x00000013
+	.set PSR_ABT_MODE,  0x00000017
+	.set PSR_UND_MODE,  0x0000001b
+	.set PSR_SYS_MODE,  0x0000001f
+	.set PSR_MODE_MASK, 0x0000001f
+	.set PSR_T_BIT,     0x00000020
+	.set PSR_F_BIT,     0x00000040
+	.set PSR_I_BIT,     0x00000080
+
+	.set EWRAM_START, 0x02000000
+	.set EWRAM_END,   EWRAM_START + 0x40000
+	.set IWRAM_START, 0x03000000
+	.set IWRAM_END,   IWRAM_START + 0x8000
+
+	.set PLTT,     0x5000000
+	.set BG_PLTT,  PLTT
+	.set OBJ_PLTT, PLTT + 0x200
+
+	.set VRAM,      0x6000000
+	.set BG_VRAM,   VRAM
+	.set OBJ_VRAM0, VRAM + 0x10000               
+	.set OBJ_VRAM1, VRAM + 0x14000                 
+
+	.set OAM, 0x7000000
+
+	.set SOUND_INFO_PTR, 0x3007FF0
+	.set INTR_CHECK,     0x3007FF8
+	.set INTR_VECTOR,    0x3007FFC
+
+	.set INTR_FLAG_VBLANK,  1 << 0
+	.set INTR_FLAG_HBLANK,  1 << 1
+	.set INTR_FLAG_VCOUNT,  1 << 2
+	.set INTR_FLAG_TIMER0,  1 << 3
+	.set INTR_FLAG_TIMER1,  1 << 4
+	.set INTR_FLAG_TIMER2,  1 << 5
+	.set INTR_FLAG_TIMER3,  1 << 6
+	.set INTR_FLAG_SERIAL,  1 << 7
+	.set INTR_FLAG_DMA0,    1 << 8
+	.set INTR_FLAG_DMA1,    1 << 9
+	.set INTR_FLAG_DMA2,    1 << 10
+	.set INTR_FLAG_DMA3,    1 << 11
+	.set INTR_FLAG_KEYPAD,  1 << 12
+	.set INTR_FLAG_GAMEPAK, 1 << 13
+
+	.set VCOUNT_VBLANK, 160
+	.set TOTAL_SCANLINES, 228
+
+	.set REG_BASE, 0x4000000                            
+
+                      
+	.set OFFSET_REG_DISPCNT,     0x0
+	.set OFFSET_REG_DISPSTAT,    0x4
+	.set OFFSET_REG_VCOUNT,      0x6
+	.set OFFSET_REG_BG0CNT,      0x8
+	.set OFFSET_REG_BG1CNT,      0xa
+	.set OFFSET_REG_BG2CNT,      0xc
+	.set OFFSET_REG_BG3CNT,      0xe
+	.set OFFSET_REG_BG0HOFS,     0x10
+	.set OFFSET_REG_BG0VOFS,     0x12
+	.set OFFSET_REG_BG1HOFS,     0x14
+	.set OFFSET_REG_BG1VOFS,     0x16
+	.set OFFSET_REG_BG2HOFS,     0x18
+	.set OFFSET_REG_BG2VOFS,     0x1a
+	.set OFFSET_REG_BG3HOFS,     0x1c
+	.set OFFSET_REG_BG3VOFS,     0x1e
+	.set OFFSET_REG_BG2PA,       0x20
+	.set OFFSET_REG_BG2PB,       0x22
+	.set OFFSET_REG_BG2PC,       0x24
+	.set OFFSET_REG_BG2PD,       0x26
+	.set OFFSET_REG_BG2X_L,      0x28
+	.set OFFSET_REG_BG2X_H,      0x2a
+	.set OFFSET_REG_BG2Y_L,      0x2c
+	.set OFFSET_REG_BG2Y_H,      0x2e
+	.set OFFSET_REG_BG3PA,       0x30
+	.set OFFSET_REG_BG3PB,       0x32
+	.set OFFSET_REG_BG3PC,       0x34
+	.set OFFSET_REG_BG3PD,       0x36
+	.set OFFSET_REG_BG3X_L,      0x38
+	.set OFFSET_REG_BG3X_H,      0x3a
+	.set OFFSET_REG_BG3Y_L,      0x3c
+	.set OFFSET_REG_BG3Y_H,      0x3e
+	.set OFFSET_REG_WIN0H,       0x40
+	.set OFFSET_REG_WIN1H,       0x42
+	.set OFFSET_REG_WIN0V,       0x44
+	.set OFFSET_REG_WIN1V,       0x46
+	.set OFFSET_REG_WININ,       0x48
+	.set OFFSET_REG_WINOUT,      0x4a
+	.set OFFSET_REG_MOSAIC,      0x4c
+	.set OFFSET_REG_BLDCNT,      0x50
+	.set OFFSET_REG_BLDALPHA,    0x52
+	.set OFFSET_REG_BLDY,        0x54
+
+	.set OFFSET_REG_SOUND1CNT,   0x60
+	.set OFFSET_REG_SOUND1CNT_L, 0x60
+	.set OFFSET_REG_NR10,        0x60
+	.set OFFSET_REG_SOUND1CNT_H, 0x62
+	.set OFFSET_REG_NR11,        0x62
+	.set OFFSET_REG_NR12,        0x63
+	.set OFFSET_REG_SOUND1CNT_X, 0x64
+	.set OFFSET_REG_NR13,        0x64
+	.set OFFSET_REG_NR14,        0x65
+	.set OFFSET_REG_SOUND2CNT,   0x68
+	.set OFFSET_REG_SOUND2CNT_L, 0x68
+	.set OFFSET_REG_NR21,        0x68
+	.set OFFSET_REG_NR22,        0x69
+	.set OFFSET_REG_SOUND2CNT_H, 0x6c
+	.set OFFSET_REG_NR23,        0x6c
+	.set OFFSET_REG_NR24,        0x6d
+	.set OFFSET_REG_SOUND3CNT,   0x70
+	.set OFFSET_REG_SOUND3CNT_L, 0x70
+	.set OFFSET_REG_NR30,        0x70
+	.set OFFSET_REG_SOUND3CNT_H, 0x72
+	.set OFFSET_REG_NR31,        0x72
+	.set OFFSET_REG_NR32,        0x73
+	.set OFFSET_REG_SOUND3CNT_X, 0x74
+	.set OFFSET_REG_NR33,        0x74
+	.set OFFSET_REG_NR34,        0x75
+	.set OFFSET_REG_SOUND4CNT,   0x78
+	.set OFFSET_REG_SOUND4CNT_L, 0x78
+	.set OFFSET_REG_NR41,        0x78
+	.set OFFSET_REG_NR42,        0x79
+	.set OFFSET_REG_SOUND4CNT_H, 0x7c
+	.set OFFSET_REG_NR43,        0x7c
+	.set OFFSET_REG_NR44,        0x7d
+	.set OFFSET_REG_SOUNDCNT,    0x80
+	.set OFFSET_REG_SOUNDCNT_L,  0x80
+	.set OFFSET_REG_NR50,        0x80
+	.set OFFSET_REG_NR51,        0x81
+	.set OFFSET_REG_SOUNDCNT_H,  0x82
+	.set OFFSET_REG_SOUNDCNT_X,  0x84
+	.set OFFSET_REG_NR52,        0x84
+	.set OFFSET_REG_SOUNDBIAS,   0x88
+	.set OFFSET_REG_WAVE_RAM,    0x90
+	.set OFFSET_REG_WAVE_RAM0,   0x90
+	.set OFFSET_REG_WAVE_RAM0_L, 0x90
+	.set OFFSET_REG_WAVE_RAM0_H, 0x92
+	.set OFFSET_REG_WAVE_RAM1,   0x94
+	.set OFFSET_REG_WAVE_RAM1_L, 0x94
+	.set OFFSET_REG_WAVE_RAM1_H, 0x96
+	.set OFFSET_REG_WAVE_RAM2,   0x98
+	.set OFFSET_REG_WAVE_RAM2_L, 0x98
+	.set OFFSET_REG_WAVE_RAM2_H, 0x9a
+	.set OFFSET_REG_WAVE_RAM3,   0x9c
+	.set OFFSET_REG_WAVE_RAM3_L, 0x9c
+	.set OFFSET_REG_WAVE_RAM3_H, 0x9e
+	.set OFFSET_REG_FIFO,        0xa0
+	.set OFFSET_REG_FIFO_A,      0xa0
+	.set OFFSET_REG_FIFO_A_L,    0xa0
+	.set OFFSET_REG_FIFO_A_H,    0xa2
+	.set OFFSET_REG_FIFO_B,      0xa4
+	.set OFFSET_REG_FIFO_B_L,    0xa4
+	.set OFFSET_REG_FIFO_B_H,    0xa6
+
+	.set OFFSET_REG_DMA0,        0xb0
+	.set OFFSET_REG_DMA0SAD,     0xb0
+	.set OFFSET_REG_DMA0SAD_L,   0xb0
+	.set OFFSET_REG_DMA0SAD_H,   0xb2
+	.set OFFSET_REG_DMA0DAD,     0xb4
+	.set OFFSET_REG_DMA0DAD_L,   0xb4
+	.set OFFSET_REG_DMA0DAD_H,   0xb6
+	.set OFFSET_REG_DMA0CNT,     0xb8
+	.set OFFSET_REG_DMA0CNT_L,   0xb8
+	.set OFFSET_REG_DMA0CNT_H,   0xba
+	.set OFFSET_REG_DMA1,        0xbc
+	.set OFFSET_REG_DMA1SAD,     0xbc
+	.set OFFSET_REG_DMA1SAD_L,   0xbc
+	.set OFFSET_REG_DMA1SAD_H,   0xbe
+	.set OFFSET_REG_DMA1DAD,     0xc0
+	.set OFFSET_REG_DMA1DAD_L,   0xc0
+	.set OFFSET_REG_DMA1DAD_H,   0xc2
+	.set OFFSET_REG_DMA1CNT,     0xc4
+	.set OFFSET_REG_DMA1CNT_L,   0xc4
+	.set OFFSET_REG_DMA1CNT_H,   0xc6
+	.set OFFSET_REG_DMA2,        0xc8
+	.set OFFSET_REG_DMA2SAD,     0xc8
+	.set OFFSET_REG_DMA2SAD_L,   0xc8
+	.set OFFSET_REG_DMA2SAD_H,   0xca
+	.set OFFSET_REG_DMA2DAD,     0xcc
+	.set OFFSET_REG_DMA2DAD_L,   0xcc
+	.set OFFSET_REG_DMA2DAD_H,   0xce
+	.set OFFSET_REG_DMA2CNT,     0xd0
+	.set OFFSET_REG_DMA2CNT_L,   0xd0
+	.set OFFSET_REG_DMA2CNT_H,   0xd2
+	.set OFFSET_REG_DMA3,        0xd4
+	.set OFFSET_REG_DMA3SAD,     0xd4
+	.set OFFSET_REG_DMA3SAD_L,   0xd4
+	.set OFFSET_REG_DMA3SAD_H,   0xd6
+	.set OFFSET_REG_DMA3DAD,     0xd8
+	.set OFFSET_REG_DMA3DAD_L,   0xd8
+	.set OFFSET_REG_DMA3DAD_H,   0xda
+	.set OFFSET_REG_DMA3CNT,     0xdc
+	.set OFFSET_REG_DMA3CNT_L,   0xdc
+	.set OFFSET_REG_DMA3CNT_H,   0xde
+
+	.set OFFSET_REG_TM0CNT,      0x100
+	.set OFFSET_REG_TM0CNT_L,    0x100
+	.set OFFSET_REG_TM0CNT_H,    0x102
+	.set OFFSET_REG_TM1CNT,      0x104
+	.set OFFSET_REG_TM1CNT_L,    0x104
+	.set OFFSET_REG_TM1CNT_H,    0x106
+	.set OFFSET_REG_TM2CNT,      0x108
+	.set OFFSET_REG_TM2CNT_L,    0x108
+	.set OFFSET_REG_TM2CNT_H,    0x10a
+	.set OFFSET_REG_TM3CNT,      0x10c
+	.set OFFSET_REG_TM3CNT_L,    0x10c
+	.set OFFSET_REG_TM3CNT_H,    0x10e
+
+	.set OFFSET_REG_SIOCNT,      0x128
+	.set OFFSET_REG_SIODATA8,    0x12a
+	.set OFFSET_REG_SIODATA32,   0x120
+	.set OFFSET_REG_SIOMLT_SEND, 0x12a
+	.set OFFSET_REG_SIOMLT_RECV, 0x120
+	.set OFFSET_REG_SIOMULTI0,   0x120
+	.set OFFSET_REG_SIOMULTI1,   0x122
+	.set OFFSET_REG_SIOMULTI2,   0x124
+	.set OFFSET_REG_SIOMULTI3,   0x126
+
+	.set OFFSET_REG_KEYINPUT,    0x130
+	.set OFFSET_REG_KEYCNT,      0x132
+
+	.set OFFSET_REG_RCNT,        0x134
+
+	.set OFFSET_REG_JOYCNT,      0x140
+	.set OFFSET_REG_JOYSTAT,     0x158
+	.set OFFSET_REG_JOY_RECV,    0x150
+	.set OFFSET_REG_JOY_RECV_L,  0x150
+	.set OFFSET_REG_JOY_RECV_H,  0x152
+	.set OFFSET_REG_JOY_TRANS,   0x154
+	.set OFFSET_REG_JOY_TRANS_L, 0x154
+	.set OFFSET_REG_JOY_TRANS_H, 0x156
+
+	.set OFFSET_REG_IME,         0x208
+	.set OFFSET_REG_IE,          0x200
+	.set OFFSET_REG_IF,          0x202
+
+	.set OFFSET_REG_WAITCNT,     0x204
+
+                        
+	.set REG_DISPCNT,     REG_BASE + OFFSET_REG_DISPCNT
+	.set REG_DISPSTAT,    REG_BASE + OFFSET_REG_DISPSTAT
+	.set REG_VCOUNT,      REG_BASE + OFFSET_REG_VCOUNT
+	.set REG_BG0CNT,      REG_BASE + OFFSET_REG_BG0CNT
+	.set REG_BG1CNT,      REG_BASE + OFFSET_REG_BG1CNT
+	.set REG_BG2CNT,      REG_BASE + OFFSET_REG_BG2CNT
+	.set REG_BG3CNT,      REG_BASE + OFFSET_REG_BG3CNT
+	.set REG_BG0HOFS,     REG_BASE + OFFSET_REG_BG0HOFS
+	.set REG_BG0VOFS,     REG_BASE + OFFSET_REG_BG0VOFS
+	.set REG_BG1HOFS,     REG_BASE + OFFSET_REG_BG1HOFS
+	.set REG_BG1VOFS,     REG_BASE + OFFSET_REG_BG1VOFS
+	.set REG_BG2HOFS,     REG_BASE + OFFSET_REG_BG2HOFS
+	.set REG_BG2VOFS,     REG_BASE + OFFSET_REG_BG2VOFS
+	.set REG_BG3HOFS,     REG_BASE + OFFSET_REG_BG3HOFS
+	.set REG_BG3VOFS,     REG_BASE + OFFSET_REG_BG3VOFS
+	.set REG_BG2PA,       REG_BASE + OFFSET_REG_BG2PA
+	.set REG_BG2PB,       REG_BASE + OFFSET_REG_BG2PB
+	.set REG_BG2PC,       REG_BASE + OFFSET_REG_BG2PC
+	.set REG_BG2PD,       REG_BASE + OFFSET_REG_BG2PD
+	.set REG_BG2X_L,      REG_BASE + OFFSET_REG_BG2X_L
+	.set REG_BG2X_H,      REG_BASE + OFFSET_REG_BG2X_H
+	.set REG_BG2Y_L,      REG_BASE + OFFSET_REG_BG2Y_L
+	.set REG_BG2Y_H,      REG_BASE + OFFSET_REG_BG2Y_H
+	.set REG_BG3PA,       REG_BASE + OFFSET_REG_BG3PA
+	.set REG_BG3PB,       REG_BASE + OFFSET_REG_BG3PB
+	.set REG_BG3PC,       REG_BASE + OFFSET_REG_BG3PC
+	.set REG_BG3PD,       REG_BASE + OFFSET_REG_BG3PD
+	.set REG_BG3X_L,      REG_BASE + OFFSET_REG_BG3X_L
+	.set REG_BG3X_H,      REG_BASE + OFFSET_REG_BG3X_H
+	.set REG_BG3Y_L,      REG_BASE + OFFSET_REG_BG3Y_L
+	.set REG_BG3Y_H,      REG_BASE + OFFSET_REG_BG3Y_H
+	.set REG_WIN0H,       REG_BASE + OFFSET_REG_WIN0H
+	.set REG_WIN1H,       REG_BASE + OFFSET_REG_WIN1H
+	.set REG_WIN0V,       REG_BASE + OFFSET_REG_WIN0V
+	.set REG_WIN1V,       REG_BASE + OFFSET_REG_WIN1V
+	.set REG_WININ,       REG_BASE + OFFSET_REG_WININ
+	.set REG_WINOUT,      REG_BASE + OFFSET_REG_WINOUT
+	.set REG_MOSAIC,      REG_BASE + OFFSET_REG_MOSAIC
+	.set REG_BLDCNT,      REG_BASE + OFFSET_REG_BLDCNT
+	.set REG_BLDALPHA,    REG_BASE + OFFSET_REG_BLDALPHA
+	.set REG_BLDY,        REG_BASE + OFFSET_REG_BLDY
+
+	.set REG_SOUND1CNT,   REG_BASE + OFFSET_REG_SOUND1CNT
+	.set REG_SOUND1CNT_L, REG_BASE + OFFSET_REG_SOUND1CNT_L
+	.set REG_NR10,        REG_BASE + OFFSET_REG_NR10
+	.set REG_SOUND1CNT_H, REG_BASE + OFFSET_REG_SOUND1CNT_H
+	.set REG_NR11,        REG_BASE + OFFSET_REG_NR11
+	.set REG_NR12,        REG_BASE + OFFSET_REG_NR12
+	.set REG_SOUND1CNT_X, REG_BASE + OFFSET_REG_SOUND1CNT_X
+	.set REG_NR13,        REG_BASE + OFFSET_REG_NR13
+	.set REG_NR14,        REG_BASE + OFFSET_REG_NR14
+	.set REG_SOUND2CNT,   REG_BASE + OFFSET_REG_SOUND2CNT
+	.set REG_SOUND2CNT_L, REG_BASE + OFFSET_REG_SOUND2CNT_L
+	.set REG_NR21,        REG_BASE + OFFSET_REG_NR21
+	.set REG_NR22,        REG_BASE + OFFSET_REG_NR22
+	.set REG_SOUND2CNT_H, REG_BASE + OFFSET_REG_SOUND2CNT_H
+	.set REG_NR23,        REG_BASE + OFFSET_REG_NR23
+	.set REG_NR24,        REG_BASE + OFFSET_REG_NR24
+	.set REG_SOUND3CNT,   REG_BASE + OFFSET_REG_SOUND3CNT
+	.set REG_SOUND3CNT_L, REG_BASE + OFFSET_REG_SOUND3CNT_L
+	.set REG_NR30,        REG_BASE + OFFSET_REG_NR30
+	.set REG_SOUND3CNT_H, REG_BASE + OFFSET_REG_SOUND3CNT_H
+	.set REG_NR31,        REG_BASE + OFFSET_REG_NR31
+	.set REG_NR32,        REG_BASE + OFFSET_REG_NR32
+	.set REG_SOUND3CNT_X, REG_BASE + OFFSET_REG_SOUND3CNT_X
+	.set REG_NR33,        REG_BASE + OFFSET_REG_NR33
+	.set REG_NR34,        REG_BASE + OFFSET_REG_NR34
+	.set REG_SOUND4CNT,   REG_BASE + OFFSET_REG_SOUND4CNT
+	.set REG_SOUND4CNT_L, REG_BASE + OFFSET_REG_SOUND4CNT_L
+	.set REG_NR41,        REG_BASE + OFFSET_REG_NR41
+	.set REG_NR42,        REG_BASE + OFFSET_REG_NR42
+	.set REG_SOUND4CNT_H, REG_BASE + OFFSET_REG_SOUND4CNT_H
+	.set REG_NR43,        REG_BASE + OFFSET_REG_NR43
+	.set REG_NR44,        REG_BASE + OFFSET_REG_NR44
+	.set REG_SOUNDCNT,    REG_BASE + OFFSET_REG_SOUNDCNT
+	.set REG_SOUNDCNT_L,  REG_BASE + OFFSET_REG_SOUNDCNT_L
+	.set REG_NR50,        REG_BASE + OFFSET_REG_NR50
+	.set REG_NR51,        REG_BASE + OFFSET_REG_NR51
+	.set REG_SOUNDCNT_H,  REG_BASE + OFFSET_REG_SOUNDCNT_H
+	.set REG_SOUNDCNT_X,  REG_BASE + OFFSET_REG_SOUNDCNT_X
+	.set REG_NR52,        REG_BASE + OFFSET_REG_NR52
+	.set REG_SOUNDBIAS,   REG_BASE + OFFSET_REG_SOUNDBIAS
+	.set REG_WAVE_RAM,    REG_BASE + OFFSET_REG_WAVE_RAM
+	.set REG_WAVE_RAM0,   REG_BASE + OFFSET_REG_WAVE_RAM0
+	.set REG_WAVE_RAM0_L, REG_BASE + OFFSET_REG_WAVE_RAM0_L
+	.set REG_WAVE_RAM0_H, REG_BASE + OFFSET_REG_WAVE_RAM0_H
+	.set REG_WAVE_RAM1,   REG_BASE + OFFSET_REG_WAVE_RAM1
+	.set REG_WAVE_RAM1_L, REG_BASE + OFFSET_REG_WAVE_RAM1_L
+	.set REG_WAVE_RAM1_H, REG_BASE + OFFSET_REG_WAVE_RAM1_H
+	.set REG_WAVE_RAM2,   REG_BASE + OFFSET_REG_WAVE_RAM2
+	.set REG_WAVE_RAM2_L, REG_BASE + OFFSET_REG_WAVE_RAM2_L
+	.set REG_WAVE_RAM2_H, REG_BASE + OFFSET_REG_WAVE_RAM2_H
+	.set REG_WAVE_RAM3,   REG_BASE + OFFSET_REG_WAVE_RAM3
+	.set REG_WAVE_RAM3_L, REG_BASE + OFFSET_REG_WAVE_RAM3_L
+	.set REG_WAVE_RAM3_H, REG_BASE + OFFSET_REG_WAVE_RAM3_H
+	.set REG_FIFO,        REG_BASE + OFFSET_REG_FIFO
+	.set REG_FIFO_A,      REG_BASE + OFFSET_REG_FIFO_A
+	.set REG_FIFO_A_L,    REG_BASE + OFFSET_REG_FIFO_A_L
+	.set REG_FIFO_A_H,    REG_BASE + OFFSET_REG_FIFO_A_H
+	.set REG_FIFO_B,      REG_BASE + OFFSET_REG_FIFO_B
+	.set REG_FIFO_B_L,    REG_BASE + OFFSET_REG_FIFO_B_L
+	.set REG_FIFO_B_H,    REG_BASE + OFFSET_REG_FIFO_B_H
+
+	.set REG_DMA0,        REG_BASE + OFFSET_REG_DMA0
+	.set REG_DMA0SAD,     REG_BASE + OFFSET_REG_DMA0SAD
+	.set REG_DMA0SAD_L,   REG_BASE + OFFSET_REG_DMA0SAD_L
+	.set REG_DMA0SAD_H,   REG_BASE + OFFSET_REG_DMA0SAD_H
+	.set REG_DMA0DAD,     REG_BASE + OFFSET_REG_DMA0DAD
+	.set REG_DMA0DAD_L,   REG_BASE + OFFSET_REG_DMA0DAD_L
+	.set REG_DMA0DAD_H,   REG_BASE + OFFSET_REG_DMA0DAD_H
+	.set REG_DMA0CNT,     REG_BASE + OFFSET_REG_DMA0CNT
+	.set REG_DMA0CNT_L,   REG_BASE + OFFSET_REG_DMA0CNT_L
+	.set REG_DMA0CNT_H,   REG_BASE + OFFSET_REG_DMA0CNT_H
+	.set REG_DMA1,        REG_BASE + OFFSET_REG_DMA1
+	.set REG_DMA1SAD,     REG_BASE + OFFSET_REG_DMA1SAD
+	.set REG_DMA1SAD_L,   REG_BASE + OFFSET_REG_DMA1SAD_L
+	.set REG_DMA1SAD_H,   REG_BASE + OFFSET_REG_DMA1SAD_H
+	.set REG_DMA1DAD,     REG_BASE + OFFSET_REG_DMA1DAD
+	.set REG_DMA1DAD_L,   REG_BASE + OFFSET_REG_DMA1DAD_L
+	.set REG_DMA1DAD_H,   REG_BASE + OFFSET_REG_DMA1DAD_H
+	.set REG_DMA1CNT,     REG_BASE + OFFSET_REG_DMA1CNT
+	.set REG_DMA1CNT_L,   REG_BASE + OFFSET_REG_DMA1CNT_L
+	.set REG_DMA1CNT_H,   REG_BASE + OFFSET_REG_DMA1CNT_H
+	.set REG_DMA2,        REG_BASE + OFFSET_REG_DMA2
+	.set REG_DMA2SAD,     REG_BASE + OFFSET_REG_DMA2SAD
+	.set REG_DMA2SAD_L,   REG_BASE + OFFSET_REG_DMA2SAD_L
+	.set REG_DMA2SAD_H,   REG_BASE + OFFSET_REG_DMA2SAD_H
+	.set REG_DMA2DAD,     REG_BASE + OFFSET_REG_DMA2DAD
+	.set REG_DMA2DAD_L,   REG_BASE + OFFSET_REG_DMA2DAD_L
+	.set REG_DMA2DAD_H,   REG_BASE + OFFSET_REG_DMA2DAD_H
+	.set REG_DMA2CNT,     REG_BASE + OFFSET_REG_DMA2CNT
+	.set REG_DMA2CNT_L,   REG_BASE + OFFSET_REG_DMA2CNT_L
+	.set REG_DMA2CNT_H,   REG_BASE + OFFSET_REG_DMA2CNT_H
+	.set REG_DMA3,        REG_BASE + OFFSET_REG_DMA3
+	.set REG_DMA3SAD,     REG_BASE + OFFSET_REG_DMA3SAD
+	.set REG_DMA3SAD_L,   REG_BASE + OFFSET_REG_DMA3SAD_L
+	.set REG_DMA3SAD_H,   REG_BASE + OFFSET_REG_DMA3SAD_H
+	.set REG_DMA3DAD,     REG_BASE + OFFSET_REG_DMA3DAD
+	.set REG_DMA3DAD_L,   REG_BASE + OFFSET_REG_DMA3DAD_L
+	.set REG_DMA3DAD_H,   REG_BASE + OFFSET_REG_DMA3DAD_H
+	.set REG_DMA3CNT,     REG_BASE + OFFSET_REG_DMA3CNT
+	.set REG_DMA3CNT_L,   REG_BASE + OFFSET_REG_DMA3CNT_L
+	.set REG_DMA3CNT_H,   REG_BASE + OFFSET_REG_DMA3CNT_H
+
+	.set REG_TM0CNT,      REG_BASE + OFFSET_REG_TM0CNT
+	.set REG_TM0CNT_L,    REG_BASE + OFFSET_REG_TM0CNT_L
+	.set REG_TM0CNT_H,    REG_BASE + OFFSET_REG_TM0CNT_H
+	.set REG_TM1CNT,      REG_BASE + OFFSET_REG_TM1CNT
+	.set REG_TM1CNT_L,    REG_BASE + OFFSET_REG_TM1CNT_L
+	.set REG_TM1CNT_H,    REG_BASE + OFFSET_REG_TM1CNT_H
+	.set REG_TM2CNT,      REG_BASE + OFFSET_REG_TM2CNT
+	.set REG_TM2CNT_L,    REG_BASE + OFFSET_REG_TM2CNT_L
+	.set REG_TM2CNT_H,    REG_BASE + OFFSET_REG_TM2CNT_H
+	.set REG_TM3CNT,      REG_BASE + OFFSET_REG_TM3CNT
+	.set REG_TM3CNT_L,    REG_BASE + OFFSET_REG_TM3CNT_L
+	.set REG_TM3CNT_H,    REG_BASE + OFFSET_REG_TM3CNT_H
+
+	.set REG_SIOCNT,      REG_BASE + OFFSET_REG_SIOCNT
+	.set REG_SIODATA8,    REG_BASE + OFFSET_REG_SIODATA8
+	.set REG_SIODATA32,   REG_BASE + OFFSET_REG_SIODATA32
+	.set REG_SIOMLT_SEND, REG_BASE + OFFSET_REG_SIOMLT_SEND
+	.set REG_SIOMLT_RECV, REG_BASE + OFFSET_REG_SIOMLT_RECV
+	.set REG_SIOMULTI0,   REG_BASE + OFFSET_REG_SIOMULTI0
+	.set REG_SIOMULTI1,   REG_BASE + OFFSET_REG_SIOMULTI1
+	.set REG_SIOMULTI2,   REG_BASE + OFFSET_REG_SIOMULTI2
+	.set REG_SIOMULTI3,   REG_BASE + OFFSET_REG_SIOMULTI3
+
+	.set REG_KEYINPUT,    REG_BASE + OFFSET_REG_KEYINPUT
+	.set REG_KEYCNT,      REG_BASE + OFFSET_REG_KEYCNT
+
+	.set REG_RCNT,        REG_BASE + OFFSET_REG_RCNT
+
+	.set REG_JOYCNT,      REG_BASE + OFFSET_REG_JOYCNT
+	.set REG_JOYSTAT,     REG_BASE + OFFSET_REG_JOYSTAT
+	.set REG_JOY_RECV,    REG_BASE + OFFSET_REG_JOY_RECV
+	.set REG_JOY_RECV_L,  REG_BASE + OFFSET_REG_JOY_RECV_L
+	.set REG_JOY_RECV_H,  REG_BASE + OFFSET_REG_JOY_RECV_H
+	.set REG_JOY_TRANS,   REG_BASE + OFFSET_REG_JOY_TRANS
+	.set REG_JOY_TRANS_L, REG_BASE + OFFSET_REG_JOY_TRANS_L
+	.set REG_JOY_TRANS_H, REG_BASE + OFFSET_REG_JOY_TRANS_H
+
+	.set REG_IME,         REG_BASE + OFFSET_REG_IME
+	.set REG_IE,          REG_BASE + OFFSET_REG_IE
+	.set REG_IF,          REG_BASE + OFFSET_REG_IF
+
+	.set REG_WAITCNT,     REG_BASE + OFFSET_REG_WAITCNT
+
+                        
+
+	.set DMA_DEST_INC,      0x0000
+	.set DMA_DEST_DEC,      0x0020
+	.set DMA_DEST_FIXED,    0x0040
+	.set DMA_DEST_RELOAD,   0x0060
+	.set DMA_SRC_INC,       0x0000
+	.set DMA_SRC_DEC,       0x0080
+	.set DMA_SRC_FIXED,     0x0100
+	.set DMA_REPEAT,        0x0200
+	.set DMA_16BIT,         0x0000
+	.set DMA_32BIT,         0x0400
+	.set DMA_DREQ_ON,       0x0800
+	.set DMA_START_NOW,     0x0000
+	.set DMA_START_VBLANK,  0x1000
+	.set DMA_START_HBLANK,  0x2000
+	.set DMA_START_SPECIAL, 0x3000
+	.set DMA_INTR_ENABLE,   0x4000
+	.set DMA_ENABLE,        0x8000
+
+                         
+
+	.set OAM_OBJ_NORMAL,         0x00000000
+	.set OAM_OBJ_BLEND,          0x00000400
+	.set OAM_OBJ_WINDOW,         0x00000800
+
+	.set OAM_AFFINE_NONE,        0x00000000
+	.set OAM_AFFINE_NORMAL_SIZE, 0x00000100
+	.set OAM_OBJ_DISABLED,       0x00000200
+	.set OAM_AFFINE_DOUBLE_SIZE, 0x00000300
+
+	.set OAM_MOSAIC_OFF,         0x00000000
+	.set OAM_MOSAIC_ON,          0x00001000
+
+	.set OAM_4BPP,               0x00000000
+	.set OAM_8BPP,               0x00002000
+
+	.set OAM_H_FLIP,             0x10000000
+	.set OAM_V_FLIP,             0x20000000
+
+	.set OAM_SQUARE,             0x00000000
+	.set OAM_H_RECTANGLE,        0x00004000
+	.set OAM_V_RECTANGLE,        0x00008000
+	.set OAM_SIZE_0,             0x00000000
+	.set OAM_SIZE_1,             0x40000000
+	.set OAM_SIZE_2,             0x80000000
+	.set OAM_SIZE_3,             0xc0000000
+
+	.set OAM_SIZE_8x8,           OAM_SIZE_0 | OAM_SQUARE
+	.set OAM_SIZE_16x16,         OAM_SIZE_1 | OAM_SQUARE
+	.set OAM_SIZE_32x32,         OAM_SIZE_2 | OAM_SQUARE
+	.set OAM_SIZE_64x64,         OAM_SIZE_3 | OAM_SQUARE
+
+	.set OAM_SIZE_16x8,          OAM_SIZE_0 | OAM_H_RECTANGLE
+	.set OAM_SIZE_32x8,          OAM_SIZE_1 | OAM_H_RECTANGLE
+	.set OAM_SIZE_32x16,         OAM_SIZE_2 | OAM_H_RECTANGLE
+	.set OAM_SIZE_64x32,         OAM_SIZE_3 | OAM_H_RECTANGLE
+
+	.set OAM_SIZE_8x16,          OAM_SIZE_0 | OAM_V_RECTANGLE
+	.set OAM_SIZE_8x32,          OAM_SIZE_1 | OAM_V_RECTANGLE
+	.set OAM_SIZE_16x32,         OAM_SIZE_2 | OAM_V_RECTANGLE
+	.set OAM_SIZE_32x64,         OAM_SIZE_3 | OAM_V_RECTANGLE
+
+        
+
+	.set BLDCNT_TGT1_BG0,       1 << 0
+	.set BLDCNT_TGT1_BG1,       1 << 1
+	.set BLDCNT_TGT1_BG2,       1 << 2
+	.set BLDCNT_TGT1_BG3,       1 << 3
+	.set BLDCNT_TGT1_OBJ,       1 << 4
+	.set BLDCNT_TGT1_BD,        1 << 5
+	.set BLDCNT_TGT1_ALL,       BLDCNT_TGT1_BG0 | BLDCNT_TGT1_BG1 | BLDCNT_TGT1_BG2 | BLDCNT_TGT1_BG3 | BLDCNT_TGT1_OBJ | BLDCNT_TGT1_BD
+
+	.set BLDCNT_EFFECT_NONE,    0 << 6
+	.set BLDCNT_EFFECT_BLEND,   1 << 6
+	.set BLDCNT_EFFECT_LIGHTEN, 2 << 6
+	.set BLDCNT_EFFECT_DARKEN,  3 << 6
+
+	.set BLDCNT_TGT2_BG0,       1 << 8
+	.set BLDCNT_TGT2_BG1,       1 << 9
+	.set BLDCNT_TGT2_BG2,       1 << 10
+	.set BLDCNT_TGT2_BG3,       1 << 11
+	.set BLDCNT_TGT2_OBJ,       1 << 12
+	.set BLDCNT_TGT2_BD,        1 << 13
+	.set BLDCNT_TGT2_ALL,       BLDCNT_TGT2_BG0 | BLDCNT_TGT2_BG1 | BLDCNT_TGT2_BG2 | BLDCNT_TGT2_BG3 | BLDCNT_TGT2_OBJ | BLDCNT_TGT2_BD
+# 2 "src/libagbsyscall.s"
+# 1 "asm/macros.inc"
+# 1 "asm/macros/asm.inc"
+	.ifndef GUARD_ASM_MACROS_ASM_INC
+	.set GUARD_ASM_MACROS_ASM_INC, 1
+
+	.macro inc x
+	.set \x, \x + 1
+	.endm
+
+	.macro enum_start x=0
+	.set __enum__, \x
+	.endm
+
+	.macro enum constant
+	.equiv \constant, __enum__
+	inc __enum__
+	.endm
+
+	.endif                           
+# 2 "asm/macros.inc"
+# 1 "asm/macros/function.inc"
+	.macro arm_func_start name
+	.align 2, 0
+	.global \name
+	.arm
+	.type \name, function
+	.endm
+
+	.macro arm_func_end name
+	.size \name, .-\name
+	.endm
+
+	.macro thumb_func_start name
+	.align 2, 0
+	.global \name
+	.thumb
+	.thumb_func
+	.type \name, function
+	.endm
+
+	.macro non_word_aligned_thumb_func_start name
+	.global \name
+	.thumb
+	.thumb_func
+	.type \name, function
+	.endm
+
+	.macro thumb_func_end name
+	.size \name, .-\name
+	.endm
+# 3 "asm/macros.inc"
+# 1 "asm/macros/movement.inc"
+	.macro create_movement_action name:req, value:req
+	.macro \name
+	.byte \value
+	.endm
+	.endm
+
+	create_movement_action face_down, MOVEMENT_ACTION_FACE_DOWN
+	create_movement_action face_up, MOVEMENT_ACTION_FACE_UP
+	create_movement_action face_left, MOVEMENT_ACTION_FACE_LEFT
+	create_movement_action face_right, MOVEMENT_ACTION_FACE_RIGHT
+	create_movement_action face_down_fast, MOVEMENT_ACTION_FACE_DOWN_FAST
+	create_movement_action face_up_fast, MOVEMENT_ACTION_FACE_UP_FAST
+	create_movement_action face_left_fast, MOVEMENT_ACTION_FACE_LEFT_FAST
+	create_movement_action face_right_fast, MOVEMENT_ACTION_FACE_RIGHT_FAST
+	create_movement_action walk_slower_down, MOVEMENT_ACTION_WALK_SLOWER_DOWN
+	create_movement_action walk_slower_up, MOVEMENT_ACTION_WALK_SLOWER_UP
+	create_movement_action walk_slower_left, MOVEMENT_ACTION_WALK_SLOWER_LEFT
+	create_movement_action walk_slower_right, MOVEMENT_ACTION_WALK_SLOWER_RIGHT
+	create_movement_action walk_slow_down, MOVEMENT_ACTION_WALK_SLOW_DOWN
+	create_movement_action walk_slow_up, MOVEMENT_ACTION_WALK_SLOW_UP
+	create_movement_action walk_slow_left, MOVEMENT_ACTION_WALK_SLOW_LEFT
+	create_movement_action walk_slow_right, MOVEMENT_ACTION_WALK_SLOW_RIGHT
+	create_movement_action walk_down, MOVEMENT_ACTION_WALK_NORMAL_DOWN
+	create_movement_action walk_up, MOVEMENT_ACTION_WALK_NORMAL_UP
+	create_movement_action walk_left, MOVEMENT_ACTION_WALK_NORMAL_LEFT
+	create_movement_action walk_right, MOVEMENT_ACTION_WALK_NORMAL_RIGHT
+	create_movement_action jump_2_down, MOVEMENT_ACTION_JUMP_2_DOWN
+	create_movement_action jump_2_up, MOVEMENT_ACTION_JUMP_2_UP
+	create_movement_action jump_2_left, MOVEMENT_ACTION_JUMP_2_LEFT
+	create_movement_action jump_2_right, MOVEMENT_ACTION_JUMP_2_RIGHT
+	create_movement_action delay_1, MOVEMENT_ACTION_DELAY_1
+	create_movement_action delay_2, MOVEMENT_ACTION_DELAY_2
+	create_movement_action delay_4, MOVEMENT_ACTION_DELAY_4
+	create_movement_action delay_8, MOVEMENT_ACTION_DELAY_8
+	create_movement_action delay_16, MOVEMENT_ACTION_DELAY_16
+	create_movement_action walk_fast_down, MOVEMENT_ACTION_WALK_FAST_DOWN
+	create_movement_action walk_fast_up, MOVEMENT_ACTION_WALK_FAST_UP
+	create_movement_action walk_fast_left, MOVEMENT_ACTION_WALK_FAST_LEFT
+	create_movement_action walk_fast_right, MOVEMENT_ACTION_WALK_FAST_RIGHT
+	create_movement_action walk_in_place_slow_down, MOVEMENT_ACTION_WALK_IN_PLACE_SLOW_DOWN
+	create_movement_action walk_in_place_slow_up, MOVEMENT_ACTION_WALK_IN_PLACE_SLOW_UP
+	create_movement_action walk_in_place_slow_left, MOVEMENT_ACTION_WALK_IN_PLACE_SLOW_LEFT
+	create_movement_action walk_in_place_slow_right, MOVEMENT_ACTION_WALK_IN_PLACE_SLOW_RIGHT
+	create_movement_action walk_in_place_down, MOVEMENT_ACTION_WALK_IN_PLACE_NORMAL_DOWN
+	create_movement_action walk_in_place_up, MOVEMENT_ACTION_WALK_IN_PLACE_NORMAL_UP
+	create_movement_action walk_in_place_left, MOVEMENT_ACTION_WALK_IN_PLACE_NORMAL_LEFT
+	create_movement_action walk_in_place_right, MOVEMENT_ACTION_WALK_IN_PLACE_NORMAL_RIGHT
+	create_movement_action walk_in_place_fast_down, MOVEMENT_ACTION_WALK_IN_PLACE_FAST_DOWN
+	create_movement_action walk_in_place_fast_up, MOVEMENT_ACTION_WALK_IN_PLACE_FAST_UP
+	create_movement_action walk_in_place_fast_left, MOVEMENT_ACTION_WALK_IN_PLACE_FAST_LEFT
+	create_movement_action walk_in_place_fast_right, MOVEMENT_ACTION_WALK_IN_PLACE_FAST_RIGHT
+	create_movement_action walk_in_place_faster_down, MOVEMENT_ACTION_WALK_IN_PLACE_FASTER_DOWN
+	create_movement_action walk_in_place_faster_up, MOVEMENT_ACTION_WALK_IN_PLACE_FASTER_UP
+	create_movement_action walk_in_place_faster_left, MOVEMENT_ACTION_WALK_IN_PLACE_FASTER_LEFT
+	create_movement_action walk_in_place_faster_right, MOVEMENT_ACTION_WALK_IN_PLACE_FASTER_RIGHT
+	create_movement_action ride_water_current_down, MOVEMENT_ACTION_RIDE_WATER_CURRENT_DOWN
+	create_movement_action ride_water_current_up, MOVEMENT_ACTION_RIDE_WATER_CURRENT_UP
+	create_movement_action ride_water_current_lefft, MOVEMENT_ACTION_RIDE_WATER_CURRENT_LEFT
+	create_movement_action ride_water_current_right, MOVEMENT_ACTION_RIDE_WATER_CURRENT_RIGHT
+	create_movement_action walk_faster_down, MOVEMENT_ACTION_WALK_FASTER_DOWN
+	create_movement_action walk_faster_up, MOVEMENT_ACTION_WALK_FASTER_UP
+	create_movement_action walk_faster_left, MOVEMENT_ACTION_WALK_FASTER_LEFT
+	create_movement_action walk_faster_right, MOVEMENT_ACTION_WALK_FASTER_RIGHT
+	create_movement_action slide_down, MOVEMENT_ACTION_SLIDE_DOWN
+	create_movement_action slide_up, MOVEMENT_ACTION_SLIDE_UP
+	create_movement_action slide_left, MOVEMENT_ACTION_SLIDE_LEFT
+	create_movement_action slide_right, MOVEMENT_ACTION_SLIDE_RIGHT
+	create_movement_action player_run_down, MOVEMENT_ACTION_PLAYER_RUN_DOWN
+	create_movement_action player_run_up, MOVEMENT_ACTION_PLAYER_RUN_UP
+	create_movement_action player_run_left, MOVEMENT_ACTION_PLAYER_RUN_LEFT
+	create_movement_action player_run_right, MOVEMENT_ACTION_PLAYER_RUN_RIGHT
+	create_movement_action player_run_down_slow, MOVEMENT_ACTION_PLAYER_RUN_DOWN_SLOW
+	create_movement_action player_run_up_slow, MOVEMENT_ACTION_PLAYER_RUN_UP_SLOW
+	create_movement_action player_run_left_slow, MOVEMENT_ACTION_PLAYER_RUN_LEFT_SLOW
+	create_movement_action player_run_right_slow, MOVEMENT_ACTION_PLAYER_RUN_RIGHT_SLOW
+	create_movement_action start_anim_in_direction, MOVEMENT_ACTION_START_ANIM_IN_DIRECTION
+	create_movement_action jump_special_down, MOVEMENT_ACTION_JUMP_SPECIAL_DOWN
+	create_movement_action jump_special_up, MOVEMENT_ACTION_JUMP_SPECIAL_UP
+	create_movement_action jump_special_left, MOVEMENT_ACTION_JUMP_SPECIAL_LEFT
+	create_movement_action jump_special_right, MOVEMENT_ACTION_JUMP_SPECIAL_RIGHT
+	create_movement_action face_player, MOVEMENT_ACTION_FACE_PLAYER
+	create_movement_action face_away_player, MOVEMENT_ACTION_FACE_AWAY_PLAYER
+	create_movement_action lock_facing_direction, MOVEMENT_ACTION_LOCK_FACING_DIRECTION
+	create_movement_action unlock_facing_direction, MOVEMENT_ACTION_UNLOCK_FACING_DIRECTION
+	create_movement_action jump_down, MOVEMENT_ACTION_JUMP_DOWN
+	create_movement_action jump_up, MOVEMENT_ACTION_JUMP_UP
+	create_movement_action jump_left, MOVEMENT_ACTION_JUMP_LEFT
+	create_movement_action jump_right, MOVEMENT_ACTION_JUMP_RIGHT
+	create_movement_action jump_in_place_down, MOVEMENT_ACTION_JUMP_IN_PLACE_DOWN
+	create_movement_action jump_in_place_up, MOVEMENT_ACTION_JUMP_IN_PLACE_UP
+	create_movement_action jump_in_place_left, MOVEMENT_ACTION_JUMP_IN_PLACE_LEFT
+	create_movement_action jump_in_place_right, MOVEMENT_ACTION_JUMP_IN_PLACE_RIGHT
+	create_movement_action jump_in_place_down_up, MOVEMENT_ACTION_JUMP_IN_PLACE_DOWN_UP
+	create_movement_action jump_in_place_up_down, MOVEMENT_ACTION_JUMP_IN_PLACE_UP_DOWN
+	create_movement_action jump_in_place_left_right, MOVEMENT_ACTION_JUMP_IN_PLACE_LEFT_RIGHT
+	create_movement_action jump_in_place_right_left, MOVEMENT_ACTION_JUMP_IN_PLACE_RIGHT_LEFT
+	create_movement_action face_original_direction, MOVEMENT_ACTION_FACE_ORIGINAL_DIRECTION
+	create_movement_action nurse_joy_bow, MOVEMENT_ACTION_NURSE_JOY_BOW_DOWN
+	create_movement_action enable_jump_landing_ground_effect, MOVEMENT_ACTION_ENABLE_JUMP_LANDING_GROUND_EFFECT
+	create_movement_action disable_jump_landing_ground_effect, MOVEMENT_ACTION_DISABLE_JUMP_LANDING_GROUND_EFFECT
+	create_movement_action disable_anim, MOVEMENT_ACTION_DISABLE_ANIMATION
+	create_movement_action restore_anim, MOVEMENT_ACTION_RESTORE_ANIMATION
+	create_movement_action set_invisible, MOVEMENT_ACTION_SET_INVISIBLE
+	create_movement_action set_visible, MOVEMENT_ACTION_SET_VISIBLE
+	create_movement_action emote_exclamation_mark, MOVEMENT_ACTION_EMOTE_EXCLAMATION_MARK
+	create_movement_action emote_question_mark, MOVEMENT_ACTION_EMOTE_QUESTION_MARK
+	create_movement_action emote_x, MOVEMENT_ACTION_EMOTE_X
+	create_movement_action emote_double_exclamation_mark, MOVEMENT_ACTION_EMOTE_DOUBLE_EXCL_MARK
+	create_movement_action emote_smile, MOVEMENT_ACTION_EMOTE_SMILE
+	create_movement_action reveal_trainer, MOVEMENT_ACTION_REVEAL_TRAINER
+	create_movement_action rock_smash_break, MOVEMENT_ACTION_ROCK_SMASH_BREAK
+	create_movement_action cut_tree, MOVEMENT_ACTION_CUT_TREE
+	create_movement_action set_fixed_priority, MOVEMENT_ACTION_SET_FIXED_PRIORITY
+	create_movement_action clear_fixed_priority, MOVEMENT_ACTION_CLEAR_FIXED_PRIORITY
+	create_movement_action init_affine_anim, MOVEMENT_ACTION_INIT_AFFINE_ANIM
+	create_movement_action clear_affine_anim, MOVEMENT_ACTION_CLEAR_AFFINE_ANIM
+	create_movement_action walk_down_start_affine, MOVEMENT_ACTION_WALK_DOWN_START_AFFINE
+	create_movement_action walk_down_affine, MOVEMENT_ACTION_WALK_DOWN_AFFINE
+	create_movement_action acro_wheelie_face_down, MOVEMENT_ACTION_ACRO_WHEELIE_FACE_DOWN
+	create_movement_action acro_wheelie_face_up, MOVEMENT_ACTION_ACRO_WHEELIE_FACE_UP
+	create_movement_action acro_wheelie_face_left, MOVEMENT_ACTION_ACRO_WHEELIE_FACE_LEFT
+	create_movement_action acro_wheelie_face_right, MOVEMENT_ACTION_ACRO_WHEELIE_FACE_RIGHT
+	create_movement_action acro_pop_wheelie_down, MOVEMENT_ACTION_ACRO_POP_WHEELIE_DOWN
+	create_movement_action acro_pop_wheelie_up, MOVEMENT_ACTION_ACRO_POP_WHEELIE_UP
+	create_movement_action acro_pop_wheelie_left, MOVEMENT_ACTION_ACRO_POP_WHEELIE_LEFT
+	create_movement_action acro_pop_wheelie_right, MOVEMENT_ACTION_ACRO_POP_WHEELIE_RIGHT
+	create_movement_action acro_end_wheelie_face_down, MOVEMENT_ACTION_ACRO_END_WHEELIE_FACE_DOWN
+	create_movement_action acro_end_wheelie_face_up, MOVEMENT_ACTION_ACRO_END_WHEELIE_FACE_UP
+	create_movement_action acro_end_wheelie_face_left, MOVEMENT_ACTION_ACRO_END_WHEELIE_FACE_LEFT
+	create_movement_action acro_end_wheelie_face_right, MOVEMENT_ACTION_ACRO_END_WHEELIE_FACE_RIGHT
+	create_movement_action acro_wheelie_hop_face_down, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_FACE_DOWN
+	create_movement_action acro_wheelie_hop_face_up, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_FACE_UP
+	create_movement_action acro_wheelie_hop_face_left, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_FACE_LEFT
+	create_movement_action acro_wheelie_hop_face_right, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_FACE_RIGHT
+	create_movement_action acro_wheelie_hop_down, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_DOWN
+	create_movement_action acro_wheelie_hop_up, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_UP
+	create_movement_action acro_wheelie_hop_left, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_LEFT
+	create_movement_action acro_wheelie_hop_right, MOVEMENT_ACTION_ACRO_WHEELIE_HOP_RIGHT
+	create_movement_action acro_wheelie_jump_down, MOVEMENT_ACTION_ACRO_WHEELIE_JUMP_DOWN
+	create_movement_action acro_wheelie_jump_up, MOVEMENT_ACTION_ACRO_WHEELIE_JUMP_UP
+	create_movement_action acro_wheelie_jump_left, MOVEMENT_ACTION_ACRO_WHEELIE_JUMP_LEFT
+	create_movement_action acro_wheelie_jump_right, MOVEMENT_ACTION_ACRO_WHEELIE_JUMP_RIGHT
+	create_movement_action acro_wheelie_in_place_down, MOVEMENT_ACTION_ACRO_WHEELIE_IN_PLACE_DOWN
+	create_movement_action acro_wheelie_in_place_up, MOVEMENT_ACTION_ACRO_WHEELIE_IN_PLACE_UP
+	create_movement_action acro_wheelie_in_place_left, MOVEMENT_ACTION_ACRO_WHEELIE_IN_PLACE_LEFT
+	create_movement_action acro_wheelie_in_place_right, MOVEMENT_ACTION_ACRO_WHEELIE_IN_PLACE_RIGHT
+	create_movement_action acro_pop_wheelie_move_down, MOVEMENT_ACTION_ACRO_POP_WHEELIE_MOVE_DOWN
+	create_movement_action acro_pop_wheelie_move_up, MOVEMENT_ACTION_ACRO_POP_WHEELIE_MOVE_UP
+	create_movement_action acro_pop_wheelie_move_left, MOVEMENT_ACTION_ACRO_POP_WHEELIE_MOVE_LEFT
+	create_movement_action acro_pop_wheelie_move_right, MOVEMENT_ACTION_ACRO_POP_WHEELIE_MOVE_RIGHT
+	create_movement_action acro_wheelie_move_down, MOVEMENT_ACTION_ACRO_WHEELIE_MOVE_DOWN
+	create_movement_action acro_wheelie_move_up, MOVEMENT_ACTION_ACRO_WHEELIE_MOVE_UP
+	create_movement_action acro_wheelie_move_left, MOVEMENT_ACTION_ACRO_WHEELIE_MOVE_LEFT
+	create_movement_action acro_wheelie_move_right, MOVEMENT_ACTION_ACRO_WHEELIE_MOVE_RIGHT
+	create_movement_action spin_down, MOVEMENT_ACTION_SPIN_DOWN
+	create_movement_action spin_up, MOVEMENT_ACTION_SPIN_UP
+	create_movement_action spin_left, MOVEMENT_ACTION_SPIN_LEFT
+	create_movement_action spin_right, MOVEMENT_ACTION_SPIN_RIGHT
+	create_movement_action raise_hand_and_stop, MOVEMENT_ACTION_RAISE_HAND_AND_STOP
+	create_movement_action raise_hand_and_jump, MOVEMENT_ACTION_RAISE_HAND_AND_JUMP
+	create_movement_action raise_hand_and_swim, MOVEMENT_ACTION_RAISE_HAND_AND_SWIM
+	create_movement_action walk_slowest_down, MOVEMENT_ACTION_WALK_SLOWEST_DOWN
+	create_movement_action walk_slowest_up, MOVEMENT_ACTION_WALK_SLOWEST_UP
+	create_movement_action walk_slowest_left, MOVEMENT_ACTION_WALK_SLOWEST_LEFT
+	create_movement_action walk_slowest_right, MOVEMENT_ACTION_WALK_SLOWEST_RIGHT
+	create_movement_action shake_head_or_walk_in_place, MOVEMENT_ACTION_SHAKE_HEAD_OR_WALK_IN_PLACE
+	create_movement_action glide_down, MOVEMENT_ACTION_GLIDE_DOWN
+	create_movement_action glide_up, MOVEMENT_ACTION_GLIDE_UP
+	create_movement_action glide_left, MOVEMENT_ACTION_GLIDE_LEFT
+	create_movement_action glide_right, MOVEMENT_ACTION_GLIDE_RIGHT
+	create_movement_action fly_up, MOVEMENT_ACTION_FLY_UP
+	create_movement_action fly_down, MOVEMENT_ACTION_FLY_DOWN
+	create_movement_action jump_special_with_effect_down, MOVEMENT_ACTION_JUMP_SPECIAL_WITH_EFFECT_DOWN
+	create_movement_action jump_special_with_effect_up, MOVEMENT_ACTION_JUMP_SPECIAL_WITH_EFFECT_UP
+	create_movement_action jump_special_with_effect_left, MOVEMENT_ACTION_JUMP_SPECIAL_WITH_EFFECT_LEFT
+	create_movement_action jump_special_with_effect_right, MOVEMENT_ACTION_JUMP_SPECIAL_WITH_EFFECT_RIGHT
+	create_movement_action step_end, MOVEMENT_ACTION_STEP_END
+# 4 "asm/macros.inc"
+# 1 "asm/macros/ec.inc"
+
+	.macro ec_duplicates count
+	.2byte 0xff00 + \count
+	.endm
+
+	.macro ec_words_by_letter label
+	.2byte (gEasyChatWordsByLetter_\label - gEasyChatWordsAlphabetized) / 2
+	.endm
+# 5 "asm/macros.inc"
+# 1 "asm/macros/map.inc"
+                                                                                                                                   
+
+	                                                                                 
+	.macro map map_id:req
+	.byte \map_id >> 8               
+	.byte \map_id & 0xFF           
+	.endm
+
+	                                                                                                 
+	.macro map_script type:req, script:req
+	.byte \type
+	.4byte \script
+	.endm
+
+	                                                                                              
+	.macro map_script_2 var:req, compare:req, script:req
+	.2byte \var
+	.2byte \compare
+	.4byte \script
+	.endm
+
+	                                                                                                                                                             
+	.macro object_event index:req, gfx:req, x:req, y:req, elevation:req, movement_type:req, x_radius:req, y_radius:req, trainer_type:req, sight_radius_tree_etc:req, script:req, event_flag:req
+	.byte \index
+	.byte \gfx
+	.byte OBJ_KIND_NORMAL
+	.space 1           
+	.2byte \x, \y
+	.byte \elevation
+	.byte \movement_type
+	.byte ((\y_radius << 4) | \x_radius)
+	.space 1           
+	.2byte \trainer_type
+	.2byte \sight_radius_tree_etc
+	.4byte \script
+	.2byte \event_flag
+	.space 2           
+	inc _num_npcs
+	.endm
+
+	                                                                                                                                                            
+	.macro clone_event index:req, gfx:req, x:req, y:req, target_local_id:req, target_map_id:req
+	.byte \index
+	.byte \gfx
+	.byte OBJ_KIND_CLONE
+	.space 1           
+	.2byte \x, \y
+	.byte \target_local_id
+	.space 3           
+	.2byte \target_map_id & 0xFF           
+	.2byte \target_map_id >> 8               
+	.space 8           
+	inc _num_npcs
+	.endm
+
+	                                                                                                        
+	.macro warp_def x:req, y:req, elevation:req, warpId:req, map_id:req
+	.2byte \x, \y
+	.byte \elevation
+	.byte \warpId
+	.byte \map_id & 0xFF           
+	.byte \map_id >> 8               
+	inc _num_warps
+	.endm
+
+	                                                                                                          
+	.macro coord_event x:req, y:req, elevation:req, var:req, varValue:req, script:req
+	.2byte \x, \y
+	.byte \elevation
+	.space 1           
+	.2byte \var
+	.2byte \varValue
+	.space 2           
+	.4byte \script
+	inc _num_traps
+	.endm
+
+	                                                                                                                        
+	                                                                                              
+	.macro coord_weather_event x:req, y:req, elevation:req, weather:req
+	coord_event \x, \y, \elevation, \weather, 0, NULL
+	.endm
+
+	                                                                                                                    
+	                                                                       
+	                                                                                                                     
+	                   
+	.macro bg_event x:req, y, elevation:req, kind:req, arg6:req, arg7, arg8
+	.2byte \x, \y
+	.byte \elevation
+	.byte \kind
+	.space 2           
+	.if \kind != BG_EVENT_HIDDEN_ITEM
+		.4byte \arg6
+	.else
+		.2byte \arg6
+		.byte \arg7
+		.byte \arg8
+	.endif
+	inc _num_signs
+	.endm
+
+	                                                                                                                                                
+	.macro bg_sign_event x:req, y:req, elevation:req, facing_dir:req, script:req
+	bg_event \x, \y, \elevation, \facing_dir, \script
+	.endm
+
+	                                                     
+	.macro bg_hidden_item_event x:req, y:req, elevation:req, item:req, flag:req, quantity:req, underfoot:req
+	bg_event \x, \y, \elevation, BG_EVENT_HIDDEN_ITEM, \item, ((\flag) - FLAG_HIDDEN_ITEMS_START), \quantity | (\underfoot << 7)
+	.endm
+
+	                                                      
+	                
+	.macro bg_secret_base_event x:req, y:req, elevation:req, secret_base_id:req
+	bg_event \x, \y, \elevation, BG_EVENT_SECRET_BASE, \secret_base_id
+	.endm
+
+	                                                                                                                
+	.macro map_events npcs:req, warps:req, traps:req, signs:req
+	.byte _num_npcs, _num_warps, _num_traps, _num_signs
+	.4byte \npcs, \warps, \traps, \signs
+	reset_map_events
+	.endm
+
+	                                                                                                                       
+	.macro reset_map_events
+	.set _num_npcs, 0
+	.set _num_warps, 0
+	.set _num_traps, 0
+	.set _num_signs, 0
+	.endm
+
+	                                                 
+	reset_map_events
+
+	                                
+	                                                                                                                                     
+	.equiv connection_down, CONNECTION_SOUTH
+	.equiv connection_up, CONNECTION_NORTH
+	.equiv connection_left, CONNECTION_WEST
+	.equiv connection_right, CONNECTION_EAST
+	.equiv connection_dive, CONNECTION_DIVE
+	.equiv connection_emerge, CONNECTION_EMERGE
+
+	                                                                                                   
+	.macro connection direction:req, offset:req, map:req
+	.byte connection_\direction
+	.space 3           
+	.4byte \offset
+	map \map
+	.space 2           
+	.endm
+
+	                                                                                                                         
+	.macro map_header_flags allow_cycling:req, allow_escaping:req, allow_running:req, show_map_name:req
+	.byte \allow_cycling
+	.byte ((\show_map_name & 1) << 2) | ((\allow_running & 1) << 1) | ((\allow_escaping & 1) << 0)
+	.endm
+# 6 "asm/macros.inc"
+# 1 "asm/macros/m4a.inc"
+	.macro song label, music_player, unknown
+	.4byte \label
+	.2byte \music_player
+	.2byte \unknown
+	.endm
+
+	.macro music_player info_struct, track_struct, unknown_1, unknown_2
+	.4byte \info_struct
+	.4byte \track_struct
+	.byte \unknown_1
+	.space 1
+	.2byte \unknown_2
+	.endm
+# 7 "asm/macros.inc"
+# 1 "asm/macros/trainer_tower.inc"
+	                                                                            
+	.macro ttower_initfloor
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_INIT_FLOOR
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                         
+	.macro ttower_getspeech speech:req, trainer=0xFF
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_SPEECH
+	setvar VAR_0x8005, \speech
+	.if \trainer >= VARS_START && \trainer != 0xFF
+	copyvar VAR_0x8006, \trainer
+	.elseif \trainer != 0xFF
+	setvar VAR_0x8006, \trainer
+	.endif
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                     
+	.macro ttower_dobattle
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_DO_BATTLE
+	setvar VAR_0x8005, 0
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                                                                                     
+	.macro ttower_getchallengetype
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_CHALLENGE_TYPE
+	setvar VAR_0x8005, FALSE
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                         
+	.macro ttower_clearedfloor
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_CLEARED_FLOOR
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                         
+	.macro ttower_isfloorcleared
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_FLOOR_CLEARED
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                              
+	.macro ttower_startchallenge
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_START_CHALLENGE
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                    
+	.macro ttower_getownerstate
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_OWNER_STATE
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                                           
+	.macro ttower_giveprize
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GIVE_PRIZE
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                                
+	.macro ttower_checkfinaltime
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_CHECK_FINAL_TIME
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                            
+	.macro ttower_resumetimer
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_RESUME_TIMER
+	special CallTrainerTowerFunc
+	.endm
+
+	                                         
+	.macro ttower_setlost
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_SET_LOST
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                
+	.macro ttower_getchallengestatus
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_CHALLENGE_STATUS
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                                          
+	.macro ttower_gettime
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_TIME
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                              
+	.macro ttower_showresults
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_SHOW_RESULTS
+	special CallTrainerTowerFunc
+	.endm
+
+	                   
+	.macro ttower_closeresults
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_CLOSE_RESULTS
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                                
+	.macro ttower_checkdoubles
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_CHECK_DOUBLES
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                                                               
+	.macro ttower_getnumfloors
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_NUM_FLOORS
+	special CallTrainerTowerFunc
+	.endm
+
+	                               
+	.macro ttower_shouldexit
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_SHOULD_WARP_TO_COUNTER
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                
+	.macro ttower_encountermusic
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_ENCOUNTER_MUSIC
+	special CallTrainerTowerFunc
+	.endm
+
+	                                                                    
+	.macro ttower_getbeatchallenge
+	setvar VAR_0x8004, TRAINER_TOWER_FUNC_GET_BEAT_CHALLENGE
+	special CallTrainerTowerFunc
+	.endm
+# 8 "asm/macros.inc"
+
+	.macro region_map_location x, y, width, height, name
+	.byte \x
+	.byte \y
+	.byte \width
+	.byte \height
+	.4byte gMapName_\name
+	.endm
+
+	.macro obj_tiles address, uncompressed_size, tag
+	.4byte \address
+	.2byte \uncompressed_size
+	.2byte \tag
+	.endm
+
+	.macro null_obj_tiles
+	obj_tiles 0, 0, 0
+	.endm
+
+	.macro obj_pal address, tag
+	.4byte \address
+	.2byte \tag
+	.2byte 0          
+	.endm
+
+	.macro null_obj_pal
+	obj_pal 0, 0
+	.endm
+
+	.macro paired_pals tag, address
+	.2byte \tag
+	.2byte 0          
+	.4byte \address
+	.endm
+
+                              
+	.macro obj_frame_tiles address, uncompressed_size
+	.4byte \address
+	.2byte \uncompressed_size
+	.2byte 0          
+	.endm
+
+	.macro spr_template tile_tag, pal_tag, oam, anims, images, affine_anims, callback
+	.2byte \tile_tag
+	.2byte \pal_tag
+	.4byte \oam
+	.4byte \anims
+	.4byte \images
+	.4byte \affine_anims
+	.4byte \callback
+	.endm
+
+                                                                             
+                                                                             
+                                                                              
+	.macro berry_tree_palette_slot_table slot
+	.byte 3, 4, \slot, \slot, \slot
+	.endm
+
+	.macro subsprite x, y, priority, tile_num_offset, size
+	.byte \x
+	.byte \y
+	.2byte ((\priority) << 14) | ((\tile_num_offset) << 4) | SPRITE_SIZE_\size
+	.endm
+
+	.macro obj_image_anim_frame pic_id, duration, flags = 0
+	.2byte \pic_id
+	.byte (\flags) | (\duration)
+	.byte 0          
+	.endm
+
+	.macro obj_image_anim_loop count
+	.2byte 0xfffd
+	.byte \count
+	.byte 0          
+	.endm
+
+	.macro obj_image_anim_jump target_index
+	.2byte 0xfffe
+	.byte \target_index
+	.byte 0          
+	.endm
+
+	.macro obj_image_anim_end
+	.2byte 0xffff
+	.2byte 0          
+	.endm
+
+	.macro obj_rot_scal_anim_frame delta_x_scale, delta_y_scale, delta_angle, duration
+	.2byte \delta_x_scale
+	.2byte \delta_y_scale
+	.byte \delta_angle
+	.byte \duration
+	.2byte 0          
+	.endm
+
+	.macro obj_rot_scal_anim_loop count
+	.2byte 0x7ffd
+	.2byte \count
+	.4byte 0          
+	.endm
+
+	.macro obj_rot_scal_anim_jump target_index
+	.2byte 0x7ffe
+	.2byte \target_index
+	.4byte 0          
+	.endm
+
+	.macro obj_rot_scal_anim_end unknown=0
+	.2byte 0x7fff
+	.2byte \unknown
+	.fill 4          
+	.endm
+
+	.macro overworld_frame ptr:req, width:req, height:req, frame:req
+	.4byte (\ptr + (\width * \height * \frame * 64) / 2)
+	.2byte (\width * \height * 64) / 2
+	.2byte 0          
+	.endm
+
+	.macro credits_entry number, text
+	.4byte \number
+	.4byte \text
+	.endm
+
+	.macro door_anim_frame unknown, offset
+	.byte \unknown
+	.byte 0          
+	.2byte \offset
+	.endm
+
+	.macro door_anim_gfx metatile_num, unknown, tile_addr, palette_addr
+	.2byte \metatile_num
+	.2byte \unknown
+	.4byte \tile_addr
+	.4byte \palette_addr
+	.endm
+
+	.macro trainer_eye_trainer opp_1, opp_2, opp_3, opp_4, opp_5, map_name
+	.2byte OPPONENT_\opp_1
+	.2byte OPPONENT_\opp_2
+	.2byte OPPONENT_\opp_3
+	.2byte OPPONENT_\opp_4
+	.2byte OPPONENT_\opp_5
+	.2byte GROUP_\map_name
+	.2byte MAP_\map_name
+	.space 2
+	.endm
+
+	.macro window_template bg, top, left, height, width, palno, baseBlock
+	.byte \bg, \top, \left, \height, \width, \palno
+	.2byte \baseBlock
+	.endm
+
+	.macro abspath relative
+	.if REVISION == 0
+	.ascii "C:/WORK/POKeFRLG/src/pm_lgfr_ose/source/"
+	.else
+	.ascii "C:/WORK/POKeFRLG/Src/pm_lgfr_ose/source/"
+	.endif
+	.asciz "\relative"
+	.endm
+# 3 "src/libagbsyscall.s"
+
+	.syntax unified
+
+	.text
+
+	thumb_func_start ArcTan2
+ArcTan2:
+	svc 0xA
+	bx lr
+	thumb_func_end ArcTan2
+
+	thumb_func_start BgAffineSet
+BgAffineSet:
+	svc 0xE
+	bx lr
+	thumb_func_end BgAffineSet
+
+	thumb_func_start CpuFastSet
+CpuFastSet:
+	svc 0xC
+	bx lr
+	thumb_func_end CpuFastSet
+
+	thumb_func_start CpuSet
+CpuSet:
+	svc 0xB
+	bx lr
+	thumb_func_end CpuSet
+
+	thumb_func_start Div
+Div:
+	svc 0x6
+	bx lr
+	thumb_func_end Div
+
+	thumb_func_start LZ77UnCompVram
+LZ77UnCompVram:
+	svc 0x12
+	bx lr
+	thumb_func_end LZ77UnCompVram
+
+	thumb_func_start LZ77UnCompWram
+LZ77UnCompWram:
+	svc 0x11
+	bx lr
+	thumb_func_end LZ77UnCompWram
+
+	thumb_func_start MultiBoot
+MultiBoot:
+	movs r1, 0x1
+	svc 0x25
+	bx lr
+	thumb_func_end MultiBoot
+
+	thumb_func_start ObjAffineSet
+ObjAffineSet:
+	svc 0xF
+	bx lr
+	thumb_func_end ObjAffineSet
+
+	thumb_func_start RegisterRamReset
+RegisterRamReset:
+	svc 0x1
+	bx lr
+	thumb_func_end RegisterRamReset
+
+	thumb_func_start SoftReset
+SoftReset:
+	ldr r3, =REG_IME
+	movs r2, 0
+	strb r2, [r3]
+	ldr r1, =0x03007f00             
+	mov sp, r1
+	svc 0x1
+	svc 0
+	.pool
+	thumb_func_end SoftReset
+
+	thumb_func_start Sqrt
+Sqrt:
+	svc 0x8
+	bx lr
+	thumb_func_end Sqrt
+
+	thumb_func_start VBlankIntrWait
+VBlankIntrWait:
+	movs r2, 0
+	svc 0x5
+	bx lr
+	thumb_func_end VBlankIntrWait
+
+	.align 2, 0                      
@@ -0,0 +1,72 @@
+# 1 "src/rom_header.s"
+                                            
+                                                                      
+
+	.global Start
+Start:
+	b start_vector
+
+	.global RomHeaderNintendoLogo
+RomHeaderNintendoLogo:
+	.space 156
+
+RomHeaderGameTitle:
+	.space 12
+
+	.global RomHeaderGameCode
+RomHeaderGameCode:
+	.space 4
+
+RomHeaderMakerCode:
+	.space 2
+
+RomHeaderMagic:
+	.byte 0
+
+RomHeaderMainUnitCode:
+	.byte 0
+
+RomHeaderDeviceType:
+	.byte 0
+
+RomHeaderReserved1:
+	.space 7
+
+	.global RomHeaderSoftwareVersion
+RomHeaderSoftwareVersion:
+	.byte 0
+
+RomHeaderChecksum:
+	.byte 0
+
+RomHeaderReserved2:
+	.space 2
+
+	.word 0
+
+	.global GPIOPortData
+GPIOPortData:
+	.hword 0
+
+	.global GPIOPortDirection
+GPIOPortDirection:
+	.hword 0
+
+	.global GPIOPortReadEnable
+GPIOPortReadEnable:
+	.hword 0
+
+	.space 6
+
+	.4byte 0xFFFFFFFF
+	.4byte 0xFFFFFFFF
+	.4byte 0xFFFFFFFF
+	.4byte 0xFFFFFFFF
+	.4byte 0xFFFFFFFF
+	.4byte 0xFFFFFFFF
+	.4byte 0xFFFFFFFF
+	.4byte 0xFFFFFFFF
+	.4byte 0xFFFFFFFF
+	.4byte 0xFFFFFFFF
+	.4byte 0xFFFFFFFF
+	.4byte 0xFFFFFFFF
@@ -0,0 +1,64 @@
+# With GFX_BATCH=1 (the default), the graphics the ROM INCBINs are converted
+# and compressed with one gbagfx process per directory instead of one process
+# per file. Each directory's .png/.pal -> .1bpp/.4bpp/.8bpp/.gbapal and
+# .lz/.rl jobs go in one manifest, so gbagfx compresses each image on the same
+# worker right after converting it. Only jobs whose source changed since the
+# directory's last batch are listed, and gbagfx only rewrites outputs whose
+# contents changed, so untouched objects stay up to date.
+#
+# Files with a rule of their own in graphics_file_rules.mk, tileset_rules.mk or
+# spritesheet_rules.mk (per-file options, or built with cat) keep that rule;
+# the batch that compresses one of them waits for make to build it first.
+
+GFX_BATCH ?= 1
+GFX_BATCH_DIR := $(BUILD_DIR)/gfx_batch
+
+ifeq ($(GFX_BATCH)$(SETUP_PREREQS),11)
+
+# Every target of an explicit rule in the graphics rule files. The sed prints
+# the text before the first colon of each rule line, which $(eval) expands.
+GFX_RULE_FILES := graphics_file_rules.mk tileset_rules.mk spritesheet_rules.mk
+$(eval GFX_EXPLICIT_TARGETS := $(shell sed -n 's/^\([^#[:space:]][^:=]*\):\([^=].*\)\{0,1\}$$/\1/p' $(GFX_RULE_FILES)))
+
+GFX_BATCH_TARGETS := $(filter-out $(GFX_EXPLICIT_TARGETS),$(shell grep -rhoE '"(graphics|data/tilesets)/[^"]+\.(1bpp|4bpp|8bpp|gbapal|lz|rl)"' $(C_SUBDIR) $(DATA_ASM_SUBDIR) | tr -d '"' | sort -u))
+GFX_BATCH_COMPRESSED := $(filter %.lz %.rl,$(GFX_BATCH_TARGETS))
+GFX_BATCH_CONVERTED := $(filter-out $(GFX_EXPLICIT_TARGETS),$(filter %.1bpp %.4bpp %.8bpp %.gbapal,$(sort $(GFX_BATCH_TARGETS) $(basename $(GFX_BATCH_COMPRESSED)))))
+
+# The source the generic rules in the Makefile would pick: a .gbapal comes
+# from its .pal if there is one.
+gfx_batch_source = $(if $(filter %.gbapal,$1),$(firstword $(wildcard $(1:.gbapal=.pal)) $(1:.gbapal=.png)),$(basename $1).png)
+
+# INPUT:OUTPUT for each job, grouped by output directory
+$(foreach out,$(GFX_BATCH_CONVERTED),$(eval GFX_BATCH_JOBS_$(dir $(out)) += $(call gfx_batch_source,$(out)):$(out)))
+$(foreach out,$(GFX_BATCH_COMPRESSED),$(eval GFX_BATCH_JOBS_$(dir $(out)) += $(basename $(out)):$(out)))
+
+GFX_BATCH_DIRS := $(sort $(dir $(GFX_BATCH_CONVERTED) $(GFX_BATCH_COMPRESSED)))
+$(shell mkdir -p $(GFX_BATCH_DIRS:%=$(GFX_BATCH_DIR)/%))
+
+gfx_batch_inputs = $(foreach job,$1,$(firstword $(subst :, ,$(job))))
+gfx_batch_outputs = $(foreach job,$1,$(lastword $(subst :, ,$(job))))
+gfx_batch_jobs_reading = $(foreach job,$1,$(if $(filter $2,$(call gfx_batch_inputs,$(job))),$(job)))
+
+# The jobs in $1 to rerun when the prerequisites in $2 changed: those reading
+# a changed file, and those compressing what the first ones convert.
+gfx_batch_changed_jobs = $(sort $(call gfx_batch_jobs_reading,$1,$2) \
+	$(call gfx_batch_jobs_reading,$1,$(call gfx_batch_outputs,$(call gfx_batch_jobs_reading,$1,$2))))
+
+# One stamp per directory. A missing output reruns all of the directory's jobs.
+define GFX_BATCH_RULE
+GFX_BATCH_OUTPUTS_$1 := $(call gfx_batch_outputs,$(GFX_BATCH_JOBS_$1))
+GFX_BATCH_MISSING_$1 := $$(filter-out $$(wildcard $$(GFX_BATCH_OUTPUTS_$1)),$$(GFX_BATCH_OUTPUTS_$1))
+
+$$(GFX_BATCH_OUTPUTS_$1): $(GFX_BATCH_DIR)/$1stamp ;
+
+$(GFX_BATCH_DIR)/$1stamp: $$(filter-out $$(GFX_BATCH_OUTPUTS_$1),$(call gfx_batch_inputs,$(GFX_BATCH_JOBS_$1))) \
+		$$(if $$(GFX_BATCH_MISSING_$1),FORCE)
+	$$(file >$(GFX_BATCH_DIR)/$1manifest.txt)
+	$$(foreach job,$$(if $$(GFX_BATCH_MISSING_$1),$$(GFX_BATCH_JOBS_$1),$$(filter $$(call gfx_batch_changed_jobs,$$(GFX_BATCH_JOBS_$1),$$?),$$(GFX_BATCH_JOBS_$1))),$$(file >>$(GFX_BATCH_DIR)/$1manifest.txt,$$(subst :, ,$$(job))))
+	$(GFX) batch $(GFX_BATCH_DIR)/$1manifest.txt
+	@touch $$@
+endef
+
+$(foreach dir,$(GFX_BATCH_DIRS),$(eval $(call GFX_BATCH_RULE,$(dir))))
+
+endif
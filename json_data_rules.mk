@@ -2,39 +2,69 @@
 # based on an Inja template. https://github.com/pantor/inja
 
 AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/wild_encounters.h
-$(DATA_SRC_SUBDIR)/wild_encounters.h: $(DATA_SRC_SUBDIR)/wild_encounters.json $(DATA_SRC_SUBDIR)/wild_encounters.json.txt
-	$(JSONPROC) $^ $@
+AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/region_map/region_map_entries.h
+AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/region_map/region_map_entry_strings.h
+AUTO_GEN_TARGETS += include/constants/region_map_sections.h
+AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/items.h
+AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/heal_locations.h
+AUTO_GEN_TARGETS += include/constants/heal_locations.h
 
 $(C_BUILDDIR)/wild_encounter.o: c_dep += $(DATA_SRC_SUBDIR)/wild_encounters.h
+$(C_BUILDDIR)/region_map.o: c_dep += $(DATA_SRC_SUBDIR)/region_map/region_map_entries.h
+$(C_BUILDDIR)/region_map.o: c_dep += $(DATA_SRC_SUBDIR)/region_map/region_map_entry_strings.h
+$(C_BUILDDIR)/item.o: c_dep += $(DATA_SRC_SUBDIR)/items.h
+$(C_BUILDDIR)/heal_location.o: c_dep += $(DATA_SRC_SUBDIR)/heal_locations.h
 
-AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/region_map/region_map_entries.h
-$(DATA_SRC_SUBDIR)/region_map/region_map_entries.h: $(DATA_SRC_SUBDIR)/region_map/region_map_sections.json $(DATA_SRC_SUBDIR)/region_map/region_map_sections.entries.json.txt
-	$(JSONPROC) $^ $@
+# With JSONPROC_BATCH=1, a single jsonproc run renders every file above. Each
+# JSON and template is parsed once however many outputs share it, and only
+# files whose contents change are rewritten, so the generated files hang off a
+# stamp instead of their own rules. A missing output reruns the batch even if
+# the stamp is newer than every input.
+JSONPROC_BATCH ?= 0
+JSONPROC_STAMP := $(OBJ_DIR)/jsonproc.stamp
+ifeq ($(JSONPROC_BATCH),1)
+AUTO_GEN_TARGETS += $(JSONPROC_STAMP)
 
-$(C_BUILDDIR)/region_map.o: c_dep += $(DATA_SRC_SUBDIR)/region_map/region_map_entries.h
+# JSON:TEMPLATE:OUTPUT for each generated file
+JSONPROC_MANIFEST := $(OBJ_DIR)/jsonproc_manifest.txt
+JSONPROC_JOBS := \
+	$(DATA_SRC_SUBDIR)/wild_encounters.json:$(DATA_SRC_SUBDIR)/wild_encounters.json.txt:$(DATA_SRC_SUBDIR)/wild_encounters.h \
+	$(DATA_SRC_SUBDIR)/region_map/region_map_sections.json:$(DATA_SRC_SUBDIR)/region_map/region_map_sections.entries.json.txt:$(DATA_SRC_SUBDIR)/region_map/region_map_entries.h \
+	$(DATA_SRC_SUBDIR)/region_map/region_map_sections.json:$(DATA_SRC_SUBDIR)/region_map/region_map_sections.strings.json.txt:$(DATA_SRC_SUBDIR)/region_map/region_map_entry_strings.h \
+	$(DATA_SRC_SUBDIR)/region_map/region_map_sections.json:$(DATA_SRC_SUBDIR)/region_map/region_map_sections.constants.json.txt:include/constants/region_map_sections.h \
+	$(DATA_SRC_SUBDIR)/items.json:$(DATA_SRC_SUBDIR)/items.json.txt:$(DATA_SRC_SUBDIR)/items.h \
+	$(DATA_SRC_SUBDIR)/heal_locations.json:$(DATA_SRC_SUBDIR)/heal_locations.json.txt:$(DATA_SRC_SUBDIR)/heal_locations.h \
+	$(DATA_SRC_SUBDIR)/heal_locations.json:$(DATA_SRC_SUBDIR)/heal_locations.constants.json.txt:include/constants/heal_locations.h
+JSONPROC_INPUTS := $(sort $(foreach job,$(JSONPROC_JOBS),$(wordlist 1,2,$(subst :, ,$(job)))))
+JSONPROC_OUTPUTS := $(foreach job,$(JSONPROC_JOBS),$(word 3,$(subst :, ,$(job))))
+JSONPROC_MISSING := $(filter-out $(wildcard $(JSONPROC_OUTPUTS)),$(JSONPROC_OUTPUTS))
 
-AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/region_map/region_map_entry_strings.h
-$(DATA_SRC_SUBDIR)/region_map/region_map_entry_strings.h: $(DATA_SRC_SUBDIR)/region_map/region_map_sections.json $(DATA_SRC_SUBDIR)/region_map/region_map_sections.strings.json.txt
-	$(JSONPROC) $^ $@
+$(JSONPROC_OUTPUTS): $(JSONPROC_STAMP) ;
 
-$(C_BUILDDIR)/region_map.o: c_dep += $(DATA_SRC_SUBDIR)/region_map/region_map_entry_strings.h
+$(JSONPROC_STAMP): $(JSONPROC_INPUTS) $(if $(JSONPROC_MISSING),FORCE)
+	$(file >$(JSONPROC_MANIFEST))
+	$(foreach job,$(JSONPROC_JOBS),$(file >>$(JSONPROC_MANIFEST),$(subst :, ,$(job))))
+	$(JSONPROC) -c $(JSONPROC_CACHE) -B $(JSONPROC_MANIFEST)
+	@mkdir -p $(@D) && touch $@
+else
+$(DATA_SRC_SUBDIR)/wild_encounters.h: $(DATA_SRC_SUBDIR)/wild_encounters.json $(DATA_SRC_SUBDIR)/wild_encounters.json.txt
+	$(JSONPROC) -c $(JSONPROC_CACHE) $^ $@
+
+$(DATA_SRC_SUBDIR)/region_map/region_map_entries.h: $(DATA_SRC_SUBDIR)/region_map/region_map_sections.json $(DATA_SRC_SUBDIR)/region_map/region_map_sections.entries.json.txt
+	$(JSONPROC) -c $(JSONPROC_CACHE) $^ $@
+
+$(DATA_SRC_SUBDIR)/region_map/region_map_entry_strings.h: $(DATA_SRC_SUBDIR)/region_map/region_map_sections.json $(DATA_SRC_SUBDIR)/region_map/region_map_sections.strings.json.txt
+	$(JSONPROC) -c $(JSONPROC_CACHE) $^ $@
 
-AUTO_GEN_TARGETS += include/constants/region_map_sections.h
 include/constants/region_map_sections.h: $(DATA_SRC_SUBDIR)/region_map/region_map_sections.json $(DATA_SRC_SUBDIR)/region_map/region_map_sections.constants.json.txt
-	$(JSONPROC) $^ $@
+	$(JSONPROC) -c $(JSONPROC_CACHE) $^ $@
 
-AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/items.h
 $(DATA_SRC_SUBDIR)/items.h: $(DATA_SRC_SUBDIR)/items.json $(DATA_SRC_SUBDIR)/items.json.txt
-	$(JSONPROC) $^ $@
-
-$(C_BUILDDIR)/item.o: c_dep += $(DATA_SRC_SUBDIR)/items.h
+	$(JSONPROC) -c $(JSONPROC_CACHE) $^ $@
 
-AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/heal_locations.h
 $(DATA_SRC_SUBDIR)/heal_locations.h: $(DATA_SRC_SUBDIR)/heal_locations.json $(DATA_SRC_SUBDIR)/heal_locations.json.txt
-	$(JSONPROC) $^ $@
+	$(JSONPROC) -c $(JSONPROC_CACHE) $^ $@
 
-$(C_BUILDDIR)/heal_location.o: c_dep += $(DATA_SRC_SUBDIR)/heal_locations.h
-
-AUTO_GEN_TARGETS += include/constants/heal_locations.h
 include/constants/heal_locations.h: $(DATA_SRC_SUBDIR)/heal_locations.json $(DATA_SRC_SUBDIR)/heal_locations.constants.json.txt
-	$(JSONPROC) $^ $@
+	$(JSONPROC) -c $(JSONPROC_CACHE) $^ $@
+endif
@@ -20,12 +20,34 @@ MAP_HEADERS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/header.inc,$(MAP_DIRS))
 MAP_JSONS := $(patsubst $(MAPS_DIR)/%/,$(MAPS_DIR)/%/map.json,$(MAP_DIRS))
 
 $(DATA_ASM_BUILDDIR)/maps.o: $(DATA_ASM_SUBDIR)/maps.s $(LAYOUTS_DIR)/layouts.inc $(LAYOUTS_DIR)/layouts_table.inc $(MAPS_DIR)/headers.inc $(MAPS_DIR)/groups.inc $(MAPS_DIR)/connections.inc $(MAP_CONNECTIONS) $(MAP_HEADERS)
-	$(PREPROC) $< charmap.txt | $(CPP) -I include -nostdinc -undef -Wno-unicode - | $(PREPROC) -ie $< charmap.txt | $(AS) $(ASFLAGS) -o $@
+	$(PREPROC) -c $(PREPROC_CACHE) $< charmap.txt | $(CPP) -I include -nostdinc -undef -Wno-unicode - | $(PREPROC) -c $(PREPROC_CACHE) -ie $< charmap.txt | $(AS) $(ASFLAGS) -o $@
 $(DATA_ASM_BUILDDIR)/map_events.o: $(DATA_ASM_SUBDIR)/map_events.s $(MAPS_DIR)/events.inc $(MAP_EVENTS)
-	$(PREPROC) $< charmap.txt | $(CPP) -I include -nostdinc -undef -Wno-unicode - | $(PREPROC) -ie $< charmap.txt | $(AS) $(ASFLAGS) -o $@
-
+	$(PREPROC) -c $(PREPROC_CACHE) $< charmap.txt | $(CPP) -I include -nostdinc -undef -Wno-unicode - | $(PREPROC) -c $(PREPROC_CACHE) -ie $< charmap.txt | $(AS) $(ASFLAGS) -o $@
+
+# With MAPJSON_ALL=1, a single mapjson run generates every file above from one
+# parse of layouts.json and each map.json. It only rewrites files whose contents
+# change, so the generated files hang off a stamp instead of their own rules.
+# A missing output reruns it even if the stamp is newer than every input.
+MAPJSON_ALL ?= 0
+MAPJSON_STAMP := $(OBJ_DIR)/mapjson.stamp
+ifeq ($(MAPJSON_ALL),1)
+AUTO_GEN_TARGETS += $(MAPJSON_STAMP)
+
+MAPJSON_OUTPUTS := $(MAP_HEADERS) $(MAP_EVENTS) $(MAP_CONNECTIONS) \
+	$(MAPS_OUTDIR)/connections.inc $(MAPS_OUTDIR)/groups.inc $(MAPS_OUTDIR)/events.inc $(MAPS_OUTDIR)/headers.inc \
+	$(LAYOUTS_OUTDIR)/layouts.inc $(LAYOUTS_OUTDIR)/layouts_table.inc \
+	$(INCLUDECONSTS_OUTDIR)/map_groups.h $(INCLUDECONSTS_OUTDIR)/layouts.h $(INCLUDECONSTS_OUTDIR)/map_event_ids.h
+MAPJSON_MISSING := $(filter-out $(wildcard $(MAPJSON_OUTPUTS)),$(MAPJSON_OUTPUTS))
+
+$(MAPJSON_OUTPUTS): $(MAPJSON_STAMP) ;
+
+$(MAPJSON_STAMP): $(MAPS_DIR)/map_groups.json $(LAYOUTS_DIR)/layouts.json $(MAP_JSONS) $(if $(MAPJSON_MISSING),FORCE)
+	@$(MAPJSON) -c $(MAPJSON_CACHE) all firered $(MAPS_DIR)/map_groups.json $(LAYOUTS_DIR)/layouts.json $(INCLUDECONSTS_OUTDIR) $(MAP_JSONS)
+	@echo "$(MAPJSON) -c $(MAPJSON_CACHE) all firered $(MAPS_DIR)/map_groups.json $(LAYOUTS_DIR)/layouts.json $(INCLUDECONSTS_OUTDIR) <MAP_JSONS>"
+	@mkdir -p $(@D) && touch $@
+else
 $(MAPS_OUTDIR)/%/header.inc $(MAPS_OUTDIR)/%/events.inc $(MAPS_OUTDIR)/%/connections.inc: $(MAPS_DIR)/%/map.json
-	$(MAPJSON) map firered $< $(LAYOUTS_DIR)/layouts.json $(@D)
+	$(MAPJSON) -c $(MAPJSON_CACHE) map firered $< $(LAYOUTS_DIR)/layouts.json $(@D)
 
 $(MAPS_OUTDIR)/connections.inc $(MAPS_OUTDIR)/groups.inc $(MAPS_OUTDIR)/events.inc $(MAPS_OUTDIR)/headers.inc $(INCLUDECONSTS_OUTDIR)/map_groups.h: $(MAPS_DIR)/map_groups.json
 	$(MAPJSON) groups firered $< $(MAPS_OUTDIR) $(INCLUDECONSTS_OUTDIR)
@@ -36,5 +58,6 @@ $(LAYOUTS_OUTDIR)/layouts.inc $(LAYOUTS_OUTDIR)/layouts_table.inc $(INCLUDECONST
 # Generate constants for map events, which depend on data that's distributed across the map.json files.
 # There's a lot of map.json files, so we print an abbreviated output with echo.
 $(INCLUDECONSTS_OUTDIR)/map_event_ids.h: $(MAP_JSONS)
-	@$(MAPJSON) event_constants firered $^ $(INCLUDECONSTS_OUTDIR)/map_event_ids.h
-	@echo "$(MAPJSON) event_constants firered <MAP_JSONS> $(INCLUDECONSTS_OUTDIR)/map_event_ids.h"
+	@$(MAPJSON) -c $(MAPJSON_CACHE) event_constants firered $^ $(INCLUDECONSTS_OUTDIR)/map_event_ids.h
+	@echo "$(MAPJSON) -c $(MAPJSON_CACHE) event_constants firered <MAP_JSONS> $(INCLUDECONSTS_OUTDIR)/map_event_ids.h"
+endif
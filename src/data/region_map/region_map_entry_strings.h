@@ -0,0 +1,115 @@
+//
+// DO NOT MODIFY THIS FILE! It is auto-generated from src/data/region_map/region_map_sections.json and Inja template src/data/region_map/region_map_sections.strings.json.txt
+//
+
+#ifndef GUARD_DATA_REGION_MAP_REGION_MAP_ENTRY_STRINGS_H
+#define GUARD_DATA_REGION_MAP_REGION_MAP_ENTRY_STRINGS_H
+
+
+static const u8 sMapsecName_PALLET_TOWN[] = _("PALLET TOWN");
+static const u8 sMapsecName_VIRIDIAN_CITY[] = _("VIRIDIAN CITY");
+static const u8 sMapsecName_PEWTER_CITY[] = _("PEWTER CITY");
+static const u8 sMapsecName_CERULEAN_CITY[] = _("CERULEAN CITY");
+static const u8 sMapsecName_LAVENDER_TOWN[] = _("LAVENDER TOWN");
+static const u8 sMapsecName_VERMILION_CITY[] = _("VERMILION CITY");
+static const u8 sMapsecName_CELADON_CITY[] = _("CELADON CITY");
+static const u8 sMapsecName_FUCHSIA_CITY[] = _("FUCHSIA CITY");
+static const u8 sMapsecName_CINNABAR_ISLAND[] = _("CINNABAR ISLAND");
+static const u8 sMapsecName_INDIGO_PLATEAU[] = _("INDIGO PLATEAU");
+static const u8 sMapsecName_SAFFRON_CITY[] = _("SAFFRON CITY");
+static const u8 sMapsecName_ROUTE_4[] = _("ROUTE 4");
+static const u8 sMapsecName_ROUTE_10[] = _("ROUTE 10");
+static const u8 sMapsecName_ROUTE_1[] = _("ROUTE 1");
+static const u8 sMapsecName_ROUTE_2[] = _("ROUTE 2");
+static const u8 sMapsecName_ROUTE_3[] = _("ROUTE 3");
+static const u8 sMapsecName_ROUTE_5[] = _("ROUTE 5");
+static const u8 sMapsecName_ROUTE_6[] = _("ROUTE 6");
+static const u8 sMapsecName_ROUTE_7[] = _("ROUTE 7");
+static const u8 sMapsecName_ROUTE_8[] = _("ROUTE 8");
+static const u8 sMapsecName_ROUTE_9[] = _("ROUTE 9");
+static const u8 sMapsecName_ROUTE_11[] = _("ROUTE 11");
+static const u8 sMapsecName_ROUTE_12[] = _("ROUTE 12");
+static const u8 sMapsecName_ROUTE_13[] = _("ROUTE 13");
+static const u8 sMapsecName_ROUTE_14[] = _("ROUTE 14");
+static const u8 sMapsecName_ROUTE_15[] = _("ROUTE 15");
+static const u8 sMapsecName_ROUTE_16[] = _("ROUTE 16");
+static const u8 sMapsecName_ROUTE_17[] = _("ROUTE 17");
+static const u8 sMapsecName_ROUTE_18[] = _("ROUTE 18");
+static const u8 sMapsecName_ROUTE_19[] = _("ROUTE 19");
+static const u8 sMapsecName_ROUTE_20[] = _("ROUTE 20");
+static const u8 sMapsecName_ROUTE_21[] = _("ROUTE 21");
+static const u8 sMapsecName_ROUTE_22[] = _("ROUTE 22");
+static const u8 sMapsecName_ROUTE_23[] = _("ROUTE 23");
+static const u8 sMapsecName_ROUTE_24[] = _("ROUTE 24");
+static const u8 sMapsecName_ROUTE_25[] = _("ROUTE 25");
+static const u8 sMapsecName_VIRIDIAN_FOREST[] = _("VIRIDIAN FOREST");
+static const u8 sMapsecName_MT__MOON[] = _("MT. MOON");
+static const u8 sMapsecName_S_S__ANNE[] = _("S.S. ANNE");
+static const u8 sMapsecName_UNDERGROUND_PATH[] = _("UNDERGROUND PATH");
+static const u8 sMapsecName_DIGLETT_S_CAVE[] = _("DIGLETT'S CAVE");
+static const u8 sMapsecName_VICTORY_ROAD[] = _("VICTORY ROAD");
+static const u8 sMapsecName_ROCKET_HIDEOUT[] = _("ROCKET HIDEOUT");
+static const u8 sMapsecName_SILPH_CO_[] = _("SILPH CO.");
+static const u8 sMapsecName_POK__MON_MANSION[] = _("POKéMON MANSION");
+static const u8 sMapsecName_SAFARI_ZONE[] = _("SAFARI ZONE");
+static const u8 sMapsecName_POK__MON_LEAGUE[] = _("POKéMON LEAGUE");
+static const u8 sMapsecName_ROCK_TUNNEL[] = _("ROCK TUNNEL");
+static const u8 sMapsecName_SEAFOAM_ISLANDS[] = _("SEAFOAM ISLANDS");
+static const u8 sMapsecName_POK__MON_TOWER[] = _("POKéMON TOWER");
+static const u8 sMapsecName_CERULEAN_CAVE[] = _("CERULEAN CAVE");
+static const u8 sMapsecName_POWER_PLANT[] = _("POWER PLANT");
+static const u8 sMapsecName_ONE_ISLAND[] = _("ONE ISLAND");
+static const u8 sMapsecName_TWO_ISLAND[] = _("TWO ISLAND");
+static const u8 sMapsecName_THREE_ISLAND[] = _("THREE ISLAND");
+static const u8 sMapsecName_FOUR_ISLAND[] = _("FOUR ISLAND");
+static const u8 sMapsecName_FIVE_ISLAND[] = _("FIVE ISLAND");
+static const u8 sMapsecName_SEVEN_ISLAND[] = _("SEVEN ISLAND");
+static const u8 sMapsecName_SIX_ISLAND[] = _("SIX ISLAND");
+static const u8 sMapsecName_KINDLE_ROAD[] = _("KINDLE ROAD");
+static const u8 sMapsecName_TREASURE_BEACH[] = _("TREASURE BEACH");
+static const u8 sMapsecName_CAPE_BRINK[] = _("CAPE BRINK");
+static const u8 sMapsecName_BOND_BRIDGE[] = _("BOND BRIDGE");
+static const u8 sMapsecName_THREE_ISLE_PORT[] = _("THREE ISLE PORT");
+static const u8 sMapsecName_SEVII_ISLE_6[] = _("SEVII ISLE 6");
+static const u8 sMapsecName_SEVII_ISLE_7[] = _("SEVII ISLE 7");
+static const u8 sMapsecName_SEVII_ISLE_8[] = _("SEVII ISLE 8");
+static const u8 sMapsecName_SEVII_ISLE_9[] = _("SEVII ISLE 9");
+static const u8 sMapsecName_RESORT_GORGEOUS[] = _("RESORT GORGEOUS");
+static const u8 sMapsecName_WATER_LABYRINTH[] = _("WATER LABYRINTH");
+static const u8 sMapsecName_FIVE_ISLE_MEADOW[] = _("FIVE ISLE MEADOW");
+static const u8 sMapsecName_MEMORIAL_PILLAR[] = _("MEMORIAL PILLAR");
+static const u8 sMapsecName_OUTCAST_ISLAND[] = _("OUTCAST ISLAND");
+static const u8 sMapsecName_GREEN_PATH[] = _("GREEN PATH");
+static const u8 sMapsecName_WATER_PATH[] = _("WATER PATH");
+static const u8 sMapsecName_RUIN_VALLEY[] = _("RUIN VALLEY");
+static const u8 sMapsecName_TRAINER_TOWER[] = _("TRAINER TOWER");
+static const u8 sMapsecName_CANYON_ENTRANCE[] = _("CANYON ENTRANCE");
+static const u8 sMapsecName_SEVAULT_CANYON[] = _("SEVAULT CANYON");
+static const u8 sMapsecName_TANOBY_RUINS[] = _("TANOBY RUINS");
+static const u8 sMapsecName_SEVII_ISLE_22[] = _("SEVII ISLE 22");
+static const u8 sMapsecName_SEVII_ISLE_23[] = _("SEVII ISLE 23");
+static const u8 sMapsecName_SEVII_ISLE_24[] = _("SEVII ISLE 24");
+static const u8 sMapsecName_NAVEL_ROCK[] = _("NAVEL ROCK");
+static const u8 sMapsecName_MT__EMBER[] = _("MT. EMBER");
+static const u8 sMapsecName_BERRY_FOREST[] = _("BERRY FOREST");
+static const u8 sMapsecName_ICEFALL_CAVE[] = _("ICEFALL CAVE");
+static const u8 sMapsecName_ROCKET_WAREHOUSE[] = _("ROCKET WAREHOUSE");
+static const u8 sMapsecName_DOTTED_HOLE[] = _("DOTTED HOLE");
+static const u8 sMapsecName_LOST_CAVE[] = _("LOST CAVE");
+static const u8 sMapsecName_PATTERN_BUSH[] = _("PATTERN BUSH");
+static const u8 sMapsecName_ALTERING_CAVE[] = _("ALTERING CAVE");
+static const u8 sMapsecName_TANOBY_CHAMBERS[] = _("TANOBY CHAMBERS");
+static const u8 sMapsecName_THREE_ISLE_PATH[] = _("THREE ISLE PATH");
+static const u8 sMapsecName_TANOBY_KEY[] = _("TANOBY KEY");
+static const u8 sMapsecName_BIRTH_ISLAND[] = _("BIRTH ISLAND");
+static const u8 sMapsecName_MONEAN_CHAMBER[] = _("MONEAN CHAMBER");
+static const u8 sMapsecName_LIPTOO_CHAMBER[] = _("LIPTOO CHAMBER");
+static const u8 sMapsecName_WEEPTH_CHAMBER[] = _("WEEPTH CHAMBER");
+static const u8 sMapsecName_DILFORD_CHAMBER[] = _("DILFORD CHAMBER");
+static const u8 sMapsecName_SCUFIB_CHAMBER[] = _("SCUFIB CHAMBER");
+static const u8 sMapsecName_RIXY_CHAMBER[] = _("RIXY CHAMBER");
+static const u8 sMapsecName_VIAPOIS_CHAMBER[] = _("VIAPOIS CHAMBER");
+static const u8 sMapsecName_EMBER_SPA[] = _("EMBER SPA");
+static const u8 sMapsecName_CELADON_DEPT_[] = _("CELADON DEPT.");
+
+#endif // GUARD_DATA_REGION_MAP_REGION_MAP_ENTRY_STRINGS_H
@@ -0,0 +1,509 @@
+// Runs many conversions in one gbagfx process.
+//
+// A manifest has one job per line, written like a gbagfx command line without
+// the program name:
+//
+//     INPUT_PATH OUTPUT_PATH [options...]
+//
+// Blank lines and lines starting with '#' are ignored. A job that reads a file
+// written by another job waits for that job to finish, wherever the two are
+// listed; all other jobs run concurrently on a work-stealing pool. Each output
+// (OUTPUT_PATH, and the -tilemap file of a .png conversion) is written to a
+// temporary file first and only replaces the real output if its contents
+// changed.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "global.h"
+#include "util.h"
+#include "batch.h"
+#include "work_pool.h"
+
+// A .png -> .4bpp job writes its -tilemap file as well as its output.
+#define MAX_JOB_OUTPUTS 2
+
+struct BatchJob {
+    int argc;
+    char **argv;
+    // The argv indices of the paths the job writes, and their temporary files.
+    int outputArgs[MAX_JOB_OUTPUTS];
+    char *tempPaths[MAX_JOB_OUTPUTS];
+    int numOutputs;
+    int numDeps;
+    atomic_int numPendingDeps;
+    int *dependents;
+    int numDependents;
+};
+
+struct Batch {
+    struct BatchJob *jobs;
+    int numJobs;
+    atomic_int numWritten;
+    atomic_int numUnchanged;
+    BatchCommandFunc runCommand;
+};
+
+struct CachedPalette {
+    char *path;
+    void (*readPalette)(char *path, struct Palette *palette);
+    struct Palette palette;
+    struct CachedPalette *next;
+};
+
+static bool sPaletteCacheEnabled;
+static struct CachedPalette *sPaletteCache;
+static pthread_mutex_t sPaletteCacheMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void InvalidateCachedPalette(char *path);
+
+// The batch that is running, so that its temporary files can be removed if a
+// job fails and exits.
+static struct Batch *sRunningBatch;
+
+static char *CopyString(const char *s)
+{
+    char *copy = malloc(strlen(s) + 1);
+
+    if (copy == NULL)
+        FATAL_ERROR("Failed to allocate memory for string.\n");
+
+    strcpy(copy, s);
+    return copy;
+}
+
+// Builds "dir/.gbagfx_tmp<n>_name.ext" for "dir/name.ext". The extension is
+// kept so the job is dispatched to the same handler as the real output.
+static char *MakeTempPath(char *outputPath, int jobIndex)
+{
+    char *slash = strrchr(outputPath, '/');
+    int dirLength = slash != NULL ? (int)(slash - outputPath) + 1 : 0;
+    char *tempPath = malloc(strlen(outputPath) + 32);
+
+    if (tempPath == NULL)
+        FATAL_ERROR("Failed to allocate memory for temporary path.\n");
+
+    sprintf(tempPath, "%.*s.gbagfx_tmp%d_%s", dirLength, outputPath, jobIndex, outputPath + dirLength);
+    return tempPath;
+}
+
+static bool IsJobOutput(struct BatchJob *job, int arg)
+{
+    for (int i = 0; i < job->numOutputs; i++)
+        if (job->outputArgs[i] == arg)
+            return true;
+
+    return false;
+}
+
+static void FindOutputs(struct BatchJob *job)
+{
+    char *inputExtension = GetFileExtensionAfterDot(job->argv[1]);
+    char *outputExtension = GetFileExtensionAfterDot(job->argv[2]);
+    bool pngToGba = inputExtension != NULL && strcmp(inputExtension, "png") == 0
+        && (strcmp(outputExtension, "1bpp") == 0 || strcmp(outputExtension, "4bpp") == 0 || strcmp(outputExtension, "8bpp") == 0);
+
+    job->outputArgs[0] = 2;
+    job->numOutputs = 1;
+
+    for (int i = 3; pngToGba && i + 1 < job->argc; i++)
+    {
+        if (strcmp(job->argv[i], "-tilemap") == 0)
+        {
+            if (GetFileExtensionAfterDot(job->argv[i + 1]) == NULL)
+                FATAL_ERROR("Batch output \"%s\" has no extension.\n", job->argv[i + 1]);
+
+            job->outputArgs[job->numOutputs++] = i + 1;
+            break;
+        }
+    }
+}
+
+static void ParseManifest(char *manifestPath, struct Batch *batch)
+{
+    int fileSize;
+    unsigned char *buffer = ReadWholeFileZeroPadded(manifestPath, &fileSize, 1);
+    char *line = (char *)buffer;
+    int capacity = 0;
+
+    batch->jobs = NULL;
+    batch->numJobs = 0;
+
+    while (*line != 0)
+    {
+        char *lineEnd = strchr(line, '\n');
+        char *next = lineEnd != NULL ? lineEnd + 1 : line + strlen(line);
+
+        if (lineEnd != NULL)
+            *lineEnd = 0;
+
+        char *args[64];
+        int argc = 1;
+
+        for (char *token = strtok(line, " \t\r"); token != NULL; token = strtok(NULL, " \t\r"))
+        {
+            if (argc == 1 && token[0] == '#')
+                break;
+
+            if (argc == 64)
+                FATAL_ERROR("Too many options in batch job \"%s\".\n", args[1]);
+
+            args[argc++] = token;
+        }
+
+        line = next;
+
+        if (argc == 1)
+            continue;
+
+        if (argc < 3)
+            FATAL_ERROR("Batch job \"%s\" has no output path.\n", args[1]);
+
+        if (GetFileExtensionAfterDot(args[2]) == NULL)
+            FATAL_ERROR("Batch output \"%s\" has no extension.\n", args[2]);
+
+        if (batch->numJobs == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 64;
+            batch->jobs = realloc(batch->jobs, capacity * sizeof(struct BatchJob));
+
+            if (batch->jobs == NULL)
+                FATAL_ERROR("Failed to allocate memory for batch jobs.\n");
+        }
+
+        struct BatchJob *job = &batch->jobs[batch->numJobs];
+
+        job->argc = argc;
+        job->argv = malloc((argc + 1) * sizeof(char *));
+
+        if (job->argv == NULL)
+            FATAL_ERROR("Failed to allocate memory for batch job.\n");
+
+        job->argv[0] = "gbagfx";
+
+        for (int i = 1; i < argc; i++)
+            job->argv[i] = CopyString(args[i]);
+
+        job->argv[argc] = NULL;
+        FindOutputs(job);
+
+        for (int i = 0; i < job->numOutputs; i++)
+            job->tempPaths[i] = MakeTempPath(job->argv[job->outputArgs[i]], batch->numJobs);
+
+        batch->numJobs++;
+    }
+
+    free(buffer);
+}
+
+// A job depends on every other job whose output it reads, either as its input
+// or through an option such as -palette or -tilemap.
+static void FindDependencies(struct Batch *batch)
+{
+    for (int i = 0; i < batch->numJobs; i++)
+    {
+        batch->jobs[i].numDeps = 0;
+        batch->jobs[i].numDependents = 0;
+        batch->jobs[i].dependents = NULL;
+    }
+
+    for (int j = 0; j < batch->numJobs; j++)
+    {
+        struct BatchJob *job = &batch->jobs[j];
+
+        for (int i = 0; i < batch->numJobs; i++)
+        {
+            struct BatchJob *producer = &batch->jobs[i];
+            bool reads = false;
+
+            if (i == j)
+                continue;
+
+            for (int o = 0; o < producer->numOutputs; o++)
+            {
+                char *outputPath = producer->argv[producer->outputArgs[o]];
+
+                for (int k = 1; k < job->argc; k++)
+                {
+                    if (strcmp(job->argv[k], outputPath) != 0)
+                        continue;
+
+                    if (IsJobOutput(job, k))
+                        FATAL_ERROR("\"%s\" is the output of more than one batch job.\n", outputPath);
+
+                    reads = true;
+                }
+            }
+
+            if (reads)
+            {
+                producer->dependents = realloc(producer->dependents, (producer->numDependents + 1) * sizeof(int));
+
+                if (producer->dependents == NULL)
+                    FATAL_ERROR("Failed to allocate memory for batch dependencies.\n");
+
+                producer->dependents[producer->numDependents++] = j;
+                job->numDeps++;
+            }
+        }
+
+        atomic_init(&job->numPendingDeps, job->numDeps);
+    }
+}
+
+// Fails if some jobs wait on each other in a cycle, since the pool would never
+// finish them.
+static void CheckForCycles(struct Batch *batch)
+{
+    int *numDeps = malloc((batch->numJobs > 0 ? batch->numJobs : 1) * sizeof(int));
+    int *readyJobs = malloc((batch->numJobs > 0 ? batch->numJobs : 1) * sizeof(int));
+    int numReadyJobs = 0;
+    int numVisited = 0;
+
+    if (numDeps == NULL || readyJobs == NULL)
+        FATAL_ERROR("Failed to allocate memory for batch dependencies.\n");
+
+    for (int i = 0; i < batch->numJobs; i++)
+    {
+        numDeps[i] = batch->jobs[i].numDeps;
+
+        if (numDeps[i] == 0)
+            readyJobs[numReadyJobs++] = i;
+    }
+
+    while (numVisited < numReadyJobs)
+    {
+        struct BatchJob *job = &batch->jobs[readyJobs[numVisited++]];
+
+        for (int i = 0; i < job->numDependents; i++)
+            if (--numDeps[job->dependents[i]] == 0)
+                readyJobs[numReadyJobs++] = job->dependents[i];
+    }
+
+    for (int i = 0; i < batch->numJobs; i++)
+        if (numDeps[i] != 0)
+            FATAL_ERROR("Batch job \"%s\" depends on its own output through other jobs.\n", batch->jobs[i].argv[2]);
+
+    free(numDeps);
+    free(readyJobs);
+}
+
+static bool FileContentsEqual(char *pathA, char *pathB)
+{
+    FILE *fpA = fopen(pathA, "rb");
+    FILE *fpB = fopen(pathB, "rb");
+    bool equal = (fpA != NULL && fpB != NULL);
+
+    while (equal)
+    {
+        unsigned char bufferA[4096];
+        unsigned char bufferB[4096];
+        size_t sizeA = fread(bufferA, 1, sizeof(bufferA), fpA);
+        size_t sizeB = fread(bufferB, 1, sizeof(bufferB), fpB);
+
+        if (sizeA != sizeB || memcmp(bufferA, bufferB, sizeA) != 0)
+            equal = false;
+        else if (sizeA == 0)
+            break;
+    }
+
+    if (fpA != NULL)
+        fclose(fpA);
+    if (fpB != NULL)
+        fclose(fpB);
+
+    return equal;
+}
+
+// Replaces the output with the job's temporary file if they differ. Unchanged
+// outputs are left alone, mtime included, so nothing that includes them is
+// rebuilt; make tracks the batch itself with a stamp.
+static bool CommitOutput(char *tempPath, char *outputPath)
+{
+    if (FileContentsEqual(tempPath, outputPath))
+    {
+        remove(tempPath);
+        return false;
+    }
+
+#ifdef _WIN32
+    remove(outputPath);
+#endif
+    InvalidateCachedPalette(outputPath);
+
+    if (rename(tempPath, outputPath) != 0)
+        FATAL_ERROR("Failed to rename \"%s\" to \"%s\".\n", tempPath, outputPath);
+
+    return true;
+}
+
+// Runs a job, then hands every job that was only waiting on it to the same
+// worker, so the next stage of an image (e.g. compressing the tiles that were
+// just converted) follows right behind it.
+static void RemoveTempFiles(void)
+{
+    if (sRunningBatch == NULL)
+        return;
+
+    for (int i = 0; i < sRunningBatch->numJobs; i++)
+        for (int j = 0; j < sRunningBatch->jobs[i].numOutputs; j++)
+            remove(sRunningBatch->jobs[i].tempPaths[j]);
+}
+
+static void RunJob(struct WorkPool *pool, int worker, int jobIndex, void *context)
+{
+    struct Batch *batch = context;
+    struct BatchJob *job = &batch->jobs[jobIndex];
+
+    char *outputPaths[MAX_JOB_OUTPUTS];
+
+    for (int i = 0; i < job->numOutputs; i++)
+    {
+        outputPaths[i] = job->argv[job->outputArgs[i]];
+        job->argv[job->outputArgs[i]] = job->tempPaths[i];
+    }
+
+    batch->runCommand(job->argc, job->argv);
+
+    for (int i = 0; i < job->numOutputs; i++)
+    {
+        job->argv[job->outputArgs[i]] = outputPaths[i];
+
+        if (CommitOutput(job->tempPaths[i], outputPaths[i]))
+            atomic_fetch_add(&batch->numWritten, 1);
+        else
+            atomic_fetch_add(&batch->numUnchanged, 1);
+    }
+
+    for (int i = 0; i < job->numDependents; i++)
+    {
+        int dependent = job->dependents[i];
+
+        if (atomic_fetch_sub(&batch->jobs[dependent].numPendingDeps, 1) == 1)
+            SubmitWork(pool, worker, dependent);
+    }
+}
+
+void RunBatch(char *manifestPath, int numThreads, BatchCommandFunc runCommand)
+{
+    struct Batch batch;
+
+    ParseManifest(manifestPath, &batch);
+    FindDependencies(&batch);
+    CheckForCycles(&batch);
+
+    atomic_init(&batch.numWritten, 0);
+    atomic_init(&batch.numUnchanged, 0);
+    batch.runCommand = runCommand;
+
+    int *readyJobs = malloc((batch.numJobs > 0 ? batch.numJobs : 1) * sizeof(int));
+    int numReadyJobs = 0;
+
+    if (readyJobs == NULL)
+        FATAL_ERROR("Failed to allocate memory for batch jobs.\n");
+
+    for (int i = 0; i < batch.numJobs; i++)
+        if (batch.jobs[i].numDeps == 0)
+            readyJobs[numReadyJobs++] = i;
+
+    static bool sRemoveTempFilesRegistered;
+
+    if (!sRemoveTempFilesRegistered)
+    {
+        atexit(RemoveTempFiles);
+        sRemoveTempFilesRegistered = true;
+    }
+
+    sRunningBatch = &batch;
+    sPaletteCacheEnabled = true;
+
+    RunWorkPool(batch.numJobs, numThreads, readyJobs, numReadyJobs, RunJob, &batch);
+
+    sRunningBatch = NULL;
+
+    printf("%s: %d jobs, %d written, %d unchanged\n", manifestPath, batch.numJobs,
+        atomic_load(&batch.numWritten), atomic_load(&batch.numUnchanged));
+
+    for (int i = 0; i < batch.numJobs; i++)
+    {
+        for (int j = 1; j < batch.jobs[i].argc; j++)
+            free(batch.jobs[i].argv[j]);
+        free(batch.jobs[i].argv);
+        for (int j = 0; j < batch.jobs[i].numOutputs; j++)
+            free(batch.jobs[i].tempPaths[j]);
+        free(batch.jobs[i].dependents);
+    }
+
+    free(batch.jobs);
+    free(readyJobs);
+}
+
+// Palettes are shared by many jobs in a batch (the -palette file of every
+// sprite in a family, or the .png and .gbapal outputs of the same image), so
+// each one is only read and decoded once.
+void ReadCachedPalette(char *path, struct Palette *palette, void (*readPalette)(char *path, struct Palette *palette))
+{
+    if (!sPaletteCacheEnabled)
+    {
+        readPalette(path, palette);
+        return;
+    }
+
+    pthread_mutex_lock(&sPaletteCacheMutex);
+
+    for (struct CachedPalette *entry = sPaletteCache; entry != NULL; entry = entry->next)
+    {
+        if (entry->readPalette == readPalette && strcmp(entry->path, path) == 0)
+        {
+            *palette = entry->palette;
+            pthread_mutex_unlock(&sPaletteCacheMutex);
+            return;
+        }
+    }
+
+    pthread_mutex_unlock(&sPaletteCacheMutex);
+
+    readPalette(path, palette);
+
+    struct CachedPalette *entry = malloc(sizeof(struct CachedPalette));
+
+    if (entry == NULL)
+        FATAL_ERROR("Failed to allocate memory for palette cache.\n");
+
+    entry->path = CopyString(path);
+    entry->readPalette = readPalette;
+    entry->palette = *palette;
+
+    pthread_mutex_lock(&sPaletteCacheMutex);
+    entry->next = sPaletteCache;
+    sPaletteCache = entry;
+    pthread_mutex_unlock(&sPaletteCacheMutex);
+}
+
+static void InvalidateCachedPalette(char *path)
+{
+    pthread_mutex_lock(&sPaletteCacheMutex);
+
+    for (struct CachedPalette **link = &sPaletteCache; *link != NULL;)
+    {
+        struct CachedPalette *entry = *link;
+
+        if (strcmp(entry->path, path) == 0)
+        {
+            *link = entry->next;
+            free(entry->path);
+            free(entry);
+        }
+        else
+        {
+            link = &entry->next;
+        }
+    }
+
+    pthread_mutex_unlock(&sPaletteCacheMutex);
+}
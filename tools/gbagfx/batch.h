@@ -0,0 +1,14 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stdbool.h>
+#include "gfx.h"
+
+// Runs a single conversion. argv has the same layout as gbagfx's own command
+// line: argv[1] is the input path, argv[2] the output path, then options.
+typedef void (*BatchCommandFunc)(int argc, char **argv);
+
+void RunBatch(char *manifestPath, int numThreads, BatchCommandFunc runCommand);
+void ReadCachedPalette(char *path, struct Palette *palette, void (*readPalette)(char *path, struct Palette *palette));
+
+#endif // BATCH_H
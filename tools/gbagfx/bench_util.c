@@ -0,0 +1,77 @@
+// Helpers shared by the benchmarks.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "global.h"
+#include "util.h"
+#include "bench_util.h"
+
+struct BenchFile *LoadBenchFiles(const char *missingHint, int *numFiles, long *totalSize)
+{
+    struct BenchFile *files = NULL;
+    int capacity = 0;
+    char line[4096];
+
+    *numFiles = 0;
+    *totalSize = 0;
+
+    while (fgets(line, sizeof(line), stdin) != NULL)
+    {
+        line[strcspn(line, "\r\n")] = 0;
+
+        if (line[0] == 0)
+            continue;
+
+        FILE *fp = fopen(line, "rb");
+
+        if (fp == NULL)
+            continue; // not built yet
+
+        fclose(fp);
+
+        if (*numFiles == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 256;
+            files = realloc(files, capacity * sizeof(*files));
+
+            if (files == NULL)
+                FATAL_ERROR("Failed to allocate memory for file list.\n");
+        }
+
+        struct BenchFile *file = &files[*numFiles];
+        file->path = malloc(strlen(line) + 1);
+
+        if (file->path == NULL)
+            FATAL_ERROR("Failed to allocate memory for file path.\n");
+
+        strcpy(file->path, line);
+        file->data = ReadWholeFile(file->path, &file->size);
+
+        if (file->size == 0)
+        {
+            free(file->data);
+            free(file->path);
+            continue;
+        }
+
+        *totalSize += file->size;
+        (*numFiles)++;
+    }
+
+    if (*numFiles == 0)
+        FATAL_ERROR("No input files found. Build the %s first.\n", missingHint);
+
+    return files;
+}
+
+void FreeBenchFiles(struct BenchFile *files, int numFiles)
+{
+    for (int i = 0; i < numFiles; i++)
+    {
+        free(files[i].data);
+        free(files[i].path);
+    }
+
+    free(files);
+}
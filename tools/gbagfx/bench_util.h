@@ -0,0 +1,16 @@
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+struct BenchFile {
+    unsigned char *data;
+    int size;
+    char *path;
+};
+
+// Reads the files named on stdin, one path per line, skipping any that don't
+// exist yet or are empty. If none are left, fails with a message asking to
+// build missingHint (e.g. "graphics") first.
+struct BenchFile *LoadBenchFiles(const char *missingHint, int *numFiles, long *totalSize);
+void FreeBenchFiles(struct BenchFile *files, int numFiles);
+
+#endif // BENCH_UTIL_H
@@ -0,0 +1,426 @@
+// Content-addressed compression cache.
+//
+// Each entry is a file named after a 128-bit hash of the options string and
+// the input bytes, stored as <dir>/<first 2 hex digits>/<remaining digits>.
+// Entries are written to a temporary file and renamed into place, so parallel
+// gbagfx processes can share a cache directory. A hit refreshes the entry's
+// mtime, and eviction removes the least recently used entries first.
+//
+// Each process counts its own hits and misses and adds them to the totals in
+// <dir>/stats when it exits, so the file stays the same size however many
+// lookups are made.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <utime.h>
+#include <sys/stat.h>
+#include "global.h"
+#include "util.h"
+#include "cache.h"
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#define MakeDirectory(path) _mkdir(path)
+#define getpid _getpid
+#else
+#include <fcntl.h>
+#define MakeDirectory(path) mkdir(path, 0777)
+#endif
+
+#define DEFAULT_CACHE_SIZE_MB 256
+
+// On average, the cache size is checked after this many stores.
+#define EVICTION_INTERVAL 64
+
+struct CacheKey {
+    uint64_t lo;
+    uint64_t hi;
+};
+
+struct CacheEntry {
+    char *path;
+    long size;
+    time_t mtime;
+};
+
+static atomic_long sNumHits;
+static atomic_long sNumMisses;
+
+// Numbers temporary files, so batch workers in one process don't collide.
+static atomic_uint sTempCount;
+
+static char *GetCacheDir(void)
+{
+    char *dir = getenv("GBAGFX_CACHE_DIR");
+
+    if (dir == NULL || *dir == 0)
+        return NULL;
+
+    return dir;
+}
+
+static long GetCacheSizeLimit(void)
+{
+    char *size = getenv("GBAGFX_CACHE_SIZE");
+    int megabytes;
+
+    if (size == NULL || !ParseNumber(size, NULL, 10, &megabytes) || megabytes < 1)
+        megabytes = DEFAULT_CACHE_SIZE_MB;
+
+    return (long)megabytes * 1024 * 1024;
+}
+
+static inline uint64_t Mix64(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDull;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ull;
+    x ^= x >> 33;
+    return x;
+}
+
+static void HashBytes(struct CacheKey *key, const unsigned char *data, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        key->lo = (key->lo ^ data[i]) * 0x100000001B3ull;
+        key->hi = (key->hi ^ data[i]) * 0x9E3779B97F4A7C15ull + (key->lo >> 29);
+    }
+}
+
+static struct CacheKey ComputeKey(unsigned char *input, int inputSize, const char *options)
+{
+    struct CacheKey key = { 0xCBF29CE484222325ull, 0x84222325CBF29CE4ull };
+
+    HashBytes(&key, (const unsigned char *)options, strlen(options) + 1);
+    HashBytes(&key, input, inputSize);
+
+    key.lo = Mix64(key.lo ^ (uint64_t)inputSize);
+    key.hi = Mix64(key.hi ^ key.lo);
+
+    return key;
+}
+
+static char *GetEntryPath(char *dir, struct CacheKey key, bool createSubdir)
+{
+    char *path = malloc(strlen(dir) + 48);
+
+    if (path == NULL)
+        FATAL_ERROR("Failed to allocate memory for cache path.\n");
+
+    sprintf(path, "%s/%02x", dir, (unsigned int)(key.hi >> 56));
+
+    if (createSubdir)
+    {
+        MakeDirectory(dir);
+        MakeDirectory(path);
+    }
+
+    sprintf(path + strlen(path), "/%014llx%016llx",
+        (unsigned long long)(key.hi & 0xFFFFFFFFFFFFFFull), (unsigned long long)key.lo);
+
+    return path;
+}
+
+unsigned char *CacheLookup(unsigned char *input, int inputSize, const char *options, int *outputSize)
+{
+    char *dir = GetCacheDir();
+
+    if (dir == NULL)
+        return NULL;
+
+    char *path = GetEntryPath(dir, ComputeKey(input, inputSize, options), false);
+    FILE *fp = fopen(path, "rb");
+    unsigned char *output = NULL;
+
+    if (fp != NULL)
+    {
+        fseek(fp, 0, SEEK_END);
+        long size = ftell(fp);
+        rewind(fp);
+
+        output = malloc(size > 0 ? size : 1);
+
+        if (output != NULL && size > 0 && fread(output, size, 1, fp) == 1)
+        {
+            *outputSize = (int)size;
+        }
+        else
+        {
+            free(output);
+            output = NULL;
+        }
+
+        fclose(fp);
+
+        if (output != NULL)
+            utime(path, NULL);
+    }
+
+    atomic_fetch_add(output != NULL ? &sNumHits : &sNumMisses, 1);
+    free(path);
+
+    return output;
+}
+
+static int CompareEntriesByAge(const void *a, const void *b)
+{
+    const struct CacheEntry *entryA = a;
+    const struct CacheEntry *entryB = b;
+
+    if (entryA->mtime != entryB->mtime)
+        return entryA->mtime < entryB->mtime ? -1 : 1;
+
+    return strcmp(entryA->path, entryB->path);
+}
+
+// Lists every entry file. Returns the number of entries and their total size.
+static int ListEntries(char *dir, struct CacheEntry **entries_p, long *totalSize)
+{
+    struct CacheEntry *entries = NULL;
+    int numEntries = 0;
+    int capacity = 0;
+    DIR *topDir = opendir(dir);
+
+    *totalSize = 0;
+
+    if (topDir == NULL)
+    {
+        *entries_p = NULL;
+        return 0;
+    }
+
+    struct dirent *subdirEntry;
+
+    while ((subdirEntry = readdir(topDir)) != NULL)
+    {
+        if (strlen(subdirEntry->d_name) != 2 || subdirEntry->d_name[0] == '.')
+            continue;
+
+        char subdirPath[4096];
+        snprintf(subdirPath, sizeof(subdirPath), "%s/%s", dir, subdirEntry->d_name);
+
+        DIR *subdir = opendir(subdirPath);
+
+        if (subdir == NULL)
+            continue;
+
+        struct dirent *fileEntry;
+
+        while ((fileEntry = readdir(subdir)) != NULL)
+        {
+            char path[4096];
+            struct stat st;
+
+            if (fileEntry->d_name[0] == '.')
+                continue;
+
+            snprintf(path, sizeof(path), "%s/%s", subdirPath, fileEntry->d_name);
+
+            if (stat(path, &st) != 0 || !S_ISREG(st.st_mode))
+                continue;
+
+            if (numEntries == capacity)
+            {
+                capacity = capacity ? capacity * 2 : 256;
+                entries = realloc(entries, capacity * sizeof(struct CacheEntry));
+
+                if (entries == NULL)
+                    FATAL_ERROR("Failed to allocate memory for cache entries.\n");
+            }
+
+            entries[numEntries].path = malloc(strlen(path) + 1);
+
+            if (entries[numEntries].path == NULL)
+                FATAL_ERROR("Failed to allocate memory for cache entries.\n");
+
+            strcpy(entries[numEntries].path, path);
+            entries[numEntries].size = (long)st.st_size;
+            entries[numEntries].mtime = st.st_mtime;
+            *totalSize += (long)st.st_size;
+            numEntries++;
+        }
+
+        closedir(subdir);
+    }
+
+    closedir(topDir);
+
+    *entries_p = entries;
+    return numEntries;
+}
+
+static void FreeEntries(struct CacheEntry *entries, int numEntries)
+{
+    for (int i = 0; i < numEntries; i++)
+        free(entries[i].path);
+
+    free(entries);
+}
+
+// Removes the least recently used entries until the cache is at 90% of its limit.
+static void EvictEntries(char *dir)
+{
+    struct CacheEntry *entries;
+    long totalSize;
+    int numEntries = ListEntries(dir, &entries, &totalSize);
+    long limit = GetCacheSizeLimit();
+
+    if (totalSize > limit)
+    {
+        long target = limit / 10 * 9;
+
+        qsort(entries, numEntries, sizeof(struct CacheEntry), CompareEntriesByAge);
+
+        for (int i = 0; i < numEntries && totalSize > target; i++)
+        {
+            if (remove(entries[i].path) == 0)
+                totalSize -= entries[i].size;
+        }
+    }
+
+    FreeEntries(entries, numEntries);
+}
+
+// Reads the totals from <dir>/stats. A missing or unreadable file counts as
+// zero lookups.
+static void ReadStats(FILE *fp, long *hits, long *misses)
+{
+    *hits = 0;
+    *misses = 0;
+
+    if (fp == NULL || fscanf(fp, "%ld %ld", hits, misses) != 2)
+        *hits = *misses = 0;
+}
+
+void FlushCacheStats(void)
+{
+    char *dir = GetCacheDir();
+    long newHits = atomic_exchange(&sNumHits, 0);
+    long newMisses = atomic_exchange(&sNumMisses, 0);
+
+    if (dir == NULL || newHits + newMisses == 0)
+        return;
+
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/stats", dir);
+
+    // Create the file if needed without truncating one another process has
+    // just written.
+    FILE *fp = fopen(path, "ab");
+
+    if (fp != NULL)
+        fclose(fp);
+
+    fp = fopen(path, "r+b");
+
+    // The stats are only informational, so failing to update them is ignored.
+    if (fp == NULL)
+        return;
+
+#ifndef _WIN32
+    // Hold a lock over the read and rewrite, so concurrent gbagfx processes
+    // don't lose each other's counts.
+    struct flock lock = { .l_type = F_WRLCK, .l_whence = SEEK_SET };
+    fcntl(fileno(fp), F_SETLKW, &lock);
+#endif
+
+    long hits, misses;
+    ReadStats(fp, &hits, &misses);
+
+    // Fixed-width fields, so the new totals always overwrite the old ones.
+    rewind(fp);
+    fprintf(fp, "%20ld %20ld\n", hits + newHits, misses + newMisses);
+    fclose(fp);
+}
+
+void CacheStore(unsigned char *input, int inputSize, const char *options, unsigned char *output, int outputSize)
+{
+    char *dir = GetCacheDir();
+
+    if (dir == NULL)
+        return;
+
+    struct CacheKey key = ComputeKey(input, inputSize, options);
+    char *path = GetEntryPath(dir, key, true);
+    char *tempPath = malloc(strlen(path) + 48);
+
+    if (tempPath == NULL)
+        FATAL_ERROR("Failed to allocate memory for cache path.\n");
+
+    sprintf(tempPath, "%s.tmp%ld_%u", path, (long)getpid(), atomic_fetch_add(&sTempCount, 1));
+
+    // A failed store only costs a future miss, so errors are ignored.
+    FILE *fp = fopen(tempPath, "wb");
+
+    if (fp != NULL)
+    {
+        bool ok = fwrite(output, outputSize, 1, fp) == 1;
+
+        if (fclose(fp) != 0 || !ok || rename(tempPath, path) != 0)
+            remove(tempPath);
+    }
+
+    free(tempPath);
+    free(path);
+
+    // The key is effectively random, so this spreads the directory scans
+    // evenly across stores without any shared counter.
+    if (key.lo % EVICTION_INTERVAL == 0)
+        EvictEntries(dir);
+}
+
+void PrintCacheStats(char *cacheDir)
+{
+    struct CacheEntry *entries;
+    long totalSize;
+    long hits, misses;
+    int numEntries = ListEntries(cacheDir, &entries, &totalSize);
+    char path[4096];
+
+    snprintf(path, sizeof(path), "%s/stats", cacheDir);
+    FILE *fp = fopen(path, "rb");
+    ReadStats(fp, &hits, &misses);
+
+    if (fp != NULL)
+        fclose(fp);
+
+    long lookups = hits + misses;
+
+    printf("cache directory: %s\n", cacheDir);
+    printf("entries:         %d\n", numEntries);
+    printf("size:            %.2f MiB (limit %ld MiB)\n", totalSize / (1024.0 * 1024.0), GetCacheSizeLimit() / (1024 * 1024));
+    printf("hits:            %ld\n", hits);
+    printf("misses:          %ld\n", misses);
+
+    if (lookups != 0)
+        printf("hit rate:        %.1f%%\n", 100.0 * hits / lookups);
+
+    FreeEntries(entries, numEntries);
+}
+
+void ClearCache(char *cacheDir)
+{
+    struct CacheEntry *entries;
+    long totalSize;
+    int numEntries = ListEntries(cacheDir, &entries, &totalSize);
+    char path[4096];
+
+    for (int i = 0; i < numEntries; i++)
+        remove(entries[i].path);
+
+    snprintf(path, sizeof(path), "%s/stats", cacheDir);
+    remove(path);
+
+    FreeEntries(entries, numEntries);
+}
@@ -0,0 +1,14 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+// On-disk cache of compressor output, keyed by the input bytes and a string
+// describing the compression options. Enabled by setting GBAGFX_CACHE_DIR.
+// GBAGFX_CACHE_SIZE sets its size limit in MiB (default 256).
+
+unsigned char *CacheLookup(unsigned char *input, int inputSize, const char *options, int *outputSize);
+void CacheStore(unsigned char *input, int inputSize, const char *options, unsigned char *output, int outputSize);
+void FlushCacheStats(void);
+void PrintCacheStats(char *cacheDir);
+void ClearCache(char *cacheDir);
+
+#endif // CACHE_H
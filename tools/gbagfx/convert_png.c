@@ -1,6 +1,8 @@
 // Copyright (c) 2015 YamaArashi
 
 #include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
 #include <setjmp.h>
 #include <png.h>
 #include "global.h"
@@ -76,6 +78,37 @@ static unsigned char *ConvertBitDepth(unsigned char *src, int srcBitDepth, int d
     return output;
 }
 
+// Converts a single row. Only valid when a row is a whole number of bytes at
+// both bit depths, so that rows can be converted independently.
+static void ConvertRowBitDepth(unsigned char *src, int srcBitDepth, unsigned char *dest, int destBitDepth, int numPixels)
+{
+    int destBit = 8 - destBitDepth;
+    int srcBit = 8 - srcBitDepth;
+
+    memset(dest, 0, numPixels * destBitDepth / 8);
+
+    for (int i = 0; i < numPixels; i++)
+    {
+        unsigned char pixel = ((*src >> srcBit) % (1 << srcBitDepth)) % (1 << destBitDepth);
+
+        *dest |= pixel << destBit;
+
+        srcBit -= srcBitDepth;
+        if (srcBit < 0)
+        {
+            src++;
+            srcBit = 8 - srcBitDepth;
+        }
+
+        destBit -= destBitDepth;
+        if (destBit < 0)
+        {
+            dest++;
+            destBit = 8 - destBitDepth;
+        }
+    }
+}
+
 void ReadPng(char *path, struct Image *image)
 {
     png_structp png_ptr;
@@ -98,6 +131,52 @@ void ReadPng(char *path, struct Image *image)
     image->height = png_get_image_height(png_ptr, info_ptr);
 
     int rowbytes = png_get_rowbytes(png_ptr, info_ptr);
+    bool convert = (bit_depth != image->bitDepth && image->tilemap.data.affine == NULL);
+
+    if (convert && bit_depth != 1 && bit_depth != 2 && bit_depth != 4 && bit_depth != 8)
+        FATAL_ERROR("Bit depth of image must be 1, 2, 4, or 8.\n");
+
+    // Rows can be streamed unless the image is interlaced (libpng needs the
+    // whole image for that) or a row's bits don't end on a byte boundary at
+    // the target depth. The whole-image conversion treats the pixels as one
+    // continuous bit stream, so such rows can't be converted on their own.
+    bool streamRows = png_get_interlace_type(png_ptr, info_ptr) == PNG_INTERLACE_NONE
+                   && (!convert || ((image->width * bit_depth) % 8 == 0 && (image->width * image->bitDepth) % 8 == 0));
+
+    if (streamRows)
+    {
+        int destRowBytes = convert ? image->width * image->bitDepth / 8 : rowbytes;
+        unsigned char *row = convert ? malloc(rowbytes) : NULL;
+
+        image->pixels = malloc(image->height * destRowBytes);
+
+        if (image->pixels == NULL || (convert && row == NULL))
+            FATAL_ERROR("Failed to allocate pixel buffer.\n");
+
+        if (setjmp(png_jmpbuf(png_ptr)))
+            FATAL_ERROR("Error reading from \"%s\".\n", path);
+
+        for (int i = 0; i < image->height; i++)
+        {
+            unsigned char *dest = image->pixels + i * destRowBytes;
+
+            if (convert)
+            {
+                png_read_row(png_ptr, row, NULL);
+                ConvertRowBitDepth(row, bit_depth, dest, image->bitDepth, image->width);
+            }
+            else
+            {
+                png_read_row(png_ptr, dest, NULL);
+            }
+        }
+
+        png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
+
+        free(row);
+        fclose(fp);
+        return;
+    }
 
     image->pixels = malloc(image->height * rowbytes);
 
@@ -122,12 +201,10 @@ void ReadPng(char *path, struct Image *image)
     free(row_pointers);
     fclose(fp);
 
-    if (bit_depth != image->bitDepth && image->tilemap.data.affine == NULL)
+    if (convert)
     {
         unsigned char *src = image->pixels;
 
-        if (bit_depth != 1 && bit_depth != 2 && bit_depth != 4 && bit_depth != 8)
-            FATAL_ERROR("Bit depth of image must be 1, 2, 4, or 8.\n");
         image->pixels = ConvertBitDepth(image->pixels, bit_depth, image->bitDepth, image->width * image->height);
         free(src);
     }
@@ -223,20 +300,13 @@ void WritePng(char *path, struct Image *image)
 
     png_write_info(png_ptr, info_ptr);
 
-    png_bytepp row_pointers = malloc(image->height * sizeof(png_bytep));
-
-    if (row_pointers == NULL)
-        FATAL_ERROR("Failed to allocate row pointers.\n");
-
     int rowbytes = png_get_rowbytes(png_ptr, info_ptr);
 
-    for (int i = 0; i < image->height; i++)
-        row_pointers[i] = (png_bytep)(image->pixels + (i * rowbytes));
-
     if (setjmp(png_jmpbuf(png_ptr)))
         FATAL_ERROR("Error writing \"%s\".\n", path);
 
-    png_write_image(png_ptr, row_pointers);
+    for (int i = 0; i < image->height; i++)
+        png_write_row(png_ptr, (png_bytep)(image->pixels + (i * rowbytes)));
 
     if (setjmp(png_jmpbuf(png_ptr)))
         FATAL_ERROR("Error ending write of \"%s\".\n", path);
@@ -246,5 +316,4 @@ void WritePng(char *path, struct Image *image)
     fclose(fp);
 
     png_destroy_write_struct(&png_ptr, &info_ptr);
-    free(row_pointers);
 }
@@ -0,0 +1,111 @@
+// Benchmarks the fast decoders against the reference ones. Reads input paths,
+// one per line, from stdin, compresses each file with LZ, RL and Huffman, and
+// times decoding the results.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "global.h"
+#include "util.h"
+#include "bench_util.h"
+#include "lz.h"
+#include "rl.h"
+#include "huff.h"
+
+// Decoding is fast, so every stream is decoded several times.
+#define DECODE_BENCH_ROUNDS 20
+
+typedef unsigned char *(*DecompressFunc)(unsigned char *src, int srcSize, int *uncompressedSize);
+
+// A file compressed with the codec being timed.
+struct Stream {
+    unsigned char *data;
+    int size;
+};
+
+static double RunDecoder(struct BenchFile *files, struct Stream *streams, int numFiles, DecompressFunc decompress, const char *name, int *mismatches)
+{
+    double seconds = 0;
+
+    for (int i = 0; i < numFiles; i++)
+    {
+        unsigned char *output = NULL;
+        int outputSize;
+        clock_t start = clock();
+
+        for (int round = 0; round < DECODE_BENCH_ROUNDS; round++)
+        {
+            free(output);
+            output = decompress(streams[i].data, streams[i].size, &outputSize);
+        }
+
+        seconds += (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        if (outputSize != files[i].size || memcmp(output, files[i].data, outputSize) != 0)
+        {
+            fprintf(stderr, "%s: output mismatch for \"%s\".\n", name, files[i].path);
+            (*mismatches)++;
+        }
+
+        free(output);
+    }
+
+    return seconds;
+}
+
+int main(void)
+{
+    int numFiles;
+    long totalSize;
+    struct BenchFile *files = LoadBenchFiles("graphics", &numFiles, &totalSize);
+    struct Stream *streams = malloc(numFiles * sizeof(*streams));
+
+    if (streams == NULL)
+        FATAL_ERROR("Failed to allocate memory for compressed streams.\n");
+
+    struct {
+        const char *name;
+        DecompressFunc fast;
+        DecompressFunc reference;
+    } codecs[] = {
+        { "lz", LZDecompress, LZDecompressReference },
+        { "rl", RLDecompress, RLDecompressReference },
+        { "huff", HuffDecompress, HuffDecompressReference },
+    };
+
+    double megabytes = (double)totalSize * DECODE_BENCH_ROUNDS / (1024.0 * 1024.0);
+    int mismatches = 0;
+
+    printf("%d files, %.2f MB x %d rounds\n", numFiles, totalSize / (1024.0 * 1024.0), DECODE_BENCH_ROUNDS);
+
+    for (int codec = 0; codec < 3; codec++)
+    {
+        for (int i = 0; i < numFiles; i++)
+        {
+            struct BenchFile *file = &files[i];
+            struct Stream *stream = &streams[i];
+
+            if (codec == 0)
+                stream->data = LZCompress(file->data, file->size, &stream->size, 2);
+            else if (codec == 1)
+                stream->data = RLCompress(file->data, file->size, &stream->size);
+            else
+                stream->data = HuffCompress(file->data, file->size, &stream->size, 4);
+        }
+
+        double referenceTime = RunDecoder(files, streams, numFiles, codecs[codec].reference, codecs[codec].name, &mismatches);
+        double fastTime = RunDecoder(files, streams, numFiles, codecs[codec].fast, codecs[codec].name, &mismatches);
+
+        printf("%-4s reference: %8.3f s %8.2f MB/s  fast: %8.3f s %8.2f MB/s\n", codecs[codec].name,
+            referenceTime, megabytes / referenceTime, fastTime, megabytes / fastTime);
+
+        for (int i = 0; i < numFiles; i++)
+            free(streams[i].data);
+    }
+
+    free(streams);
+    FreeBenchFiles(files, numFiles);
+
+    return mismatches != 0;
+}
@@ -0,0 +1,284 @@
+// Checks the fast LZ, RL and Huffman decoders against the reference ones.
+//
+// Valid streams are made by compressing random data and must decode to that
+// data with both decoders. Corrupted streams are made by flipping, overwriting
+// and truncating bytes of valid ones; each decoder runs in its own child
+// process, since a decoder reports bad input by exiting, and both must either
+// fail or produce the same output.
+//
+// Usage: decode_fuzz [iterations [seed]]
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "global.h"
+#include "lz.h"
+#include "rl.h"
+#include "huff.h"
+
+typedef unsigned char *(*DecompressFunc)(unsigned char *src, int srcSize, int *uncompressedSize);
+
+struct Codec {
+    const char *name;
+    DecompressFunc fast;
+    DecompressFunc reference;
+};
+
+static uint64_t sRandomState;
+
+static uint32_t Random(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 7;
+    sRandomState ^= sRandomState << 17;
+    return sRandomState >> 32;
+}
+
+// Random data with the kinds of structure the encoders look for: runs of one
+// byte, copies of earlier data at short and long distances, a small alphabet,
+// and plain noise.
+static unsigned char *MakeInput(int *size)
+{
+    int length = 4 + Random() % 4096;
+    int alphabet = 1 + Random() % 256;
+    unsigned char *data = malloc(length);
+
+    if (data == NULL)
+        FATAL_ERROR("Failed to allocate memory for fuzz input.\n");
+
+    for (int i = 0; i < length;)
+    {
+        int count = 1 + Random() % 40;
+
+        if (count > length - i)
+            count = length - i;
+
+        switch (Random() % 4)
+        {
+        case 0:
+            memset(data + i, Random() % alphabet, count);
+            break;
+        case 1:
+            if (i > 0)
+            {
+                int distance = 1 + Random() % (i < 0x1000 ? i : 0x1000);
+
+                for (int j = 0; j < count; j++)
+                    data[i + j] = data[i + j - distance];
+                break;
+            }
+            // fallthrough
+        default:
+            for (int j = 0; j < count; j++)
+                data[i + j] = Random() % alphabet;
+            break;
+        }
+
+        i += count;
+    }
+
+    *size = length;
+    return data;
+}
+
+static unsigned char *Compress(int codec, unsigned char *data, int size, int *compressedSize)
+{
+    switch (codec)
+    {
+    case 0:
+        if (Random() % 2)
+            return LZCompressOptimal(data, size, compressedSize, 1 + Random() % 3);
+        return LZCompress(data, size, compressedSize, 1 + Random() % 3);
+    case 1:
+        return RLCompress(data, size, compressedSize);
+    default:
+        break;
+    }
+
+    // With many distinct bytes, the tree is too wide for the 8-bit format.
+    bool seen[256] = {0};
+    int numDistinct = 0;
+
+    for (int i = 0; i < size; i++)
+    {
+        numDistinct += !seen[data[i]];
+        seen[data[i]] = true;
+    }
+
+    return HuffCompress(data, size, compressedSize, numDistinct <= 48 && Random() % 2 ? 8 : 4);
+}
+
+static unsigned char *Corrupt(unsigned char *data, int size, int *corruptSize)
+{
+    unsigned char *corrupt = malloc(size + 16);
+
+    if (corrupt == NULL)
+        FATAL_ERROR("Failed to allocate memory for fuzz input.\n");
+
+    memcpy(corrupt, data, size);
+
+    int numEdits = 1 + Random() % 4;
+
+    for (int i = 0; i < numEdits && size > 4; i++)
+    {
+        switch (Random() % 3)
+        {
+        case 0:
+            corrupt[Random() % size] ^= 1 << (Random() % 8);
+            break;
+        case 1:
+            corrupt[4 + Random() % (size - 4)] = Random();
+            break;
+        default:
+            size -= Random() % (size - 4);
+            break;
+        }
+    }
+
+    *corruptSize = size;
+    return corrupt;
+}
+
+struct DecodeResult {
+    int status;
+    int size;
+    uint64_t hash;
+};
+
+// Decodes in a child process. The child reports the size and an FNV-1a hash
+// of the output through a pipe.
+static struct DecodeResult DecodeInChild(DecompressFunc decompress, unsigned char *src, int srcSize)
+{
+    struct DecodeResult result = { -1, 0, 0 };
+    int fds[2];
+
+    fflush(stdout);
+
+    if (pipe(fds) != 0)
+        FATAL_ERROR("Failed to create pipe.\n");
+
+    pid_t pid = fork();
+
+    if (pid < 0)
+        FATAL_ERROR("Failed to fork.\n");
+
+    if (pid == 0)
+    {
+        close(fds[0]);
+
+        if (freopen("/dev/null", "w", stderr) == NULL)
+            _exit(2);
+
+        int size;
+        unsigned char *dest = decompress(src, srcSize, &size);
+        uint64_t hash = 0xCBF29CE484222325;
+
+        for (int i = 0; i < size; i++)
+            hash = (hash ^ dest[i]) * 0x100000001B3;
+
+        if (write(fds[1], &size, sizeof(size)) != sizeof(size) || write(fds[1], &hash, sizeof(hash)) != sizeof(hash))
+            _exit(2);
+
+        _exit(0);
+    }
+
+    close(fds[1]);
+
+    int status;
+
+    if (read(fds[0], &result.size, sizeof(result.size)) != sizeof(result.size)
+     || read(fds[0], &result.hash, sizeof(result.hash)) != sizeof(result.hash))
+    {
+        result.size = 0;
+        result.hash = 0;
+    }
+
+    close(fds[0]);
+    waitpid(pid, &status, 0);
+    result.status = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    struct Codec codecs[] = {
+        { "lz", LZDecompress, LZDecompressReference },
+        { "rl", RLDecompress, RLDecompressReference },
+        { "huff", HuffDecompress, HuffDecompressReference },
+    };
+    int iterations = argc > 1 ? atoi(argv[1]) : 2000;
+
+    sRandomState = argc > 2 ? strtoull(argv[2], NULL, 0) : 0x9E3779B97F4A7C15;
+
+    if (sRandomState == 0)
+        sRandomState = 1;
+
+    int failures = 0;
+    int corruptFailed = 0;
+    int corruptDecoded = 0;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        int codec = i % 3;
+        int size;
+        unsigned char *data = MakeInput(&size);
+        int compressedSize;
+        unsigned char *compressed = Compress(codec, data, size, &compressedSize);
+
+        int fastSize;
+        int referenceSize;
+        unsigned char *fast = codecs[codec].fast(compressed, compressedSize, &fastSize);
+        unsigned char *reference = codecs[codec].reference(compressed, compressedSize, &referenceSize);
+
+        if (fastSize != size || referenceSize != size || memcmp(fast, data, size) != 0 || memcmp(reference, data, size) != 0)
+        {
+            fprintf(stderr, "%s: iteration %d did not round trip.\n", codecs[codec].name, i);
+            failures++;
+        }
+
+        free(fast);
+        free(reference);
+
+        // Corrupted streams are much slower to check, so only some are.
+        if (i % 4 == 0)
+        {
+            int corruptSize;
+            unsigned char *corrupt = Corrupt(compressed, compressedSize, &corruptSize);
+            struct DecodeResult fastResult = DecodeInChild(codecs[codec].fast, corrupt, corruptSize);
+            struct DecodeResult referenceResult = DecodeInChild(codecs[codec].reference, corrupt, corruptSize);
+
+            if (fastResult.status != referenceResult.status
+             || (fastResult.status == 0 && (fastResult.size != referenceResult.size || fastResult.hash != referenceResult.hash)))
+            {
+                fprintf(stderr, "%s: iteration %d: corrupted stream decoded differently (exit %d vs %d).\n",
+                    codecs[codec].name, i, fastResult.status, referenceResult.status);
+                failures++;
+            }
+            else if (fastResult.status == 0)
+            {
+                corruptDecoded++;
+            }
+            else
+            {
+                corruptFailed++;
+            }
+
+            free(corrupt);
+        }
+
+        free(compressed);
+        free(data);
+    }
+
+    printf("%d streams, %d corrupted (%d rejected, %d decoded), %d failures\n",
+        iterations, corruptFailed + corruptDecoded, corruptFailed, corruptDecoded, failures);
+
+    return failures != 0;
+}
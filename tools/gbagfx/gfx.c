@@ -8,6 +8,7 @@
 #include "global.h"
 #include "gfx.h"
 #include "util.h"
+#include "tile_kernels.h"
 
 #define GET_GBA_PAL_RED(x)   (((x) >>  0) & 0x1F)
 #define GET_GBA_PAL_GREEN(x) (((x) >>  5) & 0x1F)
@@ -64,6 +65,7 @@ static void ConvertFromTiles1Bpp(unsigned char *src, unsigned char *dest, int nu
 
 static void ConvertFromTiles4Bpp(unsigned char *src, unsigned char *dest, int numTiles, int metatilesWide, int metatileWidth, int metatileHeight, bool invertColors)
 {
+	const struct TileKernels *kernels = GetTileKernels();
 	int subTileX = 0;
 	int subTileY = 0;
 	int metatileX = 0;
@@ -71,23 +73,11 @@ static void ConvertFromTiles4Bpp(unsigned char *src, unsigned char *dest, int nu
 	int pitch = (metatilesWide * metatileWidth) * 4;
 
 	for (int i = 0; i < numTiles; i++) {
-		for (int j = 0; j < 8; j++) {
-			int destY = (metatileY * metatileHeight + subTileY) * 8 + j;
-
-			for (int k = 0; k < 4; k++) {
-				int destX = (metatileX * metatileWidth + subTileX) * 4 + k;
-				unsigned char srcPixelPair = *src++;
-				unsigned char leftPixel = srcPixelPair & 0xF;
-				unsigned char rightPixel = srcPixelPair >> 4;
+		int destY = (metatileY * metatileHeight + subTileY) * 8;
+		int destX = (metatileX * metatileWidth + subTileX) * 4;
 
-				if (invertColors) {
-					leftPixel = 15 - leftPixel;
-					rightPixel = 15 - rightPixel;
-				}
-
-				dest[destY * pitch + destX] = (leftPixel << 4) | rightPixel;
-			}
-		}
+		kernels->unpack4Bpp(src, &dest[destY * pitch + destX], pitch, invertColors);
+		src += 32;
 
 		AdvanceMetatilePosition(&subTileX, &subTileY, &metatileX, &metatileY, metatilesWide, metatileWidth, metatileHeight);
 	}
@@ -95,6 +85,7 @@ static void ConvertFromTiles4Bpp(unsigned char *src, unsigned char *dest, int nu
 
 static void ConvertFromTiles8Bpp(unsigned char *src, unsigned char *dest, int numTiles, int metatilesWide, int metatileWidth, int metatileHeight, bool invertColors)
 {
+	const struct TileKernels *kernels = GetTileKernels();
 	int subTileX = 0;
 	int subTileY = 0;
 	int metatileX = 0;
@@ -102,19 +93,11 @@ static void ConvertFromTiles8Bpp(unsigned char *src, unsigned char *dest, int nu
 	int pitch = (metatilesWide * metatileWidth) * 8;
 
 	for (int i = 0; i < numTiles; i++) {
-		for (int j = 0; j < 8; j++) {
-			int destY = (metatileY * metatileHeight + subTileY) * 8 + j;
-
-			for (int k = 0; k < 8; k++) {
-				int destX = (metatileX * metatileWidth + subTileX) * 8 + k;
-				unsigned char srcPixel = *src++;
+		int destY = (metatileY * metatileHeight + subTileY) * 8;
+		int destX = (metatileX * metatileWidth + subTileX) * 8;
 
-				if (invertColors)
-					srcPixel = 255 - srcPixel;
-
-				dest[destY * pitch + destX] = srcPixel;
-			}
-		}
+		kernels->unpack8Bpp(src, &dest[destY * pitch + destX], pitch, invertColors);
+		src += 64;
 
 		AdvanceMetatilePosition(&subTileX, &subTileY, &metatileX, &metatileY, metatilesWide, metatileWidth, metatileHeight);
 	}
@@ -148,6 +131,7 @@ static void ConvertToTiles1Bpp(unsigned char *src, unsigned char *dest, int numT
 
 static void ConvertToTiles4Bpp(unsigned char *src, unsigned char *dest, int numTiles, int metatilesWide, int metatileWidth, int metatileHeight, bool invertColors)
 {
+	const struct TileKernels *kernels = GetTileKernels();
 	int subTileX = 0;
 	int subTileY = 0;
 	int metatileX = 0;
@@ -155,23 +139,11 @@ static void ConvertToTiles4Bpp(unsigned char *src, unsigned char *dest, int numT
 	int pitch = (metatilesWide * metatileWidth) * 4;
 
 	for (int i = 0; i < numTiles; i++) {
-		for (int j = 0; j < 8; j++) {
-			int srcY = (metatileY * metatileHeight + subTileY) * 8 + j;
+		int srcY = (metatileY * metatileHeight + subTileY) * 8;
+		int srcX = (metatileX * metatileWidth + subTileX) * 4;
 
-			for (int k = 0; k < 4; k++) {
-				int srcX = (metatileX * metatileWidth + subTileX) * 4 + k;
-				unsigned char srcPixelPair = src[srcY * pitch + srcX];
-				unsigned char leftPixel = srcPixelPair >> 4;
-				unsigned char rightPixel = srcPixelPair & 0xF;
-
-				if (invertColors) {
-					leftPixel = 15 - leftPixel;
-					rightPixel = 15 - rightPixel;
-				}
-
-				*dest++ = (rightPixel << 4) | leftPixel;
-			}
-		}
+		kernels->pack4Bpp(&src[srcY * pitch + srcX], pitch, dest, invertColors);
+		dest += 32;
 
 		AdvanceMetatilePosition(&subTileX, &subTileY, &metatileX, &metatileY, metatilesWide, metatileWidth, metatileHeight);
 	}
@@ -179,6 +151,7 @@ static void ConvertToTiles4Bpp(unsigned char *src, unsigned char *dest, int numT
 
 static void ConvertToTiles8Bpp(unsigned char *src, unsigned char *dest, int numTiles, int metatilesWide, int metatileWidth, int metatileHeight, bool invertColors)
 {
+	const struct TileKernels *kernels = GetTileKernels();
 	int subTileX = 0;
 	int subTileY = 0;
 	int metatileX = 0;
@@ -186,19 +159,11 @@ static void ConvertToTiles8Bpp(unsigned char *src, unsigned char *dest, int numT
 	int pitch = (metatilesWide * metatileWidth) * 8;
 
 	for (int i = 0; i < numTiles; i++) {
-		for (int j = 0; j < 8; j++) {
-			int srcY = (metatileY * metatileHeight + subTileY) * 8 + j;
-
-			for (int k = 0; k < 8; k++) {
-				int srcX = (metatileX * metatileWidth + subTileX) * 8 + k;
-				unsigned char srcPixel = src[srcY * pitch + srcX];
+		int srcY = (metatileY * metatileHeight + subTileY) * 8;
+		int srcX = (metatileX * metatileWidth + subTileX) * 8;
 
-				if (invertColors)
-					srcPixel = 255 - srcPixel;
-
-				*dest++ = srcPixel;
-			}
-		}
+		kernels->pack8Bpp(&src[srcY * pitch + srcX], pitch, dest, invertColors);
+		dest += 64;
 
 		AdvanceMetatilePosition(&subTileX, &subTileY, &metatileX, &metatileY, metatilesWide, metatileWidth, metatileHeight);
 	}
@@ -408,7 +373,7 @@ void ReadTileImage(char *path, int tilesWidth, int metatileWidth, int metatileHe
 	free(buffer);
 }
 
-void WriteTileImage(char *path, enum NumTilesMode numTilesMode, int numTiles, int metatileWidth, int metatileHeight, struct Image *image, bool invertColors)
+static unsigned char *ConvertImageToTiles(int metatileWidth, int metatileHeight, struct Image *image, bool invertColors, int *numTiles_p)
 {
 	int tileSize = image->bitDepth * 8;
 
@@ -428,15 +393,7 @@ void WriteTileImage(char *path, enum NumTilesMode numTilesMode, int numTiles, in
 		FATAL_ERROR("The height in tiles (%d) isn't a multiple of the specified metatile height (%d)\n", tilesHeight, metatileHeight);
 
 	int maxNumTiles = tilesWidth * tilesHeight;
-
-	if (numTiles == 0)
-		numTiles = maxNumTiles;
-	else if (numTiles > maxNumTiles)
-		FATAL_ERROR("The specified number of tiles (%d) is greater than the maximum possible value (%d).\n", numTiles, maxNumTiles);
-
-	int bufferSize = numTiles * tileSize;
-	int maxBufferSize = maxNumTiles * tileSize;
-	unsigned char *buffer = malloc(maxBufferSize);
+	unsigned char *buffer = malloc(maxNumTiles * tileSize);
 
 	if (buffer == NULL)
 		FATAL_ERROR("Failed to allocate memory for pixels.\n");
@@ -455,6 +412,24 @@ void WriteTileImage(char *path, enum NumTilesMode numTilesMode, int numTiles, in
 		break;
 	}
 
+	*numTiles_p = maxNumTiles;
+	return buffer;
+}
+
+void WriteTileImage(char *path, enum NumTilesMode numTilesMode, int numTiles, int metatileWidth, int metatileHeight, struct Image *image, bool invertColors)
+{
+	int tileSize = image->bitDepth * 8;
+	int maxNumTiles;
+	unsigned char *buffer = ConvertImageToTiles(metatileWidth, metatileHeight, image, invertColors, &maxNumTiles);
+
+	if (numTiles == 0)
+		numTiles = maxNumTiles;
+	else if (numTiles > maxNumTiles)
+		FATAL_ERROR("The specified number of tiles (%d) is greater than the maximum possible value (%d).\n", numTiles, maxNumTiles);
+
+	int bufferSize = numTiles * tileSize;
+	int maxBufferSize = maxNumTiles * tileSize;
+
 	bool zeroPadded = true;
 	for (int i = bufferSize; i < maxBufferSize && zeroPadded; i++) {
 		if (buffer[i] != 0)
@@ -479,6 +454,136 @@ void WriteTileImage(char *path, enum NumTilesMode numTilesMode, int numTiles, in
 	free(buffer);
 }
 
+static uint32_t HashTile(unsigned char *tile, int tileSize)
+{
+	uint32_t hash = 2166136261u;
+
+	for (int i = 0; i < tileSize; i++)
+		hash = (hash ^ tile[i]) * 16777619u;
+
+	return hash;
+}
+
+// Open-addressed set of the unique tiles found so far. Slots hold an index
+// into the unique tile buffer, or -1.
+struct TileSet {
+	int *slots;
+	int mask;
+	unsigned char *tiles;
+	int tileSize;
+};
+
+static int FindTile(struct TileSet *set, unsigned char *tile)
+{
+	int slot = HashTile(tile, set->tileSize) & set->mask;
+
+	while (set->slots[slot] >= 0) {
+		if (memcmp(&set->tiles[set->slots[slot] * set->tileSize], tile, set->tileSize) == 0)
+			return set->slots[slot];
+		slot = (slot + 1) & set->mask;
+	}
+
+	return -1;
+}
+
+static void AddTile(struct TileSet *set, unsigned char *tile, int index)
+{
+	int slot = HashTile(tile, set->tileSize) & set->mask;
+
+	while (set->slots[slot] >= 0)
+		slot = (slot + 1) & set->mask;
+
+	set->slots[slot] = index;
+}
+
+// The inverse of DecodeTilemap: writes only the unique tiles and a tilemap
+// that rebuilds the original image from them. Non-affine maps also match
+// tiles that are flipped copies of an earlier tile.
+void WriteTileImageWithTilemap(char *path, char *tilemapPath, bool isAffine, int metatileWidth, int metatileHeight, struct Image *image, bool invertColors)
+{
+	int tileSize = image->bitDepth * 8;
+	int numTiles;
+
+	if (image->bitDepth != 4 && image->bitDepth != 8)
+		FATAL_ERROR("Tilemaps can only be generated for 4bpp or 8bpp images.\n");
+
+	if (isAffine && image->bitDepth != 8)
+		FATAL_ERROR("affine maps are necessarily 8bpp\n");
+
+	unsigned char *tiles = ConvertImageToTiles(metatileWidth, metatileHeight, image, invertColors, &numTiles);
+	int maxUniqueTiles = isAffine ? 256 : 1024;
+	int mapTileSize = isAffine ? 1 : 2;
+	unsigned char *uniqueTiles = malloc(numTiles * tileSize);
+	unsigned char *tilemap = calloc(numTiles, mapTileSize);
+	int numSlots = 1;
+
+	while (numSlots < numTiles * 2)
+		numSlots <<= 1;
+
+	struct TileSet set = { malloc(numSlots * sizeof(int)), numSlots - 1, uniqueTiles, tileSize };
+
+	if (uniqueTiles == NULL || tilemap == NULL || set.slots == NULL)
+		FATAL_ERROR("Failed to allocate memory for tilemap.\n");
+
+	for (int i = 0; i < numSlots; i++)
+		set.slots[i] = -1;
+
+	int numUniqueTiles = 0;
+	int numFlipped = 0;
+
+	for (int i = 0; i < numTiles; i++) {
+		unsigned char *tile = &tiles[i * tileSize];
+		unsigned char flipped[64];
+		bool hflip = false;
+		bool vflip = false;
+		int index = FindTile(&set, tile);
+
+		// Flipping the tile the same way DecodeNonAffineTilemap does turns it
+		// back into the stored tile, since each flip is its own inverse.
+		for (int flips = 1; index < 0 && !isAffine && flips < 4; flips++) {
+			memcpy(flipped, tile, tileSize);
+			hflip = (flips & 1) != 0;
+			vflip = (flips & 2) != 0;
+			if (hflip)
+				HflipTile(flipped, image->bitDepth);
+			if (vflip)
+				VflipTile(flipped, image->bitDepth);
+			index = FindTile(&set, flipped);
+		}
+
+		if (index < 0) {
+			if (numUniqueTiles == maxUniqueTiles)
+				FATAL_ERROR("The image has more than %d unique tiles.\n", maxUniqueTiles);
+
+			index = numUniqueTiles++;
+			hflip = false;
+			vflip = false;
+			memcpy(&uniqueTiles[index * tileSize], tile, tileSize);
+			AddTile(&set, tile, index);
+		} else if (hflip || vflip) {
+			numFlipped++;
+		}
+
+		if (isAffine) {
+			tilemap[i] = index;
+		} else {
+			struct NonAffineTile entry = { .index = index, .hflip = hflip, .vflip = vflip, .palno = 0 };
+			memcpy(&tilemap[i * 2], &entry, 2);
+		}
+	}
+
+	WriteWholeFile(path, uniqueTiles, numUniqueTiles * tileSize);
+	WriteWholeFile(tilemapPath, tilemap, numTiles * mapTileSize);
+
+	printf("%s: %d tiles, %d unique (%d flipped matches), %d bytes saved\n",
+		path, numTiles, numUniqueTiles, numFlipped, (numTiles - numUniqueTiles) * tileSize);
+
+	free(set.slots);
+	free(tilemap);
+	free(uniqueTiles);
+	free(tiles);
+}
+
 void ReadPlainImage(char *path, int dataWidth, struct Image *image, bool invertColors)
 {
 	int fileSize;
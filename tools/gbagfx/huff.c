@@ -1,4 +1,5 @@
 #include <stdbool.h>
+#include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 #include <stdio.h>
@@ -6,209 +7,172 @@
 #include "global.h"
 #include "huff.h"
 
-static int cmp_tree(const void *a0, const void *b0) {
-    return ((struct HuffData *)a0)->value - ((struct HuffData *)b0)->value;
+#define MAX_CODE_LENGTH 32
+
+struct HuffTreeNode {
+    uint32_t weight;
+    int left;  // -1 for leaves
+    int right;
+    int key;
+};
+
+struct HuffCode {
+    uint64_t bits;
+    int nbits;
+};
+
+struct BitWriter {
+    unsigned char * dest;
+    int destPos;
+    uint64_t buff;
+    int buffBits;
+};
+
+static int cmp_leaf(const void *a0, const void *b0) {
+    const struct HuffTreeNode *a = a0;
+    const struct HuffTreeNode *b = b0;
+
+    // Ties are broken by key so the tree does not depend on the sort algorithm.
+    if (a->weight != b->weight)
+        return a->weight < b->weight ? -1 : 1;
+    return a->key - b->key;
 }
 
-typedef int (*cmpfun)(const void *, const void *);
-
-int msort_r(void *data, size_t count, size_t size, cmpfun cmp, void *buffer) {
+static int build_tree(struct HuffTreeNode * nodes, uint32_t * freqs, int nsymbols) {
     /*
-     * Out-of-place mergesort (stable sort)
-     * Returns 1 on success, 0 on failure
+     * Two-queue Huffman construction.  The leaves are sorted once; branches
+     * are created in non-decreasing weight order, so the two lightest nodes
+     * are always at the front of one of the two queues.  On equal weights a
+     * leaf is taken before a branch.
+     * Returns the index of the root.
      */
-    void *leftPtr;
-    void *rightPtr;
-    void *leftEnd;
-    void *rightEnd;
-    int i;
-
-    switch (count) {
-    case 0:
-        // Should never be here
-        return 0;
-
-    case 1:
-        // Nothing to do here
-        break;
-
-    case 2:
-        // Swap the two entries if the right one compares higher.
-        if (cmp(data, data + size) > 0) {
-            memcpy(buffer, data, size);
-            memcpy(data, data + size, size);
-            memcpy(data + size, buffer, size);
+    int nleaves = 0;
+    int lastUnused = -1;
+
+    for (int i = 0; i < nsymbols; i++) {
+        if (freqs[i] != 0) {
+            nodes[nleaves].weight = freqs[i];
+            nodes[nleaves].left = nodes[nleaves].right = -1;
+            nodes[nleaves].key = i;
+            nleaves++;
+        } else {
+            lastUnused = i;
         }
-        break;
-    default:
-        // Merge sort out-of-place.
-        leftPtr = data;
-        leftEnd = rightPtr = data + count / 2 * size;
-        rightEnd = data + count * size;
-
-        // Sort the left half
-        if (!msort_r(leftPtr, count / 2, size, cmp, buffer))
-            return 0;
-
-        // Sort the right half
-        if (!msort_r(rightPtr, count / 2 + (count & 1), size, cmp, buffer))
-            return 0;
-
-        // Merge the sorted halves out of place
-        i = 0;
-        do {
-            if (cmp(leftPtr, rightPtr) <= 0) {
-                memcpy(buffer + i * size, leftPtr, size);
-                leftPtr += size;
-            } else {
-                memcpy(buffer + i * size, rightPtr, size);
-                rightPtr += size;
-            }
+    }
 
-        } while (++i < count && leftPtr < leftEnd && rightPtr < rightEnd);
+    // The decoder needs at least one branch, so give a lone symbol a sibling.
+    if (nleaves == 1) {
+        nodes[1].weight = 0;
+        nodes[1].left = nodes[1].right = -1;
+        nodes[1].key = lastUnused;
+        nleaves++;
+    }
 
-        // Copy the remainder
-        if (i < count) {
-            if (leftPtr < leftEnd) {
-                memcpy(buffer + i * size, leftPtr, leftEnd - leftPtr);
-            }
-            else {
-                memcpy(buffer + i * size, rightPtr, rightEnd - rightPtr);
-            }
-        }
+    qsort(nodes, nleaves, sizeof(struct HuffTreeNode), cmp_leaf);
 
-        // Copy the merged data back
-        memcpy(data, buffer, count * size);
-        break;
-    }
+    int leafPos = 0;
+    int branchPos = nleaves;
+    int nnodes = nleaves;
 
-    return 1;
-}
+    while (nnodes < 2 * nleaves - 1) {
+        int picked[2];
+        for (int i = 0; i < 2; i++) {
+            if (leafPos < nleaves && (branchPos == nnodes || nodes[leafPos].weight <= nodes[branchPos].weight))
+                picked[i] = leafPos++;
+            else
+                picked[i] = branchPos++;
+        }
+        // The lighter node goes on the right.
+        nodes[nnodes].weight = nodes[picked[0]].weight + nodes[picked[1]].weight;
+        nodes[nnodes].left = picked[1];
+        nodes[nnodes].right = picked[0];
+        nodes[nnodes].key = -1;
+        nnodes++;
+    }
 
-int msort(void *data, size_t count, size_t size, cmpfun cmp) {
-    void *buffer = malloc(count * size);
-    if (buffer == NULL) return 0;
-    int result = msort_r(data, count, size, cmp, buffer);
-    free(buffer);
-    return result;
+    return nnodes - 1;
 }
 
-static void write_tree(unsigned char * dest, HuffNode_t * tree, int nitems, struct BitEncoding * encoding) {
+static void write_tree(unsigned char * dest, struct HuffTreeNode * nodes, int root, int nleaves, struct HuffCode * codes) {
     /*
-     * The example used to guide this function encodes the tree in a
-     * breadth-first manner.  We attempt to emulate that here.
+     * The tree is stored breadth-first, with the two children of a branch
+     * next to each other.  Walking it with a queue gives that order directly,
+     * and the same walk assigns each leaf its code.
      */
+    int nnodes = 2 * nleaves - 1;
+    int order[511];
+    struct HuffCode paths[511];
 
-    int i, j, k;
-
-    // There are (2 * nitems - 1) nodes in the binary tree.  Allocate that.
-    HuffNode_t * traversal = calloc(2 * nitems - 1, sizeof(HuffNode_t));
-    if (traversal == NULL)
-        FATAL_ERROR("Fatal error while compressing Huff file.\n");
-
-    // The first node is the root of the tree.
-    traversal[0] = *tree;
-    i = 1;
-
-    // Copy the tree into a breadth-first ordering using brute force.
-    for (int depth = 1; i < 2 * nitems - 1; depth++) {
-        // Consider every possible path up to the current depth.
-        for (j = 0; i < 2 * nitems - 1 && j < 1 << depth; j++) {
-            // The index of the path is used to encode the path itself.
-            // Start from the most significant relevant bit and work our way down.
-            // Keep track of the current and previous nodes.
-            HuffNode_t * currNode = traversal;
-            HuffNode_t * parent = NULL;
-            for (k = 0; k < depth; k++) {
-                if (currNode->header.isLeaf)
-                    break;
-                parent = currNode;
-                if ((j >> (depth - k - 1)) & 1)
-                    currNode = currNode->branch.right;
-                else
-                    currNode = currNode->branch.left;
-            }
-            // Check that the length of the current path equals the current depth.
-            if (k == depth) {
-                // Make sure we can encode the current branch.
-                // Bail here if we cannot.
-                // This is only applicable for 8-bit encodings.
-                if (traversal + i - parent > 128)
-                    FATAL_ERROR("Fatal error while compressing Huff file: unable to encode binary tree.\n");
-                // Copy the current node, and update its parent.
-                traversal[i] = *currNode;
-                if (parent != NULL) {
-                    if ((j & 1) == 1)
-                        parent->branch.right = traversal + i;
-                    else
-                        parent->branch.left = traversal + i;
-                }
-                // Encode the path through the tree in the lookup table
-                if (traversal[i].header.isLeaf) {
-                    encoding[traversal[i].leaf.key].nbits = depth;
-                    encoding[traversal[i].leaf.key].bitstring = j;
-                }
-                i++;
-            }
-        }
-    }
+    order[0] = root;
+    paths[0].bits = 0;
+    paths[0].nbits = 0;
 
     // Encode the size of the tree.
     // This is used by the decompressor to skip the tree.
-    dest[4] = nitems - 1;
+    dest[4] = nleaves - 1;
 
-    // Encode each node in the tree.
-    for (i = 0; i < 2 * nitems - 1; i++) {
-        HuffNode_t * currNode = traversal + i;
-        if (currNode->header.isLeaf) {
-            dest[5 + i] = traversal[i].leaf.key;
-        } else {
-            dest[5 + i] = (((currNode->branch.right - traversal - i) / 2) - 1);
-            if (currNode->branch.left->header.isLeaf)
-                dest[5 + i] |= 0x80;
-            if (currNode->branch.right->header.isLeaf)
-                dest[5 + i] |= 0x40;
+    for (int i = 0, queued = 1; i < nnodes; i++) {
+        struct HuffTreeNode * node = &nodes[order[i]];
+
+        if (node->left < 0) {
+            dest[5 + i] = node->key;
+            codes[node->key] = paths[i];
+            continue;
         }
-    }
 
-    free(traversal);
+        // The child offset is stored in 6 bits.
+        if (queued + 1 - i > 128)
+            FATAL_ERROR("Fatal error while compressing Huff file: unable to encode binary tree.\n");
+        if (paths[i].nbits == MAX_CODE_LENGTH)
+            FATAL_ERROR("Fatal error while compressing Huff file: code too long.\n");
+
+        order[queued] = node->left;
+        paths[queued].bits = paths[i].bits << 1;
+        paths[queued].nbits = paths[i].nbits + 1;
+        order[queued + 1] = node->right;
+        paths[queued + 1].bits = (paths[i].bits << 1) | 1;
+        paths[queued + 1].nbits = paths[i].nbits + 1;
+
+        dest[5 + i] = ((queued + 1 - i) / 2) - 1;
+        if (nodes[node->left].left < 0)
+            dest[5 + i] |= 0x80;
+        if (nodes[node->right].left < 0)
+            dest[5 + i] |= 0x40;
+
+        queued += 2;
+    }
 }
 
-static inline void write_32_le(unsigned char * dest, int * destPos, uint32_t * buff, int * buffPos) {
-    dest[*destPos] = *buff;
-    dest[*destPos + 1] = *buff >> 8;
-    dest[*destPos + 2] = *buff >> 16;
-    dest[*destPos + 3] = *buff >> 24;
+static inline void write_32_le(unsigned char * dest, int * destPos, uint32_t value) {
+    dest[*destPos] = value;
+    dest[*destPos + 1] = value >> 8;
+    dest[*destPos + 2] = value >> 16;
+    dest[*destPos + 3] = value >> 24;
     *destPos += 4;
-    *buff = 0;
-    *buffPos = 0;
 }
 
 static inline void read_32_le(unsigned char * src, int * srcPos, uint32_t * buff) {
     uint32_t tmp = src[*srcPos];
-    tmp |= src[*srcPos + 1] << 8;
-    tmp |= src[*srcPos + 2] << 16;
-    tmp |= src[*srcPos + 3] << 24;
+    tmp |= (uint32_t)src[*srcPos + 1] << 8;
+    tmp |= (uint32_t)src[*srcPos + 2] << 16;
+    tmp |= (uint32_t)src[*srcPos + 3] << 24;
     *srcPos += 4;
     *buff = tmp;
 }
 
-static void write_bits(unsigned char * dest, int * destPos, struct BitEncoding * encoding, int value, uint32_t * buff, int * buffBits) {
-    int nbits = encoding[value].nbits;
-    uint32_t bitstring = encoding[value].bitstring;
-
-    if (*buffBits + nbits >= 32) {
-        int diff = *buffBits + nbits - 32;
-        *buff <<= nbits - diff;
-        *buff |= bitstring >> diff;
-        bitstring &= ~(1 << diff);
-        nbits = diff;
-        write_32_le(dest, destPos, buff, buffBits);
+static inline void write_bits(struct BitWriter * writer, uint64_t bits, int nbits) {
+    // Bits are packed MSB-first into little-endian words.  nbits is at most
+    // 2 * MAX_CODE_LENGTH, and fewer than 32 bits are ever left pending.
+    if (nbits > 32) {
+        write_bits(writer, bits >> 32, nbits - 32);
+        bits &= 0xFFFFFFFF;
+        nbits = 32;
     }
-    if (nbits != 0) {
-        *buff <<= nbits;
-        *buff |= bitstring;
-        *buffBits += nbits;
+    writer->buff = (writer->buff << nbits) | bits;
+    writer->buffBits += nbits;
+    if (writer->buffBits >= 32) {
+        writer->buffBits -= 32;
+        write_32_le(writer->dest, &writer->destPos, writer->buff >> writer->buffBits);
     }
 }
 
@@ -222,128 +186,90 @@ unsigned char * HuffCompress(unsigned char * src, int srcSize, int * compressedS
     if (srcSize <= 0)
         goto fail;
 
-    int worstCaseDestSize = 4 + (2 << bitDepth) + srcSize * 3;
-
-    unsigned char *dest = malloc(worstCaseDestSize);
-    if (dest == NULL)
-        goto fail;
-
-    int nitems = 1 << bitDepth;
-
-    HuffNode_t * freqs = calloc(nitems, sizeof(HuffNode_t));
-    if (freqs == NULL)
-        goto fail;
-
-    struct BitEncoding * encoding = calloc(nitems, sizeof(struct BitEncoding));
-    if (encoding == NULL)
-        goto fail;
+    int nsymbols = 1 << bitDepth;
+    uint32_t freqs[256] = {0};
 
-    // Set up the frequencies table.  This will inform the tree.
-    for (int i = 0; i < nitems; i++) {
-        freqs[i].header.isLeaf = 1;
-        freqs[i].header.value = 0;
-        freqs[i].leaf.key = i;
-    }
+    // The data is encoded in whole words, so a partial last word is padded
+    // with zeros.
+    int paddedSize = (srcSize + 3) & ~3;
 
     // Count each nybble or byte.
-    for (int i = 0; i < srcSize; i++) {
-        if (bitDepth == 8) {
-            freqs[src[i]].header.value++;
-        } else {
-            freqs[src[i] >> 4].header.value++;
-            freqs[src[i] & 0xF].header.value++;
+    if (bitDepth == 8) {
+        for (int i = 0; i < srcSize; i++)
+            freqs[src[i]]++;
+    } else {
+        for (int i = 0; i < srcSize; i++) {
+            freqs[src[i] >> 4]++;
+            freqs[src[i] & 0xF]++;
         }
     }
+    freqs[0] += (paddedSize - srcSize) * (8 / bitDepth);
 
 #ifdef DEBUG
-    for (int i = 0; i < nitems; i++) {
-        fprintf(stderr, "%d: %d\n", i, freqs[i].header.value);
+    for (int i = 0; i < nsymbols; i++) {
+        fprintf(stderr, "%d: %d\n", i, freqs[i]);
     }
 #endif // DEBUG
 
-    // Sort the frequency table.
-    if (!msort(freqs, nitems, sizeof(HuffNode_t), cmp_tree))
-        goto fail;
-
-    // Prune zero-frequency values.
-    for (int i = 0; i < nitems; i++) {
-        if (freqs[i].header.value != 0) {
-            if (i > 0) {
-                for (int j = i; j < nitems; j++) {
-                    freqs[j - i] = freqs[j];
-                }
-                nitems -= i;
-            }
-            break;
-        }
-        // This should never happen:
-        if (i == nitems - 1)
-            goto fail;
-    }
+    struct HuffTreeNode nodes[511];
+    struct HuffCode codes[256] = {{0}};
+    int root = build_tree(nodes, freqs, nsymbols);
+    int nleaves = (root + 2) / 2;
 
-    HuffNode_t * tree = calloc(nitems * 2 - 1, sizeof(HuffNode_t));
-    if (tree == NULL)
-        goto fail;
+    uint64_t totalBits = 0;
+    unsigned char tree[4 + 512];
+    write_tree(tree, nodes, root, nleaves, codes);
 
-    // Iteratively collapse the two least frequent nodes.
-    HuffNode_t * endptr = freqs + nitems - 2;
-
-    for (int i = 0; i < nitems - 1; i++) {
-        HuffNode_t * left = freqs;
-        HuffNode_t * right = freqs + 1;
-        tree[i * 2] = *right;
-        tree[i * 2 + 1] = *left;
-        for (int j = 0; j < nitems - i - 2; j++)
-            freqs[j] = freqs[j + 2];
-        endptr->header.isLeaf = 0;
-        endptr->header.value = tree[i * 2].header.value + tree[i * 2 + 1].header.value;
-        endptr->branch.left = tree + i * 2;
-        endptr->branch.right = tree + i * 2 + 1;
-        endptr--;
-        if (i < nitems - 2 && !msort(freqs, nitems - i - 1, sizeof(HuffNode_t), cmp_tree))
-            goto fail;
-    }
+    for (int i = 0; i < nsymbols; i++)
+        totalBits += (uint64_t)freqs[i] * codes[i].nbits;
 
-    // Write the tree breadth-first, and create the path lookup table.
-    write_tree(dest, freqs, nitems, encoding);
+    int headerSize = 4 + nleaves * 2;
+    int destSize = headerSize + (int)((totalBits + 31) / 32) * 4;
+    unsigned char *dest = calloc(destSize + 3, 1);
+    if (dest == NULL)
+        goto fail;
 
-    free(tree);
-    free(freqs);
+    memcpy(dest + 4, tree + 4, nleaves * 2);
 
-    // Encode the data itself.
-    int destPos = 4 + nitems * 2;
-    uint32_t destBuf = 0;
-    uint32_t srcBuf = 0;
-    int destBitPos = 0;
-
-    for (int srcPos = 0; srcPos < srcSize;) {
-        read_32_le(src, &srcPos, &srcBuf);
-        for (int i = 0; i < 32 / bitDepth; i++) {
-            write_bits(dest, &destPos, encoding, srcBuf & (0xFF >> (8 - bitDepth)), &destBuf, &destBitPos);
-            srcBuf >>= bitDepth;
+    // Build a table that encodes a whole source byte at once.  Nybbles are
+    // stored low one first.
+    struct HuffCode byteCodes[256];
+    for (int i = 0; i < 256; i++) {
+        if (bitDepth == 8) {
+            byteCodes[i] = codes[i];
+        } else {
+            struct HuffCode lo = codes[i & 0xF];
+            struct HuffCode hi = codes[i >> 4];
+            byteCodes[i].bits = (lo.bits << hi.nbits) | hi.bits;
+            byteCodes[i].nbits = lo.nbits + hi.nbits;
         }
     }
 
-    if (destBitPos != 0) {
-        write_32_le(dest, &destPos, &destBuf, &destBitPos);
-    }
+    // Encode the data itself.
+    struct BitWriter writer = { dest, headerSize, 0, 0 };
+
+    for (int i = 0; i < srcSize; i++)
+        write_bits(&writer, byteCodes[src[i]].bits, byteCodes[src[i]].nbits);
+    for (int i = srcSize; i < paddedSize; i++)
+        write_bits(&writer, byteCodes[0].bits, byteCodes[0].nbits);
 
-    free(encoding);
+    if (writer.buffBits != 0)
+        write_32_le(dest, &writer.destPos, writer.buff << (32 - writer.buffBits));
 
     // Write the header.
     dest[0] = bitDepth | 0x20;
     dest[1] = srcSize;
     dest[2] = srcSize >> 8;
     dest[3] = srcSize >> 16;
-    *compressedSize_p = (destPos + 3) & ~3;
+    *compressedSize_p = (writer.destPos + 3) & ~3;
     return dest;
 
 fail:
     FATAL_ERROR("Fatal error while compressing Huff file.\n");
 }
 
-unsigned char * HuffDecompress(unsigned char * src, int srcSize, int * uncompressedSize_p) {
-    if (srcSize < 4)
+unsigned char * HuffDecompressReference(unsigned char * src, int srcSize, int * uncompressedSize_p) {
+    if (srcSize < 5)
         goto fail;
 
     int bitDepth = *src & 15;
@@ -352,7 +278,9 @@ unsigned char * HuffDecompress(unsigned char * src, int srcSize, int * uncompres
 
     int destSize = (src[3] << 16) | (src[2] << 8) | src[1];
 
-    unsigned char *dest = malloc(destSize);
+    // The data is decoded in whole words, and at least one word is always
+    // decoded.
+    unsigned char *dest = malloc(destSize > 0 ? (destSize + 3) & ~3 : 4);
 
     if (dest == NULL)
         goto fail;
@@ -367,22 +295,28 @@ unsigned char * HuffDecompress(unsigned char * src, int srcSize, int * uncompres
 
     for (;;)
     {
-        if (srcPos >= srcSize)
+        if (srcPos + 4 > srcSize)
             goto fail;
         read_32_le(src, &srcPos, &window);
         for (int i = 0; i < 32; i++) {
             int curBit = (window >> 31) & 1;
+            if (treePos >= srcSize)
+                goto fail;
             unsigned char treeView = src[treePos];
             bool isLeaf = ((treeView << curBit) & 0x80) != 0;
             treePos &= ~1; // align
             treePos += ((treeView & 0x3F) + 1) * 2 + curBit;
             if (isLeaf) {
+                if (treePos >= srcSize)
+                    goto fail;
                 destTmp >>= bitDepth;
-                destTmp |= (src[treePos] << (32 - bitDepth));
+                destTmp |= ((uint32_t)src[treePos] << (32 - bitDepth));
                 curValPos++;
                 if (curValPos == 32 / bitDepth) {
-                    write_32_le(dest, &destPos, &destTmp, &curValPos);
-                    if (destPos == destSize) {
+                    write_32_le(dest, &destPos, destTmp);
+                    destTmp = 0;
+                    curValPos = 0;
+                    if (destPos >= destSize) {
                         *uncompressedSize_p = destSize;
                         return dest;
                     }
@@ -396,3 +330,202 @@ unsigned char * HuffDecompress(unsigned char * src, int srcSize, int * uncompres
 fail:
     FATAL_ERROR("Fatal error while decompressing Huff file.\n");
 }
+
+/*
+ * The fast decoder looks up the next HUFF_LOOKUP_BITS bits of the stream in a
+ * table built from the tree.  Most codes are shorter than that and are
+ * decoded in one step; longer ones continue bit by bit from the node the
+ * table stopped at.  Anything the table cannot resolve safely (a malformed
+ * tree pointing outside the file) is left to the bit-by-bit walk, which fails
+ * exactly where HuffDecompressReference does.
+ */
+#define HUFF_LOOKUP_BITS 10
+
+enum HuffLookupType {
+    HUFF_LOOKUP_LEAF,   // a whole code: symbol and length
+    HUFF_LOOKUP_BRANCH, // no leaf yet: continue from treePos
+    HUFF_LOOKUP_WALK,   // walk from the root
+};
+
+struct HuffLookup {
+    unsigned char type;
+    unsigned char length;
+    unsigned char symbol;
+    int treePos;
+};
+
+struct HuffBitReader {
+    unsigned char * src;
+    int srcSize;
+    int srcPos;
+    uint64_t buff;
+    int buffBits;
+};
+
+static inline bool huff_step(unsigned char * src, int * treePos, int bit) {
+    unsigned char treeView = src[*treePos];
+    bool isLeaf = ((treeView << bit) & 0x80) != 0;
+    *treePos = (*treePos & ~1) + ((treeView & 0x3F) + 1) * 2 + bit;
+    return isLeaf;
+}
+
+static void fill_lookup(struct HuffLookup * table, int first, int count, int type, int length, int symbol, int treePos) {
+    for (int i = first; i < first + count; i++) {
+        table[i].type = type;
+        table[i].length = length;
+        table[i].symbol = symbol;
+        table[i].treePos = treePos;
+    }
+}
+
+// Fills the entries for every prefix that starts with the depth-bit path to
+// the node at treePos.
+static void build_lookup(unsigned char * src, int srcSize, struct HuffLookup * table, int treePos, int depth, int path) {
+    int span = 1 << (HUFF_LOOKUP_BITS - depth);
+
+    if (treePos >= srcSize) {
+        fill_lookup(table, path * span, span, HUFF_LOOKUP_WALK, 0, 0, 0);
+        return;
+    }
+
+    for (int bit = 0; bit < 2; bit++) {
+        int childPos = treePos;
+        int childPath = path * 2 + bit;
+        bool isLeaf = huff_step(src, &childPos, bit);
+
+        if (isLeaf && childPos >= srcSize)
+            fill_lookup(table, childPath * (span / 2), span / 2, HUFF_LOOKUP_WALK, 0, 0, 0);
+        else if (isLeaf)
+            fill_lookup(table, childPath * (span / 2), span / 2, HUFF_LOOKUP_LEAF, depth + 1, src[childPos], 0);
+        else if (depth + 1 == HUFF_LOOKUP_BITS)
+            fill_lookup(table, childPath, 1, HUFF_LOOKUP_BRANCH, 0, 0, childPos);
+        else
+            build_lookup(src, srcSize, table, childPos, depth + 1, childPath);
+    }
+}
+
+static inline void refill_bits(struct HuffBitReader * reader) {
+    if (reader->buffBits <= 32 && reader->srcPos + 4 <= reader->srcSize) {
+        uint32_t word;
+        read_32_le(reader->src, &reader->srcPos, &word);
+        reader->buff = (reader->buff << 32) | word;
+        reader->buffBits += 32;
+    }
+}
+
+static inline int read_bit(struct HuffBitReader * reader) {
+    if (reader->buffBits == 0) {
+        refill_bits(reader);
+        if (reader->buffBits == 0)
+            FATAL_ERROR("Fatal error while decompressing Huff file.\n");
+    }
+    reader->buffBits--;
+    return (reader->buff >> reader->buffBits) & 1;
+}
+
+// Decodes one symbol, using the table for its first HUFF_LOOKUP_BITS bits
+// when that many are buffered.
+static int decode_symbol(struct HuffBitReader * reader, struct HuffLookup * table) {
+    int treePos = 5;
+
+    refill_bits(reader);
+
+    if (reader->buffBits >= HUFF_LOOKUP_BITS) {
+        struct HuffLookup * entry = &table[(reader->buff >> (reader->buffBits - HUFF_LOOKUP_BITS)) & ((1 << HUFF_LOOKUP_BITS) - 1)];
+
+        if (entry->type == HUFF_LOOKUP_LEAF) {
+            reader->buffBits -= entry->length;
+            return entry->symbol;
+        }
+        if (entry->type == HUFF_LOOKUP_BRANCH) {
+            reader->buffBits -= HUFF_LOOKUP_BITS;
+            treePos = entry->treePos;
+        }
+    }
+
+    for (;;) {
+        int bit = read_bit(reader);
+        if (treePos >= reader->srcSize)
+            goto fail;
+        if (huff_step(reader->src, &treePos, bit))
+            break;
+    }
+    if (treePos >= reader->srcSize)
+        goto fail;
+    return reader->src[treePos];
+
+fail:
+    FATAL_ERROR("Fatal error while decompressing Huff file.\n");
+}
+
+unsigned char * HuffDecompress(unsigned char * src, int srcSize, int * uncompressedSize_p) {
+    if (srcSize < 5)
+        goto fail;
+
+    int bitDepth = *src & 15;
+    if (bitDepth != 4 && bitDepth != 8)
+        goto fail;
+
+    int destSize = (src[3] << 16) | (src[2] << 8) | src[1];
+    int paddedSize = destSize > 0 ? (destSize + 3) & ~3 : 4;
+
+    unsigned char *dest = malloc(paddedSize);
+
+    if (dest == NULL)
+        goto fail;
+
+    struct HuffLookup table[1 << HUFF_LOOKUP_BITS];
+    build_lookup(src, srcSize, table, 5, 0, 0);
+
+    // A second table decodes a whole output byte per lookup.  For 4bpp that
+    // is two codes whose total length fits in the lookup.
+    struct HuffLookup byteTable[1 << HUFF_LOOKUP_BITS];
+    struct HuffLookup * bytes = table;
+
+    if (bitDepth == 4) {
+        int mask = (1 << HUFF_LOOKUP_BITS) - 1;
+
+        for (int i = 0; i <= mask; i++) {
+            struct HuffLookup * lo = &table[i];
+            struct HuffLookup * hi = &table[(i << lo->length) & mask];
+
+            if (lo->type == HUFF_LOOKUP_LEAF && hi->type == HUFF_LOOKUP_LEAF && lo->length + hi->length <= HUFF_LOOKUP_BITS) {
+                byteTable[i].type = HUFF_LOOKUP_LEAF;
+                byteTable[i].length = lo->length + hi->length;
+                byteTable[i].symbol = (lo->symbol & 0xF) | (hi->symbol << 4);
+            } else {
+                byteTable[i].type = HUFF_LOOKUP_WALK;
+            }
+        }
+        bytes = byteTable;
+    }
+
+    struct HuffBitReader reader = { src, srcSize, 4 + (src[4] + 1) * 2, 0, 0 };
+
+    for (int destPos = 0; destPos < paddedSize; destPos++) {
+        refill_bits(&reader);
+
+        if (reader.buffBits >= HUFF_LOOKUP_BITS) {
+            struct HuffLookup * entry = &bytes[(reader.buff >> (reader.buffBits - HUFF_LOOKUP_BITS)) & ((1 << HUFF_LOOKUP_BITS) - 1)];
+
+            if (entry->type == HUFF_LOOKUP_LEAF) {
+                reader.buffBits -= entry->length;
+                dest[destPos] = entry->symbol;
+                continue;
+            }
+        }
+
+        if (bitDepth == 8) {
+            dest[destPos] = decode_symbol(&reader, table);
+        } else {
+            int lo = decode_symbol(&reader, table) & 0xF;
+            dest[destPos] = lo | (decode_symbol(&reader, table) << 4);
+        }
+    }
+
+    *uncompressedSize_p = destSize;
+    return dest;
+
+fail:
+    FATAL_ERROR("Fatal error while decompressing Huff file.\n");
+}
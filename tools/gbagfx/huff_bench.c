@@ -0,0 +1,76 @@
+// Benchmarks the Huffman encoder and checks that every output decodes back to
+// its input. Reads input paths, one per line, from stdin.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "global.h"
+#include "util.h"
+#include "bench_util.h"
+#include "huff.h"
+
+// Each file is small, so it is compressed several times to get a stable time.
+#define HUFF_BENCH_ROUNDS 20
+
+static double RunEncoder(struct BenchFile *files, int numFiles, int bitDepth, long *compressedTotal, int *mismatches)
+{
+    double seconds = 0;
+
+    *compressedTotal = 0;
+
+    for (int i = 0; i < numFiles; i++)
+    {
+        unsigned char *compressed = NULL;
+        int compressedSize;
+        clock_t start = clock();
+
+        for (int round = 0; round < HUFF_BENCH_ROUNDS; round++)
+        {
+            free(compressed);
+            compressed = HuffCompress(files[i].data, files[i].size, &compressedSize, bitDepth);
+        }
+
+        seconds += (double)(clock() - start) / CLOCKS_PER_SEC;
+        *compressedTotal += compressedSize;
+
+        int uncompressedSize;
+        unsigned char *uncompressed = HuffDecompress(compressed, compressedSize, &uncompressedSize);
+
+        if (uncompressedSize != files[i].size || memcmp(uncompressed, files[i].data, files[i].size) != 0)
+        {
+            fprintf(stderr, "Round trip mismatch for \"%s\" at depth %d.\n", files[i].path, bitDepth);
+            (*mismatches)++;
+        }
+
+        free(uncompressed);
+        free(compressed);
+    }
+
+    return seconds;
+}
+
+int main(void)
+{
+    int numFiles;
+    long totalSize;
+    struct BenchFile *files = LoadBenchFiles("fonts", &numFiles, &totalSize);
+
+    double megabytes = (double)totalSize * HUFF_BENCH_ROUNDS / (1024.0 * 1024.0);
+    int mismatches = 0;
+
+    printf("%d files, %.2f MB x %d rounds\n", numFiles, totalSize / (1024.0 * 1024.0), HUFF_BENCH_ROUNDS);
+
+    for (int bitDepth = 4; bitDepth <= 8; bitDepth += 4)
+    {
+        long compressedTotal;
+        double seconds = RunEncoder(files, numFiles, bitDepth, &compressedTotal, &mismatches);
+
+        printf("depth %d: %8.3f s %8.2f MB/s  ratio %.3f\n", bitDepth, seconds, megabytes / seconds,
+            (double)compressedTotal / totalSize);
+    }
+
+    FreeBenchFiles(files, numFiles);
+
+    return mismatches != 0;
+}
@@ -2,10 +2,12 @@
 
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
 #include "global.h"
 #include "lz.h"
 
-unsigned char *LZDecompress(unsigned char *src, int srcSize, int *uncompressedSize)
+unsigned char *LZDecompressReference(unsigned char *src, int srcSize, int *uncompressedSize)
 {
 	if (srcSize < 4)
 		goto fail;
@@ -69,7 +71,242 @@ fail:
 	FATAL_ERROR("Fatal error while decompressing LZ file.\n");
 }
 
+// Room for the 8-byte copies below to run past the end of the output.
+#define LZ_DECOMPRESS_SLACK 8
+
+// Same results as LZDecompressReference, but copies matches and runs of
+// literals in 8-byte chunks. A match can be copied that way when its source
+// is at least 8 bytes back; the chunks may write up to 7 bytes past the end of
+// the match, which the next token overwrites.
+unsigned char *LZDecompress(unsigned char *src, int srcSize, int *uncompressedSize)
+{
+	if (srcSize < 4)
+		goto fail;
+
+	int destSize = (src[3] << 16) | (src[2] << 8) | src[1];
+
+	unsigned char *dest = malloc(destSize + LZ_DECOMPRESS_SLACK);
+
+	if (dest == NULL)
+		goto fail;
+
+	int srcPos = 4;
+	int destPos = 0;
+
+	for (;;) {
+		if (srcPos >= srcSize)
+			goto fail;
+
+		unsigned char flags = src[srcPos++];
+
+		// Eight literals in a row.
+		if (flags == 0 && srcPos + 8 <= srcSize && destPos + 8 <= destSize) {
+			memcpy(dest + destPos, src + srcPos, 8);
+			srcPos += 8;
+			destPos += 8;
+
+			if (destPos == destSize)
+				goto done;
+
+			continue;
+		}
+
+		for (int i = 0; i < 8; i++) {
+			if (flags & 0x80) {
+				if (srcPos + 1 >= srcSize)
+					goto fail;
+
+				int blockSize = (src[srcPos] >> 4) + 3;
+				int blockDistance = (((src[srcPos] & 0xF) << 8) | src[srcPos + 1]) + 1;
+
+				srcPos += 2;
+
+				int blockPos = destPos - blockDistance;
+
+				// Some Ruby/Sapphire tilesets overflow.
+				if (destPos + blockSize > destSize) {
+					blockSize = destSize - destPos;
+					fprintf(stderr, "Destination buffer overflow.\n");
+				}
+
+				if (blockPos < 0)
+					goto fail;
+
+				unsigned char *out = dest + destPos;
+				unsigned char *in = dest + blockPos;
+
+				if (blockDistance >= 8) {
+					for (int j = 0; j < blockSize; j += 8)
+						memcpy(out + j, in + j, 8);
+				} else if (blockDistance == 1) {
+					memset(out, *in, blockSize);
+				} else {
+					for (int j = 0; j < blockSize; j++)
+						out[j] = in[j];
+				}
+
+				destPos += blockSize;
+			} else {
+				if (srcPos >= srcSize || destPos >= destSize)
+					goto fail;
+
+				dest[destPos++] = src[srcPos++];
+			}
+
+			if (destPos == destSize)
+				goto done;
+
+			flags <<= 1;
+		}
+	}
+
+done:
+	*uncompressedSize = destSize;
+	return dest;
+
+fail:
+	FATAL_ERROR("Fatal error while decompressing LZ file.\n");
+}
+
+#define LZ_MIN_MATCH 3
+#define LZ_MAX_MATCH 18
+#define LZ_MAX_DISTANCE 0x1000
+#define LZ_HASH_BITS 13
+#define LZ_HASH_SIZE (1 << LZ_HASH_BITS)
+
+// Hash chains over every 3-byte prefix seen so far. Any match the encoder can
+// use is at least LZ_MIN_MATCH bytes long, so walking the chain for the current
+// position visits every usable candidate, nearest first.
+struct LZMatchFinder {
+	unsigned char *src;
+	int srcSize;
+	int minDistance;
+	int *head;
+	int *prev;
+	int numInserted;
+};
+
+static inline int LZHash(unsigned char *p)
+{
+	unsigned int value = (p[0] << 16) | (p[1] << 8) | p[2];
+
+	return (int)((value * 2654435761u) >> (32 - LZ_HASH_BITS));
+}
+
+static void InitMatchFinder(struct LZMatchFinder *mf, unsigned char *src, int srcSize, int minDistance)
+{
+	mf->src = src;
+	mf->srcSize = srcSize;
+	mf->minDistance = minDistance;
+	mf->head = malloc(LZ_HASH_SIZE * sizeof(int));
+	mf->prev = malloc(srcSize * sizeof(int));
+	mf->numInserted = 0;
+
+	if (mf->head == NULL || mf->prev == NULL)
+		FATAL_ERROR("Failed to allocate memory for LZ match finder.\n");
+
+	for (int i = 0; i < LZ_HASH_SIZE; i++)
+		mf->head[i] = -1;
+}
+
+static void FreeMatchFinder(struct LZMatchFinder *mf)
+{
+	free(mf->head);
+	free(mf->prev);
+}
+
+static inline int GetMatchLength(unsigned char *src, int srcSize, int srcPos, int blockStart)
+{
+	int blockSize = 0;
+
+	while (blockSize < LZ_MAX_MATCH
+	    && srcPos + blockSize < srcSize
+	    && src[blockStart + blockSize] == src[srcPos + blockSize])
+		blockSize++;
+
+	return blockSize;
+}
+
+// Returns the longest match at srcPos, preferring the nearest one on ties.
+// This is the same match the brute-force search below picks.
+static int FindMatchHashChain(struct LZMatchFinder *mf, int srcPos, int *bestBlockDistance)
+{
+	unsigned char *src = mf->src;
+	int bestBlockSize = 0;
+
+	*bestBlockDistance = 0;
+
+	// Bring the chains up to date with every position before srcPos.
+	while (mf->numInserted < srcPos) {
+		int pos = mf->numInserted++;
+
+		if (pos + LZ_MIN_MATCH <= mf->srcSize) {
+			int hash = LZHash(&src[pos]);
+			mf->prev[pos] = mf->head[hash];
+			mf->head[hash] = pos;
+		}
+	}
+
+	if (srcPos + LZ_MIN_MATCH > mf->srcSize)
+		return 0;
+
+	int blockStart = mf->head[LZHash(&src[srcPos])];
+
+	while (blockStart >= 0) {
+		int blockDistance = srcPos - blockStart;
+
+		if (blockDistance > LZ_MAX_DISTANCE)
+			break;
+
+		if (blockDistance >= mf->minDistance) {
+			int blockSize = GetMatchLength(src, mf->srcSize, srcPos, blockStart);
+
+			if (blockSize > bestBlockSize) {
+				*bestBlockDistance = blockDistance;
+				bestBlockSize = blockSize;
+
+				if (blockSize == LZ_MAX_MATCH)
+					break;
+			}
+		}
+
+		blockStart = mf->prev[blockStart];
+	}
+
+	return bestBlockSize;
+}
+
+// Reference search that tries every distance in the window.
+static int FindMatchBruteForce(struct LZMatchFinder *mf, int srcPos, int *bestBlockDistance)
+{
+	int bestBlockSize = 0;
+	int blockDistance = mf->minDistance;
+
+	*bestBlockDistance = 0;
+
+	while (blockDistance <= srcPos && blockDistance <= LZ_MAX_DISTANCE) {
+		int blockSize = GetMatchLength(mf->src, mf->srcSize, srcPos, srcPos - blockDistance);
+
+		if (blockSize > bestBlockSize) {
+			*bestBlockDistance = blockDistance;
+			bestBlockSize = blockSize;
+
+			if (blockSize == LZ_MAX_MATCH)
+				break;
+		}
+
+		blockDistance++;
+	}
+
+	return bestBlockSize;
+}
+
 unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+{
+	return LZCompressWithMatchFinder(src, srcSize, compressedSize, minDistance, LZ_MATCH_FINDER_HASH_CHAIN);
+}
+
+unsigned char *LZCompressWithMatchFinder(unsigned char *src, int srcSize, int *compressedSize, const int minDistance, enum LZMatchFinderType matchFinderType)
 {
 	if (srcSize <= 0)
 		goto fail;
@@ -90,6 +327,9 @@ unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize,
 	dest[2] = (unsigned char)(srcSize >> 8);
 	dest[3] = (unsigned char)(srcSize >> 16);
 
+	struct LZMatchFinder mf;
+	InitMatchFinder(&mf, src, srcSize, minDistance);
+
 	int srcPos = 0;
 	int destPos = 4;
 
@@ -98,37 +338,124 @@ unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize,
 		*flags = 0;
 
 		for (int i = 0; i < 8; i++) {
-			int bestBlockDistance = 0;
-			int bestBlockSize = 0;
-			int blockDistance = minDistance;
+			int bestBlockDistance;
+			int bestBlockSize;
 
-			while (blockDistance <= srcPos && blockDistance <= 0x1000) {
-				int blockStart = srcPos - blockDistance;
-				int blockSize = 0;
+			if (matchFinderType == LZ_MATCH_FINDER_BRUTE_FORCE)
+				bestBlockSize = FindMatchBruteForce(&mf, srcPos, &bestBlockDistance);
+			else
+				bestBlockSize = FindMatchHashChain(&mf, srcPos, &bestBlockDistance);
 
-				while (blockSize < 18
-				    && srcPos + blockSize < srcSize
-				    && src[blockStart + blockSize] == src[srcPos + blockSize])
-					blockSize++;
+			if (bestBlockSize >= LZ_MIN_MATCH) {
+				*flags |= (0x80 >> i);
+				srcPos += bestBlockSize;
+				bestBlockSize -= 3;
+				bestBlockDistance--;
+				dest[destPos++] = (bestBlockSize << 4) | ((unsigned int)bestBlockDistance >> 8);
+				dest[destPos++] = (unsigned char)bestBlockDistance;
+			} else {
+				dest[destPos++] = src[srcPos++];
+			}
 
-				if (blockSize > bestBlockSize) {
-					bestBlockDistance = blockDistance;
-					bestBlockSize = blockSize;
+			if (srcPos == srcSize) {
+				// Pad to multiple of 4 bytes.
+				int remainder = destPos % 4;
 
-					if (blockSize == 18)
-						break;
+				if (remainder != 0) {
+					for (int i = 0; i < 4 - remainder; i++)
+						dest[destPos++] = 0;
 				}
 
-				blockDistance++;
+				FreeMatchFinder(&mf);
+
+				*compressedSize = destPos;
+				return dest;
 			}
+		}
+	}
+
+fail:
+	FATAL_ERROR("Fatal error while compressing LZ file.\n");
+}
 
-			if (bestBlockSize >= 3) {
+// Bit cost of each token, counting its bit in the flags byte.
+#define LZ_LITERAL_COST 9
+#define LZ_BLOCK_COST 17
+
+// Chooses the sequence of literals and blocks with the smallest total size
+// instead of always taking the longest match. Every length from LZ_MIN_MATCH
+// up to the longest match at a position is available at the same distance,
+// so only the longest match per position needs to be found.
+unsigned char *LZCompressOptimal(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+{
+	if (srcSize <= 0)
+		goto fail;
+
+	int worstCaseDestSize = 4 + srcSize + ((srcSize + 7) / 8);
+
+	// Round up to the next multiple of four.
+	worstCaseDestSize = (worstCaseDestSize + 3) & ~3;
+
+	unsigned char *dest = malloc(worstCaseDestSize);
+	int *blockSizes = malloc(srcSize * sizeof(int));
+	int *blockDistances = malloc(srcSize * sizeof(int));
+	int *costs = malloc((srcSize + 1) * sizeof(int));
+
+	if (dest == NULL || blockSizes == NULL || blockDistances == NULL || costs == NULL)
+		goto fail;
+
+	struct LZMatchFinder mf;
+	InitMatchFinder(&mf, src, srcSize, minDistance);
+
+	for (int srcPos = 0; srcPos < srcSize; srcPos++)
+		blockSizes[srcPos] = FindMatchHashChain(&mf, srcPos, &blockDistances[srcPos]);
+
+	FreeMatchFinder(&mf);
+
+	// costs[i] is the smallest number of bits needed to encode src[i..].
+	// blockSizes[i] is overwritten with the token chosen at i (1 for a literal).
+	costs[srcSize] = 0;
+
+	for (int srcPos = srcSize - 1; srcPos >= 0; srcPos--) {
+		int bestCost = LZ_LITERAL_COST + costs[srcPos + 1];
+		int bestBlockSize = 1;
+
+		for (int blockSize = LZ_MIN_MATCH; blockSize <= blockSizes[srcPos]; blockSize++) {
+			int cost = LZ_BLOCK_COST + costs[srcPos + blockSize];
+
+			if (cost <= bestCost) {
+				bestCost = cost;
+				bestBlockSize = blockSize;
+			}
+		}
+
+		costs[srcPos] = bestCost;
+		blockSizes[srcPos] = bestBlockSize;
+	}
+
+	// header
+	dest[0] = 0x10; // LZ compression type
+	dest[1] = (unsigned char)srcSize;
+	dest[2] = (unsigned char)(srcSize >> 8);
+	dest[3] = (unsigned char)(srcSize >> 16);
+
+	int srcPos = 0;
+	int destPos = 4;
+
+	for (;;) {
+		unsigned char *flags = &dest[destPos++];
+		*flags = 0;
+
+		for (int i = 0; i < 8; i++) {
+			int blockSize = blockSizes[srcPos];
+
+			if (blockSize >= LZ_MIN_MATCH) {
+				int blockDistance = blockDistances[srcPos] - 1;
 				*flags |= (0x80 >> i);
-				srcPos += bestBlockSize;
-				bestBlockSize -= 3;
-				bestBlockDistance--;
-				dest[destPos++] = (bestBlockSize << 4) | ((unsigned int)bestBlockDistance >> 8);
-				dest[destPos++] = (unsigned char)bestBlockDistance;
+				srcPos += blockSize;
+				blockSize -= 3;
+				dest[destPos++] = (blockSize << 4) | ((unsigned int)blockDistance >> 8);
+				dest[destPos++] = (unsigned char)blockDistance;
 			} else {
 				dest[destPos++] = src[srcPos++];
 			}
@@ -142,6 +469,10 @@ unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize,
 						dest[destPos++] = 0;
 				}
 
+				free(blockSizes);
+				free(blockDistances);
+				free(costs);
+
 				*compressedSize = destPos;
 				return dest;
 			}
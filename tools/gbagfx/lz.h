@@ -3,7 +3,15 @@
 #ifndef LZ_H
 #define LZ_H
 
+enum LZMatchFinderType {
+    LZ_MATCH_FINDER_HASH_CHAIN,
+    LZ_MATCH_FINDER_BRUTE_FORCE,
+};
+
 unsigned char *LZDecompress(unsigned char *src, int srcSize, int *uncompressedSize);
+unsigned char *LZDecompressReference(unsigned char *src, int srcSize, int *uncompressedSize);
 unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance);
+unsigned char *LZCompressWithMatchFinder(unsigned char *src, int srcSize, int *compressedSize, const int minDistance, enum LZMatchFinderType matchFinderType);
+unsigned char *LZCompressOptimal(unsigned char *src, int srcSize, int *compressedSize, const int minDistance);
 
 #endif // LZ_H
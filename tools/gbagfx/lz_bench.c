@@ -0,0 +1,67 @@
+// Benchmarks the LZ match finders against each other.
+// Reads input paths, one per line, from stdin.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "global.h"
+#include "util.h"
+#include "bench_util.h"
+#include "lz.h"
+
+static double RunMatchFinder(struct BenchFile *files, int numFiles, enum LZMatchFinderType matchFinderType, unsigned char **outputs, int *outputSizes)
+{
+    clock_t start = clock();
+
+    for (int i = 0; i < numFiles; i++)
+        outputs[i] = LZCompressWithMatchFinder(files[i].data, files[i].size, &outputSizes[i], 2, matchFinderType);
+
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(void)
+{
+    int numFiles;
+    long totalSize;
+    struct BenchFile *files = LoadBenchFiles("graphics", &numFiles, &totalSize);
+
+    unsigned char **hashOutputs = malloc(numFiles * sizeof(*hashOutputs));
+    unsigned char **bruteOutputs = malloc(numFiles * sizeof(*bruteOutputs));
+    int *hashSizes = malloc(numFiles * sizeof(*hashSizes));
+    int *bruteSizes = malloc(numFiles * sizeof(*bruteSizes));
+
+    if (hashOutputs == NULL || bruteOutputs == NULL || hashSizes == NULL || bruteSizes == NULL)
+        FATAL_ERROR("Failed to allocate memory for outputs.\n");
+
+    double bruteTime = RunMatchFinder(files, numFiles, LZ_MATCH_FINDER_BRUTE_FORCE, bruteOutputs, bruteSizes);
+    double hashTime = RunMatchFinder(files, numFiles, LZ_MATCH_FINDER_HASH_CHAIN, hashOutputs, hashSizes);
+
+    int mismatches = 0;
+
+    for (int i = 0; i < numFiles; i++)
+    {
+        if (hashSizes[i] != bruteSizes[i] || memcmp(hashOutputs[i], bruteOutputs[i], hashSizes[i]) != 0)
+        {
+            fprintf(stderr, "Output mismatch for \"%s\".\n", files[i].path);
+            mismatches++;
+        }
+
+        free(hashOutputs[i]);
+        free(bruteOutputs[i]);
+    }
+
+    double megabytes = totalSize / (1024.0 * 1024.0);
+
+    printf("%d files, %.2f MB\n", numFiles, megabytes);
+    printf("brute force: %8.3f s %8.2f MB/s\n", bruteTime, megabytes / bruteTime);
+    printf("hash chain:  %8.3f s %8.2f MB/s\n", hashTime, megabytes / hashTime);
+
+    free(hashOutputs);
+    free(bruteOutputs);
+    free(hashSizes);
+    free(bruteSizes);
+    FreeBenchFiles(files, numFiles);
+
+    return mismatches != 0;
+}
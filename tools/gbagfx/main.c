@@ -13,6 +13,14 @@
 #include "rl.h"
 #include "font.h"
 #include "huff.h"
+#include "batch.h"
+#include "cache.h"
+
+// Part of every compressed output's cache key. Bump an encoder's version when a
+// change to it alters its output, so entries from the old encoder aren't used.
+#define LZ_CACHE_VERSION 1
+#define RL_CACHE_VERSION 1
+#define HUFF_CACHE_VERSION 2 // 1 could leave the last word misaligned
 
 struct CommandHandler
 {
@@ -34,11 +42,11 @@ void ConvertGbaToPng(char *inputPath, char *outputPath, struct GbaToPngOptions *
 
         if (strcmp(paletteFileExtension, "gbapal") == 0)
         {
-            ReadGbaPalette(options->paletteFilePath, &image.palette);
+            ReadCachedPalette(options->paletteFilePath, &image.palette, ReadGbaPalette);
         }
         else
         {
-            ReadJascPalette(options->paletteFilePath, &image.palette);
+            ReadCachedPalette(options->paletteFilePath, &image.palette, ReadJascPalette);
         }
 
         image.hasPalette = true;
@@ -83,7 +91,9 @@ void ConvertPngToGba(char *inputPath, char *outputPath, struct PngToGbaOptions *
 
     ReadPng(inputPath, &image);
 
-    if (options->isTiled)
+    if (options->isTiled && options->tilemapFilePath != NULL)
+        WriteTileImageWithTilemap(outputPath, options->tilemapFilePath, options->isAffineMap, options->metatileWidth, options->metatileHeight, &image, !image.hasPalette);
+    else if (options->isTiled)
         WriteTileImage(outputPath, options->numTilesMode, options->numTiles, options->metatileWidth, options->metatileHeight, &image, !image.hasPalette);
     else
         WritePlainImage(outputPath, options->dataWidth, &image, !image.hasPalette);
@@ -264,6 +274,17 @@ void HandlePngToGbaCommand(char *inputPath, char *outputPath, int argc, char **a
             if (options.metatileHeight < 1)
                 FATAL_ERROR("metatile height must be positive.\n");
         }
+        else if (strcmp(option, "-tilemap") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No tilemap value following \"-tilemap\".\n");
+            i++;
+            options.tilemapFilePath = argv[i];
+        }
+        else if (strcmp(option, "-affine") == 0)
+        {
+            options.isAffineMap = true;
+        }
         else if (strcmp(option, "-plain") == 0)
         {
             options.isTiled = false;
@@ -286,6 +307,9 @@ void HandlePngToGbaCommand(char *inputPath, char *outputPath, int argc, char **a
         }
     }
 
+    if (options.tilemapFilePath != NULL && options.numTiles != 0)
+        FATAL_ERROR("\"-num_tiles\" can't be used with \"-tilemap\".\n");
+
     ConvertPngToGba(inputPath, outputPath, &options);
 }
 
@@ -293,7 +317,7 @@ void HandlePngToJascPaletteCommand(char *inputPath, char *outputPath, int argc U
 {
     struct Palette palette = {};
 
-    ReadPngPalette(inputPath, &palette);
+    ReadCachedPalette(inputPath, &palette, ReadPngPalette);
     WriteJascPalette(outputPath, &palette);
 }
 
@@ -301,7 +325,7 @@ void HandlePngToGbaPaletteCommand(char *inputPath, char *outputPath, int argc UN
 {
     struct Palette palette = {};
 
-    ReadPngPalette(inputPath, &palette);
+    ReadCachedPalette(inputPath, &palette, ReadPngPalette);
     WriteGbaPalette(outputPath, &palette);
 }
 
@@ -426,6 +450,7 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
 {
     int overflowSize = 0;
     int minDistance = 2; // default, for compatibility with LZ77UnCompVram()
+    bool optimal = false;
 
     for (int i = 3; i < argc; i++)
     {
@@ -457,6 +482,10 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
             if (minDistance < 1)
                 FATAL_ERROR("LZ min search distance must be positive.\n");
         }
+        else if (strcmp(option, "-optimal") == 0)
+        {
+            optimal = true;
+        }
         else
         {
             FATAL_ERROR("Unrecognized option \"%s\".\n", option);
@@ -473,12 +502,38 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
     unsigned char *buffer = ReadWholeFileZeroPadded(inputPath, &fileSize, overflowSize);
 
     int compressedSize;
-    unsigned char *compressedData = LZCompress(buffer, fileSize + overflowSize, &compressedSize, minDistance);
+    char cacheOptions[64];
+    sprintf(cacheOptions, "lz%d -overflow %d -search %d%s", LZ_CACHE_VERSION, overflowSize, minDistance, optimal ? " -optimal" : "");
+    unsigned char *compressedData = CacheLookup(buffer, fileSize + overflowSize, cacheOptions, &compressedSize);
+    bool cached = (compressedData != NULL);
+
+    if (cached)
+    {
+        if (optimal)
+            printf("%s: %d bytes, optimal %d bytes (cached)\n", outputPath, fileSize, compressedSize);
+    }
+    else if (optimal)
+    {
+        // The optimal parse picks the smallest encoding rather than the one
+        // the original data was built with, so report what it saved.
+        int greedySize;
+        free(LZCompress(buffer, fileSize + overflowSize, &greedySize, minDistance));
+        compressedData = LZCompressOptimal(buffer, fileSize + overflowSize, &compressedSize, minDistance);
+        printf("%s: %d bytes, greedy %d bytes, optimal %d bytes (%d saved)\n",
+            outputPath, fileSize, greedySize, compressedSize, greedySize - compressedSize);
+    }
+    else
+    {
+        compressedData = LZCompress(buffer, fileSize + overflowSize, &compressedSize, minDistance);
+    }
 
     compressedData[1] = (unsigned char)fileSize;
     compressedData[2] = (unsigned char)(fileSize >> 8);
     compressedData[3] = (unsigned char)(fileSize >> 16);
 
+    if (!cached)
+        CacheStore(buffer, fileSize + overflowSize, cacheOptions, compressedData, compressedSize);
+
     free(buffer);
 
     WriteWholeFile(outputPath, compressedData, compressedSize);
@@ -507,7 +562,15 @@ void HandleRLCompressCommand(char *inputPath, char *outputPath, int argc UNUSED,
     unsigned char *buffer = ReadWholeFile(inputPath, &fileSize);
 
     int compressedSize;
-    unsigned char *compressedData = RLCompress(buffer, fileSize, &compressedSize);
+    char cacheOptions[16];
+    sprintf(cacheOptions, "rl%d", RL_CACHE_VERSION);
+    unsigned char *compressedData = CacheLookup(buffer, fileSize, cacheOptions, &compressedSize);
+
+    if (compressedData == NULL)
+    {
+        compressedData = RLCompress(buffer, fileSize, &compressedSize);
+        CacheStore(buffer, fileSize, cacheOptions, compressedData, compressedSize);
+    }
 
     free(buffer);
 
@@ -562,7 +625,15 @@ void HandleHuffCompressCommand(char *inputPath, char *outputPath, int argc, char
     unsigned char *buffer = ReadWholeFile(inputPath, &fileSize);
 
     int compressedSize;
-    unsigned char *compressedData = HuffCompress(buffer, fileSize, &compressedSize, bitDepth);
+    char cacheOptions[32];
+    sprintf(cacheOptions, "huff%d -depth %d", HUFF_CACHE_VERSION, bitDepth);
+    unsigned char *compressedData = CacheLookup(buffer, fileSize, cacheOptions, &compressedSize);
+
+    if (compressedData == NULL)
+    {
+        compressedData = HuffCompress(buffer, fileSize, &compressedSize, bitDepth);
+        CacheStore(buffer, fileSize, cacheOptions, compressedData, compressedSize);
+    }
 
     free(buffer);
 
@@ -586,13 +657,10 @@ void HandleHuffDecompressCommand(char *inputPath, char *outputPath, int argc UNU
     free(uncompressedData);
 }
 
-int main(int argc, char **argv)
+void RunCommand(int argc, char **argv)
 {
     char converted = 0;
 
-    if (argc < 3)
-        FATAL_ERROR("Usage: gbagfx INPUT_PATH OUTPUT_PATH [options...]\n");
-
     struct CommandHandler handlers[] =
     {
         { "1bpp", "png", HandleGbaToPngCommand },
@@ -672,6 +740,78 @@ int main(int argc, char **argv)
 
     if (!converted)
         FATAL_ERROR("Don't know how to convert \"%s\" to \"%s\".\n", argv[1], argv[2]);
+}
+
+void HandleBatchCommand(int argc, char **argv)
+{
+    int numThreads = 0;
+
+    for (int i = 3; i < argc; i++)
+    {
+        char *option = argv[i];
+
+        if (strcmp(option, "-j") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No number of threads following \"-j\".\n");
+
+            i++;
+
+            if (!ParseNumber(argv[i], NULL, 10, &numThreads))
+                FATAL_ERROR("Failed to parse number of threads.\n");
+
+            if (numThreads < 1)
+                FATAL_ERROR("Number of threads must be positive.\n");
+        }
+        else
+        {
+            FATAL_ERROR("Unrecognized option \"%s\".\n", option);
+        }
+    }
+
+    RunBatch(argv[2], numThreads, RunCommand);
+}
+
+void HandleCacheCommand(int argc, char **argv)
+{
+    bool clear = false;
+
+    for (int i = 3; i < argc; i++)
+    {
+        char *option = argv[i];
+
+        if (strcmp(option, "-clear") == 0)
+        {
+            clear = true;
+        }
+        else
+        {
+            FATAL_ERROR("Unrecognized option \"%s\".\n", option);
+        }
+    }
+
+    if (clear)
+        ClearCache(argv[2]);
+    else
+        PrintCacheStats(argv[2]);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+        FATAL_ERROR("Usage: gbagfx INPUT_PATH OUTPUT_PATH [options...]\n"
+                    "       gbagfx batch MANIFEST_PATH [-j THREADS]\n"
+                    "       gbagfx cache CACHE_DIR [-clear]\n");
+
+    if (strcmp(argv[1], "batch") == 0)
+        HandleBatchCommand(argc, argv);
+    else if (strcmp(argv[1], "cache") == 0)
+        HandleCacheCommand(argc, argv);
+    else
+        RunCommand(argc, argv);
+
+    FlushCacheStats();
+    ReportPeakMemory();
 
     return 0;
 }
@@ -2,10 +2,11 @@
 
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include "global.h"
 #include "rl.h"
 
-unsigned char *RLDecompress(unsigned char *src, int srcSize, int *uncompressedSize)
+unsigned char *RLDecompressReference(unsigned char *src, int srcSize, int *uncompressedSize)
 {
     if (srcSize < 4)
         goto fail;
@@ -31,6 +32,10 @@ unsigned char *RLDecompress(unsigned char *src, int srcSize, int *uncompressedSi
         if (compressed)
         {
             int length = (flags & 0x7F) + 3;
+
+            if (srcPos >= srcSize)
+                goto fail;
+
             unsigned char data = src[srcPos++];
 
             if (destPos + length > destSize)
@@ -43,7 +48,7 @@ unsigned char *RLDecompress(unsigned char *src, int srcSize, int *uncompressedSi
         {
             int length = (flags & 0x7F) + 1;
 
-            if (destPos + length > destSize)
+            if (destPos + length > destSize || srcPos + length > srcSize)
                 goto fail;
 
             for (int i = 0; i < length; i++)
@@ -61,6 +66,69 @@ fail:
     FATAL_ERROR("Fatal error while decompressing RL file.\n");
 }
 
+// Same results as RLDecompressReference, with each run written by one
+// memset or memcpy.
+unsigned char *RLDecompress(unsigned char *src, int srcSize, int *uncompressedSize)
+{
+    if (srcSize < 4)
+        goto fail;
+
+    int destSize = (src[3] << 16) | (src[2] << 8) | src[1];
+
+    unsigned char *dest = malloc(destSize);
+
+    if (dest == NULL)
+        goto fail;
+
+    int srcPos = 4;
+    int destPos = 0;
+
+    for (;;)
+    {
+        if (srcPos >= srcSize)
+            goto fail;
+
+        unsigned char flags = src[srcPos++];
+        bool compressed = ((flags & 0x80) != 0);
+
+        if (compressed)
+        {
+            int length = (flags & 0x7F) + 3;
+
+            if (srcPos >= srcSize)
+                goto fail;
+
+            unsigned char data = src[srcPos++];
+
+            if (destPos + length > destSize)
+                goto fail;
+
+            memset(dest + destPos, data, length);
+            destPos += length;
+        }
+        else
+        {
+            int length = (flags & 0x7F) + 1;
+
+            if (destPos + length > destSize || srcPos + length > srcSize)
+                goto fail;
+
+            memcpy(dest + destPos, src + srcPos, length);
+            destPos += length;
+            srcPos += length;
+        }
+
+        if (destPos == destSize)
+        {
+            *uncompressedSize = destSize;
+            return dest;
+        }
+    }
+
+fail:
+    FATAL_ERROR("Fatal error while decompressing RL file.\n");
+}
+
 unsigned char *RLCompress(unsigned char *src, int srcSize, int *compressedSize)
 {
     if (srcSize <= 0)
@@ -4,6 +4,7 @@
 #define RL_H
 
 unsigned char *RLDecompress(unsigned char *src, int srcSize, int *uncompressedSize);
+unsigned char *RLDecompressReference(unsigned char *src, int srcSize, int *uncompressedSize);
 unsigned char *RLCompress(unsigned char *src, int srcSize, int *compressedSize);
 
 #endif // RL_H
@@ -0,0 +1,110 @@
+// Benchmarks the tile conversion kernels against each other on whole images.
+// Usage: tile_bench PNG_PATH...
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "global.h"
+#include "gfx.h"
+#include "convert_png.h"
+#include "tile_kernels.h"
+
+#define ITERATIONS 200
+
+static const char *const sKernelNames[] = { "scalar", "sse2", "avx2" };
+
+static double BenchKernels(const struct TileKernels *kernels, struct Image *image, unsigned char *tiles, unsigned char *pixels)
+{
+    int tileBytes = image->bitDepth * 8;
+    int rowBytes = image->bitDepth;
+    int pitch = image->width * image->bitDepth / 8;
+    int tilesWide = image->width / 8;
+    int numTiles = tilesWide * (image->height / 8);
+    TilePackFunc pack = image->bitDepth == 4 ? kernels->pack4Bpp : kernels->pack8Bpp;
+    TileUnpackFunc unpack = image->bitDepth == 4 ? kernels->unpack4Bpp : kernels->unpack8Bpp;
+
+    clock_t start = clock();
+
+    for (int iteration = 0; iteration < ITERATIONS; iteration++)
+    {
+        for (int i = 0; i < numTiles; i++)
+        {
+            int offset = (i / tilesWide) * 8 * pitch + (i % tilesWide) * rowBytes;
+            pack(&image->pixels[offset], pitch, &tiles[i * tileBytes], false);
+        }
+
+        for (int i = 0; i < numTiles; i++)
+        {
+            int offset = (i / tilesWide) * 8 * pitch + (i % tilesWide) * rowBytes;
+            unpack(&tiles[i * tileBytes], &pixels[offset], pitch, false);
+        }
+    }
+
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void BenchImage(char *path, int bitDepth)
+{
+    struct Image image;
+
+    image.bitDepth = bitDepth;
+    image.tilemap.data.affine = NULL;
+    ReadPng(path, &image);
+
+    if (image.width % 8 != 0 || image.height % 8 != 0)
+    {
+        FreeImage(&image);
+        return;
+    }
+
+    int size = image.width * image.height * bitDepth / 8;
+    unsigned char *tiles = malloc(size);
+    unsigned char *pixels = malloc(size);
+    unsigned char *reference = malloc(size);
+    double megapixels = (double)image.width * image.height * ITERATIONS / 1e6;
+
+    if (tiles == NULL || pixels == NULL || reference == NULL)
+        FATAL_ERROR("Failed to allocate memory for benchmark.\n");
+
+    printf("%s (%dx%d, %dbpp)\n", path, image.width, image.height, bitDepth);
+
+    for (int i = 0; i < (int)(sizeof(sKernelNames) / sizeof(sKernelNames[0])); i++)
+    {
+        const struct TileKernels *kernels = GetTileKernelsByName(sKernelNames[i]);
+
+        if (kernels == NULL)
+            continue;
+
+        double seconds = BenchKernels(kernels, &image, tiles, pixels);
+
+        if (i == 0)
+            memcpy(reference, tiles, size);
+        else if (memcmp(reference, tiles, size) != 0)
+            FATAL_ERROR("%s output differs from scalar output.\n", kernels->name);
+
+        if (memcmp(pixels, image.pixels, size) != 0)
+            FATAL_ERROR("%s did not round-trip.\n", kernels->name);
+
+        printf("  %-6s %8.1f Mpixel/s\n", kernels->name, megapixels / seconds);
+    }
+
+    free(tiles);
+    free(pixels);
+    free(reference);
+    FreeImage(&image);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+        FATAL_ERROR("Usage: tile_bench PNG_PATH...\n");
+
+    for (int i = 1; i < argc; i++)
+    {
+        BenchImage(argv[i], 4);
+        BenchImage(argv[i], 8);
+    }
+
+    return 0;
+}
@@ -0,0 +1,254 @@
+// Per-tile 4bpp/8bpp conversion kernels.
+//
+// A 4bpp PNG row stores the left pixel of each pair in the high nibble and the
+// GBA stores it in the low nibble, so converting in either direction is a
+// nibble swap of every byte. 8bpp is a straight copy. Inverting colors is an
+// XOR with all ones in both cases.
+//
+// On x86 the SSE2 and AVX2 versions handle a whole tile in registers and are
+// picked at runtime; GBAGFX_TILE_KERNELS=scalar|sse2|avx2 overrides the choice.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "global.h"
+#include "tile_kernels.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define HAVE_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+static inline unsigned char SwapNibbles(unsigned char x)
+{
+	return (unsigned char)((x << 4) | (x >> 4));
+}
+
+static void Pack4BppScalar(const unsigned char *image, int pitch, unsigned char *tile, bool invertColors)
+{
+	unsigned char mask = invertColors ? 0xFF : 0;
+
+	for (int j = 0; j < 8; j++, image += pitch)
+		for (int k = 0; k < 4; k++)
+			*tile++ = SwapNibbles(image[k]) ^ mask;
+}
+
+static void Unpack4BppScalar(const unsigned char *tile, unsigned char *image, int pitch, bool invertColors)
+{
+	unsigned char mask = invertColors ? 0xFF : 0;
+
+	for (int j = 0; j < 8; j++, image += pitch)
+		for (int k = 0; k < 4; k++)
+			image[k] = SwapNibbles(*tile++) ^ mask;
+}
+
+static void Pack8BppScalar(const unsigned char *image, int pitch, unsigned char *tile, bool invertColors)
+{
+	unsigned char mask = invertColors ? 0xFF : 0;
+
+	for (int j = 0; j < 8; j++, image += pitch)
+		for (int k = 0; k < 8; k++)
+			*tile++ = image[k] ^ mask;
+}
+
+static void Unpack8BppScalar(const unsigned char *tile, unsigned char *image, int pitch, bool invertColors)
+{
+	unsigned char mask = invertColors ? 0xFF : 0;
+
+	for (int j = 0; j < 8; j++, image += pitch)
+		for (int k = 0; k < 8; k++)
+			image[k] = *tile++ ^ mask;
+}
+
+#ifdef HAVE_X86_KERNELS
+
+static inline uint32_t LoadRow32(const unsigned char *p)
+{
+	uint32_t value;
+	memcpy(&value, p, 4);
+	return value;
+}
+
+static inline void StoreRow32(unsigned char *p, uint32_t value)
+{
+	memcpy(p, &value, 4);
+}
+
+__attribute__((target("sse2")))
+static inline __m128i SwapNibblesSse2(__m128i x)
+{
+	const __m128i lowNibbles = _mm_set1_epi8(0x0F);
+	__m128i high = _mm_and_si128(_mm_slli_epi16(x, 4), _mm_set1_epi8((char)0xF0));
+	__m128i low = _mm_and_si128(_mm_srli_epi16(x, 4), lowNibbles);
+	return _mm_or_si128(high, low);
+}
+
+__attribute__((target("sse2")))
+static void Pack4BppSse2(const unsigned char *image, int pitch, unsigned char *tile, bool invertColors)
+{
+	__m128i mask = _mm_set1_epi8(invertColors ? (char)0xFF : 0);
+
+	for (int half = 0; half < 2; half++, image += pitch * 4, tile += 16) {
+		__m128i rows = _mm_setr_epi32(LoadRow32(image), LoadRow32(image + pitch),
+		                              LoadRow32(image + pitch * 2), LoadRow32(image + pitch * 3));
+		_mm_storeu_si128((__m128i *)tile, _mm_xor_si128(SwapNibblesSse2(rows), mask));
+	}
+}
+
+__attribute__((target("sse2")))
+static void Unpack4BppSse2(const unsigned char *tile, unsigned char *image, int pitch, bool invertColors)
+{
+	__m128i mask = _mm_set1_epi8(invertColors ? (char)0xFF : 0);
+
+	for (int half = 0; half < 2; half++, image += pitch * 4, tile += 16) {
+		__m128i rows = _mm_xor_si128(SwapNibblesSse2(_mm_loadu_si128((const __m128i *)tile)), mask);
+
+		for (int j = 0; j < 4; j++) {
+			StoreRow32(image + pitch * j, (uint32_t)_mm_cvtsi128_si32(rows));
+			rows = _mm_srli_si128(rows, 4);
+		}
+	}
+}
+
+__attribute__((target("sse2")))
+static void Pack8BppSse2(const unsigned char *image, int pitch, unsigned char *tile, bool invertColors)
+{
+	__m128i mask = _mm_set1_epi8(invertColors ? (char)0xFF : 0);
+
+	for (int j = 0; j < 8; j += 2, image += pitch * 2, tile += 16) {
+		__m128i rows = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)image),
+		                                  _mm_loadl_epi64((const __m128i *)(image + pitch)));
+		_mm_storeu_si128((__m128i *)tile, _mm_xor_si128(rows, mask));
+	}
+}
+
+__attribute__((target("sse2")))
+static void Unpack8BppSse2(const unsigned char *tile, unsigned char *image, int pitch, bool invertColors)
+{
+	__m128i mask = _mm_set1_epi8(invertColors ? (char)0xFF : 0);
+
+	for (int j = 0; j < 8; j += 2, image += pitch * 2, tile += 16) {
+		__m128i rows = _mm_xor_si128(_mm_loadu_si128((const __m128i *)tile), mask);
+		_mm_storel_epi64((__m128i *)image, rows);
+		_mm_storel_epi64((__m128i *)(image + pitch), _mm_unpackhi_epi64(rows, rows));
+	}
+}
+
+__attribute__((target("avx2")))
+static inline __m256i SwapNibblesAvx2(__m256i x)
+{
+	__m256i high = _mm256_and_si256(_mm256_slli_epi16(x, 4), _mm256_set1_epi8((char)0xF0));
+	__m256i low = _mm256_and_si256(_mm256_srli_epi16(x, 4), _mm256_set1_epi8(0x0F));
+	return _mm256_or_si256(high, low);
+}
+
+// The eight 4-byte rows of a 4bpp tile fill one register, so packing is a
+// single gather.
+__attribute__((target("avx2")))
+static void Pack4BppAvx2(const unsigned char *image, int pitch, unsigned char *tile, bool invertColors)
+{
+	__m256i offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(pitch));
+	__m256i rows = _mm256_i32gather_epi32((const int *)image, offsets, 1);
+	__m256i mask = _mm256_set1_epi8(invertColors ? (char)0xFF : 0);
+	_mm256_storeu_si256((__m256i *)tile, _mm256_xor_si256(SwapNibblesAvx2(rows), mask));
+}
+
+// AVX2 has no scatter, so the rows are written out from the two 128-bit halves.
+__attribute__((target("avx2")))
+static void Unpack4BppAvx2(const unsigned char *tile, unsigned char *image, int pitch, bool invertColors)
+{
+	__m256i mask = _mm256_set1_epi8(invertColors ? (char)0xFF : 0);
+	__m256i rows = _mm256_xor_si256(SwapNibblesAvx2(_mm256_loadu_si256((const __m256i *)tile)), mask);
+	__m128i lo = _mm256_castsi256_si128(rows);
+	__m128i hi = _mm256_extracti128_si256(rows, 1);
+
+	for (int j = 0; j < 4; j++) {
+		StoreRow32(image + pitch * j, (uint32_t)_mm_extract_epi32(lo, 0));
+		StoreRow32(image + pitch * (j + 4), (uint32_t)_mm_extract_epi32(hi, 0));
+		lo = _mm_srli_si128(lo, 4);
+		hi = _mm_srli_si128(hi, 4);
+	}
+}
+
+__attribute__((target("avx2")))
+static void Pack8BppAvx2(const unsigned char *image, int pitch, unsigned char *tile, bool invertColors)
+{
+	__m256i offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 0, 0, 0, 0), _mm256_set1_epi32(pitch));
+	__m128i rowOffsets = _mm256_castsi256_si128(offsets);
+	__m256i mask = _mm256_set1_epi8(invertColors ? (char)0xFF : 0);
+
+	for (int half = 0; half < 2; half++, image += pitch * 4, tile += 32) {
+		__m256i rows = _mm256_i32gather_epi64((const long long *)image, rowOffsets, 1);
+		_mm256_storeu_si256((__m256i *)tile, _mm256_xor_si256(rows, mask));
+	}
+}
+
+__attribute__((target("avx2")))
+static void Unpack8BppAvx2(const unsigned char *tile, unsigned char *image, int pitch, bool invertColors)
+{
+	__m256i mask = _mm256_set1_epi8(invertColors ? (char)0xFF : 0);
+
+	for (int half = 0; half < 2; half++, image += pitch * 4, tile += 32) {
+		__m256i rows = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)tile), mask);
+		__m128i lo = _mm256_castsi256_si128(rows);
+		__m128i hi = _mm256_extracti128_si256(rows, 1);
+		_mm_storel_epi64((__m128i *)image, lo);
+		_mm_storel_epi64((__m128i *)(image + pitch), _mm_unpackhi_epi64(lo, lo));
+		_mm_storel_epi64((__m128i *)(image + pitch * 2), hi);
+		_mm_storel_epi64((__m128i *)(image + pitch * 3), _mm_unpackhi_epi64(hi, hi));
+	}
+}
+
+#endif // HAVE_X86_KERNELS
+
+static const struct TileKernels sTileKernels[] = {
+#ifdef HAVE_X86_KERNELS
+	{ "avx2", Pack4BppAvx2, Unpack4BppAvx2, Pack8BppAvx2, Unpack8BppAvx2 },
+	{ "sse2", Pack4BppSse2, Unpack4BppSse2, Pack8BppSse2, Unpack8BppSse2 },
+#endif
+	{ "scalar", Pack4BppScalar, Unpack4BppScalar, Pack8BppScalar, Unpack8BppScalar },
+	{ NULL },
+};
+
+static bool IsSupported(const struct TileKernels *kernels)
+{
+#ifdef HAVE_X86_KERNELS
+	if (strcmp(kernels->name, "avx2") == 0)
+		return __builtin_cpu_supports("avx2");
+	if (strcmp(kernels->name, "sse2") == 0)
+		return __builtin_cpu_supports("sse2");
+#endif
+	return true;
+}
+
+// Returns NULL if the kernels don't exist or the CPU can't run them.
+const struct TileKernels *GetTileKernelsByName(const char *name)
+{
+	for (int i = 0; sTileKernels[i].name != NULL; i++)
+		if (strcmp(sTileKernels[i].name, name) == 0)
+			return IsSupported(&sTileKernels[i]) ? &sTileKernels[i] : NULL;
+
+	return NULL;
+}
+
+const struct TileKernels *GetTileKernels(void)
+{
+	char *name = getenv("GBAGFX_TILE_KERNELS");
+
+	if (name != NULL && *name != 0) {
+		const struct TileKernels *kernels = GetTileKernelsByName(name);
+
+		if (kernels == NULL)
+			FATAL_ERROR("Tile kernels \"%s\" are not available.\n", name);
+
+		return kernels;
+	}
+
+	// The table is ordered fastest first.
+	for (int i = 0; sTileKernels[i].name != NULL; i++)
+		if (IsSupported(&sTileKernels[i]))
+			return &sTileKernels[i];
+
+	return NULL;
+}
@@ -0,0 +1,22 @@
+#ifndef TILE_KERNELS_H
+#define TILE_KERNELS_H
+
+#include <stdbool.h>
+
+// Converts one 8x8 tile between a row-major image (pitch bytes per row) and
+// the GBA's packed tile format. Tile data is 32 bytes at 4bpp and 64 at 8bpp.
+typedef void (*TilePackFunc)(const unsigned char *image, int pitch, unsigned char *tile, bool invertColors);
+typedef void (*TileUnpackFunc)(const unsigned char *tile, unsigned char *image, int pitch, bool invertColors);
+
+struct TileKernels {
+	const char *name;
+	TilePackFunc pack4Bpp;
+	TileUnpackFunc unpack4Bpp;
+	TilePackFunc pack8Bpp;
+	TileUnpackFunc unpack8Bpp;
+};
+
+const struct TileKernels *GetTileKernels(void);
+const struct TileKernels *GetTileKernelsByName(const char *name);
+
+#endif // TILE_KERNELS_H
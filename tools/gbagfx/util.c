@@ -1,5 +1,7 @@
 // Copyright (c) 2015 YamaArashi
 
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -9,6 +11,10 @@
 #include "global.h"
 #include "util.h"
 
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
 bool ParseNumber(char *s, char **end, int radix, int *intValue)
 {
 	char *localEnd;
@@ -129,3 +135,17 @@ void WriteWholeFile(char *path, void *buffer, int bufferSize)
 
 	fclose(fp);
 }
+
+// Prints the process's peak resident set size if GBAGFX_REPORT_MEMORY is set.
+void ReportPeakMemory(void)
+{
+	if (getenv("GBAGFX_REPORT_MEMORY") == NULL)
+		return;
+
+#ifndef _WIN32
+	struct rusage usage;
+
+	if (getrusage(RUSAGE_SELF, &usage) == 0)
+		fprintf(stderr, "peak RSS: %ld KiB\n", (long)usage.ru_maxrss);
+#endif
+}
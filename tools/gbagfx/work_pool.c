@@ -0,0 +1,212 @@
+// Work-stealing thread pool.
+//
+// Every worker owns a deque of item indices. A worker takes its newest item
+// first, so work it submits itself (such as the next stage of the image it just
+// converted) runs while that image's data is still in cache. A worker that runs
+// out of items steals the oldest item from another worker's deque. The pool
+// returns once numItems items have been run; every item must be submitted
+// exactly once, either up front or by SubmitWork from a running item.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "global.h"
+#include "work_pool.h"
+
+struct WorkDeque {
+    int *items;
+    int top;
+    int bottom;
+    pthread_mutex_t mutex;
+};
+
+struct WorkPool {
+    struct WorkDeque *deques;
+    int numThreads;
+    int numItems;
+    atomic_int numQueued;
+    atomic_int numFinished;
+    WorkFunc func;
+    void *context;
+    pthread_mutex_t idleMutex;
+    pthread_cond_t idleCond;
+};
+
+struct WorkerArgs {
+    struct WorkPool *pool;
+    int worker;
+};
+
+static void WakeIdleWorkers(struct WorkPool *pool)
+{
+    pthread_mutex_lock(&pool->idleMutex);
+    pthread_cond_broadcast(&pool->idleCond);
+    pthread_mutex_unlock(&pool->idleMutex);
+}
+
+static void PushBottom(struct WorkDeque *deque, int item)
+{
+    pthread_mutex_lock(&deque->mutex);
+    deque->items[deque->bottom++] = item;
+    pthread_mutex_unlock(&deque->mutex);
+}
+
+static int PopBottom(struct WorkDeque *deque)
+{
+    int item = -1;
+
+    pthread_mutex_lock(&deque->mutex);
+
+    if (deque->bottom > deque->top)
+        item = deque->items[--deque->bottom];
+
+    pthread_mutex_unlock(&deque->mutex);
+
+    return item;
+}
+
+static int StealTop(struct WorkDeque *deque)
+{
+    int item = -1;
+
+    pthread_mutex_lock(&deque->mutex);
+
+    if (deque->bottom > deque->top)
+        item = deque->items[deque->top++];
+
+    // Reuse the space once the deque drains.
+    if (deque->bottom == deque->top)
+        deque->bottom = deque->top = 0;
+
+    pthread_mutex_unlock(&deque->mutex);
+
+    return item;
+}
+
+void SubmitWork(struct WorkPool *pool, int worker, int item)
+{
+    PushBottom(&pool->deques[worker], item);
+    atomic_fetch_add(&pool->numQueued, 1);
+    WakeIdleWorkers(pool);
+}
+
+static int TakeWork(struct WorkPool *pool, int worker)
+{
+    int item = PopBottom(&pool->deques[worker]);
+
+    for (int i = 1; item < 0 && i < pool->numThreads; i++)
+        item = StealTop(&pool->deques[(worker + i) % pool->numThreads]);
+
+    if (item >= 0)
+        atomic_fetch_sub(&pool->numQueued, 1);
+
+    return item;
+}
+
+static void *Worker(void *arg)
+{
+    struct WorkerArgs *args = arg;
+    struct WorkPool *pool = args->pool;
+    int worker = args->worker;
+
+    while (atomic_load(&pool->numFinished) < pool->numItems)
+    {
+        int item = TakeWork(pool, worker);
+
+        if (item >= 0)
+        {
+            pool->func(pool, worker, item, pool->context);
+
+            if (atomic_fetch_add(&pool->numFinished, 1) + 1 == pool->numItems)
+                WakeIdleWorkers(pool);
+
+            continue;
+        }
+
+        // Nothing to run until a running item submits more work or finishes.
+        pthread_mutex_lock(&pool->idleMutex);
+
+        while (atomic_load(&pool->numQueued) == 0 && atomic_load(&pool->numFinished) < pool->numItems)
+            pthread_cond_wait(&pool->idleCond, &pool->idleMutex);
+
+        pthread_mutex_unlock(&pool->idleMutex);
+    }
+
+    return NULL;
+}
+
+void RunWorkPool(int numItems, int numThreads, int *initialItems, int numInitialItems, WorkFunc func, void *context)
+{
+    struct WorkPool pool;
+
+    if (numThreads <= 0)
+        numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (numThreads > numItems)
+        numThreads = numItems;
+    if (numThreads <= 0)
+        numThreads = 1;
+
+    pool.deques = malloc(numThreads * sizeof(struct WorkDeque));
+    pool.numThreads = numThreads;
+    pool.numItems = numItems;
+    pool.func = func;
+    pool.context = context;
+    atomic_init(&pool.numQueued, numInitialItems);
+    atomic_init(&pool.numFinished, 0);
+    pthread_mutex_init(&pool.idleMutex, NULL);
+    pthread_cond_init(&pool.idleCond, NULL);
+
+    pthread_t *threads = malloc(numThreads * sizeof(pthread_t));
+    struct WorkerArgs *args = malloc(numThreads * sizeof(struct WorkerArgs));
+
+    if (pool.deques == NULL || threads == NULL || args == NULL)
+        FATAL_ERROR("Failed to allocate memory for work pool.\n");
+
+    for (int i = 0; i < numThreads; i++)
+    {
+        struct WorkDeque *deque = &pool.deques[i];
+
+        // A deque never holds more than every item at once.
+        deque->items = malloc((numItems > 0 ? numItems : 1) * sizeof(int));
+        deque->top = 0;
+        deque->bottom = 0;
+        pthread_mutex_init(&deque->mutex, NULL);
+
+        if (deque->items == NULL)
+            FATAL_ERROR("Failed to allocate memory for work pool.\n");
+    }
+
+    // Deal the initial items out round-robin so every worker starts busy.
+    for (int i = 0; i < numInitialItems; i++)
+    {
+        struct WorkDeque *deque = &pool.deques[i % numThreads];
+        deque->items[deque->bottom++] = initialItems[i];
+    }
+
+    for (int i = 0; i < numThreads; i++)
+    {
+        args[i].pool = &pool;
+        args[i].worker = i;
+
+        if (pthread_create(&threads[i], NULL, Worker, &args[i]) != 0)
+            FATAL_ERROR("Failed to create worker thread.\n");
+    }
+
+    for (int i = 0; i < numThreads; i++)
+        pthread_join(threads[i], NULL);
+
+    for (int i = 0; i < numThreads; i++)
+    {
+        free(pool.deques[i].items);
+        pthread_mutex_destroy(&pool.deques[i].mutex);
+    }
+
+    free(pool.deques);
+    free(threads);
+    free(args);
+    pthread_mutex_destroy(&pool.idleMutex);
+    pthread_cond_destroy(&pool.idleCond);
+}
@@ -0,0 +1,13 @@
+#ifndef WORK_POOL_H
+#define WORK_POOL_H
+
+struct WorkPool;
+
+// Called on a worker thread for each item. worker identifies the calling
+// thread and is what SubmitWork expects.
+typedef void (*WorkFunc)(struct WorkPool *pool, int worker, int item, void *context);
+
+void RunWorkPool(int numItems, int numThreads, int *initialItems, int numInitialItems, WorkFunc func, void *context);
+void SubmitWork(struct WorkPool *pool, int worker, int item);
+
+#endif // WORK_POOL_H
@@ -0,0 +1,24 @@
+// callbacks.h
+
+#ifndef CALLBACKS_H
+#define CALLBACKS_H
+
+#include <string>
+
+namespace inja {
+class Environment;
+}
+
+// The inputs of the output being rendered, named in its doNotModifyHeader.
+extern std::string currentJsonFilepath;
+extern std::string currentTemplateFilepath;
+
+void add_callbacks(inja::Environment& env);
+
+// Forgets the setVar variables, which each output starts without.
+void clear_custom_vars();
+
+// What the doNotModifyHeader callback returns.
+std::string do_not_modify_header();
+
+#endif // CALLBACKS_H
@@ -0,0 +1,387 @@
+// generators.cpp
+// C++ versions of the largest Inja templates. Each follows its template line
+// for line, including the whitespace Inja leaves with trim_blocks set: the
+// spaces and first newline after a {% %} tag are dropped.
+
+#include "generators.h"
+#include "callbacks.h"
+
+#include <algorithm>
+#include <map>
+
+#include <string>
+using std::string; using std::to_string;
+
+// Appends a value the way {{ value }} prints it.
+static void print(string& out, const json& value)
+{
+    if (value.is_string())
+        out += value.get_ref<const string&>();
+    else if (value.is_number_integer())
+        out += to_string(value.get<json::number_integer_t>());
+    else if (!value.is_null())
+        out += value.dump();
+}
+
+// Whether {% if value %} takes the branch.
+static bool truthy(const json& value)
+{
+    if (value.is_boolean())
+        return value.get<bool>();
+    else if (value.is_number())
+        return value != 0;
+    else if (value.is_null())
+        return false;
+    return !value.empty();
+}
+
+static bool contains(const json& word, const char *check)
+{
+    return word.get_ref<const string&>().find(check) != string::npos;
+}
+
+static bool exists_in(const json& object, const char *key)
+{
+    return object.find(key) != object.end();
+}
+
+static string upper(const json& value)
+{
+    string result = value.get<string>();
+    std::transform(result.begin(), result.end(), result.begin(), ::toupper);
+    return result;
+}
+
+// src/data/items.json.txt
+static string generate_items(const json& data)
+{
+    const json& items = data.at("items");
+    string out;
+
+    out.reserve(1024 * 1024);
+    out += do_not_modify_header();
+    out += "\n";
+
+    for (const json& item : items)
+    {
+        if (item.at("pocket") == "POCKET_TM_CASE")
+        {
+            out += "extern const u8 gMoveDescription_";
+            print(out, item.at("moveId"));
+            out += "[];\n";
+        }
+        if (item.at("itemId") != "ITEM_NONE")
+        {
+            out += "const u8 gItemDescription_";
+            print(out, item.at("itemId"));
+            out += "[] = _(\"";
+            print(out, item.at("description_english"));
+            out += "\");";
+        }
+    }
+
+    out += "const u8 gItemDescription_ITEM_NONE[] = _(\"?????\");\n"
+           "\n"
+           "const struct Item gItems[] = {\n"
+           "    ";
+
+    for (const json& item : items)
+    {
+        out += "{\n        .name = _(\"";
+        print(out, item.at("english"));
+        out += "\"),\n        .itemId = ";
+        print(out, item.at("itemId"));
+        out += ",\n        .price = ";
+        print(out, item.at("price"));
+        out += ",\n        .holdEffect = ";
+        print(out, item.at("holdEffect"));
+        out += ",\n        .holdEffectParam = ";
+        print(out, item.at("holdEffectParam"));
+        if (item.at("pocket") == "POCKET_TM_CASE")
+        {
+            out += ",\n        .description = gMoveDescription_";
+            print(out, item.at("moveId"));
+        }
+        else
+        {
+            out += ",\n        .description = gItemDescription_";
+            print(out, item.at("itemId"));
+        }
+        out += ",\n        .importance = ";
+        print(out, item.at("importance"));
+        out += ",\n        .registrability = ";
+        print(out, item.at("registrability"));
+        out += ",\n        .pocket = ";
+        print(out, item.at("pocket"));
+        out += ",\n        .type = ";
+        print(out, item.at("type"));
+        out += ",\n        .fieldUseFunc = ";
+        print(out, item.at("fieldUseFunc"));
+        out += ",\n        .battleUsage = ";
+        print(out, item.at("battleUsage"));
+        out += ",\n        .battleUseFunc = ";
+        print(out, item.at("battleUseFunc"));
+        out += ",\n        .secondaryId = ";
+        print(out, item.at("secondaryId"));
+        out += "\n    }, ";
+    }
+
+    out += "};\n";
+    return out;
+}
+
+// The #ifdef a FireRed or LeafGreen only encounter table is wrapped in.
+static void open_version_block(string& out, const json& encounter)
+{
+    const json& baseLabel = encounter.at("base_label");
+
+    if (contains(baseLabel, "LeafGreen"))
+        out += "#ifdef LEAFGREEN\n";
+    else if (contains(baseLabel, "FireRed"))
+        out += "#ifdef FIRERED\n";
+}
+
+static void close_version_block(string& out, const json& encounter)
+{
+    const json& baseLabel = encounter.at("base_label");
+
+    if (contains(baseLabel, "FireRed") || contains(baseLabel, "LeafGreen"))
+        out += "#endif\n";
+}
+
+static void generate_mons(string& out, const json& encounter, const char *field, const char *name)
+{
+    if (!exists_in(encounter, field))
+        return;
+
+    const json& baseLabel = encounter.at("base_label");
+    const json& mons = encounter.at(field);
+
+    out += "const struct WildPokemon ";
+    print(out, baseLabel);
+    out += "_";
+    out += name;
+    out += "[] =\n{\n";
+
+    for (const json& mon : mons.at("mons"))
+    {
+        out += "    { ";
+        print(out, mon.at("min_level"));
+        out += ", ";
+        print(out, mon.at("max_level"));
+        out += ", ";
+        print(out, mon.at("species"));
+        out += " },\n";
+    }
+
+    out += "};\n\nconst struct WildPokemonInfo ";
+    print(out, baseLabel);
+    out += "_";
+    out += name;
+    out += "Info = { ";
+    print(out, mons.at("encounter_rate"));
+    out += ", ";
+    print(out, baseLabel);
+    out += "_";
+    out += name;
+    out += " };\n";
+}
+
+static void generate_mons_info_pointer(string& out, const json& encounter, const char *field, const char *name, const char *member)
+{
+    out += "        .";
+    out += member;
+    out += " = ";
+
+    if (exists_in(encounter, field))
+    {
+        out += "&";
+        print(out, encounter.at("base_label"));
+        out += "_";
+        out += name;
+        out += "Info";
+    }
+    else
+    {
+        out += "NULL";
+    }
+
+    out += ",\n";
+}
+
+// src/data/wild_encounters.json.txt
+static string generate_wild_encounters(const json& data)
+{
+    // The json field, the label suffix, and the WildPokemonHeader member.
+    static const char *const monFields[][3] = {
+        { "land_mons", "LandMons", "landMonsInfo" },
+        { "water_mons", "WaterMons", "waterMonsInfo" },
+        { "rock_smash_mons", "RockSmashMons", "rockSmashMonsInfo" },
+        { "fishing_mons", "FishingMons", "fishingMonsInfo" },
+    };
+
+    // The template's setVarInt/getVar variables.
+    std::map<string, string> vars;
+    string out;
+
+    out.reserve(1024 * 1024);
+    out += do_not_modify_header();
+    out += "\n\n";
+
+    for (const json& group : data.at("wild_encounter_groups"))
+    {
+        bool forMaps = truthy(group.at("for_maps"));
+
+        if (forMaps)
+        {
+            for (const json& field : group.at("fields"))
+            {
+                const json& rates = field.at("encounter_rates");
+                string type = upper(field.at("type"));
+
+                if (!exists_in(field, "groups"))
+                {
+                    for (size_t i = 0; i < rates.size(); i++)
+                    {
+                        if (i == 0)
+                        {
+                            out += "#define ENCOUNTER_CHANCE_" + type + "_SLOT_0 ";
+                            print(out, rates[i]);
+                            out += " ";
+                        }
+                        else
+                        {
+                            out += "#define ENCOUNTER_CHANCE_" + type + "_SLOT_" + to_string(i)
+                                 + " ENCOUNTER_CHANCE_" + type + "_SLOT_" + to_string(i - 1) + " + ";
+                            print(out, rates[i]);
+                        }
+                        vars[field.at("type").get<string>()] = to_string(i);
+                        out += "\n";
+                    }
+                    out += "#define ENCOUNTER_CHANCE_" + type + "_TOTAL (ENCOUNTER_CHANCE_" + type + "_SLOT_"
+                         + vars[field.at("type").get<string>()] + ")\n";
+                }
+                else
+                {
+                    for (auto& subgroup : field.at("groups").items())
+                    {
+                        string key = upper(subgroup.key());
+                        string prefix = "#define ENCOUNTER_CHANCE_" + type + "_" + key + "_SLOT_";
+                        const json& indexes = subgroup.value();
+
+                        for (size_t i = 0; i < indexes.size(); i++)
+                        {
+                            const json& index = indexes[i];
+
+                            out += prefix;
+                            print(out, index);
+                            out += " ";
+                            if (i == 0)
+                            {
+                                print(out, rates.at(index.get<int>()));
+                                out += " ";
+                            }
+                            else
+                            {
+                                out += "ENCOUNTER_CHANCE_" + type + "_" + key + "_SLOT_" + vars["previous_slot"] + " + ";
+                                print(out, rates.at(index.get<int>()));
+                            }
+                            vars[field.at("type").get<string>() + subgroup.key()] = to_string(index.get<int>());
+                            vars["previous_slot"] = to_string(index.get<int>());
+                            out += "\n";
+                        }
+                        out += "#define ENCOUNTER_CHANCE_" + type + "_" + key + "_TOTAL (ENCOUNTER_CHANCE_" + type + "_" + key + "_SLOT_"
+                             + vars[field.at("type").get<string>() + subgroup.key()] + ")\n";
+                    }
+                }
+            }
+        }
+
+        out += "\n\n\n";
+
+        for (const json& encounter : group.at("encounters"))
+        {
+            open_version_block(out, encounter);
+            for (auto& monField : monFields)
+                generate_mons(out, encounter, monField[0], monField[1]);
+            close_version_block(out, encounter);
+            out += "\n";
+        }
+
+        out += "\nconst struct WildPokemonHeader ";
+        print(out, group.at("label"));
+        out += "[] =\n{\n";
+
+        int index1 = 1;
+        for (const json& encounter : group.at("encounters"))
+        {
+            open_version_block(out, encounter);
+            out += "    {\n        .mapGroup = ";
+            if (forMaps)
+            {
+                out += "MAP_GROUP(";
+                print(out, encounter.at("map"));
+                out += ")";
+            }
+            else
+            {
+                out += "0";
+            }
+            out += ",\n        .mapNum = ";
+            if (forMaps)
+            {
+                out += "MAP_NUM(";
+                print(out, encounter.at("map"));
+                out += ")";
+            }
+            else
+            {
+                out += to_string(index1);
+            }
+            out += ",\n";
+            for (auto& monField : monFields)
+                generate_mons_info_pointer(out, encounter, monField[0], monField[1], monField[2]);
+            out += "    },\n";
+            close_version_block(out, encounter);
+            index1++;
+        }
+
+        out += "    {\n"
+               "        .mapGroup = MAP_GROUP(MAP_UNDEFINED),\n"
+               "        .mapNum = MAP_NUM(MAP_UNDEFINED),\n"
+               "        .landMonsInfo = NULL,\n"
+               "        .waterMonsInfo = NULL,\n"
+               "        .rockSmashMonsInfo = NULL,\n"
+               "        .fishingMonsInfo = NULL,\n"
+               "    },\n"
+               "};\n";
+    }
+
+    return out;
+}
+
+static const Generator s_generators[] = {
+    { "items.json.txt", 0x7A47EB6A65BB6A9D, generate_items },
+    { "wild_encounters.json.txt", 0x24710B7CA84A0359, generate_wild_encounters },
+};
+
+uint64_t text_hash(const string& text, uint64_t basis)
+{
+    uint64_t hash = basis;
+
+    for (unsigned char c : text)
+        hash = (hash ^ c) * 0x100000001B3;
+
+    return hash;
+}
+
+const Generator *find_generator(const string& templateText)
+{
+    uint64_t hash = text_hash(templateText);
+
+    for (const Generator& generator : s_generators)
+        if (generator.templateHash == hash)
+            return &generator;
+
+    return nullptr;
+}
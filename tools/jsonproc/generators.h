@@ -0,0 +1,35 @@
+// generators.h
+
+#ifndef GENERATORS_H
+#define GENERATORS_H
+
+#include <cstdint>
+#include <string>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json;
+
+// A template that jsonproc renders with C++ instead of Inja, because it's big
+// enough for Inja's interpreting to show up in the build.
+//
+// A generator is only used for the exact template text it was written from,
+// named by its hash, so that a template that's been edited falls back to Inja
+// instead of generating stale output. Whoever edits one of these templates
+// should update its generator to match and then its hash, which
+// `make -C tools/jsonproc bench` prints.
+struct Generator
+{
+    const char *templateName;
+    uint64_t templateHash;
+    std::string (*generate)(const json& data);
+};
+
+// The 64-bit FNV-1a hash of text. Several strings are hashed together by
+// passing the hash of the ones before as basis. Generators are found by the
+// hash of their template alone.
+uint64_t text_hash(const std::string& text, uint64_t basis = 0xCBF29CE484222325);
+
+// The generator for this template, or nullptr to render it with Inja.
+const Generator *find_generator(const std::string& templateText);
+
+#endif // GENERATORS_H
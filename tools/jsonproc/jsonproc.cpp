@@ -3,6 +3,8 @@
 // https://github.com/pantor/inja
 
 #include "jsonproc.h"
+#include "callbacks.h"
+#include "generators.h"
 
 #include <map>
 
@@ -12,124 +14,318 @@ using std::string; using std::to_string;
 #include <algorithm>
 using std::replace_if;
 
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <cstdint>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
 #include <inja.hpp>
 using namespace inja;
 using json = nlohmann::json;
 
-std::map<string, string> customVars;
+// Set with -c. Keeps rendered outputs across runs.
+string cacheDir;
+
+// Cleared with -i, to render every template with Inja.
+bool useGenerators = true;
+
+// Part of every cache key. Bump it when a change to jsonproc, its callbacks or
+// its generators changes what some input renders to.
+#define JSONPROC_CACHE_VERSION "1"
+
+string read_text_file(const string& filepath)
+{
+    std::ifstream file(filepath, std::ifstream::binary);
+
+    if (!file.is_open())
+        FATAL_ERROR("JSONPROC_ERROR: failed accessing file at '%s'\n", filepath.c_str());
+
+    std::ostringstream text;
+    text << file.rdbuf();
+    return text.str();
+}
+
+void write_text_file(const string& filepath, const string& text)
+{
+    std::ofstream file(filepath, std::ofstream::binary);
+
+    if (!file.is_open())
+        FATAL_ERROR("JSONPROC_ERROR: failed writing file at '%s'\n", filepath.c_str());
+
+    file << text;
+}
 
-void set_custom_var(string key, string value)
+// Leaves the file alone if it already has these contents, so that whatever
+// includes it isn't rebuilt.
+void write_if_changed(const string& filepath, const string& text)
 {
-    customVars[key] = value;
+    std::ifstream file(filepath, std::ifstream::binary);
+
+    if (file.is_open())
+    {
+        std::ostringstream oldText;
+        oldText << file.rdbuf();
+        if (oldText.str() == text)
+            return;
+    }
+
+    write_text_file(filepath, text);
 }
 
-string get_custom_var(string key)
+// Rendering only depends on the json and the template, on their paths through
+// doNotModifyHeader, and on the version of jsonproc and whether it may use a
+// generator. An output is cached as <slot>-<contents>-<size>.out, where the
+// slot is a hash of the paths, the version and the renderer, and the rest
+// identifies the texts. Storing an output removes the slot's older entries,
+// so the cache holds one file per output instead of one per edit.
+uint64_t cache_slot_hash()
 {
-    return customVars[key];
+    const string renderer = useGenerators ? "generators" : "inja";
+    const string separator = "\xFF";
+    const string *parts[] = { &renderer, &currentJsonFilepath, &currentTemplateFilepath };
+    uint64_t hash = text_hash(JSONPROC_CACHE_VERSION);
+
+    for (const string *part : parts)
+        hash = text_hash(*part, text_hash(separator, hash));
+
+    return hash;
+}
+
+string cache_slot_prefix()
+{
+    char prefix[32];
+    snprintf(prefix, sizeof(prefix), "%016llx-", static_cast<unsigned long long>(cache_slot_hash()));
+    return prefix;
+}
+
+string cached_output_path(const string& jsonText, const string& templateText)
+{
+    uint64_t hash = text_hash(templateText, text_hash("\xFF", text_hash(jsonText)));
+    char name[64];
+
+    snprintf(name, sizeof(name), "%016llx-%lu.out", static_cast<unsigned long long>(hash),
+             static_cast<unsigned long>(jsonText.size() + templateText.size()));
+    return cacheDir + cache_slot_prefix() + name;
+}
+
+bool read_cached_output(const string& path, string& output)
+{
+    std::ifstream file(path, std::ifstream::binary);
+
+    if (!file.is_open())
+        return false;
+
+    std::ostringstream text;
+    text << file.rdbuf();
+    output = text.str();
+    return true;
+}
+
+// Removes the entries in path's slot other than path itself.
+void prune_cache_slot(const string& path)
+{
+    namespace fs = std::filesystem;
+    string prefix = cache_slot_prefix();
+    string name = fs::path(path).filename().string();
+    std::error_code error;
+
+    for (fs::directory_iterator entry(cacheDir, error), end; !error && entry != end; entry.increment(error))
+    {
+        string entryName = entry->path().filename().string();
+
+        if (entryName != name && entryName.compare(0, prefix.size(), prefix) == 0
+         && entryName.size() > 4 && entryName.compare(entryName.size() - 4, 4, ".out") == 0)
+            fs::remove(entry->path(), error);
+    }
+}
+
+void store_cached_output(const string& path, const string& output)
+{
+    static std::atomic<unsigned> tempCount(0);
+    string tempPath = path + ".tmp" + to_string(getpid()) + "-" + to_string(tempCount++);
+
+    {
+        std::ofstream file(tempPath, std::ofstream::binary);
+
+        if (!file.is_open())
+            return; // nothing is cached in a directory that can't be written
+
+        file << output;
+    }
+
+#ifdef _WIN32
+    remove(path.c_str());
+#endif
+
+    if (rename(tempPath.c_str(), path.c_str()) != 0)
+        remove(tempPath.c_str());
+    else
+        prune_cache_slot(path);
+}
+
+// The inputs of one run. Each file is read and parsed at most once, however
+// many outputs it's used for, and not at all if every output using it is
+// cached.
+class Inputs
+{
+public:
+    explicit Inputs(Environment& env) : m_env(env) {}
+
+    const string& text(const string& filepath)
+    {
+        auto it = m_texts.find(filepath);
+        if (it == m_texts.end())
+            it = m_texts.emplace(filepath, read_text_file(filepath)).first;
+        return it->second;
+    }
+
+    const json& data(const string& filepath)
+    {
+        auto it = m_jsons.find(filepath);
+        if (it == m_jsons.end())
+            it = m_jsons.emplace(filepath, json::parse(text(filepath))).first;
+        return it->second;
+    }
+
+    const Template& compiledTemplate(const string& filepath)
+    {
+        auto it = m_templates.find(filepath);
+        if (it == m_templates.end())
+            it = m_templates.emplace(filepath, m_env.parse(text(filepath))).first;
+        return it->second;
+    }
+
+private:
+    Environment& m_env;
+    std::map<string, string> m_texts;
+    std::map<string, json> m_jsons;
+    std::map<string, Template> m_templates;
+};
+
+string render(Environment& env, Inputs& inputs, const string& jsonFilepath, const string& templateFilepath)
+{
+    currentJsonFilepath = jsonFilepath;
+    currentTemplateFilepath = templateFilepath;
+    clear_custom_vars();
+
+    string cachePath;
+    string output;
+
+    if (!cacheDir.empty())
+    {
+        cachePath = cached_output_path(inputs.text(jsonFilepath), inputs.text(templateFilepath));
+        if (read_cached_output(cachePath, output))
+            return output;
+    }
+
+    const Generator *generator = useGenerators ? find_generator(inputs.text(templateFilepath)) : nullptr;
+    bool generated = false;
+
+    // A generator only sees a bare json error when the data is missing
+    // something, so the template is then rendered with Inja instead, which
+    // fails with the variable and the template line that were to blame.
+    if (generator != nullptr)
+    {
+        try
+        {
+            output = generator->generate(inputs.data(jsonFilepath));
+            generated = true;
+        }
+        catch (const json::exception&)
+        {
+            clear_custom_vars();
+        }
+    }
+
+    if (!generated)
+        output = env.render(inputs.compiledTemplate(templateFilepath), inputs.data(jsonFilepath));
+
+    if (!cacheDir.empty())
+        store_cached_output(cachePath, output);
+
+    return output;
+}
+
+// Renders each line of the manifest, "JSON TEMPLATE OUTPUT", in one process.
+// Outputs whose contents wouldn't change are left alone, so the build can run
+// every output through one jsonproc and only rebuild what includes changed ones.
+void render_batch(Environment& env, const string& manifestFilepath)
+{
+    std::istringstream manifest(read_text_file(manifestFilepath));
+    Inputs inputs(env);
+    string line;
+
+    while (std::getline(manifest, line))
+    {
+        std::istringstream fields(line);
+        string jsonFilepath, templateFilepath, outputFilepath;
+
+        if (!(fields >> jsonFilepath))
+            continue;
+        if (!(fields >> templateFilepath >> outputFilepath))
+            FATAL_ERROR("JSONPROC_ERROR: %s: expected \"JSON TEMPLATE OUTPUT\", got \"%s\"\n", manifestFilepath.c_str(), line.c_str());
+
+        try
+        {
+            write_if_changed(outputFilepath, render(env, inputs, jsonFilepath, templateFilepath));
+        }
+        catch (const std::exception& e)
+        {
+            FATAL_ERROR("JSONPROC_ERROR: %s: %s\n", outputFilepath.c_str(), e.what());
+        }
+    }
 }
 
 int main(int argc, char *argv[])
 {
-    if (argc != 4)
-        FATAL_ERROR("USAGE: jsonproc <json-filepath> <template-filepath> <output-filepath>\n");
+    if (argc >= 3 && string(argv[1]) == "-c")
+    {
+        cacheDir = argv[2];
+        if (cacheDir.back() != '/' && cacheDir.back() != '\\')
+            cacheDir += '/';
+        argc -= 2;
+        argv += 2;
+    }
 
-    string jsonfilepath = argv[1];
-    string templateFilepath = argv[2];
-    string outputFilepath = argv[3];
+    if (argc >= 2 && string(argv[1]) == "-i")
+    {
+        useGenerators = false;
+        argc--;
+        argv++;
+    }
+
+    bool batch = (argc == 3 && string(argv[1]) == "-B");
+
+    if (argc != 4 && !batch)
+        FATAL_ERROR("USAGE: jsonproc [-c <cache-dir>] [-i] <json-filepath> <template-filepath> <output-filepath>\n"
+                    "       jsonproc [-c <cache-dir>] [-i] -B <manifest-filepath>\n");
 
     Environment env;
     env.set_trim_blocks(true);
+    add_callbacks(env);
 
-    // Add custom command callbacks.
-    env.add_callback("doNotModifyHeader", 0, [jsonfilepath, templateFilepath](Arguments& args) {
-        return "//\n// DO NOT MODIFY THIS FILE! It is auto-generated from " + jsonfilepath +" and Inja template " + templateFilepath + "\n//\n";
-    });
-
-    env.add_callback("contains", 2, [](Arguments& args) {
-        string word = args.at(0)->get<string>();
-        string check = args.at(1)->get<string>();
-
-        return word.find(check) != std::string::npos;
-    });
-
-    env.add_callback("subtract", 2, [](Arguments& args) {
-        int minuend = args.at(0)->get<int>();
-        int subtrahend = args.at(1)->get<int>();
-
-        return minuend - subtrahend;
-    });
-
-    env.add_callback("setVar", 2, [=](Arguments& args) {
-        string key = args.at(0)->get<string>();
-        string value = args.at(1)->get<string>();
-        set_custom_var(key, value);
-        return "";
-    });
-
-    env.add_callback("setVarInt", 2, [=](Arguments& args) {
-        string key = args.at(0)->get<string>();
-        string value = to_string(args.at(1)->get<int>());
-        set_custom_var(key, value);
-        return "";
-    });
-
-    env.add_callback("getVar", 1, [=](Arguments& args) {
-        string key = args.at(0)->get<string>();
-        return get_custom_var(key);
-    });
-
-    env.add_callback("concat", 2, [](Arguments& args) {
-        string first = args.at(0)->get<string>();
-        string second = args.at(1)->get<string>();
-        return first + second;
-    });
-
-    env.add_callback("removePrefix", 2, [](Arguments& args) {
-        string rawValue = args.at(0)->get<string>();
-        string prefix = args.at(1)->get<string>();
-        string::size_type i = rawValue.find(prefix);
-        if (i != 0)
-            return rawValue;
-
-        return rawValue.erase(0, prefix.length());
-    });
-
-    env.add_callback("removeSuffix", 2, [](Arguments& args) {
-        string rawValue = args.at(0)->get<string>();
-        string suffix = args.at(1)->get<string>();
-        string::size_type i = rawValue.rfind(suffix);
-        if (i == string::npos)
-            return rawValue;
-
-        return rawValue.substr(0, i);
-    });
-
-    // single argument is a json object
-    env.add_callback("isEmpty", 1, [](Arguments& args) {
-        return args.at(0)->empty();
-    });
-
-    env.add_callback("isEmptyString", 1, [](Arguments& args) {
-        return args.at(0)->get<string>().empty();
-    });
-
-    env.add_callback("cleanString", 1, [](Arguments& args) {
-        string str = args.at(0)->get<string>();
-        for (unsigned int i = 0; i < str.length(); i++) {
-            // This code is not Unicode aware, so UTF-8 is not easily parsable without introducing
-            // another library. Just filter out any non-alphanumeric characters for now.
-            // TODO: proper Unicode string normalization
-            if ((i == 0 && isdigit(str[i]))
-             || !isalnum(str[i])) {
-                str[i] = '_';
-            }
-        }
-        return str;
-    });
+    if (batch)
+    {
+        render_batch(env, argv[2]);
+        return 0;
+    }
+
+    string jsonFilepath = argv[1];
+    string templateFilepath = argv[2];
+    string outputFilepath = argv[3];
+    Inputs inputs(env);
 
     try
     {
-        env.write_with_json_file(templateFilepath, jsonfilepath, outputFilepath);
+        write_text_file(outputFilepath, render(env, inputs, jsonFilepath, templateFilepath));
     }
     catch (const std::exception& e)
     {
@@ -0,0 +1,97 @@
+// jsonproc_bench.cpp
+// Times rendering templates that have a C++ generator both with the generator
+// and with Inja, and checks that the two outputs are identical.
+//
+// Usage: jsonproc_bench <json-filepath> <template-filepath> [<json-filepath> <template-filepath>...]
+
+#include "jsonproc.h"
+#include "callbacks.h"
+#include "generators.h"
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+#include <string>
+using std::string;
+
+#include <inja.hpp>
+using namespace inja;
+using json = nlohmann::json;
+
+// Each render takes milliseconds, so each is repeated to steady the timing.
+#define JSONPROC_BENCH_ROUNDS 20
+
+static string read_text_file(const string& filepath)
+{
+    std::ifstream file(filepath, std::ifstream::binary);
+
+    if (!file.is_open())
+        FATAL_ERROR("Cannot open file %s for reading.\n", filepath.c_str());
+
+    std::ostringstream text;
+    text << file.rdbuf();
+    return text.str();
+}
+
+// Milliseconds per render.
+template <typename Render>
+static double time_renders(Render render, string& output)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (int round = 0; round < JSONPROC_BENCH_ROUNDS; round++)
+    {
+        clear_custom_vars();
+        output = render();
+    }
+
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / JSONPROC_BENCH_ROUNDS;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3 || argc % 2 != 1)
+        FATAL_ERROR("Usage: %s <json-filepath> <template-filepath> [<json-filepath> <template-filepath>...]\n", argv[0]);
+
+    Environment env;
+    env.set_trim_blocks(true);
+    add_callbacks(env);
+
+    bool ok = true;
+
+    for (int i = 1; i < argc; i += 2)
+    {
+        currentJsonFilepath = argv[i];
+        currentTemplateFilepath = argv[i + 1];
+
+        string templateText = read_text_file(currentTemplateFilepath);
+        const Generator *generator = find_generator(templateText);
+
+        if (generator == nullptr)
+        {
+            std::printf("%s: no generator for this template (hash 0x%016llX)\n", currentTemplateFilepath.c_str(),
+                        static_cast<unsigned long long>(text_hash(templateText)));
+            ok = false;
+            continue;
+        }
+
+        json data = json::parse(read_text_file(currentJsonFilepath));
+        Template tmpl = env.parse(templateText);
+        string injaOutput, generatorOutput;
+
+        double injaTime = time_renders([&]() { return env.render(tmpl, data); }, injaOutput);
+        double generatorTime = time_renders([&]() { return generator->generate(data); }, generatorOutput);
+        bool same = (injaOutput == generatorOutput);
+
+        std::printf("%s: Inja %.2f ms, generator %.2f ms (%.1fx), %zu bytes, %s\n", currentTemplateFilepath.c_str(),
+                    injaTime, generatorTime, injaTime / generatorTime, generatorOutput.size(),
+                    same ? "identical" : "OUTPUTS DIFFER");
+
+        if (!same)
+            ok = false;
+    }
+
+    return ok ? 0 : 1;
+}
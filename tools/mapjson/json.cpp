@@ -0,0 +1,540 @@
+// json.cpp
+//
+// The parser accepts what json11's standard strategy did and reports errors
+// with the same messages.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "json.h"
+
+using std::string;
+using std::vector;
+
+static const int max_depth = 200;
+
+static const size_t arena_block_size = 64 * 1024;
+
+static const JsonValue empty_object = { Json::OBJECT, 0, { 0 } };
+
+static inline bool in_range(long x, long lower, long upper) {
+    return (x >= lower && x <= upper);
+}
+
+static string esc(char c) {
+    char buf[12];
+    if (static_cast<unsigned char>(c) >= 0x20 && static_cast<unsigned char>(c) <= 0x7f) {
+        snprintf(buf, sizeof buf, "'%c' (%d)", c, c);
+    } else {
+        snprintf(buf, sizeof buf, "(%d)", c);
+    }
+    return string(buf);
+}
+
+JsonArrayItems::iterator &JsonArrayItems::iterator::operator++() {
+    current.value++;
+    return *this;
+}
+
+JsonArrayItems::iterator JsonArrayItems::begin() const {
+    return iterator(items);
+}
+
+JsonArrayItems::iterator JsonArrayItems::end() const {
+    return iterator(items + count);
+}
+
+Json JsonArrayItems::operator[](size_t i) const {
+    return i < count ? Json(&items[i]) : Json();
+}
+
+JsonObjectItems::iterator JsonObjectItems::end() const {
+    return members + count;
+}
+
+JsonObjectItems::iterator JsonObjectItems::find(const string &key) const {
+    for (size_t i = count; i-- > 0;) {
+        const JsonMember &member = members[i];
+        if (member.key_length == key.size() && memcmp(member.key, key.data(), key.size()) == 0)
+            return &member;
+    }
+    return end();
+}
+
+Json Json::object() {
+    return Json(&empty_object);
+}
+
+Json::Type Json::type() const {
+    return value ? value->type : NUL;
+}
+
+double Json::number_value() const {
+    return type() == NUMBER ? value->number : 0;
+}
+
+int Json::int_value() const {
+    return type() == NUMBER ? static_cast<int>(value->number) : 0;
+}
+
+bool Json::bool_value() const {
+    return type() == BOOL ? value->boolean : false;
+}
+
+string Json::string_value() const {
+    return type() == STRING ? string(value->string, value->length) : string();
+}
+
+JsonArrayItems Json::array_items() const {
+    if (type() != ARRAY)
+        return JsonArrayItems(nullptr, 0);
+    return JsonArrayItems(value->items, value->length);
+}
+
+JsonObjectItems Json::object_items() const {
+    if (type() != OBJECT)
+        return JsonObjectItems(nullptr, 0);
+    return JsonObjectItems(value->members, value->length);
+}
+
+Json Json::operator[](size_t i) const {
+    return array_items()[i];
+}
+
+Json Json::operator[](const string &key) const {
+    JsonObjectItems members = object_items();
+    JsonObjectItems::iterator it = members.find(key);
+    return it != members.end() ? Json(&it->value) : Json();
+}
+
+bool Json::operator==(const Json &other) const {
+    if (value == other.value)
+        return true;
+    if (type() != other.type())
+        return false;
+
+    switch (type()) {
+    case NUL:
+        return true;
+    case NUMBER:
+        return value->number == other.value->number;
+    case BOOL:
+        return value->boolean == other.value->boolean;
+    case STRING:
+        return value->length == other.value->length
+            && memcmp(value->string, other.value->string, value->length) == 0;
+    case ARRAY: {
+        if (value->length != other.value->length)
+            return false;
+        for (size_t i = 0; i < value->length; i++)
+            if ((*this)[i] != other[i])
+                return false;
+        return true;
+    }
+    case OBJECT: {
+        // Compared by key, like the std::map json11 kept members in.
+        for (auto &member : object_items()) {
+            string key(member.key, member.key_length);
+            if ((*this)[key] != other[key])
+                return false;
+        }
+        for (auto &member : other.object_items()) {
+            string key(member.key, member.key_length);
+            if ((*this)[key] != other[key])
+                return false;
+        }
+        return true;
+    }
+    }
+    return false;
+}
+
+namespace {
+
+// Values are built on the items and members stacks and copied into the
+// document's arena when their array or object ends, so the stacks are the
+// only storage that grows while parsing.
+struct JsonParser {
+    JsonDocument &doc;
+    char *str;
+    size_t size;
+    size_t i;
+    string &err;
+    bool failed;
+    vector<JsonValue> items;
+    vector<JsonMember> members;
+
+    bool fail(string &&msg) {
+        if (!failed)
+            err = std::move(msg);
+        failed = true;
+        return false;
+    }
+
+    void consume_whitespace() {
+        while (str[i] == ' ' || str[i] == '\r' || str[i] == '\n' || str[i] == '\t')
+            i++;
+    }
+
+    char get_next_token() {
+        consume_whitespace();
+        if (i == size) {
+            fail("unexpected end of input");
+            return 0;
+        }
+        return str[i++];
+    }
+
+    void encode_utf8(long pt, char *&out) {
+        if (pt < 0)
+            return;
+
+        if (pt < 0x80) {
+            *out++ = static_cast<char>(pt);
+        } else if (pt < 0x800) {
+            *out++ = static_cast<char>((pt >> 6) | 0xC0);
+            *out++ = static_cast<char>((pt & 0x3F) | 0x80);
+        } else if (pt < 0x10000) {
+            *out++ = static_cast<char>((pt >> 12) | 0xE0);
+            *out++ = static_cast<char>(((pt >> 6) & 0x3F) | 0x80);
+            *out++ = static_cast<char>((pt & 0x3F) | 0x80);
+        } else {
+            *out++ = static_cast<char>((pt >> 18) | 0xF0);
+            *out++ = static_cast<char>(((pt >> 12) & 0x3F) | 0x80);
+            *out++ = static_cast<char>(((pt >> 6) & 0x3F) | 0x80);
+            *out++ = static_cast<char>((pt & 0x3F) | 0x80);
+        }
+    }
+
+    // Parses the string starting at the current position. Escapes never
+    // decode to more bytes than they were written with, so the string is
+    // decoded over itself and points into the text.
+    bool parse_string(const char *&out_str, size_t &out_length) {
+        char *start = &str[i];
+        char *out = start;
+        long last_escaped_codepoint = -1;
+
+        while (true) {
+            if (i == size)
+                return fail("unexpected end of input in string");
+
+            char ch = str[i++];
+
+            if (ch == '"') {
+                encode_utf8(last_escaped_codepoint, out);
+                out_str = start;
+                out_length = out - start;
+                return true;
+            }
+
+            if (in_range(ch, 0, 0x1f))
+                return fail("unescaped " + esc(ch) + " in string");
+
+            // The usual case: non-escaped characters
+            if (ch != '\\') {
+                encode_utf8(last_escaped_codepoint, out);
+                last_escaped_codepoint = -1;
+                *out++ = ch;
+                continue;
+            }
+
+            // Handle escapes
+            if (i == size)
+                return fail("unexpected end of input in string");
+
+            ch = str[i++];
+
+            if (ch == 'u') {
+                string esc(&str[i], std::min<size_t>(4, size - i));
+                if (esc.length() < 4)
+                    return fail("bad \\u escape: " + esc);
+                for (size_t j = 0; j < 4; j++) {
+                    if (!in_range(esc[j], 'a', 'f') && !in_range(esc[j], 'A', 'F')
+                            && !in_range(esc[j], '0', '9'))
+                        return fail("bad \\u escape: " + esc);
+                }
+
+                long codepoint = strtol(esc.c_str(), nullptr, 16);
+
+                // A lead surrogate followed by a trail surrogate is one
+                // character outside the BMP.
+                if (in_range(last_escaped_codepoint, 0xD800, 0xDBFF)
+                        && in_range(codepoint, 0xDC00, 0xDFFF)) {
+                    encode_utf8((((last_escaped_codepoint - 0xD800) << 10)
+                                 | (codepoint - 0xDC00)) + 0x10000, out);
+                    last_escaped_codepoint = -1;
+                } else {
+                    encode_utf8(last_escaped_codepoint, out);
+                    last_escaped_codepoint = codepoint;
+                }
+
+                i += 4;
+                continue;
+            }
+
+            encode_utf8(last_escaped_codepoint, out);
+            last_escaped_codepoint = -1;
+
+            if (ch == 'b') {
+                *out++ = '\b';
+            } else if (ch == 'f') {
+                *out++ = '\f';
+            } else if (ch == 'n') {
+                *out++ = '\n';
+            } else if (ch == 'r') {
+                *out++ = '\r';
+            } else if (ch == 't') {
+                *out++ = '\t';
+            } else if (ch == '"' || ch == '\\' || ch == '/') {
+                *out++ = ch;
+            } else {
+                return fail("invalid escape character " + esc(ch));
+            }
+        }
+    }
+
+    bool parse_number(JsonValue &value) {
+        size_t start_pos = i;
+
+        if (str[i] == '-')
+            i++;
+
+        // Integer part
+        if (str[i] == '0') {
+            i++;
+            if (in_range(str[i], '0', '9'))
+                return fail("leading 0s not permitted in numbers");
+        } else if (in_range(str[i], '1', '9')) {
+            i++;
+            while (in_range(str[i], '0', '9'))
+                i++;
+        } else {
+            return fail("invalid " + esc(str[i]) + " in number");
+        }
+
+        value.type = Json::NUMBER;
+        value.length = 0;
+
+        if (str[i] != '.' && str[i] != 'e' && str[i] != 'E'
+                && (i - start_pos) <= static_cast<size_t>(std::numeric_limits<int>::digits10)) {
+            value.number = atoi(&str[start_pos]);
+            return true;
+        }
+
+        // Decimal part
+        if (str[i] == '.') {
+            i++;
+            if (!in_range(str[i], '0', '9'))
+                return fail("at least one digit required in fractional part");
+
+            while (in_range(str[i], '0', '9'))
+                i++;
+        }
+
+        // Exponent part
+        if (str[i] == 'e' || str[i] == 'E') {
+            i++;
+
+            if (str[i] == '+' || str[i] == '-')
+                i++;
+
+            if (!in_range(str[i], '0', '9'))
+                return fail("at least one digit required in exponent");
+
+            while (in_range(str[i], '0', '9'))
+                i++;
+        }
+
+        value.number = strtod(&str[start_pos], nullptr);
+        return true;
+    }
+
+    // Expects that the literal starts at the character that was just read.
+    bool expect(const char *expected) {
+        size_t length = strlen(expected);
+        i--;
+        if (size - i >= length && memcmp(&str[i], expected, length) == 0) {
+            i += length;
+            return true;
+        }
+        return fail("parse error: expected " + string(expected) + ", got "
+                    + string(&str[i], std::min(length, size - i)));
+    }
+
+    template <typename T>
+    const T *copy_to_arena(const vector<T> &stack, size_t first) {
+        size_t count = stack.size() - first;
+        if (count == 0)
+            return nullptr;
+        T *copy = static_cast<T *>(doc.allocate(count * sizeof(T)));
+        memcpy(copy, &stack[first], count * sizeof(T));
+        return copy;
+    }
+
+    bool parse_json(int depth, JsonValue &value) {
+        if (depth > max_depth)
+            return fail("exceeded maximum nesting depth");
+
+        char ch = get_next_token();
+        if (failed)
+            return false;
+
+        if (ch == '-' || (ch >= '0' && ch <= '9')) {
+            i--;
+            return parse_number(value);
+        }
+
+        if (ch == 't' || ch == 'f') {
+            value.type = Json::BOOL;
+            value.length = 0;
+            value.boolean = ch == 't';
+            return expect(ch == 't' ? "true" : "false");
+        }
+
+        if (ch == 'n') {
+            value.type = Json::NUL;
+            value.length = 0;
+            value.string = nullptr;
+            return expect("null");
+        }
+
+        if (ch == '"') {
+            value.type = Json::STRING;
+            return parse_string(value.string, value.length);
+        }
+
+        if (ch == '{') {
+            size_t first = members.size();
+            ch = get_next_token();
+
+            if (ch != '}') {
+                while (1) {
+                    if (ch != '"')
+                        return fail("expected '\"' in object, got " + esc(ch));
+
+                    JsonMember member;
+                    if (!parse_string(member.key, member.key_length))
+                        return false;
+
+                    ch = get_next_token();
+                    if (ch != ':')
+                        return fail("expected ':' in object, got " + esc(ch));
+
+                    if (!parse_json(depth + 1, member.value))
+                        return false;
+                    members.push_back(member);
+
+                    ch = get_next_token();
+                    if (ch == '}')
+                        break;
+                    if (ch != ',')
+                        return fail("expected ',' in object, got " + esc(ch));
+
+                    ch = get_next_token();
+                }
+            }
+
+            value.type = Json::OBJECT;
+            value.length = members.size() - first;
+            value.members = copy_to_arena(members, first);
+            members.resize(first);
+            return true;
+        }
+
+        if (ch == '[') {
+            size_t first = items.size();
+            ch = get_next_token();
+
+            if (ch != ']') {
+                while (1) {
+                    i--;
+                    JsonValue item;
+                    if (!parse_json(depth + 1, item))
+                        return false;
+                    items.push_back(item);
+
+                    ch = get_next_token();
+                    if (ch == ']')
+                        break;
+                    if (ch != ',')
+                        return fail("expected ',' in list, got " + esc(ch));
+
+                    ch = get_next_token();
+                    (void)ch;
+                }
+            }
+
+            value.type = Json::ARRAY;
+            value.length = items.size() - first;
+            value.items = copy_to_arena(items, first);
+            items.resize(first);
+            return true;
+        }
+
+        return fail("expected value, got " + esc(ch));
+    }
+};
+
+} // namespace
+
+JsonDocument::JsonDocument() : block_used(0), block_size(0) {
+    root_value.type = Json::NUL;
+    root_value.length = 0;
+}
+
+void *JsonDocument::allocate(size_t size) {
+    const size_t align = alignof(JsonMember) > alignof(JsonValue) ? alignof(JsonMember) : alignof(JsonValue);
+    size = (size + align - 1) & ~(align - 1);
+
+    if (size > arena_block_size / 4) {
+        // Too big to share a block, so it gets its own and the current block
+        // stays last to be filled.
+        std::unique_ptr<char[]> block(new char[size]);
+        void *p = block.get();
+        blocks.insert(blocks.end() - (block_size != 0 ? 1 : 0), std::move(block));
+        return p;
+    }
+
+    if (block_size - block_used < size) {
+        blocks.emplace_back(new char[arena_block_size]);
+        block_used = 0;
+        block_size = arena_block_size;
+    }
+
+    void *p = blocks.back().get() + block_used;
+    block_used += size;
+    return p;
+}
+
+bool JsonDocument::parse(string input, string &err) {
+    text = std::move(input);
+    blocks.clear();
+    block_used = block_size = 0;
+    root_value.type = Json::NUL;
+
+    JsonParser parser { *this, &text[0], text.size(), 0, err, false, {}, {} };
+    parser.items.reserve(64);
+    parser.members.reserve(64);
+    JsonValue result;
+    parser.parse_json(0, result);
+
+    // Check for any trailing garbage
+    if (!parser.failed) {
+        parser.consume_whitespace();
+        if (parser.i != text.size())
+            parser.fail("unexpected trailing " + esc(text[parser.i]));
+    }
+    if (parser.failed)
+        return false;
+
+    root_value = result;
+    return true;
+}
+
+Json JsonDocument::root() const {
+    return root_value.type == Json::NUL ? Json() : Json(&root_value);
+}
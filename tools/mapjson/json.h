@@ -0,0 +1,139 @@
+// json.h
+//
+// A read-only JSON document model for mapjson. Parsing a document allocates
+// every array and object from one arena, and strings point into the text that
+// was parsed (escapes are decoded in place), so a map.json costs a handful of
+// allocations instead of one per value. Values are read through Json, a view
+// that is as cheap to copy as a pointer.
+
+#ifndef JSON_H
+#define JSON_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct JsonValue;
+struct JsonMember;
+class JsonArrayItems;
+class JsonObjectItems;
+
+class Json {
+public:
+    enum Type {
+        NUL, NUMBER, BOOL, STRING, ARRAY, OBJECT
+    };
+
+    // null
+    Json() : value(nullptr) {}
+    explicit Json(const JsonValue *value) : value(value) {}
+
+    // An empty object, for comparisons.
+    static Json object();
+
+    Type type() const;
+    double number_value() const;
+    int int_value() const;
+    bool bool_value() const;
+    std::string string_value() const;
+    JsonArrayItems array_items() const;
+    JsonObjectItems object_items() const;
+
+    // Null if this isn't an array or object or has no such item.
+    Json operator[](std::size_t i) const;
+    Json operator[](const std::string &key) const;
+
+    bool operator==(const Json &other) const;
+    bool operator!=(const Json &other) const { return !(*this == other); }
+
+private:
+    friend class JsonArrayItems;
+
+    const JsonValue *value;
+};
+
+// The items of an array, read in place.
+class JsonArrayItems {
+public:
+    class iterator {
+    public:
+        explicit iterator(const JsonValue *item) : current(item) {}
+        const Json &operator*() const { return current; }
+        const Json *operator->() const { return &current; }
+        iterator &operator++();
+        bool operator!=(const iterator &other) const { return current.value != other.current.value; }
+    private:
+        Json current;
+    };
+
+    JsonArrayItems(const JsonValue *items, std::size_t count) : items(items), count(count) {}
+    iterator begin() const;
+    iterator end() const;
+    std::size_t size() const { return count; }
+    Json operator[](std::size_t i) const;
+
+private:
+    const JsonValue *items;
+    std::size_t count;
+};
+
+// The members of an object in the order they were written.
+class JsonObjectItems {
+public:
+    typedef const JsonMember *iterator;
+
+    JsonObjectItems(const JsonMember *members, std::size_t count) : members(members), count(count) {}
+    iterator begin() const { return members; }
+    iterator end() const;
+    std::size_t size() const { return count; }
+    // The last member named key, as json11 kept the last of duplicate keys.
+    iterator find(const std::string &key) const;
+
+private:
+    const JsonMember *members;
+    std::size_t count;
+};
+
+struct JsonValue {
+    Json::Type type;
+    // Bytes of a string, items of an array, or members of an object.
+    std::size_t length;
+    union {
+        double number;
+        bool boolean;
+        const char *string;
+        const JsonValue *items;
+        const JsonMember *members;
+    };
+};
+
+struct JsonMember {
+    const char *key;
+    std::size_t key_length;
+    JsonValue value;
+};
+
+class JsonDocument {
+public:
+    JsonDocument();
+    JsonDocument(const JsonDocument &) = delete;
+    JsonDocument &operator=(const JsonDocument &) = delete;
+
+    // Parses text, which the document keeps. On failure, sets err and returns
+    // false, and the root is null.
+    bool parse(std::string text, std::string &err);
+    Json root() const;
+
+    // Used by the parser.
+    void *allocate(std::size_t size);
+
+private:
+    std::string text;
+    JsonValue root_value;
+    std::vector<std::unique_ptr<char[]>> blocks;
+    std::size_t block_used;
+    std::size_t block_size;
+};
+
+#endif // JSON_H
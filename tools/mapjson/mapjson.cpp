@@ -24,14 +24,30 @@ using std::ostringstream;
 #include <limits>
 using std::numeric_limits;
 
-#include "json11.h"
-using json11::Json;
+#include <atomic>
+#include <thread>
+
+#include <cstdint>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#include "json.h"
 
 #include "mapjson.h"
 
 string version;
 // System directory separator
 string sep;
+// Leave output files alone when their contents wouldn't change, so that
+// regenerating every map doesn't make everything that includes them stale.
+bool skip_unchanged_writes = false;
+// Set with -c. Keeps the event id constants of each map.json across runs.
+string cache_dir;
 
 string read_text_file(string filepath) {
     ifstream in_file(filepath);
@@ -52,7 +68,27 @@ string read_text_file(string filepath) {
     return text;
 }
 
+bool file_has_text(const string &filepath, const string &text) {
+    ifstream in_file(filepath, std::ifstream::binary);
+
+    if (!in_file.is_open())
+        return false;
+
+    in_file.seekg(0, std::ios::end);
+    if (in_file.tellg() != static_cast<std::streamoff>(text.size()))
+        return false;
+
+    string existing(text.size(), '\0');
+    in_file.seekg(0, std::ios::beg);
+    in_file.read(&existing[0], existing.size());
+
+    return in_file && existing == text;
+}
+
 void write_text_file(string filepath, string text) {
+    if (skip_unchanged_writes && file_has_text(filepath, text))
+        return;
+
     ofstream out_file(filepath, std::ofstream::binary);
 
     if (!out_file.is_open())
@@ -119,15 +155,26 @@ string get_include_guard_end(const string &name) {
     return guard.str();
 }
 
-string generate_map_header_text(Json map_data, Json layouts_data) {
+// Layouts by id, so that each map's layout is found without a search.
+typedef map<string, vector<Json>> LayoutIndex;
+
+LayoutIndex index_layouts(const Json &layouts_data) {
+    LayoutIndex layouts;
+
+    for (auto &layout : layouts_data["layouts"].array_items())
+        layouts[json_to_string(layout, "id", true)].push_back(layout);
+
+    return layouts;
+}
+
+string generate_map_header_text(Json map_data, const LayoutIndex &layouts) {
     string map_layout_id = json_to_string(map_data, "layout");
 
+    auto matched_layouts = layouts.find(map_layout_id);
     vector<Json> matched;
 
-    for (auto &layout : layouts_data["layouts"].array_items()) {
-        if (map_layout_id == json_to_string(layout, "id", true))
-            matched.push_back(layout);
-    }
+    if (matched_layouts != layouts.end())
+        matched = matched_layouts->second;
 
     if (matched.size() != 1)
         FATAL_ERROR("Failed to find matching layout for %s.\n", map_layout_id.c_str());
@@ -367,21 +414,8 @@ string file_parent(string filename){
     return filename.substr(0, dir_pos + 1);
 }
 
-void process_map(string map_filepath, string layouts_filepath, string output_dir) {
-    string mapdata_err, layouts_err;
-
-    string mapdata_json_text = read_text_file(map_filepath);
-    string layouts_json_text = read_text_file(layouts_filepath);
-
-    Json map_data = Json::parse(mapdata_json_text, mapdata_err);
-    if (map_data == Json())
-        FATAL_ERROR("%s\n", mapdata_err.c_str());
-
-    Json layouts_data = Json::parse(layouts_json_text, layouts_err);
-    if (layouts_data == Json())
-        FATAL_ERROR("%s\n", layouts_err.c_str());
-
-    string header_text = generate_map_header_text(map_data, layouts_data);
+void write_map(const Json &map_data, const LayoutIndex &layouts, string output_dir) {
+    string header_text = generate_map_header_text(map_data, layouts);
     string events_text = generate_map_events_text(map_data);
     string connections_text = generate_map_connections_text(map_data);
 
@@ -391,46 +425,154 @@ void process_map(string map_filepath, string layouts_filepath, string output_dir
     write_text_file(out_dir + "connections.inc", connections_text);
 }
 
-void process_event_constants(const vector<string> &map_filepaths, string output_ids_file) {
+// The lines a map contributes to map_event_ids.h, if any.
+string generate_map_event_ids_text(const Json &map_data) {
+    string map_id = json_to_string(map_data, "id");
+
+    // Get IDs from the object/clone events.
+    ostringstream map_ids_text;
+    auto obj_events = map_data["object_events"].array_items();
+    for (unsigned int i = 0; i < obj_events.size(); i++) {
+        auto obj_event = obj_events[i];
+        if (obj_event.object_items().find("local_id") != obj_event.object_items().end())
+            map_ids_text << "#define " << json_to_string(obj_event, "local_id") << " " << i + 1 << "\n";
+    }
+    // Get IDs from the warp events.
+    auto warp_events = map_data["warp_events"].array_items();
+    for (unsigned int i = 0; i < warp_events.size(); i++) {
+        auto warp_event = warp_events[i];
+        if (warp_event.object_items().find("warp_id") != warp_event.object_items().end())
+            map_ids_text << "#define " << json_to_string(warp_event, "warp_id") << " " << i << "\n";
+    }
+    // Only output if we found any IDs
+    string temp = map_ids_text.str();
+    if (temp.empty())
+        return temp;
+
+    return "// " + map_id + "\n" + temp + "\n";
+}
+
+string generate_event_constants_text(const vector<string> &maps_ids_text) {
     string warning = get_generated_warning("data/maps/*/map.json", false);
 
     string guard_name = "CONSTANTS_MAP_EVENT_IDS";
     ostringstream ids_file_text;
     ids_file_text << get_include_guard_start(guard_name) << warning;
 
+    for (const string &map_ids_text : maps_ids_text)
+        ids_file_text << map_ids_text;
+
+    ids_file_text << get_include_guard_end(guard_name);
+    return ids_file_text.str();
+}
+
+// Part of every event id cache entry's name. Bump it when a change to
+// generate_map_event_ids_text() changes what some map.json generates.
+#define MAPJSON_EVENT_IDS_CACHE_VERSION 1
+
+// The event id cache has one file per map.json text, named after its hash and
+// size, holding what generate_map_event_ids_text() returned for it. The map
+// modes fill it in, so event_constants only parses maps that changed since.
+// Entries are written to a temporary file and renamed into place, so parallel
+// runs can share the directory. Nothing is ever removed from it: each edit to
+// a map.json adds another small file until the cache is cleaned.
+string event_ids_cache_path(const string &map_json_text) {
+    uint64_t hash = 0xCBF29CE484222325;
+
+    hash = (hash ^ MAPJSON_EVENT_IDS_CACHE_VERSION) * 0x100000001B3;
+    for (unsigned char c : map_json_text)
+        hash = (hash ^ c) * 0x100000001B3;
+
+    char name[64];
+    snprintf(name, sizeof(name), "%016llx-%lu.ids", static_cast<unsigned long long>(hash),
+             static_cast<unsigned long>(map_json_text.size()));
+    return cache_dir + name;
+}
+
+bool read_cached_event_ids(const string &map_json_text, string &map_ids_text) {
+    if (cache_dir.empty())
+        return false;
+
+    ifstream in_file(event_ids_cache_path(map_json_text), std::ifstream::binary);
+
+    if (!in_file.is_open())
+        return false;
+
+    ostringstream text;
+    text << in_file.rdbuf();
+    map_ids_text = text.str();
+    return true;
+}
+
+void store_cached_event_ids(const string &map_json_text, const string &map_ids_text) {
+    static std::atomic<unsigned> temp_count(0);
+
+    if (cache_dir.empty())
+        return;
+
+    string path = event_ids_cache_path(map_json_text);
+    string temp_path = path + ".tmp" + std::to_string(getpid()) + "-" + std::to_string(temp_count++);
+
+    {
+        ofstream out_file(temp_path, std::ofstream::binary);
+
+        if (!out_file.is_open())
+            return; // the cache is only an optimization
+
+        out_file << map_ids_text;
+    }
+
+#ifdef _WIN32
+    remove(path.c_str());
+#endif
+
+    if (rename(temp_path.c_str(), path.c_str()) != 0)
+        remove(temp_path.c_str());
+}
+
+void process_event_constants(const vector<string> &map_filepaths, string output_ids_file) {
+    vector<string> maps_ids_text;
+
     for (const string &filepath : map_filepaths) {
         string err;
         string map_json_text = read_text_file(filepath);
-        Json map_data = Json::parse(map_json_text, err);
-        if (map_data == Json())
-            FATAL_ERROR("Failed to read '%s' while generating map event constants: %s\n", filepath.c_str(), err.c_str());
-
-        string map_id = json_to_string(map_data, "id");
-
-        // Get IDs from the object/clone events.
-        ostringstream map_ids_text;
-        auto obj_events = map_data["object_events"].array_items();
-        for (unsigned int i = 0; i < obj_events.size(); i++) {
-            auto obj_event = obj_events[i];
-            if (obj_event.object_items().find("local_id") != obj_event.object_items().end())
-                map_ids_text << "#define " << json_to_string(obj_event, "local_id") << " " << i + 1 << "\n";
-        }
-        // Get IDs from the warp events.
-        auto warp_events = map_data["warp_events"].array_items();
-        for (unsigned int i = 0; i < warp_events.size(); i++) {
-            auto warp_event = warp_events[i];
-            if (warp_event.object_items().find("warp_id") != warp_event.object_items().end())
-                map_ids_text << "#define " << json_to_string(warp_event, "warp_id") << " " << i << "\n";
-        }
-        // Only output if we found any IDs
-        string temp = map_ids_text.str();
-        if (!temp.empty()) {
-            ids_file_text << "// " << map_id << "\n" << temp << "\n";
+        string map_ids_text;
+
+        if (!read_cached_event_ids(map_json_text, map_ids_text)) {
+            JsonDocument map_doc;
+            if (!map_doc.parse(map_json_text, err))
+                FATAL_ERROR("Failed to read '%s' while generating map event constants: %s\n", filepath.c_str(), err.c_str());
+
+            map_ids_text = generate_map_event_ids_text(map_doc.root());
+            store_cached_event_ids(map_json_text, map_ids_text);
         }
+
+        maps_ids_text.push_back(map_ids_text);
     }
 
-    ids_file_text << get_include_guard_end(guard_name);
-    write_text_file(output_ids_file, ids_file_text.str());
+    write_text_file(output_ids_file, generate_event_constants_text(maps_ids_text));
+}
+
+void process_map(string map_filepath, string layouts_filepath, string output_dir) {
+    string mapdata_err, layouts_err;
+
+    string mapdata_json_text = read_text_file(map_filepath);
+    string layouts_json_text = read_text_file(layouts_filepath);
+
+    JsonDocument map_doc, layouts_doc;
+    if (!map_doc.parse(mapdata_json_text, mapdata_err))
+        FATAL_ERROR("%s\n", mapdata_err.c_str());
+
+    if (!layouts_doc.parse(std::move(layouts_json_text), layouts_err))
+        FATAL_ERROR("%s\n", layouts_err.c_str());
+
+    Json map_data = map_doc.root();
+    Json layouts_data = layouts_doc.root();
+
+    write_map(map_data, index_layouts(layouts_data), output_dir);
+
+    if (!cache_dir.empty())
+        store_cached_event_ids(mapdata_json_text, generate_map_event_ids_text(map_data));
 }
 
 string generate_groups_text(Json groups_data) {
@@ -442,7 +584,7 @@ string generate_groups_text(Json groups_data) {
         string group = json_to_string(key);
         text << group << "::\n";
         auto maps = groups_data[group].array_items();
-        for (Json &map_name : maps)
+        for (const Json &map_name : maps)
             text << "\t.4byte " << json_to_string(map_name) << "\n";
         text << "\n";
     }
@@ -462,17 +604,19 @@ string generate_connections_text(Json groups_data, string include_path) {
     for (auto map_name : groups_data[json_to_string(group)].array_items())
         map_names.push_back(map_name);
 
-    vector<Json> connections_include_order = groups_data["connections_include_order"].array_items();
+    auto connections_include_order = groups_data["connections_include_order"].array_items();
+
+    // Maps missing from connections_include_order go last.
+    auto include_position = [connections_include_order](const Json &map_name) {
+        for (size_t i = 0; i < connections_include_order.size(); i++)
+            if (connections_include_order[i] == map_name)
+                return i;
+        return static_cast<size_t>(numeric_limits<int>::max());
+    };
 
     if (connections_include_order.size() > 0)
-        sort(map_names.begin(), map_names.end(), [connections_include_order](const Json &a, const Json &b) {
-            auto iter_a = find(connections_include_order.begin(), connections_include_order.end(), a);
-            if (iter_a == connections_include_order.end())
-                iter_a = connections_include_order.begin() + numeric_limits<int>::max();
-            auto iter_b = find(connections_include_order.begin(), connections_include_order.end(), b);
-            if (iter_b == connections_include_order.end())
-                iter_b = connections_include_order.begin() + numeric_limits<int>::max();
-            return iter_a < iter_b;
+        sort(map_names.begin(), map_names.end(), [include_position](const Json &a, const Json &b) {
+            return include_position(a) < include_position(b);
         });
 
     ostringstream text;
@@ -519,7 +663,10 @@ string generate_events_text(Json groups_data, string include_path) {
     return text.str();
 }
 
-string generate_map_constants_text(string groups_filepath, Json groups_data) {
+// Maps already parsed by `mapjson all`, by the name of their directory.
+typedef map<string, Json> ParsedMaps;
+
+string generate_map_constants_text(string groups_filepath, Json groups_data, const ParsedMaps &parsed_maps) {
     string file_dir = file_parent(groups_filepath) + sep;
 
     string guard_name = "CONSTANTS_MAP_GROUPS";
@@ -535,11 +682,18 @@ string generate_map_constants_text(string groups_filepath, Json groups_data) {
         size_t max_length = 0;
 
         for (auto &map_name : groups_data[groupName].array_items()) {
-            string map_filepath = file_dir + json_to_string(map_name) + sep + "map.json";
-            string err_str;
-            Json map_data = Json::parse(read_text_file(map_filepath), err_str);
-            if (map_data == Json())
-                FATAL_ERROR("%s: %s\n", map_filepath.c_str(), err_str.c_str());
+            JsonDocument map_doc;
+            Json map_data;
+            auto parsed = parsed_maps.find(json_to_string(map_name));
+            if (parsed != parsed_maps.end()) {
+                map_data = parsed->second;
+            } else {
+                string map_filepath = file_dir + json_to_string(map_name) + sep + "map.json";
+                string err_str;
+                if (!map_doc.parse(read_text_file(map_filepath), err_str))
+                    FATAL_ERROR("%s: %s\n", map_filepath.c_str(), err_str.c_str());
+                map_data = map_doc.root();
+            }
             string id = json_to_string(map_data, "id", true);
             map_ids.push_back(id);
             if (id.length() > max_length)
@@ -563,21 +717,15 @@ string generate_map_constants_text(string groups_filepath, Json groups_data) {
 }
 
 // Output paths are directories with trailing path separators
-void process_groups(string groups_filepath, string output_asm, string output_c) {
+void write_groups(string groups_filepath, const Json &groups_data, string output_asm, string output_c, const ParsedMaps &parsed_maps) {
     output_asm = strip_trailing_separator(output_asm); // Remove separator if existing.
     output_c = strip_trailing_separator(output_c);
 
-    string err;
-    Json groups_data = Json::parse(read_text_file(groups_filepath), err);
-
-    if (groups_data == Json())
-        FATAL_ERROR("%s\n", err.c_str());
-
     string groups_text = generate_groups_text(groups_data);
     string connections_text = generate_connections_text(groups_data, output_asm);
     string headers_text = generate_headers_text(groups_data, output_asm);
     string events_text = generate_events_text(groups_data, output_asm);
-    string map_header_text = generate_map_constants_text(groups_filepath, groups_data);
+    string map_header_text = generate_map_constants_text(groups_filepath, groups_data, parsed_maps);
 
     write_text_file(output_asm + sep + "groups.inc", groups_text);
     write_text_file(output_asm + sep + "connections.inc", connections_text);
@@ -586,6 +734,16 @@ void process_groups(string groups_filepath, string output_asm, string output_c)
     write_text_file(output_c + sep + "map_groups.h", map_header_text);
 }
 
+void process_groups(string groups_filepath, string output_asm, string output_c) {
+    string err;
+    JsonDocument groups_doc;
+
+    if (!groups_doc.parse(read_text_file(groups_filepath), err))
+        FATAL_ERROR("%s\n", err.c_str());
+
+    write_groups(groups_filepath, groups_doc.root(), output_asm, output_c, ParsedMaps());
+}
+
 string generate_layout_headers_text(Json layouts_data) {
     ostringstream text;
 
@@ -653,16 +811,10 @@ string generate_layouts_constants_text(Json layouts_data) {
     return text.str();
 }
 
-void process_layouts(string layouts_filepath, string output_asm, string output_c) {
+void write_layouts(const Json &layouts_data, string output_asm, string output_c) {
     output_asm = strip_trailing_separator(output_asm).append(sep);
     output_c = strip_trailing_separator(output_c).append(sep);
 
-    string err;
-    Json layouts_data = Json::parse(read_text_file(layouts_filepath), err);
-
-    if (layouts_data == Json())
-        FATAL_ERROR("%s\n", err.c_str());
-
     string layout_headers_text = generate_layout_headers_text(layouts_data);
     string layouts_table_text = generate_layouts_table_text(layouts_data);
     string layouts_constants_text = generate_layouts_constants_text(layouts_data);
@@ -672,9 +824,89 @@ void process_layouts(string layouts_filepath, string output_asm, string output_c
     write_text_file(output_c + "layouts.h", layouts_constants_text);
 }
 
+void process_layouts(string layouts_filepath, string output_asm, string output_c) {
+    string err;
+    JsonDocument layouts_doc;
+
+    if (!layouts_doc.parse(read_text_file(layouts_filepath), err))
+        FATAL_ERROR("%s\n", err.c_str());
+
+    write_layouts(layouts_doc.root(), output_asm, output_c);
+}
+
+// Does the work of `layouts`, `groups`, every `map` and `event_constants` in
+// one run. layouts.json and each map.json are parsed once, the maps are
+// generated on a thread per core, and files that wouldn't change aren't
+// rewritten. Assembly outputs go next to the json they come from.
+void process_all(string groups_filepath, string layouts_filepath, string output_c, const vector<string> &map_filepaths) {
+    string err;
+    JsonDocument layouts_doc, groups_doc;
+    if (!layouts_doc.parse(read_text_file(layouts_filepath), err))
+        FATAL_ERROR("%s\n", err.c_str());
+
+    if (!groups_doc.parse(read_text_file(groups_filepath), err))
+        FATAL_ERROR("%s\n", err.c_str());
+
+    Json layouts_data = layouts_doc.root();
+    Json groups_data = groups_doc.root();
+    LayoutIndex layouts = index_layouts(layouts_data);
+    // The maps' documents are kept until the groups are written.
+    vector<std::unique_ptr<JsonDocument>> map_docs(map_filepaths.size());
+    vector<Json> maps_data(map_filepaths.size());
+    vector<string> maps_ids_text(map_filepaths.size());
+    std::atomic<size_t> next_map(0);
+
+    auto worker = [&]() {
+        size_t i;
+
+        while ((i = next_map++) < map_filepaths.size()) {
+            string map_err;
+            string map_json_text = read_text_file(map_filepaths[i]);
+            map_docs[i].reset(new JsonDocument());
+            if (!map_docs[i]->parse(map_json_text, map_err))
+                FATAL_ERROR("%s: %s\n", map_filepaths[i].c_str(), map_err.c_str());
+            maps_data[i] = map_docs[i]->root();
+
+            write_map(maps_data[i], layouts, file_parent(map_filepaths[i]));
+            maps_ids_text[i] = generate_map_event_ids_text(maps_data[i]);
+            store_cached_event_ids(map_json_text, maps_ids_text[i]);
+        }
+    };
+
+    unsigned num_threads = std::thread::hardware_concurrency();
+    vector<std::thread> threads;
+
+    for (unsigned i = 1; i < num_threads; i++)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    ParsedMaps parsed_maps;
+
+    for (size_t i = 0; i < map_filepaths.size(); i++) {
+        string map_dir = strip_trailing_separator(file_parent(map_filepaths[i]));
+        parsed_maps[map_dir.substr(map_dir.find_last_of("/\\") + 1)] = maps_data[i];
+    }
+
+    write_layouts(layouts_data, file_parent(layouts_filepath), output_c);
+    write_groups(groups_filepath, groups_data, file_parent(groups_filepath), output_c, parsed_maps);
+    write_text_file(strip_trailing_separator(output_c) + sep + "map_event_ids.h", generate_event_constants_text(maps_ids_text));
+}
+
 int main(int argc, char *argv[]) {
+    if (argc >= 3 && string(argv[1]) == "-c") {
+        cache_dir = argv[2];
+        if (cache_dir.back() != '/' && cache_dir.back() != '\\')
+            cache_dir += '/';
+        argc -= 2;
+        argv += 2;
+    }
+
     if (argc < 3)
-        FATAL_ERROR("USAGE: mapjson <mode> <game-version> [options]\n");
+        FATAL_ERROR("USAGE: mapjson [-c <cache_dir>] <mode> <game-version> [options]\n");
 
     char *version_arg = argv[2];
     version = string(version_arg);
@@ -732,8 +964,21 @@ int main(int argc, char *argv[]) {
 
         process_event_constants(filepaths, output_ids_file);
     }
+    else if (mode == "all") {
+        if (argc < 7)
+            FATAL_ERROR("USAGE: mapjson all <game-version> <groups_file> <layouts_file> <output_c_dir> <map_file> [additional_map_files]\n");
+
+        infer_separator(argv[3]);
+        string groups_filepath(argv[3]);
+        string layouts_filepath(argv[4]);
+        string output_c(argv[5]);
+        vector<string> filepaths(argv + 6, argv + argc);
+
+        skip_unchanged_writes = true;
+        process_all(groups_filepath, layouts_filepath, output_c, filepaths);
+    }
     else {
-        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', 'event_constants', or 'groups'.\n");
+        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', 'event_constants', 'groups', or 'all'.\n");
     }
 
     return 0;
@@ -0,0 +1,117 @@
+// mapjson_bench.cpp
+//
+// Times parsing the json mapjson reads (layouts.json and every map.json) and
+// counts the heap allocations it makes.
+//
+// Usage: mapjson_bench <json_file>...
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "json.h"
+
+using std::string;
+using std::vector;
+
+// Each file is parsed in well under a millisecond, so all of them are parsed
+// several times.
+#define MAPJSON_BENCH_ROUNDS 20
+
+static std::atomic<unsigned long> allocation_count(0);
+
+void *operator new(size_t size) {
+    allocation_count++;
+    if (void *p = malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    free(p);
+}
+
+static string read_text_file(const string &filepath) {
+    std::ifstream in_file(filepath, std::ifstream::binary);
+
+    if (!in_file.is_open()) {
+        fprintf(stderr, "Cannot open file %s for reading.\n", filepath.c_str());
+        exit(1);
+    }
+
+    std::ostringstream text;
+    text << in_file.rdbuf();
+    return text.str();
+}
+
+// Counts every value, so the parse can't be skipped and the tree is walked as
+// mapjson would walk it.
+static size_t count_values(const Json &value) {
+    size_t count = 1;
+
+    for (auto &item : value.array_items())
+        count += count_values(item);
+    for (auto &member : value.object_items())
+        count += count_values(Json(&member.value));
+
+    return count;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <json_file>...\n", argv[0]);
+        return 1;
+    }
+
+    vector<string> texts;
+    size_t total_bytes = 0;
+
+    for (int i = 1; i < argc; i++) {
+        texts.push_back(read_text_file(argv[i]));
+        total_bytes += texts.back().size();
+    }
+
+    size_t values = 0;
+    unsigned long allocations = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int round = 0; round < MAPJSON_BENCH_ROUNDS; round++) {
+        for (size_t i = 0; i < texts.size(); i++) {
+            // The copy of the text is the document's; it's made outside the
+            // count so that only the parser's own allocations are counted.
+            string text = texts[i];
+            unsigned long before = allocation_count;
+            JsonDocument doc;
+            string err;
+
+            if (!doc.parse(std::move(text), err)) {
+                fprintf(stderr, "%s: %s\n", argv[i + 1], err.c_str());
+                return 1;
+            }
+
+            allocations += allocation_count - before;
+            values += count_values(doc.root());
+        }
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    double parsed_bytes = static_cast<double>(total_bytes) * MAPJSON_BENCH_ROUNDS;
+    double parses = static_cast<double>(texts.size()) * MAPJSON_BENCH_ROUNDS;
+
+    printf("%lu files, %.1f KB, %lu values\n", static_cast<unsigned long>(texts.size()),
+           total_bytes / 1024.0, static_cast<unsigned long>(values / MAPJSON_BENCH_ROUNDS));
+    printf("%.1f ms per pass, %.1f MB/s\n", elapsed.count() * 1000 / MAPJSON_BENCH_ROUNDS,
+           parsed_bytes / elapsed.count() / (1024 * 1024));
+    printf("%.1f allocations per file\n", allocations / parses);
+    return 0;
+}
@@ -24,6 +24,7 @@
 #include <vector>
 #include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include "midi.h"
 #include "main.h"
 #include "error.h"
@@ -873,19 +874,42 @@ bool IsCompressionMatch(std::vector<Event>& events, int index1, int index2)
     return IsPatternBoundary(events[index2].type);
 }
 
-void CompressWholeNote(std::vector<Event>& events, int index)
+// Hashes everything IsCompressionMatch compares for the whole note mark at
+// index, so marks that match always hash the same.
+std::uint64_t HashWholeNote(std::vector<Event>& events, int index)
 {
-    for (int j = index + 1; events[j].type != EventType::EndOfTrack; j++)
+    std::uint64_t hash = 0xCBF29CE484222325;
+    auto mix = [&hash](std::uint32_t value) { hash = (hash ^ value) * 0x100000001B3; };
+
+    mix((std::uint32_t)events[index].type);
+    mix(events[index].note);
+    mix(events[index].param1);
+    mix(events[index].time);
+
+    index++;
+
+    do
     {
-        while (events[j].type != EventType::WholeNoteMark)
-        {
-            j++;
+        mix(events[index].time);
+        mix((std::uint32_t)events[index].type);
+        mix(events[index].note);
+        mix(events[index].param1);
+        mix(events[index].param2);
+        index++;
+    } while (!IsPatternBoundary(events[index].type));
 
-            if (events[j].type == EventType::EndOfTrack)
-                return;
-        }
+    return hash;
+}
+
+// candidates holds the later whole note marks that might match the one at
+// index, in order.
+void CompressWholeNote(std::vector<Event>& events, int index, const std::vector<int>& candidates)
+{
+    for (auto it = std::upper_bound(candidates.begin(), candidates.end(), index); it != candidates.end(); ++it)
+    {
+        int j = *it;
 
-        if (IsCompressionMatch(events, index, j))
+        if (events[j].type == EventType::WholeNoteMark && IsCompressionMatch(events, index, j))
         {
             events[j].type = EventType::Pattern;
             events[j].param2 = events[index].param2 & 0x7FFFFFFF;
@@ -896,6 +920,21 @@ void CompressWholeNote(std::vector<Event>& events, int index)
 
 void Compress(std::vector<Event>& events)
 {
+    // Whole note marks are grouped by the hash of what follows them, so each
+    // is only compared against the marks that are likely to match it instead
+    // of every later one.
+    std::unordered_map<std::uint64_t, std::vector<int>> wholeNotes;
+    std::vector<std::uint64_t> hashes(events.size());
+
+    for (int i = 0; events[i].type != EventType::EndOfTrack; i++)
+    {
+        if (events[i].type == EventType::WholeNoteMark)
+        {
+            hashes[i] = HashWholeNote(events, i);
+            wholeNotes[hashes[i]].push_back(i);
+        }
+    }
+
     for (int i = 0; events[i].type != EventType::EndOfTrack; i++)
     {
         while (events[i].type != EventType::WholeNoteMark)
@@ -908,7 +947,7 @@ void Compress(std::vector<Event>& events)
 
         if (CalculateCompressionScore(events, i) >= 6)
         {
-            CompressWholeNote(events, i);
+            CompressWholeNote(events, i, wholeNotes[hashes[i]]);
         }
     }
 }
@@ -21,6 +21,7 @@
 #include <cstdio>
 #include <cstdarg>
 #include <stdexcept>
+#include <map>
 #include "preproc.h"
 #include "asm_file.h"
 #include "char_util.h"
@@ -28,20 +29,42 @@
 #include "string_parser.h"
 #include "../../include/characters.h"
 #include "io.h"
+#include "output.h"
+
+// Sets gas's logical file and line numbers.
+static void OutputLineMarker(long lineNum, const std::string& filename)
+{
+    g_output.Write("# ");
+    g_output.Decimal(lineNum);
+    g_output.Write(" \"");
+    g_output.Write(filename);
+    g_output.Write("\"\n");
+}
 
 AsmFile::AsmFile(std::string filename, bool isStdin, bool doEnum) : m_filename(filename)
 {
-    m_buffer = ReadFileToBuffer(filename.c_str(), isStdin, &m_size);
+    if (!m_file.Load(filename.c_str(), isStdin))
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", filename.c_str());
+
+    m_buffer = m_file.Data();
+    m_size = m_file.Size();
     m_doEnum = doEnum;
 
     m_pos = 0;
     m_lineNum = 1;
     m_lineStart = 0;
 
+    m_markerScanPos = 0;
+    m_markerPos = -1;
+    m_markerLinebreaks = 0;
+    m_markerParsedPos = -1;
+    m_markerLine = 0;
+
     RemoveComments();
 }
 
-AsmFile::AsmFile(AsmFile&& other) : m_filename(std::move(other.m_filename))
+AsmFile::AsmFile(AsmFile&& other) : m_file(std::move(other.m_file)), m_filename(std::move(other.m_filename)),
+    m_markerFilename(std::move(other.m_markerFilename))
 {
     m_buffer = other.m_buffer;
     m_doEnum = other.m_doEnum;
@@ -49,15 +72,15 @@ AsmFile::AsmFile(AsmFile&& other) : m_filename(std::move(other.m_filename))
     m_size = other.m_size;
     m_lineNum = other.m_lineNum;
     m_lineStart = other.m_lineStart;
+    m_markerScanPos = other.m_markerScanPos;
+    m_markerPos = other.m_markerPos;
+    m_markerLinebreaks = other.m_markerLinebreaks;
+    m_markerParsedPos = other.m_markerParsedPos;
+    m_markerLine = other.m_markerLine;
 
     other.m_buffer = nullptr;
 }
 
-AsmFile::~AsmFile()
-{
-    if (m_size > 0) delete[] m_buffer;
-}
-
 // Removes comments to simplify further processing.
 // It stops upon encountering a null character,
 // which may or may not be the end of file marker.
@@ -491,7 +514,8 @@ void AsmFile::OutputLine()
         if (m_pos >= m_size)
         {
             RaiseWarning("file doesn't end with newline");
-            puts(&m_buffer[m_lineStart]);
+            g_output.Write(&m_buffer[m_lineStart], m_pos - m_lineStart);
+            g_output.Char('\n');
         }
         else
         {
@@ -500,10 +524,8 @@ void AsmFile::OutputLine()
     }
     else
     {
-        m_buffer[m_pos] = 0;
-        puts(&m_buffer[m_lineStart]);
-        m_buffer[m_pos] = '\n';
         m_pos++;
+        g_output.Write(&m_buffer[m_lineStart], m_pos - m_lineStart);
         m_lineStart = m_pos;
         m_lineNum++;
     }
@@ -538,7 +560,7 @@ bool AsmFile::ParseEnum()
         std::string currentIdentName = ReadIdentifier();
         if (!currentIdentName.empty())
         {
-            std::printf("# %ld \"%s\"\n", currentHeaderLine, headerFilename.c_str());
+            OutputLineMarker(currentHeaderLine, headerFilename);
             currentHeaderLine += SkipWhitespaceAndEol();
             if (m_buffer[m_pos] == '=')
             {
@@ -564,7 +586,13 @@ bool AsmFile::ParseEnum()
                 }
                 enumCounter = 0;
             }
-            std::printf(".equiv %s, (%s) + %ld\n", currentIdentName.c_str(), enumBase.c_str(), enumCounter);
+            g_output.Write(".equiv ");
+            g_output.Write(currentIdentName);
+            g_output.Write(", (");
+            g_output.Write(enumBase);
+            g_output.Write(") + ");
+            g_output.Decimal(enumCounter);
+            g_output.Char('\n');
             enumCounter++;
             symbolCount++;
         }
@@ -630,7 +658,7 @@ bool AsmFile::IsAtEnd()
 // Output the current location to set gas's logical file and line numbers.
 void AsmFile::OutputLocation()
 {
-    std::printf("# %ld \"%s\"\n", m_lineNum, m_filename.c_str());
+    OutputLineMarker(m_lineNum, m_filename);
 }
 
 // Reports a diagnostic message.
@@ -680,25 +708,51 @@ int AsmFile::SkipWhitespaceAndEol()
 // returns the last line indicator and its corresponding file name without modifying the token index
 int AsmFile::FindLastLineNumber(std::string& filename)
 {
-    long pos = m_pos;
-    long linebreaks = 0;
-    while (m_buffer[pos] != '#' && pos >= 0)
+    // The enums of a header all look back to the same indicator, so only the
+    // text since the previous call is scanned, and the indicator itself is
+    // parsed once.
+    if (m_pos < m_markerScanPos)
+    {
+        m_markerScanPos = 0;
+        m_markerPos = -1;
+        m_markerLinebreaks = 0;
+    }
+
+    for (; m_markerScanPos <= m_pos; m_markerScanPos++)
     {
-        if (m_buffer[pos] == '\n')
-            linebreaks++;
-        pos--;
+        if (m_buffer[m_markerScanPos] == '#')
+        {
+            m_markerPos = m_markerScanPos;
+            m_markerLinebreaks = 0;
+        }
+        else if (m_buffer[m_markerScanPos] == '\n')
+        {
+            m_markerLinebreaks++;
+        }
     }
 
-    if (pos < 0)
+    if (m_markerPos < 0)
         RaiseError("line indicator for header file not found before `enum`");
-    
-    pos++;
+
+    if (m_markerPos != m_markerParsedPos)
+    {
+        ParseLineIndicator(m_markerPos + 1);
+        m_markerParsedPos = m_markerPos;
+    }
+
+    filename += m_markerFilename;
+    return m_markerLine + m_markerLinebreaks - 1;
+}
+
+// Reads the line number and file name of the line indicator at pos.
+void AsmFile::ParseLineIndicator(long pos)
+{
     while (m_buffer[pos] == ' ' || m_buffer[pos] == '\t')
         pos++;
 
     if (!IsAsciiDigit(m_buffer[pos]))
         RaiseError("malformatted line indicator found before `enum`, expected line number");
-    
+
     unsigned n = 0;
     int digit = 0;
     while ((digit = ConvertDigit(m_buffer[pos++], 10)) != -1)
@@ -710,6 +764,8 @@ int AsmFile::FindLastLineNumber(std::string& filename)
     if (m_buffer[pos++] != '"')
         RaiseError("malformatted line indicator found before `enum`, expected filename");
 
+    m_markerFilename.clear();
+
     while (m_buffer[pos] != '"')
     {
         unsigned char c = m_buffer[pos++];
@@ -731,10 +787,10 @@ int AsmFile::FindLastLineNumber(std::string& filename)
             RaiseError("unexpected escape '\\%c' in line indicator", c);
         }
 
-        filename += c;
+        m_markerFilename += c;
     }
-    
-    return n + linebreaks - 1;
+
+    m_markerLine = n;
 }
 
 std::string AsmFile::ReadIdentifier()
@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <string>
 #include "preproc.h"
+#include "io.h"
 
 enum class Directive
 {
@@ -41,7 +42,6 @@ public:
     AsmFile(std::string filename, bool isStdin, bool doEnum);
     AsmFile(AsmFile&& other);
     AsmFile(const AsmFile&) = delete;
-    ~AsmFile();
     Directive GetDirective();
     std::string GetGlobalLabel();
     std::string ReadPath();
@@ -53,6 +53,7 @@ public:
     bool ParseEnum();
 
 private:
+    InputFile m_file;
     char* m_buffer;
     bool m_doEnum;
     long m_pos;
@@ -61,6 +62,15 @@ private:
     long m_lineStart;
     std::string m_filename;
 
+    // Where the last line indicator before an enum was found. The buffer is
+    // scanned forward once, rather than backward from every enum.
+    long m_markerScanPos;
+    long m_markerPos;
+    long m_markerLinebreaks;
+    long m_markerParsedPos;
+    unsigned m_markerLine;
+    std::string m_markerFilename;
+
     bool ConsumeComma();
     int ReadPadLength();
     void RemoveComments();
@@ -73,6 +83,7 @@ private:
     void VerifyStringLength(int length);
     int SkipWhitespaceAndEol();
     int FindLastLineNumber(std::string& filename);
+    void ParseLineIndicator(long pos);
     std::string ReadIdentifier();
     long ReadInteger(std::string filename, long line);
 };
@@ -0,0 +1,119 @@
+// Preprocesses many sources in one preproc process.
+//
+// A manifest has one job per line:
+//
+//     [-e] SRC_FILE OUTPUT_FILE
+//
+// where -e enables enum handling as on the command line. Blank lines and lines
+// starting with '#' are ignored. The charmap is loaded once and shared by all
+// jobs, which are spread over a pool of threads. Each worker collects a file's
+// output in memory and only rewrites OUTPUT_FILE if it changed, so running the
+// batch again doesn't make everything downstream of it out of date.
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "preproc.h"
+#include "batch_preproc.h"
+#include "io.h"
+#include "output.h"
+
+struct PreprocJob
+{
+    std::string sourcePath;
+    std::string outputPath;
+    bool doEnum;
+};
+
+static std::vector<PreprocJob> ParseManifest(const std::string& manifestPath)
+{
+    std::ifstream input(manifestPath);
+    std::vector<PreprocJob> jobs;
+    std::string line;
+
+    if (!input.is_open())
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", manifestPath.c_str());
+
+    while (std::getline(input, line))
+    {
+        std::istringstream stream(line);
+        std::vector<std::string> args;
+        std::string arg;
+
+        while (stream >> arg)
+            args.push_back(arg);
+
+        if (args.empty() || args[0][0] == '#')
+            continue;
+
+        PreprocJob job;
+        std::size_t i = 0;
+
+        job.doEnum = (args[0] == "-e");
+        if (job.doEnum)
+            i++;
+
+        if (args.size() - i != 2)
+            FATAL_ERROR("Preproc manifest line \"%s\" needs a source and an output path.\n", line.c_str());
+
+        job.sourcePath = args[i];
+        job.outputPath = args[i + 1];
+        jobs.push_back(job);
+    }
+
+    return jobs;
+}
+
+static void WriteIfChanged(const std::string& path, const std::string& text)
+{
+    {
+        InputFile existing;
+
+        if (existing.Load(path.c_str(), false)
+         && static_cast<std::size_t>(existing.Size()) == text.size()
+         && std::memcmp(existing.Data(), text.data(), text.size()) == 0)
+            return;
+    }
+
+    if (!WriteFileAtomically(path, { { text.data(), text.size() } }))
+        FATAL_ERROR("Failed to write \"%s\".\n", path.c_str());
+}
+
+void RunBatchPreproc(const std::string& manifestPath, int numThreads)
+{
+    std::vector<PreprocJob> jobs = ParseManifest(manifestPath);
+    std::atomic<std::size_t> nextJob(0);
+
+    auto worker = [&]()
+    {
+        std::size_t i;
+        std::string output;
+
+        while ((i = nextJob++) < jobs.size())
+        {
+            output.clear();
+            g_output.SetSink(&output);
+            PreprocFile(jobs[i].sourcePath.c_str(), false, jobs[i].doEnum);
+            g_output.SetSink(nullptr);
+            WriteIfChanged(jobs[i].outputPath, output);
+        }
+    };
+
+    if (numThreads <= 0)
+        numThreads = std::thread::hardware_concurrency();
+    if (numThreads <= 0)
+        numThreads = 1;
+
+    std::vector<std::thread> threads;
+
+    for (int i = 1; i < numThreads; i++)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
@@ -0,0 +1,9 @@
+#ifndef BATCH_PREPROC_H
+#define BATCH_PREPROC_H
+
+#include <string>
+
+// Runs every job in the manifest. numThreads <= 0 uses one thread per core.
+void RunBatchPreproc(const std::string& manifestPath, int numThreads);
+
+#endif // BATCH_PREPROC_H
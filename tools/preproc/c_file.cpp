@@ -31,6 +31,8 @@
 #include "utf8.h"
 #include "string_parser.h"
 #include "io.h"
+#include "output.h"
+#include "incbin_cache.h"
 
 CFile::CFile(const char * filenameCStr, bool isStdin)
 {
@@ -39,14 +41,18 @@ CFile::CFile(const char * filenameCStr, bool isStdin)
     else
         m_filename = std::string(filenameCStr);
 
-    m_buffer = ReadFileToBuffer(filenameCStr, isStdin, &m_size);
+    if (!m_file.Load(filenameCStr, isStdin))
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", filenameCStr);
+
+    m_buffer = m_file.Data();
+    m_size = m_file.Size();
 
     m_pos = 0;
     m_lineNum = 1;
     m_isStdin = isStdin;
 }
 
-CFile::CFile(CFile&& other) : m_filename(std::move(other.m_filename))
+CFile::CFile(CFile&& other) : m_file(std::move(other.m_file)), m_filename(std::move(other.m_filename))
 {
     m_buffer = other.m_buffer;
     m_pos = other.m_pos;
@@ -57,11 +63,6 @@ CFile::CFile(CFile&& other) : m_filename(std::move(other.m_filename))
     other.m_buffer = NULL;
 }
 
-CFile::~CFile()
-{
-    free(m_buffer);
-}
-
 void CFile::Preproc()
 {
     char stringChar = 0;
@@ -72,21 +73,21 @@ void CFile::Preproc()
         {
             if (m_buffer[m_pos] == stringChar)
             {
-                std::putchar(stringChar);
+                g_output.Char(stringChar);
                 m_pos++;
                 stringChar = 0;
             }
             else if (m_buffer[m_pos] == '\\' && m_buffer[m_pos + 1] == stringChar)
             {
-                std::putchar('\\');
-                std::putchar(stringChar);
+                g_output.Char('\\');
+                g_output.Char(stringChar);
                 m_pos += 2;
             }
             else
             {
                 if (m_buffer[m_pos] == '\n')
                     m_lineNum++;
-                std::putchar(m_buffer[m_pos]);
+                g_output.Char(m_buffer[m_pos]);
                 m_pos++;
             }
         }
@@ -100,7 +101,7 @@ void CFile::Preproc()
 
             char c = m_buffer[m_pos++];
 
-            std::putchar(c);
+            g_output.Char(c);
 
             if (c == '\n')
                 m_lineNum++;
@@ -129,7 +130,7 @@ bool CFile::ConsumeNewline()
     {
         m_pos += 2;
         m_lineNum++;
-        std::putchar('\n');
+        g_output.Char('\n');
         return true;
     }
 
@@ -137,7 +138,7 @@ bool CFile::ConsumeNewline()
     {
         m_pos++;
         m_lineNum++;
-        std::putchar('\n');
+        g_output.Char('\n');
         return true;
     }
 
@@ -180,7 +181,7 @@ void CFile::TryConvertString()
 
     SkipWhitespace();
 
-    std::printf("{ ");
+    g_output.Write("{ ");
 
     while (1)
     {
@@ -202,7 +203,10 @@ void CFile::TryConvertString()
             }
 
             for (int i = 0; i < length; i++)
-                printf("0x%02X, ", s[i]);
+            {
+                g_output.HexByte(s[i]);
+                g_output.Write(", ");
+            }
         }
         else if (m_buffer[m_pos] == ')')
         {
@@ -221,9 +225,9 @@ void CFile::TryConvertString()
     }
 
     if (noTerminator)
-        std::printf(" }");
+        g_output.Write(" }");
     else
-        std::printf("0xFF }");
+        g_output.Write("0xFF }");
 }
 
 bool CFile::CheckIdentifier(const std::string& ident)
@@ -237,48 +241,6 @@ bool CFile::CheckIdentifier(const std::string& ident)
     return (i == ident.length());
 }
 
-std::unique_ptr<unsigned char[]> CFile::ReadWholeFile(const std::string& path, int& size)
-{
-    FILE* fp = std::fopen(path.c_str(), "rb");
-
-    if (fp == nullptr)
-        RaiseError("Failed to open \"%s\" for reading.\n", path.c_str());
-
-    std::fseek(fp, 0, SEEK_END);
-
-    size = std::ftell(fp);
-
-    std::unique_ptr<unsigned char[]> buffer = std::unique_ptr<unsigned char[]>(new unsigned char[size]);
-
-    std::rewind(fp);
-
-    if (std::fread(buffer.get(), size, 1, fp) != 1)
-        RaiseError("Failed to read \"%s\".\n", path.c_str());
-
-    std::fclose(fp);
-
-    return buffer;
-}
-
-int ExtractData(const std::unique_ptr<unsigned char[]>& buffer, int offset, int size)
-{
-    switch (size)
-    {
-    case 1:
-        return buffer[offset];
-    case 2:
-        return (buffer[offset + 1] << 8)
-            | buffer[offset];
-    case 4:
-        return (buffer[offset + 3] << 24)
-            | (buffer[offset + 2] << 16)
-            | (buffer[offset + 1] << 8)
-            | buffer[offset];
-    default:
-        FATAL_ERROR("Invalid size passed to ExtractData.\n");
-    }
-}
-
 void CFile::TryConvertIncbin()
 {
     std::string idents[6] = { "INCBIN_S8", "INCBIN_U8", "INCBIN_S16", "INCBIN_U16", "INCBIN_S32", "INCBIN_U32" };
@@ -315,7 +277,7 @@ void CFile::TryConvertIncbin()
 
     m_pos++;
 
-    std::printf("{");
+    g_output.Char('{');
 
     while (true)
     {
@@ -351,24 +313,36 @@ void CFile::TryConvertIncbin()
 
         m_pos++;
 
-        int fileSize;
-        std::unique_ptr<unsigned char[]> buffer = ReadWholeFile(path, fileSize);
+        InputFile file;
+
+        if (!file.Load(path.c_str(), false))
+            RaiseError("Failed to open \"%s\" for reading.\n", path.c_str());
+
+        int fileSize = file.Size();
+        const unsigned char *buffer = reinterpret_cast<unsigned char *>(file.Data());
 
         if ((fileSize % size) != 0)
             RaiseError("Size %d doesn't evenly divide file size %d.\n", size, fileSize);
 
-        int count = fileSize / size;
-        int offset = 0;
-
-        for (int i = 0; i < count; i++)
+        if (g_incbinCache != nullptr)
         {
-            int data = ExtractData(buffer, offset, size);
-            offset += size;
+            std::string key = IncbinCache::Key(buffer, fileSize, size, isSigned);
+            InputFile cached;
 
-            if (isSigned)
-                std::printf("%d,", data);
+            if (g_incbinCache->Find(key, cached))
+            {
+                g_output.Write(cached.Data(), cached.Size());
+            }
             else
-                std::printf("%uu,", data);
+            {
+                std::string text = FormatIncbin(buffer, fileSize, size, isSigned);
+                g_incbinCache->Store(key, text);
+                g_output.Write(text);
+            }
+        }
+        else
+        {
+            g_output.Write(FormatIncbin(buffer, fileSize, size, isSigned));
         }
 
         SkipWhitespace();
@@ -384,7 +358,7 @@ void CFile::TryConvertIncbin()
 
     m_pos++;
 
-    std::printf("}");
+    g_output.Char('}');
 }
 
 // Reports a diagnostic message.
@@ -26,6 +26,7 @@
 #include <string>
 #include <memory>
 #include "preproc.h"
+#include "io.h"
 
 class CFile
 {
@@ -33,10 +34,10 @@ public:
     CFile(const char * filenameCStr, bool isStdin);
     CFile(CFile&& other);
     CFile(const CFile&) = delete;
-    ~CFile();
     void Preproc();
 
 private:
+    InputFile m_file;
     char* m_buffer;
     long m_pos;
     long m_size;
@@ -48,7 +49,6 @@ private:
     bool ConsumeNewline();
     void SkipWhitespace();
     void TryConvertString();
-    std::unique_ptr<unsigned char[]> ReadWholeFile(const std::string& path, int& size);
     bool CheckIdentifier(const std::string& ident);
     void TryConvertIncbin();
     void ReportDiagnostic(const char* type, const char* format, std::va_list args);
@@ -21,10 +21,13 @@
 #include <cstdio>
 #include <cstdint>
 #include <cstdarg>
+#include <cstring>
+#include <map>
 #include "preproc.h"
 #include "charmap.h"
 #include "char_util.h"
 #include "utf8.h"
+#include "io.h"
 
 enum LhsType
 {
@@ -46,7 +49,6 @@ class CharmapReader
 public:
     CharmapReader(std::string filename);
     CharmapReader(const CharmapReader&) = delete;
-    ~CharmapReader();
     Lhs ReadLhs();
     void ExpectEqualsSign();
     std::string ReadSequence();
@@ -54,6 +56,7 @@ public:
     void RaiseError(const char* format, ...);
 
 private:
+    InputFile m_file;
     char* m_buffer;
     long m_pos;
     long m_size;
@@ -67,28 +70,11 @@ private:
 
 CharmapReader::CharmapReader(std::string filename) : m_filename(filename)
 {
-    FILE *fp = std::fopen(filename.c_str(), "rb");
-
-    if (fp == NULL)
+    if (!m_file.Load(filename.c_str(), false))
         FATAL_ERROR("Failed to open \"%s\" for reading.\n", filename.c_str());
 
-    std::fseek(fp, 0, SEEK_END);
-
-    m_size = std::ftell(fp);
-
-    if (m_size < 0)
-        FATAL_ERROR("File size of \"%s\" is less than zero.\n", filename.c_str());
-
-    m_buffer = new char[m_size + 1];
-
-    std::rewind(fp);
-
-    if (std::fread(m_buffer, m_size, 1, fp) != 1)
-        FATAL_ERROR("Failed to read \"%s\".\n", filename.c_str());
-
-    m_buffer[m_size] = 0;
-
-    std::fclose(fp);
+    m_buffer = m_file.Data();
+    m_size = m_file.Size();
 
     m_pos = 0;
     m_lineNum = 1;
@@ -96,11 +82,6 @@ CharmapReader::CharmapReader(std::string filename) : m_filename(filename)
     RemoveComments();
 }
 
-CharmapReader::~CharmapReader()
-{
-    delete[] m_buffer;
-}
-
 Lhs CharmapReader::ReadLhs()
 {
     Lhs lhs;
@@ -369,16 +350,86 @@ void CharmapReader::SkipWhitespace()
         m_pos++;
 }
 
-Charmap::Charmap(std::string filename)
+// Identifies the cache format and the layout of the tables.
+static const char kCacheMagic[8] = { 'C', 'H', 'R', 'M', 'A', 'P', '0', '1' };
+
+struct CacheHeader
+{
+    char magic[8];
+    std::uint64_t sourceHash;
+    std::uint64_t sourceSize;
+    std::uint32_t trieSize;
+    std::uint32_t constantsSize;
+    std::uint32_t poolSize;
+    std::uint32_t pad;
+};
+
+static int EncodeUtf8(std::int32_t code, unsigned char* s)
+{
+    if (code < 0x80)
+    {
+        s[0] = code;
+        return 1;
+    }
+    else if (code < 0x800)
+    {
+        s[0] = 0xC0 | (code >> 6);
+        s[1] = 0x80 | (code & 0x3F);
+        return 2;
+    }
+    else if (code < 0x10000)
+    {
+        s[0] = 0xE0 | (code >> 12);
+        s[1] = 0x80 | ((code >> 6) & 0x3F);
+        s[2] = 0x80 | (code & 0x3F);
+        return 3;
+    }
+    else
+    {
+        s[0] = 0xF0 | (code >> 18);
+        s[1] = 0x80 | ((code >> 12) & 0x3F);
+        s[2] = 0x80 | ((code >> 6) & 0x3F);
+        s[3] = 0x80 | (code & 0x3F);
+        return 4;
+    }
+}
+
+Charmap::Charmap(std::string filename, std::string cachePath)
+{
+    if (cachePath.empty())
+    {
+        Parse(filename);
+        return;
+    }
+
+    InputFile source;
+
+    if (!source.Load(filename.c_str(), false))
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", filename.c_str());
+
+    std::uint64_t sourceHash = HashBytes(source.Data(), source.Size());
+    std::uint64_t sourceSize = source.Size();
+
+    if (LoadCache(cachePath, sourceHash, sourceSize))
+        return;
+
+    Parse(filename);
+    SaveCache(cachePath, sourceHash, sourceSize);
+}
+
+void Charmap::Parse(const std::string& filename)
 {
     CharmapReader reader(filename);
+    std::map<std::int32_t, std::string> chars;
+    std::map<std::string, std::string> constants;
+    std::string escapes[128];
 
     for (;;)
     {
         Lhs lhs = reader.ReadLhs();
 
         if (lhs.type == LhsType::None)
-            return;
+            break;
 
         reader.ExpectEqualsSign();
 
@@ -387,22 +438,243 @@ Charmap::Charmap(std::string filename)
         switch (lhs.type)
         {
         case LhsType::Char:
-            if (m_chars.find(lhs.code) != m_chars.end())
+            if (chars.find(lhs.code) != chars.end())
                 reader.RaiseError("redefining char");
-            m_chars[lhs.code] = sequence;
+            chars[lhs.code] = sequence;
             break;
         case LhsType::Escape:
-            if (m_escapes[lhs.code].length() != 0)
+            if (escapes[lhs.code].length() != 0)
                 reader.RaiseError("redefining escape");
-            m_escapes[lhs.code] = sequence;
+            escapes[lhs.code] = sequence;
             break;
         case LhsType::Constant:
-            if (m_constants.find(lhs.name) != m_constants.end())
+            if (constants.find(lhs.name) != constants.end())
                 reader.RaiseError("redefining constant");
-            m_constants[lhs.name] = sequence;
+            constants[lhs.name] = sequence;
             break;
         }
 
         reader.ExpectEmptyRestOfLine();
     }
+
+    m_trie.assign(256, 0);
+
+    for (auto& pair : chars)
+        AddChar(pair.first, AddToPool(pair.second));
+
+    for (int i = 0; i < 128; i++)
+        m_escapes[i] = escapes[i].empty() ? 0 : AddToPool(escapes[i]);
+
+    std::size_t numSlots = 16;
+
+    while (numSlots < constants.size() * 2)
+        numSlots *= 2;
+
+    m_constants.assign(numSlots, ConstantSlot());
+
+    for (auto& pair : constants)
+        AddConstant(pair.first, AddToPool(pair.second));
+}
+
+std::uint32_t Charmap::AddToPool(const std::string& bytes)
+{
+    std::uint32_t offset = m_pool.size();
+
+    if (offset >= (1u << 26))
+        FATAL_ERROR("Charmap is too large.\n");
+
+    m_pool.insert(m_pool.end(), bytes.begin(), bytes.end());
+    return (offset << 5) | bytes.size();
+}
+
+void Charmap::AddChar(std::int32_t code, std::uint32_t sequence)
+{
+    unsigned char encoding[4];
+    int length = EncodeUtf8(code, encoding);
+    std::uint32_t node = 0;
+
+    for (int i = 0; i < length - 1; i++)
+    {
+        std::uint32_t& entry = m_trie[node * 256 + encoding[i]];
+
+        if (entry == 0)
+        {
+            entry = kTrieChild | (m_trie.size() / 256);
+            m_trie.resize(m_trie.size() + 256, 0);
+        }
+
+        // m_trie may have moved, so the entry is read again.
+        node = m_trie[node * 256 + encoding[i]] & ~kTrieChild;
+    }
+
+    m_trie[node * 256 + encoding[length - 1]] = sequence;
+}
+
+static std::uint32_t HashName(const char* name, std::size_t length)
+{
+    return static_cast<std::uint32_t>(HashBytes(name, length));
+}
+
+void Charmap::AddConstant(const std::string& name, std::uint32_t sequence)
+{
+    std::size_t mask = m_constants.size() - 1;
+    std::size_t slot = HashName(name.data(), name.size()) & mask;
+
+    while (m_constants[slot].sequence != 0)
+        slot = (slot + 1) & mask;
+
+    m_constants[slot].nameOffset = m_pool.size();
+    m_constants[slot].nameLength = name.size();
+    m_constants[slot].sequence = sequence;
+    m_pool.insert(m_pool.end(), name.begin(), name.end());
+}
+
+CharmapSequence Charmap::Char(std::int32_t code) const
+{
+    unsigned char encoding[5] = {};
+    int encodingLength;
+
+    if (code < 0 || code > 0x10FFFF)
+        return Unpack(0);
+
+    EncodeUtf8(code, encoding);
+    return MatchChar(reinterpret_cast<char*>(encoding), encodingLength);
+}
+
+CharmapSequence Charmap::Constant(const char* name, std::size_t length) const
+{
+    std::size_t mask = m_constants.size() - 1;
+    std::size_t slot = HashName(name, length) & mask;
+
+    while (m_constants[slot].sequence != 0)
+    {
+        const ConstantSlot& constant = m_constants[slot];
+
+        if (constant.nameLength == length && std::memcmp(&m_pool[constant.nameOffset], name, length) == 0)
+            return Unpack(constant.sequence);
+
+        slot = (slot + 1) & mask;
+    }
+
+    return Unpack(0);
+}
+
+bool Charmap::LoadCache(const std::string& cachePath, std::uint64_t sourceHash, std::uint64_t sourceSize)
+{
+    InputFile cache;
+    CacheHeader header;
+
+    if (!cache.Load(cachePath.c_str(), false) || static_cast<std::size_t>(cache.Size()) < sizeof(header))
+        return false;
+
+    std::memcpy(&header, cache.Data(), sizeof(header));
+
+    if (std::memcmp(header.magic, kCacheMagic, sizeof(kCacheMagic)) != 0
+     || header.sourceHash != sourceHash || header.sourceSize != sourceSize)
+        return false;
+
+    std::size_t trieBytes = header.trieSize * sizeof(std::uint32_t);
+    std::size_t escapeBytes = sizeof(m_escapes);
+    std::size_t constantBytes = header.constantsSize * sizeof(ConstantSlot);
+    const char* p = cache.Data() + sizeof(header);
+
+    if (static_cast<std::size_t>(cache.Size()) != sizeof(header) + trieBytes + escapeBytes + constantBytes + header.poolSize
+     || header.trieSize < 256 || header.trieSize % 256 != 0
+     || header.constantsSize == 0 || (header.constantsSize & (header.constantsSize - 1)) != 0)
+        return false;
+
+    m_trie.resize(header.trieSize);
+    std::memcpy(m_trie.data(), p, trieBytes);
+    p += trieBytes;
+
+    std::memcpy(m_escapes, p, escapeBytes);
+    p += escapeBytes;
+
+    m_constants.resize(header.constantsSize);
+    std::memcpy(m_constants.data(), p, constantBytes);
+    p += constantBytes;
+
+    m_pool.assign(p, p + header.poolSize);
+
+    if (!TablesAreValid())
+    {
+        m_trie.clear();
+        m_constants.clear();
+        m_pool.clear();
+        return false;
+    }
+
+    return true;
+}
+
+bool Charmap::SequenceIsValid(std::uint32_t entry) const
+{
+    std::size_t offset = entry >> 5;
+
+    return entry == 0 || (offset < m_pool.size() && (entry & 0x1F) <= m_pool.size() - offset);
+}
+
+// Checks that a loaded cache can't send a lookup outside the tables. Child
+// nodes always come after their parent and are only reached on a UTF-8 lead
+// byte from the root or a continuation byte below it, so walking the trie
+// stops at the NUL that ends the string.
+bool Charmap::TablesAreValid() const
+{
+    std::size_t numNodes = m_trie.size() / 256;
+
+    for (std::size_t i = 0; i < m_trie.size(); i++)
+    {
+        std::uint32_t entry = m_trie[i];
+        std::size_t node = i / 256;
+
+        if (!(entry & kTrieChild))
+        {
+            if (!SequenceIsValid(entry))
+                return false;
+        }
+        else if ((entry & ~kTrieChild) <= node || (entry & ~kTrieChild) >= numNodes
+              || (node == 0 ? i < 0xC0 : (i % 256 < 0x80 || i % 256 > 0xBF)))
+        {
+            return false;
+        }
+    }
+
+    for (std::uint32_t entry : m_escapes)
+        if (!SequenceIsValid(entry))
+            return false;
+
+    bool hasEmptySlot = false;
+
+    for (const ConstantSlot& constant : m_constants)
+    {
+        if (constant.sequence == 0)
+            hasEmptySlot = true;
+        else if (!SequenceIsValid(constant.sequence) || constant.nameOffset > m_pool.size()
+              || constant.nameLength > m_pool.size() - constant.nameOffset)
+            return false;
+    }
+
+    // Lookups probe until they reach an empty slot.
+    return hasEmptySlot;
+}
+
+void Charmap::SaveCache(const std::string& cachePath, std::uint64_t sourceHash, std::uint64_t sourceSize) const
+{
+    CacheHeader header = {};
+
+    std::memcpy(header.magic, kCacheMagic, sizeof(kCacheMagic));
+    header.sourceHash = sourceHash;
+    header.sourceSize = sourceSize;
+    header.trieSize = m_trie.size();
+    header.constantsSize = m_constants.size();
+    header.poolSize = m_pool.size();
+
+    // A cache that can't be written is just parsed again next time.
+    WriteFileAtomically(cachePath, {
+        { &header, sizeof(header) },
+        { m_trie.data(), m_trie.size() * sizeof(std::uint32_t) },
+        { m_escapes, sizeof(m_escapes) },
+        { m_constants.data(), m_constants.size() * sizeof(ConstantSlot) },
+        { m_pool.data(), m_pool.size() },
+    });
 }
@@ -21,44 +21,96 @@
 #ifndef CHARMAP_H
 #define CHARMAP_H
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
-#include <map>
 #include <vector>
 
+// The bytes a char, escape or constant maps to. data is null if there is no
+// mapping.
+struct CharmapSequence
+{
+    const unsigned char* data;
+    int length;
+};
+
+// A charmap compiled into flat tables that string parsing can use without
+// building strings.
+//
+// Chars are found by walking a trie over their UTF-8 encodings, one 256-entry
+// node per byte, so a char is looked up straight from the source text without
+// decoding it first. Each entry is 0 (no mapping), a child node index with
+// kTrieChild set, or a sequence packed as offset << 5 | length into the byte
+// pool. Escapes use the same packing in a table indexed by the escape char,
+// and constants live in an open-addressing hash table keyed on the name.
+//
+// The tables are plain arrays, so a compiled charmap can be saved and loaded
+// again instead of parsing the text file on every run.
 class Charmap
 {
 public:
-    Charmap(std::string filename);
+    // Parses the charmap at filename. If cachePath isn't empty, the tables
+    // are loaded from there when the cache was built from the same text, and
+    // saved there otherwise.
+    Charmap(std::string filename, std::string cachePath = std::string());
 
-    std::string Char(std::int32_t code)
+    // Matches the char at the start of s. Returns no mapping if there is
+    // none or s isn't valid UTF-8; encodingLength is set only on a match.
+    CharmapSequence MatchChar(const char* s, int& encodingLength) const
     {
-        auto it = m_chars.find(code);
+        std::uint32_t entry = m_trie[static_cast<unsigned char>(*s)];
+        int length = 1;
 
-        if (it == m_chars.end())
-            return std::string();
+        while (entry & kTrieChild)
+        {
+            entry = m_trie[(entry & ~kTrieChild) * 256 + static_cast<unsigned char>(s[length])];
+            length++;
+        }
 
-        return it->second;
+        encodingLength = length;
+        return Unpack(entry);
     }
 
-    std::string Escape(unsigned char code)
+    CharmapSequence Char(std::int32_t code) const;
+
+    CharmapSequence Escape(unsigned char code) const
     {
-        return m_escapes[code];
+        return Unpack(code < 128 ? m_escapes[code] : 0);
     }
 
-    std::string Constant(std::string identifier)
+    CharmapSequence Constant(const char* name, std::size_t length) const;
+
+private:
+    static const std::uint32_t kTrieChild = 0x80000000;
+
+    struct ConstantSlot
     {
-        auto it = m_constants.find(identifier);
+        std::uint32_t nameOffset;
+        std::uint32_t nameLength;
+        std::uint32_t sequence;
+    };
 
-        if (it == m_constants.end())
-            return std::string();
+    std::vector<std::uint32_t> m_trie;
+    std::uint32_t m_escapes[128];
+    std::vector<ConstantSlot> m_constants;
+    std::vector<unsigned char> m_pool;
 
-        return it->second;
+    CharmapSequence Unpack(std::uint32_t entry) const
+    {
+        CharmapSequence sequence;
+        sequence.data = (entry != 0) ? &m_pool[entry >> 5] : nullptr;
+        sequence.length = entry & 0x1F;
+        return sequence;
     }
-private:
-    std::map<std::int32_t, std::string> m_chars;
-    std::string m_escapes[128];
-    std::map<std::string, std::string> m_constants;
+
+    void Parse(const std::string& filename);
+    std::uint32_t AddToPool(const std::string& bytes);
+    void AddChar(std::int32_t code, std::uint32_t sequence);
+    void AddConstant(const std::string& name, std::uint32_t sequence);
+    bool LoadCache(const std::string& cachePath, std::uint64_t sourceHash, std::uint64_t sourceSize);
+    bool SequenceIsValid(std::uint32_t entry) const;
+    bool TablesAreValid() const;
+    void SaveCache(const std::string& cachePath, std::uint64_t sourceHash, std::uint64_t sourceSize) const;
 };
 
 #endif // CHARMAP_H
@@ -0,0 +1,81 @@
+#include <cstdint>
+#include <cstdio>
+#include "preproc.h"
+#include "incbin_cache.h"
+#include "output.h"
+
+IncbinCache* g_incbinCache;
+
+static int ExtractData(const unsigned char *buffer, long offset, int size)
+{
+    switch (size)
+    {
+    case 1:
+        return buffer[offset];
+    case 2:
+        return (buffer[offset + 1] << 8)
+            | buffer[offset];
+    case 4:
+        return static_cast<int>((static_cast<unsigned int>(buffer[offset + 3]) << 24)
+            | (buffer[offset + 2] << 16)
+            | (buffer[offset + 1] << 8)
+            | buffer[offset]);
+    default:
+        FATAL_ERROR("Invalid size passed to ExtractData.\n");
+    }
+}
+
+std::string FormatIncbin(const unsigned char *data, long size, int elementSize, bool isSigned)
+{
+    std::string text;
+    char number[MAX_DECIMAL_LENGTH + 2];
+
+    text.reserve(size * 4);
+
+    for (long offset = 0; offset + elementSize <= size; offset += elementSize)
+    {
+        int value = ExtractData(data, offset, elementSize);
+        std::size_t length;
+
+        // Elements are read without sign extension below 32 bits, as they
+        // always have been.
+        if (isSigned)
+        {
+            length = FormatDecimal(number, value);
+        }
+        else
+        {
+            length = FormatUnsigned(number, static_cast<unsigned int>(value));
+            number[length++] = 'u';
+        }
+
+        number[length++] = ',';
+        text.append(number, length);
+    }
+
+    return text;
+}
+
+IncbinCache::IncbinCache(std::string dir) : m_dir(dir)
+{
+}
+
+std::string IncbinCache::Key(const unsigned char *data, long size, int elementSize, bool isSigned)
+{
+    std::uint64_t hash = HashBytes(data, size);
+    char key[64];
+    std::snprintf(key, sizeof(key), "v%d-%016llx-%ld-%c%d", INCBIN_CACHE_VERSION,
+        static_cast<unsigned long long>(hash), size, isSigned ? 's' : 'u', elementSize * 8);
+    return key;
+}
+
+bool IncbinCache::Find(const std::string& key, InputFile& text)
+{
+    return text.Load((m_dir + key).c_str(), false);
+}
+
+void IncbinCache::Store(const std::string& key, const std::string& text)
+{
+    // An entry that can't be written is just formatted again next time.
+    WriteFileAtomically(m_dir + key, { { text.data(), text.size() } });
+}
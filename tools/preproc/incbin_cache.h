@@ -0,0 +1,42 @@
+#ifndef INCBIN_CACHE_H_
+#define INCBIN_CACHE_H_
+
+#include <string>
+#include "io.h"
+
+// Part of every cache key. Bump it when a change to FormatIncbin or the number
+// formatting it uses changes the text of some expansion.
+#define INCBIN_CACHE_VERSION 1
+
+// Formats the elements of an INCBIN_* expansion, each followed by a comma.
+std::string FormatIncbin(const unsigned char *data, long size, int elementSize, bool isSigned);
+
+// Formatted INCBIN_* expansions kept across runs, so that recompiling a file
+// like src/graphics.c doesn't format every palette and tile sheet again.
+//
+// Each entry is its own file in the cache directory, named after the format
+// version, the hash and size of the binary and the element type. Entries are
+// written to a temporary file and renamed into place, so preprocs running in
+// parallel can share the directory. A missing or unwritable directory just
+// means nothing is cached. Entries are never removed.
+class IncbinCache
+{
+public:
+    // dir must end with a slash.
+    IncbinCache(std::string dir);
+
+    // Identifies an expansion by the binary's contents and the element type.
+    static std::string Key(const unsigned char *data, long size, int elementSize, bool isSigned);
+
+    // Loads the formatted elements into text. Returns false if there is no
+    // entry yet.
+    bool Find(const std::string& key, InputFile& text);
+    void Store(const std::string& key, const std::string& text);
+
+private:
+    std::string m_dir;
+};
+
+extern IncbinCache* g_incbinCache;
+
+#endif // INCBIN_CACHE_H_
@@ -1,51 +1,193 @@
 #include "preproc.h"
 #include "io.h"
-#include <string>
+#include <atomic>
 #include <cerrno>
+#include <climits>
 #include <cstring>
+#include <sys/stat.h>
 
-char *ReadFileToBuffer(const char *filename, bool isStdin, long *size)
+#ifdef _WIN32
+#define HAVE_MMAP 0
+#include <process.h>
+#define getpid _getpid
+#else
+#define HAVE_MMAP 1
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifndef S_ISREG
+#define S_ISREG(mode) (((mode) & S_IFMT) == S_IFREG)
+#endif
+
+InputFile::InputFile() : m_data(nullptr), m_size(0), m_mappedSize(0)
 {
-    FILE *fp;
-    if (isStdin)
-        fp = stdin;
+}
+
+InputFile::InputFile(InputFile&& other) : m_data(other.m_data), m_size(other.m_size), m_mappedSize(other.m_mappedSize)
+{
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_mappedSize = 0;
+}
+
+InputFile::~InputFile()
+{
+    Release();
+}
+
+void InputFile::Release()
+{
+#if HAVE_MMAP
+    if (m_mappedSize != 0)
+        munmap(m_data, m_mappedSize);
     else
-        fp = std::fopen(filename, "rb");
+#endif
+        std::free(m_data);
+
+    m_data = nullptr;
+    m_size = 0;
+    m_mappedSize = 0;
+}
+
+bool InputFile::Load(const char *filename, bool isStdin)
+{
+    Release();
+
+    if (isStdin)
+        return Read(stdin, 0);
+
+    FILE *fp = std::fopen(filename, "rb");
 
     if (fp == NULL)
-        FATAL_ERROR("Failed to open \"%s\" for reading.\n", filename);
+        return false;
 
-    *size = 0;
-    char *buffer = (char *)malloc(CHUNK_SIZE + 1);
-    if (buffer == NULL) {
-        FATAL_ERROR("Failed to allocate memory to process file \"%s\"!", filename);
+    long long sizeHint = 0;
+    struct stat st;
+
+    if (fstat(fileno(fp), &st) == 0 && S_ISREG(st.st_mode))
+    {
+        sizeHint = st.st_size;
+#if HAVE_MMAP
+        if (Map(fileno(fp), sizeHint))
+        {
+            std::fclose(fp);
+            return true;
+        }
+#endif
     }
 
-    std::size_t numAllocatedBytes = CHUNK_SIZE + 1;
-    std::size_t bufferOffset = 0;
+    bool ok = Read(fp, sizeHint);
+    int savedErrno = errno;
+
+    std::fclose(fp);
+    errno = savedErrno;
+    return ok;
+}
+
+#if HAVE_MMAP
+bool InputFile::Map(int fd, long long size)
+{
+    long pageSize = sysconf(_SC_PAGESIZE);
+
+    if (size <= 0 || size >= LONG_MAX || pageSize <= 0 || size % pageSize == 0)
+        return false;
+
+    void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+    if (data == MAP_FAILED)
+        return false;
+
+    // The rest of the last page reads as zeros, which supplies the NUL.
+    m_data = static_cast<char *>(data);
+    m_size = size;
+    m_mappedSize = size;
+    return true;
+}
+#endif
+
+bool InputFile::Read(std::FILE *fp, long long sizeHint)
+{
+    // One more byte than expected, so a file that doesn't change as it's read
+    // ends with a short read instead of a reallocation.
+    std::size_t capacity = (sizeHint > 0 && sizeHint < LONG_MAX) ? sizeHint + 1 : CHUNK_SIZE;
+    std::size_t size = 0;
     std::size_t count;
+    char *buffer = (char *)std::malloc(capacity + 1);
+
+    if (buffer == NULL)
+        FATAL_ERROR("Failed to allocate memory to read a file!\n");
+
+    while ((count = std::fread(buffer + size, 1, capacity - size, fp)) != 0)
+    {
+        size += count;
+
+        if (size == capacity)
+        {
+            if (capacity >= LONG_MAX / 2)
+                FATAL_ERROR("Input file is too large!\n");
 
-    while ((count = std::fread(buffer + bufferOffset, 1, CHUNK_SIZE, fp)) != 0) {
-        if (!std::ferror(fp)) {
-            *size += count;
-
-            if (std::feof(fp)) {
-                break;
-            }
-
-            numAllocatedBytes += CHUNK_SIZE;
-            bufferOffset += CHUNK_SIZE;
-            buffer = (char *)realloc(buffer, numAllocatedBytes);
-            if (buffer == NULL) {
-                FATAL_ERROR("Failed to allocate memory to process file \"%s\"!", filename);
-            }
-        } else {
-            FATAL_ERROR("Failed to read \"%s\". (error: %s)", filename, std::strerror(errno));
+            capacity *= 2;
+            buffer = (char *)std::realloc(buffer, capacity + 1);
+
+            if (buffer == NULL)
+                FATAL_ERROR("Failed to allocate memory to read a file!\n");
         }
     }
 
-    buffer[*size] = 0;
+    if (std::ferror(fp))
+    {
+        int savedErrno = errno;
+        std::free(buffer);
+        errno = savedErrno;
+        return false;
+    }
 
-    std::fclose(fp);
-    return buffer;
+    buffer[size] = 0;
+    m_data = buffer;
+    m_size = size;
+    return true;
+}
+
+std::uint64_t HashBytes(const void *data, std::size_t size)
+{
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    std::uint64_t hash = 0xCBF29CE484222325;
+
+    for (std::size_t i = 0; i < size; i++)
+        hash = (hash ^ bytes[i]) * 0x100000001B3;
+
+    return hash;
+}
+
+// Numbers temporary files, so batch workers in one process don't collide.
+static std::atomic<unsigned int> s_tempCount(0);
+
+bool WriteFileAtomically(const std::string& path, std::initializer_list<OutputBlock> blocks)
+{
+    std::string tempPath = path + ".tmp" + std::to_string(getpid()) + "-" + std::to_string(s_tempCount++);
+    FILE *fp = std::fopen(tempPath.c_str(), "wb");
+
+    if (fp == NULL)
+        return false;
+
+    bool ok = true;
+
+    for (const OutputBlock& block : blocks)
+        ok = ok && std::fwrite(block.data, 1, block.size, fp) == block.size;
+
+    ok = (std::fclose(fp) == 0) && ok;
+
+#ifdef _WIN32
+    if (ok)
+        std::remove(path.c_str());
+#endif
+
+    if (!ok || std::rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    return true;
 }
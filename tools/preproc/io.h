@@ -1,8 +1,58 @@
 #ifndef IO_H_
 #define IO_H_
 
-#define CHUNK_SIZE 4096
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <string>
 
-char *ReadFileToBuffer(const char *filename, bool isStdin, long *size);
+#define CHUNK_SIZE 65536
+
+// The contents of an input file, followed by a NUL byte.
+//
+// Where it can, the file is mapped copy-on-write instead of being read, so the
+// parsers can still write into the buffer (e.g. to blank out comments) without
+// touching the file. A mapping only has room for the NUL when the file doesn't
+// fill its last page; otherwise, and for stdin and empty files, the contents
+// are read into memory.
+class InputFile
+{
+public:
+    InputFile();
+    InputFile(InputFile&& other);
+    InputFile(const InputFile&) = delete;
+    ~InputFile();
+
+    // Returns false, with errno set, if the file couldn't be opened or read.
+    bool Load(const char *filename, bool isStdin);
+
+    char *Data() { return m_data; }
+    long Size() const { return m_size; }
+
+private:
+    char *m_data;
+    long m_size;
+    std::size_t m_mappedSize;
+
+    bool Map(int fd, long long size);
+    bool Read(std::FILE *fp, long long sizeHint);
+    void Release();
+};
+
+// The 64-bit FNV-1a hash of size bytes at data.
+std::uint64_t HashBytes(const void *data, std::size_t size);
+
+struct OutputBlock
+{
+    const void *data;
+    std::size_t size;
+};
+
+// Writes the blocks to path through a temporary file that's renamed into
+// place, so other processes reading path see either the old contents or the
+// new ones. The temporary file's name is unique to this process and call.
+// Returns false, leaving path as it was, if the file couldn't be written.
+bool WriteFileAtomically(const std::string& path, std::initializer_list<OutputBlock> blocks);
 
 #endif // IO_H_
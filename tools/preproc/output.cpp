@@ -0,0 +1,108 @@
+#include <cstdio>
+#include "output.h"
+
+thread_local OutputBuffer g_output;
+
+static const char s_hexDigits[] = "0123456789ABCDEF";
+
+static const char s_decimalPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+void OutputBuffer::Write(const char *s, std::size_t length)
+{
+    if (length > OUTPUT_BUFFER_SIZE - m_length)
+    {
+        Flush();
+
+        if (length > OUTPUT_BUFFER_SIZE)
+        {
+            if (m_sink != nullptr)
+                m_sink->append(s, length);
+            else
+                std::fwrite(s, 1, length, stdout);
+            return;
+        }
+    }
+
+    std::memcpy(&m_buffer[m_length], s, length);
+    m_length += length;
+}
+
+void OutputBuffer::HexByte(unsigned char value)
+{
+    char *p = Reserve(4);
+
+    p[0] = '0';
+    p[1] = 'x';
+    p[2] = s_hexDigits[value >> 4];
+    p[3] = s_hexDigits[value & 0xF];
+    m_length += 4;
+}
+
+std::size_t FormatUnsigned(char *dest, unsigned long value)
+{
+    // Digits are produced two at a time from the end.
+    char digits[MAX_DECIMAL_LENGTH];
+    char *end = digits + sizeof(digits);
+    char *p = end;
+
+    while (value >= 100)
+    {
+        unsigned int pair = (value % 100) * 2;
+        value /= 100;
+        p -= 2;
+        p[0] = s_decimalPairs[pair];
+        p[1] = s_decimalPairs[pair + 1];
+    }
+
+    if (value >= 10)
+    {
+        p -= 2;
+        p[0] = s_decimalPairs[value * 2];
+        p[1] = s_decimalPairs[value * 2 + 1];
+    }
+    else
+    {
+        *--p = '0' + value;
+    }
+
+    std::memcpy(dest, p, end - p);
+    return end - p;
+}
+
+std::size_t FormatDecimal(char *dest, long value)
+{
+    if (value >= 0)
+        return FormatUnsigned(dest, value);
+
+    dest[0] = '-';
+    return 1 + FormatUnsigned(dest + 1, 0UL - static_cast<unsigned long>(value));
+}
+
+void OutputBuffer::Decimal(long value)
+{
+    m_length += FormatDecimal(Reserve(MAX_DECIMAL_LENGTH), value);
+}
+
+void OutputBuffer::Unsigned(unsigned long value)
+{
+    m_length += FormatUnsigned(Reserve(MAX_DECIMAL_LENGTH), value);
+}
+
+void OutputBuffer::Flush()
+{
+    if (m_sink != nullptr)
+        m_sink->append(m_buffer, m_length);
+    else
+        std::fwrite(m_buffer, 1, m_length, stdout);
+    m_length = 0;
+}
@@ -0,0 +1,71 @@
+#ifndef OUTPUT_H_
+#define OUTPUT_H_
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#define OUTPUT_BUFFER_SIZE 65536
+
+// Longest text FormatDecimal() and FormatUnsigned() write.
+#define MAX_DECIMAL_LENGTH 24
+
+// Write a number as printf("%ld") or printf("%lu") would and return the
+// length. Nothing is NUL-terminated.
+std::size_t FormatDecimal(char *dest, long value);
+std::size_t FormatUnsigned(char *dest, unsigned long value);
+
+// Everything preproc writes to stdout goes through here. Numbers are
+// formatted by hand from lookup tables, since printf's format parsing was
+// most of the time spent on .string-heavy files and large incbins.
+//
+// Each thread has its own buffer, so batch workers can preprocess files side
+// by side. A worker collects a file's output in memory with SetSink().
+class OutputBuffer
+{
+public:
+    OutputBuffer() : m_length(0), m_sink(nullptr) {}
+    ~OutputBuffer() { Flush(); }
+
+    // Flushed output is appended to sink instead of written to stdout, until
+    // SetSink(nullptr). Flushes what was written before.
+    void SetSink(std::string *sink)
+    {
+        Flush();
+        m_sink = sink;
+    }
+
+    void Char(char c)
+    {
+        if (m_length == OUTPUT_BUFFER_SIZE)
+            Flush();
+        m_buffer[m_length++] = c;
+    }
+
+    void Write(const char *s, std::size_t length);
+    void Write(const char *s) { Write(s, std::strlen(s)); }
+    void Write(const std::string& s) { Write(s.data(), s.size()); }
+
+    // "0x" followed by two upper case hex digits, as printf("0x%02X").
+    void HexByte(unsigned char value);
+    void Decimal(long value);
+    void Unsigned(unsigned long value);
+
+    void Flush();
+
+private:
+    char m_buffer[OUTPUT_BUFFER_SIZE];
+    std::size_t m_length;
+    std::string *m_sink;
+
+    char *Reserve(std::size_t length)
+    {
+        if (m_length + length > OUTPUT_BUFFER_SIZE)
+            Flush();
+        return &m_buffer[m_length];
+    }
+};
+
+extern thread_local OutputBuffer g_output;
+
+#endif // OUTPUT_H_
@@ -25,6 +25,9 @@
 #include "asm_file.h"
 #include "c_file.h"
 #include "charmap.h"
+#include "output.h"
+#include "incbin_cache.h"
+#include "batch_preproc.h"
 
 static void UsageAndExit(const char *program);
 
@@ -34,15 +37,15 @@ void PrintAsmBytes(unsigned char *s, int length)
 {
     if (length > 0)
     {
-        std::printf("\t.byte ");
+        g_output.Write("\t.byte ");
         for (int i = 0; i < length; i++)
         {
-            std::printf("0x%02X", s[i]);
+            g_output.HexByte(s[i]);
 
             if (i < length - 1)
-                std::printf(", ");
+                g_output.Write(", ");
         }
-        std::putchar('\n');
+        g_output.Char('\n');
     }
 }
 
@@ -51,7 +54,9 @@ void PreprocAsmFile(std::string filename, bool isStdin, bool doEnum)
     std::stack<AsmFile> stack;
 
     stack.push(AsmFile(filename, isStdin, doEnum));
-    std::printf("# 1 \"%s\"\n", filename.c_str());
+    g_output.Write("# 1 \"");
+    g_output.Write(filename);
+    g_output.Write("\"\n");
 
     for (;;)
     {
@@ -99,8 +104,10 @@ void PreprocAsmFile(std::string filename, bool isStdin, bool doEnum)
 
             if (globalLabel.length() != 0)
             {
-                const char *s = globalLabel.c_str();
-                std::printf("%s: ; .global %s\n", s, s);
+                g_output.Write(globalLabel);
+                g_output.Write(": ; .global ");
+                g_output.Write(globalLabel);
+                g_output.Char('\n');
             }
             else
             {
@@ -140,9 +147,38 @@ const char* GetFileExtension(const char* filename)
     return extension;
 }
 
+void PreprocFile(const char* source, bool isStdin, bool doEnum)
+{
+    const char* extension = GetFileExtension(source);
+
+    if (!extension)
+        FATAL_ERROR("\"%s\" has no file extension.\n", source);
+
+    if ((extension[0] == 's') && extension[1] == 0)
+    {
+        PreprocAsmFile(source, isStdin, doEnum);
+    }
+    else if ((extension[0] == 'c' || extension[0] == 'i') && extension[1] == 0)
+    {
+        if (doEnum)
+            FATAL_ERROR("-e is invalid for C sources\n");
+        PreprocCFile(source, isStdin);
+    }
+    else
+    {
+        FATAL_ERROR("\"%s\" has an unknown file extension of \"%s\".\n", source, extension);
+    }
+}
+
 static void UsageAndExit(const char *program)
 {
-    std::fprintf(stderr, "Usage: %s [-i] [-e] SRC_FILE CHARMAP_FILE\nwhere -i denotes if input is from stdin\n      -e enables enum handling\n", program);
+    std::fprintf(stderr, "Usage: %s [-i] [-e] [-c CACHE_DIR] SRC_FILE CHARMAP_FILE\n"
+                         "       %s -B MANIFEST_PATH [-j THREADS] [-c CACHE_DIR] CHARMAP_FILE\n"
+                         "where -i denotes if input is from stdin\n"
+                         "      -e enables enum handling\n"
+                         "      -c keeps the compiled charmap and formatted INCBIN_* expansions in CACHE_DIR\n"
+                         "      -B preprocesses every \"[-e] SRC_FILE OUTPUT_FILE\" line of MANIFEST_PATH\n"
+                         "      -j sets the number of threads -B uses (default: one per core)\n", program, program);
     std::exit(EXIT_FAILURE);
 }
 
@@ -153,9 +189,13 @@ int main(int argc, char **argv)
     const char *charmap = NULL;
     bool isStdin = false;
     bool doEnum = false;
+    std::string cacheDir;
+    std::string manifest;
+    int numThreads = 0;
 
-    /* preproc [-i] [-e] SRC_FILE CHARMAP_FILE */
-    while ((opt = getopt(argc, argv, "ie")) != -1)
+    /* preproc [-i] [-e] [-c CACHE_DIR] SRC_FILE CHARMAP_FILE
+       preproc -B MANIFEST_PATH [-j THREADS] [-c CACHE_DIR] CHARMAP_FILE */
+    while ((opt = getopt(argc, argv, "iec:B:j:")) != -1)
     {
         switch (opt)
         {
@@ -165,39 +205,60 @@ int main(int argc, char **argv)
         case 'e':
             doEnum = true;
             break;
+        case 'c':
+            cacheDir = optarg;
+            break;
+        case 'B':
+            manifest = optarg;
+            break;
+        case 'j':
+            numThreads = std::atoi(optarg);
+            break;
         default:
             UsageAndExit(argv[0]);
             break;
         }
     }
 
-    if (optind + 2 != argc)
-        UsageAndExit(argv[0]);
-
-    source = argv[optind + 0];
-    charmap = argv[optind + 1];
+    if (!manifest.empty())
+    {
+        if (isStdin || doEnum || optind + 1 != argc)
+            UsageAndExit(argv[0]);
 
-    g_charmap = new Charmap(charmap);
+        charmap = argv[optind];
+    }
+    else
+    {
+        if (optind + 2 != argc)
+            UsageAndExit(argv[0]);
 
-    const char* extension = GetFileExtension(source);
+        source = argv[optind + 0];
+        charmap = argv[optind + 1];
+    }
 
-    if (!extension)
-        FATAL_ERROR("\"%s\" has no file extension.\n", argv[1]);
+    std::string charmapCache;
 
-    if ((extension[0] == 's') && extension[1] == 0)
-    {
-        PreprocAsmFile(source, isStdin, doEnum);
-    }
-    else if ((extension[0] == 'c' || extension[0] == 'i') && extension[1] == 0)
+    if (!cacheDir.empty())
     {
-        if (doEnum)
-            FATAL_ERROR("-e is invalid for C sources\n");
-        PreprocCFile(source, isStdin);
+        if (cacheDir.back() != '/')
+            cacheDir += '/';
+
+        std::string charmapName(charmap);
+        std::size_t slash = charmapName.find_last_of("/\\");
+
+        if (slash != std::string::npos)
+            charmapName = charmapName.substr(slash + 1);
+
+        charmapCache = cacheDir + charmapName + ".bin";
+        g_incbinCache = new IncbinCache(cacheDir);
     }
+
+    g_charmap = new Charmap(charmap, charmapCache);
+
+    if (!manifest.empty())
+        RunBatchPreproc(manifest, numThreads);
     else
-    {
-        FATAL_ERROR("\"%s\" has an unknown file extension of \"%s\".\n", argv[1], extension);
-    }
+        PreprocFile(source, isStdin, doEnum);
 
     return 0;
 }
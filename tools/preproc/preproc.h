@@ -51,4 +51,7 @@ const unsigned long kMaxCharmapSequenceLength = 16;
 
 extern Charmap* g_charmap;
 
+// Preprocesses an assembly or C source to g_output, going by its extension.
+void PreprocFile(const char* source, bool isStdin, bool doEnum);
+
 #endif // PREPROC_H
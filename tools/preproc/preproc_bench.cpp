@@ -0,0 +1,139 @@
+// Times preproc on a set of inputs, reading its output through a pipe as the
+// build does. Reads input paths, one per line, from stdin.
+//
+// Usage: preproc_bench [-e] PREPROC CHARMAP [BASELINE_PREPROC]
+//
+// With a baseline (e.g. a build from before a change), both are timed and
+// their outputs are checked to be identical. -e is passed on to preproc.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Each run is short, so every input is preprocessed several times.
+#define PREPROC_BENCH_ROUNDS 10
+
+struct RunResult
+{
+    bool ok;
+    long long outputSize;
+    std::uint64_t outputHash;
+};
+
+static std::string s_flags;
+
+static RunResult RunPreproc(const std::string& preproc, const std::string& input, const std::string& charmap)
+{
+    std::string command = "\"" + preproc + "\" " + s_flags + "\"" + input + "\" \"" + charmap + "\"";
+    RunResult result = { false, 0, 0xCBF29CE484222325 };
+    FILE *pipe = popen(command.c_str(), "r");
+
+    if (pipe == NULL)
+        return result;
+
+    char buffer[65536];
+    std::size_t count;
+
+    while ((count = std::fread(buffer, 1, sizeof(buffer), pipe)) > 0)
+    {
+        for (std::size_t i = 0; i < count; i++)
+            result.outputHash = (result.outputHash ^ static_cast<unsigned char>(buffer[i])) * 0x100000001B3;
+        result.outputSize += count;
+    }
+
+    result.ok = (pclose(pipe) == 0);
+    return result;
+}
+
+static double TimePreproc(const std::string& preproc, const std::string& input, const std::string& charmap, RunResult& result)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (int round = 0; round < PREPROC_BENCH_ROUNDS; round++)
+        result = RunPreproc(preproc, input, charmap);
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+int main(int argc, char **argv)
+{
+    const char *program = argv[0];
+
+    if (argc > 1 && std::string(argv[1]) == "-e")
+    {
+        s_flags = "-e ";
+        argc--;
+        argv++;
+    }
+
+    if (argc != 3 && argc != 4)
+    {
+        std::fprintf(stderr, "Usage: %s [-e] PREPROC CHARMAP [BASELINE_PREPROC]\n", program);
+        return 1;
+    }
+
+    std::string preproc(argv[1]);
+    std::string charmap(argv[2]);
+    std::string baseline(argc == 4 ? argv[3] : "");
+    std::string input;
+    double totalSeconds = 0;
+    double totalBaselineSeconds = 0;
+    long long totalOutput = 0;
+    int mismatches = 0;
+
+    while (std::getline(std::cin, input))
+    {
+        if (input.empty())
+            continue;
+
+        // The first run also warms the file cache.
+        RunResult result = RunPreproc(preproc, input, charmap);
+
+        if (!result.ok)
+        {
+            std::fprintf(stderr, "Skipping \"%s\": preproc failed.\n", input.c_str());
+            continue;
+        }
+
+        double seconds = TimePreproc(preproc, input, charmap, result);
+        double mbPerSecond = result.outputSize * PREPROC_BENCH_ROUNDS / seconds / 1e6;
+
+        totalSeconds += seconds;
+        totalOutput += result.outputSize;
+
+        if (baseline.empty())
+        {
+            std::printf("%-50s %9lld bytes %8.2f ms %8.1f MB/s\n", input.c_str(), result.outputSize,
+                seconds * 1000 / PREPROC_BENCH_ROUNDS, mbPerSecond);
+            continue;
+        }
+
+        RunResult baselineResult;
+        double baselineSeconds = TimePreproc(baseline, input, charmap, baselineResult);
+
+        totalBaselineSeconds += baselineSeconds;
+
+        if (!baselineResult.ok || baselineResult.outputSize != result.outputSize || baselineResult.outputHash != result.outputHash)
+        {
+            std::fprintf(stderr, "Output of \"%s\" differs from the baseline.\n", input.c_str());
+            mismatches++;
+        }
+
+        std::printf("%-50s %9lld bytes %8.2f ms (baseline %8.2f ms) %5.2fx\n", input.c_str(), result.outputSize,
+            seconds * 1000 / PREPROC_BENCH_ROUNDS, baselineSeconds * 1000 / PREPROC_BENCH_ROUNDS, baselineSeconds / seconds);
+    }
+
+    if (totalSeconds > 0)
+    {
+        std::printf("total: %lld bytes, %.1f MB/s", totalOutput, totalOutput * PREPROC_BENCH_ROUNDS / totalSeconds / 1e6);
+        if (!baseline.empty())
+            std::printf(", %.2fx the baseline", totalBaselineSeconds / totalSeconds);
+        std::printf("\n");
+    }
+
+    return mismatches != 0;
+}
@@ -20,16 +20,27 @@
 
 #include <cstdio>
 #include <cstdarg>
+#include <cstring>
 #include <stdexcept>
 #include "preproc.h"
 #include "string_parser.h"
 #include "char_util.h"
 #include "utf8.h"
 
+// Appends a mapped sequence to the destination string.
+void StringParser::Append(const unsigned char* bytes, int length)
+{
+    if (length > kMaxStringLength - m_destLength)
+        RaiseError("mapped string longer than %d bytes", kMaxStringLength);
+
+    std::memcpy(&m_dest[m_destLength], bytes, length);
+    m_destLength += length;
+}
+
 // Reads a charmap char or escape sequence.
-std::string StringParser::ReadCharOrEscape()
+void StringParser::ReadCharOrEscape()
 {
-    std::string sequence;
+    CharmapSequence sequence;
 
     bool isEscape = (m_buffer[m_pos] == '\\');
 
@@ -41,19 +52,35 @@ std::string StringParser::ReadCharOrEscape()
         {
             sequence = g_charmap->Char('"');
 
-            if (sequence.length() == 0)
+            if (sequence.data == nullptr)
                 RaiseError("no mapping exists for double quote");
 
-            return sequence;
+            Append(sequence.data, sequence.length);
+            return;
         }
         else if (m_buffer[m_pos] == '\\')
         {
             sequence = g_charmap->Char('\\');
 
-            if (sequence.length() == 0)
+            if (sequence.data == nullptr)
                 RaiseError("no mapping exists for backslash");
 
-            return sequence;
+            Append(sequence.data, sequence.length);
+            return;
+        }
+    }
+    else
+    {
+        int encodingLength;
+
+        // Every mapped char is printable, so a match needs no further checks.
+        sequence = g_charmap->MatchChar(&m_buffer[m_pos], encodingLength);
+
+        if (sequence.data != nullptr)
+        {
+            m_pos += encodingLength;
+            Append(sequence.data, sequence.length);
+            return;
         }
     }
 
@@ -82,7 +109,7 @@ std::string StringParser::ReadCharOrEscape()
 
     sequence = isEscape ? g_charmap->Escape(code) : g_charmap->Char(code);
 
-    if (sequence.length() == 0)
+    if (sequence.data == nullptr)
     {
         if (isEscape)
             RaiseError("unknown escape '\\%c'", code);
@@ -90,14 +117,12 @@ std::string StringParser::ReadCharOrEscape()
             RaiseError("unknown character U+%X", code);
     }
 
-    return sequence;
+    Append(sequence.data, sequence.length);
 }
 
 // Reads a charmap constant, i.e. "{FOO}".
-std::string StringParser::ReadBracketedConstants()
+void StringParser::ReadBracketedConstants()
 {
-    std::string totalSequence;
-
     m_pos++; // Assume we're on the left curly bracket.
 
     while (m_buffer[m_pos] != '}')
@@ -113,36 +138,27 @@ std::string StringParser::ReadBracketedConstants()
             while (IsIdentifierChar(m_buffer[m_pos]))
                 m_pos++;
 
-            std::string sequence = g_charmap->Constant(std::string(&m_buffer[startPos], m_pos - startPos));
+            CharmapSequence sequence = g_charmap->Constant(&m_buffer[startPos], m_pos - startPos);
 
-            if (sequence.length() == 0)
+            if (sequence.data == nullptr)
             {
                 m_buffer[m_pos] = 0;
                 RaiseError("unknown constant '%s'", &m_buffer[startPos]);
             }
 
-            totalSequence += sequence;
+            Append(sequence.data, sequence.length);
         }
         else if (IsAsciiDigit(m_buffer[m_pos]))
         {
             Integer integer = ReadInteger();
-
-            switch (integer.size)
-            {
-            case 1:
-                totalSequence += (unsigned char)integer.value;
-                break;
-            case 2:
-                totalSequence += (unsigned char)integer.value;
-                totalSequence += (unsigned char)(integer.value >> 8);
-                break;
-            case 4:
-                totalSequence += (unsigned char)integer.value;
-                totalSequence += (unsigned char)(integer.value >> 8);
-                totalSequence += (unsigned char)(integer.value >> 16);
-                totalSequence += (unsigned char)(integer.value >> 24);
-                break;
-            }
+            unsigned char bytes[4] = {
+                (unsigned char)integer.value,
+                (unsigned char)(integer.value >> 8),
+                (unsigned char)(integer.value >> 16),
+                (unsigned char)(integer.value >> 24),
+            };
+
+            Append(bytes, integer.size);
         }
         else if (m_buffer[m_pos] == 0)
         {
@@ -161,8 +177,6 @@ std::string StringParser::ReadBracketedConstants()
     }
 
     m_pos++; // Go past the right curly bracket.
-
-    return totalSequence;
 }
 
 // Reads a charmap string.
@@ -177,23 +191,20 @@ int StringParser::ParseString(long srcPos, unsigned char* dest, int& destLength)
 
     m_pos++;
 
-    destLength = 0;
+    m_dest = dest;
+    m_destLength = 0;
 
     while (m_buffer[m_pos] != '"')
     {
-        std::string sequence = (m_buffer[m_pos] == '{') ? ReadBracketedConstants() : ReadCharOrEscape();
-
-        for (const char& c : sequence)
-        {
-            if (destLength == kMaxStringLength)
-                RaiseError("mapped string longer than %d bytes", kMaxStringLength);
-
-            dest[destLength++] = c;
-        }
+        if (m_buffer[m_pos] == '{')
+            ReadBracketedConstants();
+        else
+            ReadCharOrEscape();
     }
 
     m_pos++; // Go past the right quote.
 
+    destLength = m_destLength;
     return m_pos - start;
 }
 
@@ -23,6 +23,7 @@
 
 #include <string>
 #include "scaninc.h"
+#include "io.h"
 
 enum class IncDirectiveType
 {
@@ -35,10 +36,10 @@ class AsmFile
 {
 public:
     AsmFile(std::string path);
-    ~AsmFile();
     IncDirectiveType ReadUntilIncDirective(std::string& path);
 
 private:
+    InputFile m_file;
     char *m_buffer;
     int m_pos;
     int m_size;
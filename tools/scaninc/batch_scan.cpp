@@ -0,0 +1,157 @@
+// Writes the dependency files of many sources in one scaninc process.
+//
+// A manifest has one job per line, written like a scaninc command line without
+// the program name:
+//
+//     -M DEPENDENCY_OUT_PATH [-I INCLUDE_PATH]... FILE_PATH
+//
+// An argument may be quoted with double quotes, so -I "" works as it does in a
+// shell. Blank lines and lines starting with '#' are ignored. All jobs share
+// one include graph, so each header is scanned and its includes resolved once
+// per set of -I paths, and the jobs are spread over a pool of threads.
+
+#include <atomic>
+#include <fstream>
+#include <thread>
+#include "batch_scan.h"
+#include "dependency_graph.h"
+
+struct ScanJob
+{
+    std::string depPath;
+    std::vector<std::string> includeDirs;
+    std::string sourcePath;
+};
+
+static std::vector<std::string> SplitArgs(const std::string& line)
+{
+    std::vector<std::string> args;
+    std::size_t pos = 0;
+
+    for (;;)
+    {
+        while (pos < line.size() && (line[pos] == ' ' || line[pos] == '\t' || line[pos] == '\r'))
+            pos++;
+
+        if (pos >= line.size())
+            break;
+
+        std::string arg;
+
+        while (pos < line.size() && line[pos] != ' ' && line[pos] != '\t' && line[pos] != '\r')
+        {
+            if (line[pos] == '"')
+            {
+                std::size_t end = line.find('"', pos + 1);
+
+                if (end == std::string::npos)
+                    FATAL_ERROR("Unterminated quote in scan manifest line \"%s\".\n", line.c_str());
+
+                arg += line.substr(pos + 1, end - pos - 1);
+                pos = end + 1;
+            }
+            else
+            {
+                arg += line[pos++];
+            }
+        }
+
+        args.push_back(arg);
+    }
+
+    return args;
+}
+
+static std::vector<ScanJob> ParseManifest(const std::string& manifestPath)
+{
+    std::ifstream input(manifestPath);
+    std::vector<ScanJob> jobs;
+    std::string line;
+
+    if (!input.is_open())
+        FATAL_ERROR("Failed to open \"%s\" for reading.\n", manifestPath.c_str());
+
+    while (std::getline(input, line))
+    {
+        std::vector<std::string> args = SplitArgs(line);
+
+        if (args.empty() || args[0][0] == '#')
+            continue;
+
+        ScanJob job;
+
+        for (std::size_t i = 0; i < args.size(); i++)
+        {
+            if (args[i] == "-M" && i + 1 < args.size())
+            {
+                job.depPath = args[++i];
+            }
+            else if (args[i].substr(0, 2) == "-I")
+            {
+                std::string includeDir = args[i].substr(2);
+                if (args[i].size() == 2)
+                {
+                    if (i + 1 >= args.size())
+                        FATAL_ERROR("No path following \"-I\" in scan manifest line \"%s\".\n", line.c_str());
+                    includeDir = args[++i];
+                }
+                if (!includeDir.empty() && includeDir.back() != '/')
+                {
+                    includeDir += '/';
+                }
+                job.includeDirs.push_back(includeDir);
+            }
+            else if (i + 1 == args.size())
+            {
+                job.sourcePath = args[i];
+            }
+            else
+            {
+                FATAL_ERROR("Unrecognized argument \"%s\" in scan manifest line \"%s\".\n", args[i].c_str(), line.c_str());
+            }
+        }
+
+        if (job.depPath.empty() || job.sourcePath.empty())
+            FATAL_ERROR("Scan manifest line \"%s\" needs -M and a file path.\n", line.c_str());
+
+        jobs.push_back(job);
+    }
+
+    return jobs;
+}
+
+void RunBatchScan(const std::string& manifestPath, ScanCache& cache, DirectoryIndex& files, int numThreads)
+{
+    std::vector<ScanJob> jobs = ParseManifest(manifestPath);
+    DependencyGraph graph(cache, files);
+    std::atomic<std::size_t> nextJob(0);
+
+    auto worker = [&]()
+    {
+        std::size_t i;
+
+        while ((i = nextJob++) < jobs.size())
+        {
+            std::set<std::string> dependencies;
+            std::set<std::string> includes;
+
+            ScanDependencies(graph, jobs[i].sourcePath, jobs[i].includeDirs, dependencies, includes);
+            WriteDependencyFile(jobs[i].depPath, dependencies, includes);
+        }
+    };
+
+    if (numThreads <= 0)
+        numThreads = std::thread::hardware_concurrency();
+    if (numThreads <= 0)
+        numThreads = 1;
+
+    std::vector<std::thread> threads;
+
+    for (int i = 1; i < numThreads; i++)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
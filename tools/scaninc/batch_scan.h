@@ -0,0 +1,11 @@
+#ifndef BATCH_SCAN_H
+#define BATCH_SCAN_H
+
+#include <string>
+#include "scan_cache.h"
+#include "directory_index.h"
+
+// Runs every job in the manifest. numThreads <= 0 uses one thread per core.
+void RunBatchScan(const std::string& manifestPath, ScanCache& cache, DirectoryIndex& files, int numThreads);
+
+#endif // BATCH_SCAN_H
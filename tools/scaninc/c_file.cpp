@@ -24,39 +24,16 @@ CFile::CFile(std::string path)
 {
     m_path = path;
 
-    FILE *fp = std::fopen(path.c_str(), "rb");
-
-    if (fp == NULL)
+    if (!m_file.Load(path.c_str(), false))
         FATAL_ERROR("Failed to open \"%s\" for reading.\n", path.c_str());
 
-    std::fseek(fp, 0, SEEK_END);
-
-    m_size = std::ftell(fp);
-
-    if (m_size < 0)
-        FATAL_ERROR("File size of \"%s\" is less than zero.\n", path.c_str());
-    else if (m_size == 0)
-        return; // Empty file
-
-    m_buffer = new char[m_size + 1];
-    m_buffer[m_size] = 0;
-
-    std::rewind(fp);
-
-    if (std::fread(m_buffer, m_size, 1, fp) != 1)
-        FATAL_ERROR("Failed to read \"%s\".\n", path.c_str());
-
-    std::fclose(fp);
+    m_buffer = m_file.Data();
+    m_size = m_file.Size();
 
     m_pos = 0;
     m_lineNum = 1;
 }
 
-CFile::~CFile()
-{
-    if (m_size > 0) delete[] m_buffer;
-}
-
 void CFile::FindIncbins()
 {
     char stringChar = 0;
@@ -25,17 +25,18 @@
 #include <set>
 #include <memory>
 #include "scaninc.h"
+#include "io.h"
 
 class CFile
 {
 public:
     CFile(std::string path);
-    ~CFile();
     void FindIncbins();
     const std::set<std::string>& GetIncbins() { return m_incbins; }
     const std::set<std::string>& GetIncludes() { return m_includes; }
 
 private:
+    InputFile m_file;
     char *m_buffer;
     int m_pos;
     int m_size;
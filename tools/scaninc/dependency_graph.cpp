@@ -0,0 +1,114 @@
+#include <fstream>
+#include <queue>
+#include "dependency_graph.h"
+
+DependencyGraph::DependencyGraph(ScanCache& cache, DirectoryIndex& files) : m_cache(cache), m_files(files)
+{
+}
+
+const ResolvedFile& DependencyGraph::Resolve(const std::string& path, const std::vector<std::string>& includeDirs)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& resolvedFiles = m_resolved[includeDirs];
+        auto it = resolvedFiles.find(path);
+
+        if (it != resolvedFiles.end())
+            return it->second;
+    }
+
+    const ScannedFile& file = m_cache.Scan(path);
+    ResolvedFile resolved;
+
+    resolved.incbins.assign(file.incbins.begin(), file.incbins.end());
+
+    for (const std::string& include : file.includes)
+    {
+        bool exists = false;
+        std::string includePath("");
+
+        // The including file's own directory is searched last.
+        for (std::size_t i = 0; i <= includeDirs.size(); i++)
+        {
+            includePath = (i < includeDirs.size() ? includeDirs[i] : file.srcDir) + include;
+            if (m_files.FileExists(includePath))
+            {
+                exists = true;
+                break;
+            }
+        }
+        if (!exists && (file.type == SourceFileType::Asm || file.type == SourceFileType::Inc))
+        {
+            includePath = include;
+            if (m_files.FileExists(includePath))
+                exists = true;
+        }
+        if (exists)
+            resolved.includes.push_back(includePath);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_resolved[includeDirs].insert(std::make_pair(path, std::move(resolved))).first->second;
+}
+
+void ScanDependencies(DependencyGraph& graph, const std::string& initialPath, const std::vector<std::string>& includeDirs,
+    std::set<std::string>& dependencies, std::set<std::string>& includes)
+{
+    std::queue<std::string> filesToProcess;
+
+    filesToProcess.push(initialPath);
+
+    while (!filesToProcess.empty())
+    {
+        const ResolvedFile& file = graph.Resolve(filesToProcess.front(), includeDirs);
+        filesToProcess.pop();
+
+        for (const std::string& incbin : file.incbins)
+        {
+            dependencies.insert(incbin);
+        }
+        for (const std::string& path : file.includes)
+        {
+            includes.insert(path);
+            if (dependencies.insert(path).second)
+            {
+                filesToProcess.push(path);
+            }
+        }
+    }
+}
+
+void WriteDependencyFile(const std::string& depPath, const std::set<std::string>& dependencies, const std::set<std::string>& includes)
+{
+    // Write out make rules to a file
+    std::ofstream output(depPath);
+
+    // Print a make rule for the object file
+    size_t ext_pos = depPath.find_last_of(".");
+    auto object_file = depPath.substr(0, ext_pos + 1) + "o";
+    output << object_file.c_str() << ":";
+    for (const std::string &path : dependencies)
+    {
+        output << " " << path;
+    }
+    output << '\n';
+
+    // Dependency list rule.
+    // Although these rules are identical, they need to be separate, else make will trigger the rule again after the file is created for the first time.
+    output << depPath.c_str() << ":";
+    for (const std::string &path : includes)
+    {
+        output << " " << path;
+    }
+    output << '\n';
+
+    // Dummy rules
+    // If a dependency is deleted, make will try to make it, instead of rescanning the dependencies before trying to do that.
+    for (const std::string &path : dependencies)
+    {
+        output << path << ":\n";
+    }
+
+    output.flush();
+    output.close();
+}
@@ -0,0 +1,43 @@
+#ifndef DEPENDENCY_GRAPH_H
+#define DEPENDENCY_GRAPH_H
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+#include "scan_cache.h"
+#include "directory_index.h"
+
+// A file's direct dependencies with each include resolved to a path.
+struct ResolvedFile
+{
+    std::vector<std::string> includes;
+    std::vector<std::string> incbins;
+};
+
+// The include graph of everything scanned so far. Where an include resolves to
+// depends on the -I paths, so resolved edges are remembered per set of -I
+// paths. Safe to use from several threads.
+class DependencyGraph
+{
+public:
+    DependencyGraph(ScanCache& cache, DirectoryIndex& files);
+    const ResolvedFile& Resolve(const std::string& path, const std::vector<std::string>& includeDirs);
+
+private:
+    ScanCache& m_cache;
+    DirectoryIndex& m_files;
+    std::mutex m_mutex;
+    std::map<std::vector<std::string>, std::map<std::string, ResolvedFile>> m_resolved;
+};
+
+// Finds everything initialPath depends on, directly or not. includes gets the
+// headers and included asm files, dependencies those plus incbins.
+void ScanDependencies(DependencyGraph& graph, const std::string& initialPath, const std::vector<std::string>& includeDirs,
+    std::set<std::string>& dependencies, std::set<std::string>& includes);
+
+// Writes the make rules for an object file to the dependency file at depPath.
+void WriteDependencyFile(const std::string& depPath, const std::set<std::string>& dependencies, const std::set<std::string>& includes);
+
+#endif // DEPENDENCY_GRAPH_H
@@ -0,0 +1,30 @@
+#ifndef DIRECTORY_INDEX_H
+#define DIRECTORY_INDEX_H
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+// Answers "does this file exist?" from a listing of its directory, read the
+// first time the directory is asked about. Most include candidates do not
+// exist, so this replaces one failed open() per candidate with one listing per
+// directory. Safe to use from several threads.
+class DirectoryIndex
+{
+public:
+    DirectoryIndex();
+    bool FileExists(const std::string& path);
+    void PrintStats();
+
+private:
+    std::mutex m_mutex;
+    std::unordered_map<std::string, std::unordered_set<std::string>> m_directories;
+    long m_numChecks;
+    long m_numFound;
+    long m_numListings;
+
+    const std::unordered_set<std::string>& GetDirectory(const std::string& dir);
+};
+
+#endif // DIRECTORY_INDEX_H
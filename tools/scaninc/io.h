@@ -0,0 +1,39 @@
+#ifndef IO_H_
+#define IO_H_
+
+#include <cstddef>
+#include <cstdio>
+
+#define CHUNK_SIZE 65536
+
+// The contents of an input file, followed by a NUL byte.
+//
+// Where it can, the file is mapped instead of being read. A mapping only has
+// room for the NUL when the file doesn't fill its last page; otherwise, and
+// for empty files, the contents are read into memory. This is the same class
+// as preproc's.
+class InputFile
+{
+public:
+    InputFile();
+    InputFile(InputFile&& other);
+    InputFile(const InputFile&) = delete;
+    ~InputFile();
+
+    // Returns false, with errno set, if the file couldn't be opened or read.
+    bool Load(const char *filename, bool isStdin);
+
+    char *Data() { return m_data; }
+    long Size() const { return m_size; }
+
+private:
+    char *m_data;
+    long m_size;
+    std::size_t m_mappedSize;
+
+    bool Map(int fd, long long size);
+    bool Read(std::FILE *fp, long long sizeHint);
+    void Release();
+};
+
+#endif // IO_H_
@@ -0,0 +1,244 @@
+// The cache file is text. After a header line, each entry is
+//
+//     PATH<TAB>MTIME<TAB>SIZE<TAB>HASH<TAB>SCAN_TIME<TAB>TYPE<TAB>NUM_INCLUDES<TAB>NUM_INCBINS
+//
+// followed by one line per include and then one line per incbin.
+//
+// Many scaninc processes may share the file. Each one reads it at startup and,
+// if it scanned anything, merges in entries written since and replaces the file
+// with a rename. An entry lost to a concurrent writer is just scanned again.
+
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <sys/stat.h>
+#include "scan_cache.h"
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+static const char *const CACHE_HEADER = "scaninc cache 1";
+
+static bool ReadContentHash(const std::string& path, long long& size, std::uint64_t& hash)
+{
+    FILE *fp = std::fopen(path.c_str(), "rb");
+
+    if (fp == NULL)
+        return false;
+
+    char buffer[65536];
+    std::size_t count;
+
+    size = 0;
+    hash = 0xCBF29CE484222325;
+
+    while ((count = std::fread(buffer, 1, sizeof(buffer), fp)) > 0)
+    {
+        for (std::size_t i = 0; i < count; i++)
+            hash = (hash ^ static_cast<unsigned char>(buffer[i])) * 0x100000001B3;
+        size += count;
+    }
+
+    std::fclose(fp);
+    return true;
+}
+
+ScanCache::ScanCache(std::string path)
+{
+    m_path = path;
+    m_dirty = false;
+
+    if (!m_path.empty())
+        Load(m_entries);
+}
+
+void ScanCache::Load(std::unordered_map<std::string, Entry>& entries)
+{
+    std::ifstream input(m_path);
+    std::string line;
+
+    if (!std::getline(input, line) || line != CACHE_HEADER)
+        return;
+
+    std::unordered_map<std::string, Entry> loaded;
+
+    while (std::getline(input, line))
+    {
+        char path[SCANINC_MAX_PATH + 1];
+        Entry entry;
+        int type;
+        int numIncludes;
+        int numIncbins;
+        unsigned long long hash;
+
+        if (std::sscanf(line.c_str(), "%255[^\t]\t%lld\t%lld\t%llx\t%lld\t%d\t%d\t%d",
+                path, &entry.mtime, &entry.size, &hash, &entry.scanTime, &type, &numIncludes, &numIncbins) != 8)
+            return; // corrupt; start over
+
+        entry.hash = hash;
+        entry.checked = false;
+        entry.file.type = static_cast<SourceFileType>(type);
+        entry.file.srcDir = GetDir(line.erase(line.find('\t')));
+
+        for (int i = 0; i < numIncludes + numIncbins; i++)
+        {
+            std::string dependency;
+
+            if (!std::getline(input, dependency))
+                return;
+
+            if (i < numIncludes)
+                entry.file.includes.insert(dependency);
+            else
+                entry.file.incbins.insert(dependency);
+        }
+
+        loaded[path] = entry;
+    }
+
+    for (auto& pair : loaded)
+        entries.insert(pair);
+}
+
+const ScannedFile& ScanCache::Scan(const std::string& path)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(path);
+    bool haveEntry = (it != m_entries.end());
+
+    if (haveEntry && it->second.checked)
+        return it->second.file;
+
+    Entry old;
+
+    if (haveEntry)
+    {
+        old.mtime = it->second.mtime;
+        old.size = it->second.size;
+        old.hash = it->second.hash;
+        old.scanTime = it->second.scanTime;
+    }
+
+    // Files are checked and parsed without holding the lock, so two threads
+    // may occasionally do the same file; the first result is kept.
+    lock.unlock();
+
+    struct stat st;
+    bool haveStat = (stat(path.c_str(), &st) == 0);
+    long long size = 0;
+    std::uint64_t hash = 0;
+    bool unchanged = false;
+
+    // A file changed in the same second it was scanned could change again
+    // without its mtime moving, so such entries are always hashed.
+    if (haveStat && haveEntry && old.mtime == st.st_mtime && old.size == st.st_size && old.mtime < old.scanTime)
+    {
+        unchanged = true;
+        size = old.size;
+        hash = old.hash;
+    }
+    else if (haveStat && ReadContentHash(path, size, hash))
+    {
+        unchanged = (haveEntry && old.size == size && old.hash == hash);
+    }
+    else
+    {
+        // Let SourceFile report the missing file.
+        haveStat = false;
+    }
+
+    ScannedFile scanned;
+
+    if (!unchanged)
+    {
+        std::string pathCopy(path);
+        SourceFile source(pathCopy);
+
+        scanned.type = source.FileType();
+        scanned.srcDir = source.GetSrcDir();
+        scanned.includes = source.GetIncludes();
+        scanned.incbins = source.GetIncbins();
+    }
+
+    lock.lock();
+
+    Entry& entry = m_entries[path];
+
+    if (entry.checked)
+        return entry.file;
+
+    if (!unchanged)
+        entry.file = std::move(scanned);
+
+    entry.checked = true;
+
+    if (!haveStat)
+    {
+        // Never trusted on a later run.
+        entry.mtime = -1;
+        entry.size = -1;
+        entry.hash = 0;
+        entry.scanTime = 0;
+    }
+    else if (!unchanged || entry.mtime != st.st_mtime || entry.scanTime <= entry.mtime)
+    {
+        entry.mtime = st.st_mtime;
+        entry.size = size;
+        entry.hash = hash;
+        entry.scanTime = std::time(nullptr);
+        m_dirty = true;
+    }
+
+    return entry.file;
+}
+
+void ScanCache::Save()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_path.empty() || !m_dirty)
+        return;
+
+    Load(m_entries);
+
+    std::string tempPath = m_path + ".tmp" + std::to_string(getpid());
+    FILE *fp = std::fopen(tempPath.c_str(), "wb");
+
+    if (fp == NULL)
+        return; // the cache is only an optimization
+
+    std::fprintf(fp, "%s\n", CACHE_HEADER);
+
+    for (auto& pair : m_entries)
+    {
+        const Entry& entry = pair.second;
+
+        if (entry.size < 0 || pair.first.size() > SCANINC_MAX_PATH)
+            continue;
+
+        std::fprintf(fp, "%s\t%lld\t%lld\t%llx\t%lld\t%d\t%d\t%d\n", pair.first.c_str(), entry.mtime, entry.size,
+            static_cast<unsigned long long>(entry.hash), entry.scanTime, static_cast<int>(entry.file.type),
+            static_cast<int>(entry.file.includes.size()), static_cast<int>(entry.file.incbins.size()));
+
+        for (const std::string& include : entry.file.includes)
+            std::fprintf(fp, "%s\n", include.c_str());
+        for (const std::string& incbin : entry.file.incbins)
+            std::fprintf(fp, "%s\n", incbin.c_str());
+    }
+
+    bool ok = (std::fclose(fp) == 0);
+
+#ifdef _WIN32
+    if (ok)
+        std::remove(m_path.c_str());
+#endif
+
+    if (!ok || std::rename(tempPath.c_str(), m_path.c_str()) != 0)
+        std::remove(tempPath.c_str());
+
+    m_dirty = false;
+}
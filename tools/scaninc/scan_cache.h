@@ -0,0 +1,50 @@
+#ifndef SCAN_CACHE_H
+#define SCAN_CACHE_H
+
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include "source_file.h"
+
+// The direct dependencies of one source file.
+struct ScannedFile
+{
+    SourceFileType type;
+    std::string srcDir;
+    std::set<std::string> includes;
+    std::set<std::string> incbins;
+};
+
+// Remembers the scan of each file across runs. An entry is reused without
+// reading the file when its mtime and size are unchanged, and after hashing
+// the file when only its mtime changed. Constructed with an empty path, it
+// only caches within the current run. Safe to use from several threads.
+class ScanCache
+{
+public:
+    ScanCache(std::string path);
+    const ScannedFile& Scan(const std::string& path);
+    void Save();
+
+private:
+    struct Entry
+    {
+        long long mtime;
+        long long size;
+        std::uint64_t hash;
+        long long scanTime;
+        bool checked;
+        ScannedFile file;
+    };
+
+    std::string m_path;
+    std::unordered_map<std::string, Entry> m_entries;
+    bool m_dirty;
+    std::mutex m_mutex;
+
+    void Load(std::unordered_map<std::string, Entry>& entries);
+};
+
+#endif // SCAN_CACHE_H
@@ -20,32 +20,20 @@
 
 #include <cstdio>
 #include <cstdlib>
-#include <list>
-#include <queue>
 #include <set>
 #include <string>
 #include <iostream>
-#include <tuple>
-#include <fstream>
 #include "scaninc.h"
-#include "source_file.h"
+#include "scan_cache.h"
+#include "dependency_graph.h"
+#include "batch_scan.h"
 
-bool CanOpenFile(std::string path)
-{
-    FILE *fp = std::fopen(path.c_str(), "rb");
-
-    if (fp == NULL)
-        return false;
-
-    std::fclose(fp);
-    return true;
-}
-
-const char *const USAGE = "Usage: scaninc [-I INCLUDE_PATH] [-M DEPENDENCY_OUT_PATH] FILE_PATH\n";
+const char *const USAGE = "Usage: scaninc [-I INCLUDE_PATH] [-M DEPENDENCY_OUT_PATH] [-C CACHE_PATH] [-S] FILE_PATH\n"
+                          "       scaninc -B MANIFEST_PATH [-C CACHE_PATH] [-j THREADS] [-S]\n"
+                          "-S prints how many filesystem calls the directory index saved.\n";
 
 int main(int argc, char **argv)
 {
-    std::queue<std::string> filesToProcess;
     std::set<std::string> dependencies;
     std::set<std::string> dependencies_includes;
 
@@ -53,14 +41,24 @@ int main(int argc, char **argv)
 
     bool makeformat = false;
     std::string make_outfile;
+    std::string cachePath;
+    std::string manifestPath;
+    int numThreads = 0;
+    bool printStats = false;
 
     argc--;
     argv++;
 
-    while (argc > 1)
+    // Only the file path is left when one argument remains, unless that
+    // argument is a trailing -S after -B.
+    while (argc > 1 || (argc == 1 && std::string(argv[0]) == "-S"))
     {
         std::string arg(argv[0]);
-        if (arg.substr(0, 2) == "-I")
+        if (arg == "-S")
+        {
+            printStats = true;
+        }
+        else if (arg.substr(0, 2) == "-I")
         {
             std::string includeDir = arg.substr(2);
             if (includeDir.empty())
@@ -82,6 +80,24 @@ int main(int argc, char **argv)
             argv++;
             make_outfile = std::string(argv[0]);
         }
+        else if (arg == "-C")
+        {
+            argc--;
+            argv++;
+            cachePath = std::string(argv[0]);
+        }
+        else if (arg == "-B")
+        {
+            argc--;
+            argv++;
+            manifestPath = std::string(argv[0]);
+        }
+        else if (arg == "-j")
+        {
+            argc--;
+            argv++;
+            numThreads = std::atoi(argv[0]);
+        }
         else
         {
             FATAL_ERROR(USAGE);
@@ -90,56 +106,33 @@ int main(int argc, char **argv)
         argv++;
     }
 
+    ScanCache cache(cachePath);
+    DirectoryIndex files;
+
+    if (!manifestPath.empty())
+    {
+        if (argc != 0 || makeformat || !includeDirs.empty())
+            FATAL_ERROR(USAGE);
+
+        RunBatchScan(manifestPath, cache, files, numThreads);
+        cache.Save();
+        if (printStats)
+            files.PrintStats();
+        return 0;
+    }
+
     if (argc != 1) {
         FATAL_ERROR(USAGE);
     }
 
     std::string initialPath(argv[0]);
+    DependencyGraph graph(cache, files);
 
-    filesToProcess.push(initialPath);
+    ScanDependencies(graph, initialPath, includeDirs, dependencies, dependencies_includes);
 
-    while (!filesToProcess.empty())
-    {
-        std::string filePath = filesToProcess.front();
-        SourceFile file(filePath);
-        filesToProcess.pop();
-
-        includeDirs.push_back(file.GetSrcDir());
-        for (auto incbin : file.GetIncbins())
-        {
-            dependencies.insert(incbin);
-        }
-        for (auto include : file.GetIncludes())
-        {
-            bool exists = false;
-            std::string path("");
-            for (auto includeDir : includeDirs)
-            {
-                path = includeDir + include;
-                if (CanOpenFile(path))
-                {
-                    exists = true;
-                    break;
-                }
-            }
-            if (!exists && (file.FileType() == SourceFileType::Asm || file.FileType() == SourceFileType::Inc))
-            {
-                path = include;
-                if (CanOpenFile(path))
-                    exists = true;
-            }
-            if (!exists)
-                continue;
-
-            dependencies_includes.insert(path);
-            bool inserted = dependencies.insert(path).second;
-            if (inserted && exists)
-            {
-                filesToProcess.push(path);
-            }
-        }
-        includeDirs.pop_back();
-    }
+    cache.Save();
+    if (printStats)
+        files.PrintStats();
 
     if(!makeformat)
     {
@@ -151,36 +144,6 @@ int main(int argc, char **argv)
     }
     else
     {
-        // Write out make rules to a file
-        std::ofstream output(make_outfile);
-
-        // Print a make rule for the object file
-        size_t ext_pos = make_outfile.find_last_of(".");
-        auto object_file = make_outfile.substr(0, ext_pos + 1) + "o";
-        output << object_file.c_str() << ":";
-        for (const std::string &path : dependencies)
-        {
-            output << " " << path;
-        }
-        output << '\n';
-
-        // Dependency list rule.
-        // Although these rules are identical, they need to be separate, else make will trigger the rule again after the file is created for the first time.
-        output << make_outfile.c_str() << ":";
-        for (const std::string &path : dependencies_includes)
-        {
-            output << " " << path;
-        }
-        output << '\n';
-
-        // Dummy rules
-        // If a dependency is deleted, make will try to make it, instead of rescanning the dependencies before trying to do that.
-        for (const std::string &path : dependencies)
-        {
-            output << path << ":\n";
-        }
-
-        output.flush();
-        output.close();
+        WriteDependencyFile(make_outfile, dependencies, dependencies_includes);
     }
 }